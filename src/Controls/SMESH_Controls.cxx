@@ -2705,9 +2705,8 @@ void CoincidentNodes::SetMesh( const SMDS_Mesh* theMesh )
   if ( myMeshModifTracer.IsMeshModified() )
   {
     TIDSortedNodeSet nodesToCheck;
-    SMDS_NodeIteratorPtr nIt = theMesh->nodesIterator();
-    while ( nIt->more() )
-      nodesToCheck.insert( nodesToCheck.end(), nIt->next() );
+    for ( const SMDS_MeshNode* node : theMesh->nodesRange() )
+      nodesToCheck.insert( nodesToCheck.end(), node );
 
     std::list< std::list< const SMDS_MeshNode*> > nodeGroups;
     SMESH_OctreeNode::FindCoincidentNodes ( nodesToCheck, &nodeGroups, myToler );
@@ -3731,6 +3730,11 @@ SMDSAbs_ElementType Comparator::GetType() const
   return myFunctor ? myFunctor->GetType() : SMDSAbs_All;
 }
 
+Functor::Locality Comparator::GetLocality() const
+{
+  return myFunctor ? myFunctor->GetLocality() : ELEMENT;
+}
+
 double Comparator::GetMargin()
 {
   return myMargin;
@@ -3811,6 +3815,11 @@ SMDSAbs_ElementType LogicalNOT::GetType() const
   return myPredicate ? myPredicate->GetType() : SMDSAbs_All;
 }
 
+Functor::Locality LogicalNOT::GetLocality() const
+{
+  return myPredicate ? myPredicate->GetLocality() : ELEMENT;
+}
+
 
 /*
   Class       : LogicalBinary
@@ -3852,6 +3861,14 @@ SMDSAbs_ElementType LogicalBinary::GetType() const
   return aType1 == aType2 ? aType1 : SMDSAbs_All;
 }
 
+Functor::Locality LogicalBinary::GetLocality() const
+{
+  Locality aLoc1 = myPredicate1 ? myPredicate1->GetLocality() : ELEMENT;
+  Locality aLoc2 = myPredicate2 ? myPredicate2->GetLocality() : ELEMENT;
+
+  return std::max( aLoc1, aLoc2 );
+}
+
 
 /*
   Class       : LogicalAND
@@ -132,6 +132,7 @@ namespace SMESH{
     public:
       NumericalFunctor();
       virtual void SetMesh( const SMDS_Mesh* theMesh );
+      virtual Locality GetLocality() const { return ELEMENT; }
       virtual double GetValue( long theElementId );
       virtual double GetValue(const TSequenceOfXYZ& /*thePoints*/) { return -1.0;};
       void GetHistogram(int                            nbIntervals,
@@ -371,6 +372,7 @@ namespace SMESH{
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return MESH; } // shape IDs are not tracked
     private:
       Handle(ShapeAnalysis_Surface) mySurface;
       int                           myShapeIndex;
@@ -387,6 +389,7 @@ namespace SMESH{
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
     };
     
     /*
@@ -399,6 +402,7 @@ namespace SMESH{
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
       struct Value{
         long myPntId[2];
         Value(long thePntId1, long thePntId2);
@@ -430,6 +434,7 @@ namespace SMESH{
       virtual double GetValue( long theNodeId );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return MESH; }
     };
     
     /*
@@ -480,6 +485,7 @@ namespace SMESH{
       CoincidentElements();
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
+      virtual Locality GetLocality() const { return NEIGHBORS; }
 
     private:
       const SMDS_Mesh* myMesh;
@@ -511,6 +517,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
 
     protected:
       const SMDS_Mesh* myMesh;
@@ -528,6 +535,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return ELEMENT; }
 
     protected:
       const SMDS_Mesh* myMesh;
@@ -545,6 +553,7 @@ namespace SMESH{
       virtual bool         IsSatisfy( long theElementId );
       void                 SetType( SMDSAbs_ElementType theType );
       virtual              SMDSAbs_ElementType GetType() const;
+      virtual Locality     GetLocality() const { return ELEMENT; }
       void                 SetElemEntityType( SMDSAbs_EntityType theEntityType );
       SMDSAbs_EntityType   GetElemEntityType() const;
 
@@ -567,6 +576,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Volume; }
       virtual bool IsSatisfy( long theElementId );
+      virtual Locality GetLocality() const { return NEIGHBORS; }
     protected:
       const SMDS_Mesh* myMesh;
     };
@@ -583,6 +593,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Face; }
       virtual bool IsSatisfy( long theElementId );
+      virtual Locality GetLocality() const { return NEIGHBORS; }
     protected:
       const SMDS_Mesh* myMesh;
       std::vector< const SMDS_MeshNode* > myLinkNodes;
@@ -600,6 +611,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Volume; }
       virtual bool IsSatisfy( long theElementId );
+      virtual Locality GetLocality() const { return NEIGHBORS; }
     protected:
       const SMDS_Mesh* myMesh;
     };
@@ -616,6 +628,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Face; }
       virtual bool IsSatisfy( long theElementId );
+      virtual Locality GetLocality() const { return NEIGHBORS; }
     protected:
       const SMDS_Mesh* myMesh;
     };
@@ -632,6 +645,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
       static bool IsFreeEdge( const SMDS_MeshNode** theNodes, const ::smIdType theFaceId  );
       typedef long TElemId;
       struct Border{
@@ -660,6 +674,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theNodeId );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
 
     protected:
       const SMDS_Mesh* myMesh;
@@ -682,6 +697,7 @@ namespace SMESH{
       virtual void                  SetMesh( const SMDS_Mesh* theMesh );
       virtual bool                  IsSatisfy( long theNodeId );
       virtual SMDSAbs_ElementType   GetType() const;
+      virtual Locality              GetLocality() const { return ELEMENT; }
       virtual void                  SetType( SMDSAbs_ElementType theType );
 
       bool                          AddToRange( long theEntityId );
@@ -714,6 +730,7 @@ namespace SMESH{
       virtual void SetNumFunctor(NumericalFunctorPtr theFunct);
       virtual bool IsSatisfy( long theElementId ) = 0;
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const;
       double  GetMargin();
   
     protected:
@@ -776,6 +793,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual void SetPredicate(PredicatePtr thePred);
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const;
   
     private:
       PredicatePtr myPredicate;
@@ -795,6 +813,7 @@ namespace SMESH{
       virtual void SetPredicate1(PredicatePtr thePred);
       virtual void SetPredicate2(PredicatePtr thePred);
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const;
   
     protected:
       PredicatePtr myPredicate1;
@@ -935,6 +954,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual      SMDSAbs_ElementType GetType() const;
+      virtual      Locality GetLocality() const { return ELEMENT; }
 
       void    SetTolerance( const double theToler );
       double  GetTolerance() const;
@@ -976,6 +996,7 @@ namespace SMESH{
       virtual void SetMesh (const SMDS_Mesh* theMesh);
       virtual bool IsSatisfy (long theElementId);
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return ELEMENT; }
 
       void    SetTolerance (const double theToler);
       double  GetTolerance() const;
@@ -1030,6 +1051,7 @@ namespace SMESH{
 
       virtual void                    SetType( SMDSAbs_ElementType theType );
       virtual                         SMDSAbs_ElementType GetType() const;
+      virtual Locality                GetLocality() const { return MESH; } // shape IDs are not tracked
 
       TopoDS_Shape                    GetShape();
       const SMESHDS_Mesh*             GetMeshDS() const;
@@ -1068,6 +1090,7 @@ namespace SMESH{
       
       virtual void                    SetType( SMDSAbs_ElementType theType );
       virtual                         SMDSAbs_ElementType GetType() const;
+      virtual Locality                GetLocality() const { return MESH; } // shape IDs are not tracked
       
       TopoDS_Shape                    GetShape();
       const SMESHDS_Mesh*             GetMeshDS() const;
@@ -1099,6 +1122,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality GetLocality() const { return NEIGHBORS; }
 
     private:
       const SMDS_Mesh* myMesh;
@@ -1116,6 +1140,7 @@ namespace SMESH{
       virtual bool        IsSatisfy( long theElementId );
       void                SetType( SMDSAbs_ElementType theType );
       virtual SMDSAbs_ElementType GetType() const;
+      virtual Locality    GetLocality() const { return ELEMENT; }
 
     private:
       const SMDS_Mesh*    myMesh;
@@ -1159,6 +1184,7 @@ namespace SMESH{
       virtual bool         IsSatisfy( long theElementId );
       void                 SetType( SMDSAbs_ElementType theType );
       virtual              SMDSAbs_ElementType GetType() const;
+      virtual Locality     GetLocality() const { return ELEMENT; }
       void                 SetGeomType( SMDSAbs_GeometryType theType );
       SMDSAbs_GeometryType GetGeomType() const;
 
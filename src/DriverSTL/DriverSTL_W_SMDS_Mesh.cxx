@@ -95,35 +95,48 @@ void DriverSTL_W_SMDS_Mesh::findVolumeTriangles()
 {
   myNbVolumeTrias = 0;
 
+  // facets of volumes but polyhedra are taken from tables of facet nodes
+  SMDS_VolumeFacetIterator facetIt( myMesh->elementsIterator( SMDSAbs_Volume ),
+                                    /*ignoreCentralNodes=*/false );
+  for ( ; facetIt.more(); facetIt.next() )
+    if ( facetIt.IsFree() )
+      addVolumeFacet( facetIt.FacetNodes(), facetIt.NbFacetNodes(), /*isPoly=*/false );
+
   SMDS_VolumeTool theVolume;
-  SMDS_VolumeIteratorPtr vIt = myMesh->volumesIterator();
-  std::vector< const SMDS_MeshNode*> nodes;
+  SMDS_ElemIteratorPtr vIt = myMesh->elementGeomIterator( SMDSGeom_POLYHEDRA );
   while ( vIt->more() )
   {
     theVolume.Set( vIt->next(), /*ignoreCentralNodes=*/false );
     for ( int iF = 0; iF < theVolume.NbFaces(); ++iF )
       if ( theVolume.IsFreeFace( iF ))
-      {
-        const SMDS_MeshNode** n = theVolume.GetFaceNodes(iF);
-        int                 nbN = theVolume.NbFaceNodes(iF);
-        nodes.assign( n, n+nbN );
-        if ( !myMesh->FindElement( nodes, SMDSAbs_Face, /*noMedium=*/false))
-        {
-          if (( nbN == 9 || nbN == 7 ) &&
-              ( !theVolume.IsPoly() )) // facet is bi-quaratic
-          {
-            int nbTria = nbN - 1;
-            for ( int iT = 0; iT < nbTria; ++iT )
-              myVolumeFacets.push_back( new SMDS_FaceOfNodes( n[8], n[0+iT], n[1+iT] ));
-            myNbVolumeTrias += nbTria;
-          }
-          else
-          {
-            myVolumeFacets.push_back( new SMDS_PolygonalFaceOfNodes( nodes ));
-            myNbVolumeTrias += nbN - 2;
-          }
-        }
-      }
+        addVolumeFacet( theVolume.GetFaceNodes(iF), theVolume.NbFaceNodes(iF), /*isPoly=*/true );
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Creates temporary faces on a free facet of a volume if there is no face on it
+ */
+//================================================================================
+
+void DriverSTL_W_SMDS_Mesh::addVolumeFacet( const SMDS_MeshNode** n, int nbN, bool isPoly )
+{
+  std::vector< const SMDS_MeshNode*> nodes( n, n+nbN );
+  if ( myMesh->FindElement( nodes, SMDSAbs_Face, /*noMedium=*/false))
+    return;
+
+  if (( nbN == 9 || nbN == 7 ) &&
+      ( !isPoly )) // facet is bi-quaratic
+  {
+    int nbTria = nbN - 1;
+    for ( int iT = 0; iT < nbTria; ++iT )
+      myVolumeFacets.push_back( new SMDS_FaceOfNodes( n[8], n[0+iT], n[1+iT] ));
+    myNbVolumeTrias += nbTria;
+  }
+  else
+  {
+    myVolumeFacets.push_back( new SMDS_PolygonalFaceOfNodes( nodes ));
+    myNbVolumeTrias += nbN - 2;
   }
 }
 
@@ -34,6 +34,8 @@
 
 #include <vector>
 
+class SMDS_MeshNode;
+
 /*!
  * \brief Writer of a mesh in STL (STereoLithography) file format.
  */
@@ -52,6 +54,7 @@ class MESHDRIVERSTL_EXPORT DriverSTL_W_SMDS_Mesh: public Driver_SMDS_Mesh
   Status  writeAscii  () const;
   Status  writeBinary () const;
   void    findVolumeTriangles();
+  void    addVolumeFacet( const SMDS_MeshNode** nodes, int nbNodes, bool isPoly );
 
   SMDS_ElemIteratorPtr getFaces() const;
 
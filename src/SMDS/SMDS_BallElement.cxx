@@ -42,6 +42,6 @@ double SMDS_BallElement::GetDiameter() const
 
 void SMDS_BallElement::SetDiameter(double diameter)
 {
+  GetMesh()->setMyModified( this, SMDS_ElementHolder::ELEM_MODIFIED );
   getGrid()->SetBallDiameter( GetVtkID(), diameter );
-  GetMesh()->setMyModified();
 }
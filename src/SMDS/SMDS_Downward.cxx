@@ -92,6 +92,15 @@ SMDS_Downward::~SMDS_Downward()
 {
 }
 
+/*! Return bytes allocated for connectivity storage
+ */
+size_t SMDS_Downward::getMemorySize() const
+{
+  return ( _cellIds.capacity() * sizeof(int) +
+           _vtkCellIds.capacity() * sizeof(int) +
+           _cellTypes.capacity() );
+}
+
 /*! Give or create an entry for downward connectivity structure relative to a cell.
  * If the entry already exists, just return its id, otherwise, create it.
  * The internal storage memory is allocated if needed.
@@ -192,8 +201,6 @@ int SMDS_Downward::getNodeSet(int /*cellId*/, int* /*nodeSet*/)
 SMDS_Down1D::SMDS_Down1D(SMDS_UnstructuredGrid *grid, int nbDownCells) :
   SMDS_Downward(grid, nbDownCells)
 {
-  _upCellIdsVector.clear();
-  _upCellTypesVector.clear();
   _upCellIds.clear();
   _upCellTypes.clear();
   _upCellIndex.clear();
@@ -203,14 +210,12 @@ SMDS_Down1D::~SMDS_Down1D()
 {
 }
 
-/*! clear vectors used to reference 2D cells containing the edge
- *
- * @param cellId
- */
-void SMDS_Down1D::initCell(int cellId)
+size_t SMDS_Down1D::getMemorySize() const
 {
-  _upCellIdsVector[cellId].clear();
-  _upCellTypesVector[cellId].clear();
+  return ( SMDS_Downward::getMemorySize() +
+           _upCellIds.capacity() * sizeof(int) +
+           _upCellTypes.capacity() +
+           _upCellIndex.capacity() * sizeof(int) );
 }
 
 /*! Resize the downward connectivity storage vector if needed.
@@ -223,52 +228,18 @@ void SMDS_Down1D::allocate(int nbElems)
   {
     _vtkCellIds.resize(nbElems + SMDS_Mesh::chunkSize, -1);
     _cellIds.resize(_nbDownCells * (nbElems + SMDS_Mesh::chunkSize), -1);
-    _upCellIdsVector.resize(nbElems + SMDS_Mesh::chunkSize);
-    _upCellTypesVector.resize(nbElems + SMDS_Mesh::chunkSize);
   }
 }
 
+/*! Adjust storage size. The faces sharing edges are stored directly in compacted
+ *  storage (_upCellIds, _upCellTypes, _upCellIndex) by SMDS_UnstructuredGrid.
+ */
 void SMDS_Down1D::compactStorage()
 {
   _cellIds.resize(_nbDownCells * _maxId);
   _vtkCellIds.resize(_maxId);
-
-  smIdType sizeUpCells = 0;
-  for (int i = 0; i < _maxId; i++)
-    sizeUpCells += _upCellIdsVector[i].size();
-  _upCellIds.resize(sizeUpCells, -1);
-  _upCellTypes.resize(sizeUpCells);
-  _upCellIndex.resize(_maxId + 1, -1); // id and types of rank i correspond to [ _upCellIndex[i], _upCellIndex[i+1] [
-  int current = 0;
-  for (int i = 0; i < _maxId; i++)
-  {
-    _upCellIndex[i] = current;
-    for (size_t j = 0; j < _upCellIdsVector[i].size(); j++)
-    {
-      _upCellIds[current] = _upCellIdsVector[i][j];
-      _upCellTypes[current] = _upCellTypesVector[i][j];
-      current++;
-    }
-  }
-  _upCellIndex[_maxId] = current;
-
-  _upCellIdsVector.clear();
-  _upCellTypesVector.clear();
-}
-
-void SMDS_Down1D::addUpCell(int cellId, int upCellId, unsigned char aType)
-{
-  //ASSERT((cellId >=0) && (cellId < _maxId));
-  smIdType nbFaces = _upCellIdsVector[cellId].size();
-  for (smIdType i = 0; i < nbFaces; i++)
-    {
-      if ((_upCellIdsVector[cellId][i] == upCellId) && (_upCellTypesVector[cellId][i] == aType))
-        {
-          return; // already done
-        }
-    }
-  _upCellIdsVector[cellId].push_back(upCellId);
-  _upCellTypesVector[cellId].push_back(aType);
+  if ((int)_upCellIndex.size() < _maxId + 1)
+    _upCellIndex.resize(_maxId + 1, (int)_upCellIds.size());
 }
 
 int SMDS_Down1D::getNumberOfUpCells(int cellId)
@@ -489,6 +460,14 @@ SMDS_Down2D::~SMDS_Down2D()
 {
 }
 
+size_t SMDS_Down2D::getMemorySize() const
+{
+  return ( SMDS_Downward::getMemorySize() +
+           _upCellIds.capacity() * sizeof(int) +
+           _upCellTypes.capacity() +
+           _tempNodes.capacity() * sizeof(int) );
+}
+
 int SMDS_Down2D::getNumberOfUpCells(int cellId)
 {
   int nbup = 0;
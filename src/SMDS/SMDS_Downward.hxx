@@ -87,6 +87,7 @@ public:
   {
     return _maxId;
   }
+  virtual size_t getMemorySize() const; //!< bytes allocated for connectivity storage
   static int getCellDimension(unsigned char cellType);
 protected:
   SMDS_Downward(SMDS_UnstructuredGrid *grid, int nbDownCells);
@@ -118,13 +119,12 @@ public:
   virtual const unsigned char* getUpTypes(int cellId);
   virtual void getNodeIds(int cellId, std::set<int>& nodeSet);
   virtual int getNodes(int cellId, int* nodevec) { return getNodeSet(cellId, nodevec); }
+  virtual size_t getMemorySize() const;
 protected:
   SMDS_Down1D(SMDS_UnstructuredGrid *grid, int nbDownCells);
   ~SMDS_Down1D();
-  virtual void initCell(int cellId);
   virtual void allocate(int nbElems);
   virtual void compactStorage();
-  virtual void addUpCell(int cellId, int upCellId, unsigned char aType); //!< Id's are downward connectivity id's
   virtual int getNodeSet(int cellId, int* nodeSet);
   void setNodes(int cellId, int vtkId);
   void setNodes(int cellId, const int* nodeIds);
@@ -133,11 +133,9 @@ protected:
   int computeFaces(int cellId, int* vtkIds, int nbcells, int* downFaces, unsigned char* downTypes);
   int computeFaces(int* pts, int* vtkIds, int nbcells, int* downFaces, unsigned char* downTypes);
 
-  std::vector<std::vector<int> > _upCellIdsVector; //!< the number of faces sharing an edge is not known
-  std::vector<std::vector<unsigned char> > _upCellTypesVector; //!< the number of faces sharing an edge is not known
-  std::vector<int> _upCellIds; //!< compacted storage after connectivity calculation
-  std::vector<unsigned char> _upCellTypes; //!< compacted storage after connectivity calculation
-  std::vector<int> _upCellIndex; //!< compacted storage after connectivity calculation
+  std::vector<int> _upCellIds; //!< compacted storage filled by SMDS_UnstructuredGrid::BuildDownwardConnectivity()
+  std::vector<unsigned char> _upCellTypes; //!< compacted storage, types of faces
+  std::vector<int> _upCellIndex; //!< faces of edge i are in [ _upCellIndex[i], _upCellIndex[i+1] [
 };
 
 class SMDS_EXPORT SMDS_Down2D: public SMDS_Downward
@@ -149,6 +147,7 @@ public:
   virtual const int* getUpCells(int cellId);
   virtual const unsigned char* getUpTypes(int cellId);
   virtual void getNodeIds(int cellId, std::set<int>& nodeSet);
+  virtual size_t getMemorySize() const;
 protected:
   SMDS_Down2D(SMDS_UnstructuredGrid *grid, int nbDownCells);
   ~SMDS_Down2D();
@@ -187,7 +187,7 @@ SMDS_MeshElement* SMDS_ElementFactory::NewElement( const smIdType id )
 
   e->myHolder = & myChunks[iChunk];
 
-  myMesh->setMyModified();
+  myMesh->setMyModified( e, myIsNodal ? SMDS_ElementHolder::NODE_ADDED : SMDS_ElementHolder::CELL_ADDED );
 
   return e;
 }
@@ -254,6 +254,8 @@ void SMDS_ElementFactory::Free( const SMDS_MeshElement* e )
   if ( e != FindElement( e->GetID() ))
     SALOME_Exception("SMDS_ElementFactory::Free(): element of other mesh");
 
+  myMesh->setMyModified( e, SMDS_ElementHolder::ELEM_REMOVED );
+
   if ( !myVtkIDs.empty() )
   {
     size_t    id = e->GetID() - 1;
@@ -266,8 +268,6 @@ void SMDS_ElementFactory::Free( const SMDS_MeshElement* e )
   e->myHolder->Free( e );
   const_cast< SMDS_MeshElement*>( e )->myHolder = 0;
   --myNbUsedElements;
-
-  myMesh->setMyModified();
 }
 
 //================================================================================
@@ -359,6 +359,34 @@ bool SMDS_ElementFactory::CompactChangePointers()
   return ( NbUsedElements() != GetMaxID() );
 }
 
+//================================================================================
+/*!
+ * \brief Return bytes allocated for elements and their attributes
+ */
+//================================================================================
+
+size_t SMDS_ElementFactory::GetMemorySize() const
+{
+  const size_t elemSize = myIsNodal ? sizeof( SMDS_MeshNode ) : sizeof( SMDS_MeshCell );
+  size_t size = myChunks.size() * ( sizeof( SMDS_ElementChunk ) + theChunkSize * elemSize );
+  for ( size_t i = 0; i < myChunks.size(); ++i )
+    size += myChunks[i].GetMemorySize();
+  size += myChunksWithUnused.size() * 4 * sizeof( void* ); // std::set node
+  return size;
+}
+
+//================================================================================
+/*!
+ * \brief Return bytes allocated for ID maps
+ */
+//================================================================================
+
+size_t SMDS_ElementFactory::GetIDMapsMemorySize() const
+{
+  return ( myVtkIDs.capacity()  * sizeof( vtkIdType ) +
+           mySmdsIDs.capacity() * sizeof( smIdType ));
+}
+
 //================================================================================
 /*!
  * \brief Create a factory of nodes in a given mesh
@@ -471,6 +499,17 @@ bool SMDS_NodeFactory::CompactChangePointers()
   return ( NbUsedElements() != GetMaxID() );
 }
 
+//================================================================================
+/*!
+ * \brief Return bytes allocated for nodes and their attributes
+ */
+//================================================================================
+
+size_t SMDS_NodeFactory::GetMemorySize() const
+{
+  return SMDS_ElementFactory::GetMemorySize() + myShapeDim.capacity();
+}
+
 //================================================================================
 /*!
  * \brief De-allocate all nodes
@@ -875,6 +914,20 @@ void SMDS_ElementChunk::Compact()
   }
 }
 
+//================================================================================
+/*!
+ * \brief Return bytes allocated for attributes of elements, not including elements
+ */
+//================================================================================
+
+size_t SMDS_ElementChunk::GetMemorySize() const
+{
+  return ( myMarkedSet.num_blocks() * sizeof( TBitSet::block_type ) +
+           myUsedRanges.mySet.capacity()  * sizeof( _UsedRange ) +
+           mySubIDRanges.mySet.capacity() * sizeof( _ShapeIDRange ) +
+           myPositions.capacity() * sizeof( TParam ));
+}
+
 //================================================================================
 /*!
  * \brief Print some data for debug purposes
@@ -100,6 +100,9 @@ public:
   //! Return a number of used elements
   smIdType NbUsedElements() const { return myNbUsedElements; }
 
+  //! Return chunks of elements, see SMDS_ElementRange
+  const TChunkVector& GetChunks() const { return myChunks; }
+
   //! Return an iterator on all element filtered using a given filter.
   //  nbElemsToReturn is used to optimize by stopping the iteration as soon as
   //  all elements satisfying filtering condition encountered.
@@ -135,6 +138,12 @@ public:
   //! Return true if Compact() will change IDs of elements
   virtual bool CompactChangePointers();
 
+  //! Return bytes allocated for elements and their attributes
+  virtual size_t GetMemorySize() const;
+
+  //! Return bytes allocated for ID maps
+  size_t GetIDMapsMemorySize() const;
+
   //! Return a number of elements in a chunk
   static int ChunkSize();
 };
@@ -176,6 +185,9 @@ public:
 
   //! Return true if Compact() will change IDs of node
   virtual bool CompactChangePointers();
+
+  //! Return bytes allocated for nodes and their attributes
+  virtual size_t GetMemorySize() const;
 };
 
 //------------------------------------------------------------------------------------
@@ -420,6 +432,9 @@ public:
   const TUsedRangeSet&  GetUsedRangesMinMax( bool& min, bool& max ) const
   { min = false; max = true; return myUsedRanges; }
 
+  //! Return ranges of elements assigned to sub-shapes
+  const TSubIDRangeSet& GetSubIDRanges() const { return mySubIDRanges; }
+
   //! Return ranges of elements assigned to sub-shapes and min/max of sub-shape IDs
   const TSubIDRangeSet& GetSubIDRangesMinMax( int& /*min*/, int& /*max*/ ) const
   { /*min = myMinSubID; max = myMaxSubID;*/ return mySubIDRanges; }
@@ -427,6 +442,9 @@ public:
   //! Minimize allocated memory
   void Compact();
 
+  //! Return bytes allocated for attributes of elements, not including elements
+  size_t GetMemorySize() const;
+
   //! Print some data
   void Dump() const; // debug
 
@@ -29,13 +29,15 @@
 #include "SMDS_CellOfNodes.hxx"
 #include "SMDS_Mesh.hxx"
 
+#include <algorithm>
+
 //=======================================================================
 //function : SMDS_ElementHolder
 //purpose  : register self in the mesh
 //=======================================================================
 
 SMDS_ElementHolder::SMDS_ElementHolder( const SMDS_Mesh* mesh )
-  : myMesh( const_cast< SMDS_Mesh* >( mesh ))
+  : myMesh( const_cast< SMDS_Mesh* >( mesh )), myIsTrackingChanges( false )
 {
   if ( myMesh )
     myPtrInMesh = myMesh->myElemHolders.insert( this ).first;
@@ -48,10 +50,30 @@ SMDS_ElementHolder::SMDS_ElementHolder( const SMDS_Mesh* mesh )
 
 SMDS_ElementHolder::~SMDS_ElementHolder()
 {
+  trackChanges( false );
   if ( myMesh )
     myMesh->myElemHolders.erase( myPtrInMesh );
 }
 
+//=======================================================================
+//function : trackChanges
+//purpose  : start or stop notifying self of changes of elements
+//=======================================================================
+
+void SMDS_ElementHolder::trackChanges( bool toTrack )
+{
+  if ( !myMesh || toTrack == myIsTrackingChanges )
+    return;
+
+  std::vector< SMDS_ElementHolder* >& trackers = myMesh->myChangeTrackers;
+  if ( toTrack )
+    trackers.push_back( this );
+  else
+    trackers.erase( std::find( trackers.begin(), trackers.end(), this ));
+
+  myIsTrackingChanges = toTrack;
+}
+
 //=======================================================================
 //function : beforeCompacting
 //purpose  : store vtkIDs of elements
@@ -42,7 +42,8 @@ class SMDS_MeshElement;
 /*!
  * \brief Base class of object holding SMDS_MeshElement pointers.
  *        Registering such an object in SMDS_Mesh assures that the
- *        pointers remain valid after compacting the mesh
+ *        pointers remain valid after compacting the mesh.
+ *        On demand, the object is also notified of changes of mesh elements
  */
 class SMDS_EXPORT SMDS_ElementHolder
 {
@@ -54,6 +55,13 @@ class SMDS_EXPORT SMDS_ElementHolder
   //! un-register self from the mesh
   virtual ~SMDS_ElementHolder();
 
+  //! change of an element notified to holders tracking changes
+  enum TChange { NODE_ADDED,
+                 CELL_ADDED,    //!< the cell is not initialized yet, only its ID is valid
+                 ELEM_REMOVED,  //!< notified before the removal
+                 ELEM_MODIFIED  //!< node moved or cell nodes changed; notified before the change
+  };
+
 
  protected:
 
@@ -72,6 +80,12 @@ class SMDS_EXPORT SMDS_ElementHolder
   //!< allow the descendant treat its elements before mesh clearing
   virtual void clear() {}
 
+  //!< the descendant tracking changes is notified of a change of an element
+  virtual void elementChanged( const SMDS_MeshElement* /*element*/, TChange /*change*/ ) {}
+
+  //!< start or stop notifying the descendant of changes of elements
+  void trackChanges( bool toTrack );
+
   SMDS_Mesh* myMesh;
 
 
@@ -90,6 +104,7 @@ class SMDS_EXPORT SMDS_ElementHolder
   std::vector<const SMDS_MeshElement*>      myExternalElems; //!< elements not contained in the mesh
   std::vector< vtkIdType >                  myVtkIDs;        //!< vtk IDs of elements
   std::vector< bool >                       myIsNode;
+  bool                                      myIsTrackingChanges;
   std::set< SMDS_ElementHolder* >::iterator myPtrInMesh;
 };
 
@@ -0,0 +1,52 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  SMESH SMDS : implementation of Salome mesh data structure
+// File      : SMDS_ElementRange.cxx
+// Module    : SMESH
+//
+
+#include "SMDS_ElementRange.hxx"
+
+#ifdef WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+//================================================================================
+/*!
+ * \brief Call func( begin, end ) for sub-ranges of [0,nbItems), in parallel
+ *        if TBB is available
+ */
+//================================================================================
+
+void SMDS_ParallelForBlocks( size_t                                        nbItems,
+                             const std::function< void( size_t, size_t ) >& func )
+{
+  if ( nbItems == 0 )
+    return;
+#ifdef WITH_TBB
+  tbb::parallel_for ( tbb::blocked_range<size_t>( 0, nbItems ),
+                      [&]( const tbb::blocked_range<size_t>& r )
+                      {
+                        func( r.begin(), r.end() );
+                      });
+#else
+  func( 0, nbItems );
+#endif
+}
@@ -0,0 +1,269 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  SMESH SMDS : implementation of Salome mesh data structure
+// File      : SMDS_ElementRange.hxx
+// Module    : SMESH
+//
+#ifndef __SMDS_ElementRange_HXX__
+#define __SMDS_ElementRange_HXX__
+
+#include "SMDS_ElementFactory.hxx"
+
+#include <functional>
+#include <iterator>
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Non-virtual filters of elements used by SMDS_ElementRange
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+namespace SMDS_RangeFilter
+{
+  struct All
+  {
+    bool operator()( const SMDS_MeshElement* ) const { return true; }
+  };
+  struct Type
+  {
+    SMDSAbs_ElementType _type;
+    Type( SMDSAbs_ElementType t = SMDSAbs_All ): _type( t ) {}
+    bool operator()( const SMDS_MeshElement* e ) const
+    { return _type == SMDSAbs_All || e->GetType() == _type; }
+  };
+  struct Entity
+  {
+    SMDSAbs_EntityType _type;
+    Entity( SMDSAbs_EntityType t = SMDSEntity_Last ): _type( t ) {}
+    bool operator()( const SMDS_MeshElement* e ) const { return e->GetEntityType() == _type; }
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Selectors of ranges of elements in a SMDS_ElementChunk:
+ *        either used elements or elements assigned to a sub-shape
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+struct SMDS_UsedSelector
+{
+  typedef TUsedRangeSet range_set;
+  static const range_set& Get( const SMDS_ElementChunk& c ) { return c.GetUsedRanges(); }
+  static bool Default() { return true; }
+};
+
+struct SMDS_ShapeSelector
+{
+  typedef TSubIDRangeSet range_set;
+  static const range_set& Get( const SMDS_ElementChunk& c ) { return c.GetSubIDRanges(); }
+  static int Default() { return 0; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Range of elements stored in chunks of SMDS_ElementFactory, usable in
+ *        range-based for loops:
+ *
+ *   for ( const SMDS_MeshNode* node : mesh->nodesRange() )
+ *
+ * Unlike SMDS_ElemIteratorPtr, the range is not allocated in the heap and there is
+ * no virtual call per element (except for the ones done by the FILTER), unused
+ * elements are skipped by ranges. The range can be split by chunks to be processed
+ * in parallel, see SMDS_ParallelForEach().
+ * Elements must not be added or removed while the range is traversed.
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+template< class ELEM,
+          class FILTER   = SMDS_RangeFilter::All,
+          class SELECTOR = SMDS_UsedSelector >
+class SMDS_ElementRange
+{
+public:
+  typedef typename SELECTOR::range_set     range_set;
+  typedef typename range_set::attr_t       attr_t;
+  typedef typename range_set::set_iterator set_iterator;
+
+  class iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef const ELEM*               value_type;
+    typedef std::ptrdiff_t            difference_type;
+    typedef const ELEM* const*        pointer;
+    typedef const ELEM*               reference;
+
+    // constructor to use as return from end()
+    iterator(): myRange( 0 ), myChunk( 0 ), mySet( 0 ), myElem( 0 ) {}
+
+    // constructor to use as return from begin()
+    iterator( const SMDS_ElementRange* range ):
+      myRange( range ), myChunkIndex( range->myChunkBegin - 1 ), myChunk( 0 ),
+      mySet( 0 ), myIndex( 0 ), myEnd( 0 ), myElem( 0 )
+    {
+      next();
+    }
+
+    const ELEM* operator*() const { return myElem; }
+
+    iterator& operator++() { next(); return *this; }
+
+    iterator operator++(int) { iterator res = *this; next(); return res; }
+
+    bool operator==( const iterator& other ) const { return myElem == other.myElem; }
+    bool operator!=( const iterator& other ) const { return myElem != other.myElem; }
+
+  private:
+
+    //! Find the next element
+    void next()
+    {
+      while ( true )
+      {
+        while ( myIndex < myEnd )
+        {
+          const SMDS_MeshElement* e = myChunk->Element( myIndex++ );
+          if ( !e->IsNull() && myRange->myFilter( e ))
+          {
+            myElem = static_cast< const ELEM* >( e );
+            return;
+          }
+        }
+        if ( !nextRange() )
+        {
+          myElem = 0;
+          return;
+        }
+      }
+    }
+
+    //! Find the next range of elements having the value of attribute
+    bool nextRange()
+    {
+      while ( true )
+      {
+        if ( mySet )
+          while ( ++myRangeIndex < mySet->mySet.size() )
+          {
+            set_iterator r = mySet->mySet.begin() + myRangeIndex;
+            if ( r->myValue == myRange->myValue )
+            {
+              myIndex = r->my1st;
+              myEnd   = r->my1st + (int) mySet->Size( r );
+              return true;
+            }
+          }
+        if ( ++myChunkIndex >= myRange->myChunkEnd )
+          return false;
+        myChunk      = & (*myRange->myChunks)[ myChunkIndex ];
+        mySet        = & SELECTOR::Get( *myChunk );
+        myRangeIndex = size_t( -1 );
+      }
+    }
+
+    const SMDS_ElementRange* myRange;
+    int                      myChunkIndex;
+    const SMDS_ElementChunk* myChunk;
+    const range_set*         mySet;
+    size_t                   myRangeIndex;
+    int                      myIndex, myEnd; // current and end index of element in myChunk
+    const ELEM*              myElem;
+  };
+
+  typedef iterator const_iterator;
+
+  SMDS_ElementRange( const TChunkVector& chunks,
+                     const FILTER&       filter     = FILTER(),
+                     attr_t              value      = SELECTOR::Default(),
+                     int                 chunkBegin = 0,
+                     int                 chunkEnd   = -1 ):
+    myChunks( &chunks ), myFilter( filter ), myValue( value ),
+    myChunkBegin( chunkBegin ), myChunkEnd( chunkEnd < 0 ? (int) chunks.size() : chunkEnd )
+  {}
+
+  iterator begin() const { return iterator( this ); }
+  iterator end()   const { return iterator(); }
+
+  //! Return index of the first chunk and of the chunk after the last one
+  int ChunkBegin() const { return myChunkBegin; }
+  int ChunkEnd()   const { return myChunkEnd; }
+
+  //! Return a range of elements located in chunks [chunkBegin,chunkEnd)
+  SMDS_ElementRange SubRange( int chunkBegin, int chunkEnd ) const
+  {
+    return SMDS_ElementRange( *myChunks, myFilter, myValue, chunkBegin, chunkEnd );
+  }
+
+private:
+
+  const TChunkVector* myChunks;
+  FILTER              myFilter;
+  attr_t              myValue;
+  int                 myChunkBegin, myChunkEnd;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Call func( begin, end ) for sub-ranges of [0,nbItems), in parallel
+ *        if TBB is available
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+SMDS_EXPORT void SMDS_ParallelForBlocks( size_t                                        nbItems,
+                                         const std::function< void( size_t, size_t ) >& func );
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Call func( i ) for i in [0,nbItems), in parallel if TBB is available
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+template< class FUNC >
+void SMDS_ParallelFor( size_t nbItems, const FUNC& func )
+{
+  SMDS_ParallelForBlocks( nbItems, [&]( size_t begin, size_t end )
+                          {
+                            for ( size_t i = begin; i < end; ++i )
+                              func( i );
+                          });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/*!
+ * \brief Call func( element ) for all elements of a range; chunks of elements
+ *        are processed in parallel if TBB is available.
+ *        func() must be thread safe.
+ */
+///////////////////////////////////////////////////////////////////////////////
+
+template< class RANGE, class FUNC >
+void SMDS_ParallelForEach( const RANGE& range, const FUNC& func )
+{
+  const int chunk0 = range.ChunkBegin();
+  SMDS_ParallelForBlocks( range.ChunkEnd() - chunk0, [&]( size_t begin, size_t end )
+                          {
+                            for ( auto elem : range.SubRange( chunk0 + int( begin ),
+                                                              chunk0 + int( end )))
+                              func( elem );
+                          });
+}
+
+#endif
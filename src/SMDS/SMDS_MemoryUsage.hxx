@@ -0,0 +1,141 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_MemoryUsage.hxx
+// Module    : SMESH
+//
+#ifndef SMDS_MemoryUsage_HeaderFile
+#define SMDS_MemoryUsage_HeaderFile
+
+#include "SMESH_SMDS.hxx"
+
+#include "SMDSAbs_ElementType.hxx"
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Memory used by a mesh, in bytes, split by data structure ("component")
+ *        and by entity type.
+ *
+ * Components do not overlap, so their sum is the total mesh memory. The split by
+ * entity type is another view of the memory of elements (objects, connectivity,
+ * ID maps). Values are computed from sizes of containers and may be
+ * estimated by sampling, see SMDS_Mesh::GetMemoryUsage().
+ */
+class SMDS_MemoryUsage
+{
+public:
+
+  SMDS_MemoryUsage(): myEntities( SMDSEntity_Last, 0 ), myIsSampled( false ) {}
+
+  //! Add bytes used by a data structure
+  void Add( const std::string& component, size_t nbBytes ) { myComponents[ component ] += nbBytes; }
+
+  //! Add bytes used by elements of an entity type
+  void AddEntity( SMDSAbs_EntityType type, size_t nbBytes ) { myEntities[ type ] += nbBytes; }
+
+  //! Return bytes used by a data structure
+  size_t Get( const std::string& component ) const
+  {
+    std::map< std::string, size_t >::const_iterator c = myComponents.find( component );
+    return c == myComponents.end() ? 0 : c->second;
+  }
+
+  //! Return bytes used by elements of an entity type
+  size_t GetEntity( SMDSAbs_EntityType type ) const { return myEntities[ type ]; }
+
+  //! Return all data structures
+  const std::map< std::string, size_t >& GetComponents() const { return myComponents; }
+
+  //! Return total bytes
+  size_t Total() const
+  {
+    size_t total = 0;
+    for ( auto& c : myComponents )
+      total += c.second;
+    return total;
+  }
+
+  //! Return true if some values are estimated by sampling
+  bool IsSampled() const { return myIsSampled; }
+  void SetSampled( bool isSampled ) { myIsSampled = myIsSampled || isSampled; }
+
+  //! Return a name of an entity type as in SMESH.EntityType, e.g. "Entity_Hexa"
+  static const char* EntityName( SMDSAbs_EntityType type )
+  {
+    static const char* names[] = {
+      "Entity_Node", "Entity_0D", "Entity_Edge", "Entity_Quad_Edge",
+      "Entity_Triangle", "Entity_Quad_Triangle", "Entity_BiQuad_Triangle",
+      "Entity_Quadrangle", "Entity_Quad_Quadrangle", "Entity_BiQuad_Quadrangle",
+      "Entity_Polygon", "Entity_Quad_Polygon", "Entity_Tetra", "Entity_Quad_Tetra",
+      "Entity_Pyramid", "Entity_Quad_Pyramid",
+      "Entity_Hexa", "Entity_Quad_Hexa", "Entity_TriQuad_Hexa",
+      "Entity_Penta", "Entity_Quad_Penta", "Entity_BiQuad_Penta", "Entity_Hexagonal_Prism",
+      "Entity_Polyhedra", "Entity_Quad_Polyhedra", "Entity_Ball" };
+    static_assert( sizeof( names ) / sizeof( names[0] ) == SMDSEntity_Last,
+                   "names of SMDSAbs_EntityType are out of date" );
+    return ( 0 <= type && type < SMDSEntity_Last ) ? names[ type ] : "";
+  }
+
+  //! Return a human-readable report
+  std::string Dump() const
+  {
+    std::ostringstream out;
+    out << "Total: " << Total() << " bytes" << ( myIsSampled ? " (sampled)" : "" ) << std::endl;
+    for ( auto& c : myComponents )
+      out << "  " << c.first << ": " << c.second << std::endl;
+    out << "By entity:" << std::endl;
+    for ( int i = 0; i < SMDSEntity_Last; ++i )
+      if ( myEntities[ i ] > 0 )
+        out << "  " << EntityName( SMDSAbs_EntityType( i )) << ": " << myEntities[ i ] << std::endl;
+    return out.str();
+  }
+
+  //! Write the report in JSON format: total, sampling flag, bytes per component
+  //! and per entity type (only used ones)
+  void WriteJSON( std::ostream& stream ) const
+  {
+    stream << "{\n  \"total\": " << Total()
+           << ",\n  \"sampled\": " << ( myIsSampled ? "true" : "false" )
+           << ",\n  \"components\": {";
+    for ( auto c = myComponents.begin(); c != myComponents.end(); ++c )
+      stream << ( c == myComponents.begin() ? "\n    \"" : ",\n    \"" )
+             << c->first << "\": " << c->second;
+    stream << "\n  },\n  \"entities\": {";
+    bool isFirst = true;
+    for ( int i = 0; i < SMDSEntity_Last; ++i )
+      if ( myEntities[ i ] > 0 )
+      {
+        stream << ( isFirst ? "\n    \"" : ",\n    \"" )
+               << EntityName( SMDSAbs_EntityType( i )) << "\": " << myEntities[ i ];
+        isFirst = false;
+      }
+    stream << "\n  }\n}\n";
+  }
+
+private:
+
+  std::map< std::string, size_t > myComponents;
+  std::vector< size_t >           myEntities;
+  bool                            myIsSampled;
+};
+
+#endif
@@ -30,6 +30,7 @@
 
 #include "SMDS_ElementFactory.hxx"
 #include "SMDS_ElementHolder.hxx"
+#include "SMDS_NodeCoords.hxx"
 #include "SMDS_SetIterator.hxx"
 #include "SMDS_SpacePosition.hxx"
 #include "SMDS_UnstructuredGrid.hxx"
@@ -39,9 +40,11 @@
 #include <vtkUnstructuredGrid.h>
 //#include <vtkUnstructuredGridWriter.h>
 #include <vtkCell.h>
+#include <vtkDoubleArray.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkCellLinks.h>
 #include <vtkIdList.h>
+#include <vtkPoints.h>
 
 #include <algorithm>
 #include <iostream>
@@ -125,7 +128,7 @@ SMDS_Mesh::SMDS_Mesh():
   myNodeFactory( new SMDS_NodeFactory( this )),
   myCellFactory( new SMDS_ElementFactory( this )),
   myParent(NULL),
-  myModified(false), myModifTime(0), myCompactTime(0),
+  myModified(false), myModifTime(0), myCompactTime(0), myNodesModifTime(0),
   xmin(0), xmax(0), ymin(0), ymax(0), zmin(0), zmax(0)
 {
   myGrid = SMDS_UnstructuredGrid::New();
@@ -988,6 +991,82 @@ void SMDS_Mesh::MoveNode(const SMDS_MeshNode *n, double x, double y, double z)
   node->setXYZ(x,y,z);
 }
 
+//================================================================================
+/*!
+ * \brief Move several nodes at once
+ *  \param [in] nodes - nodes to move, each node must be present once
+ *  \param [in] xyz - new coordinates, 3 values per node
+ *
+ * Coordinates are written directly to the points of the grid, in parallel if
+ * possible, and the modification time of the mesh is increased once.
+ */
+//================================================================================
+
+void SMDS_Mesh::MoveNodes(const std::vector<const SMDS_MeshNode*>& nodes,
+                          const std::vector<double>&               xyz)
+{
+  if ( nodes.empty() )
+    return;
+  if ( xyz.size() < 3 * nodes.size() )
+    throw SALOME_Exception("SMDS_Mesh::MoveNodes(): too few coordinates");
+
+  if ( !myChangeTrackers.empty() )
+    for ( size_t i = 0; i < nodes.size(); ++i )
+      notifyChangeTrackers( nodes[i], SMDS_ElementHolder::ELEM_MODIFIED );
+
+  vtkPoints* points = myGrid->GetPoints();
+  double*   pntXYZ = static_cast< vtkDoubleArray* >( points->GetData() )->GetPointer( 0 );
+
+  SMDS_ParallelFor( nodes.size(), [&]( size_t i )
+                    {
+                      double* p = pntXYZ + 3 * nodes[i]->GetVtkID();
+                      p[0] = xyz[ 3 * i + 0 ];
+                      p[1] = xyz[ 3 * i + 1 ];
+                      p[2] = xyz[ 3 * i + 2 ];
+                    });
+  points->Modified();
+  setNodesModified();
+  setMyModified();
+  Modified();
+}
+
+//================================================================================
+/*!
+ * \brief Set coordinates of nodes changed in a view loaded from this mesh
+ *  \param [in] coords - coordinates loaded from this mesh and modified
+ *  \return smIdType - number of moved nodes
+ */
+//================================================================================
+
+smIdType SMDS_Mesh::MoveNodes(const SMDS_NodeCoords& coords)
+{
+  if ( coords.GetMesh() != this )
+    throw SALOME_Exception("SMDS_Mesh::MoveNodes(): coordinates of other mesh");
+
+  vtkPoints*      points = myGrid->GetPoints();
+  const double*   pntXYZ = static_cast< vtkDoubleArray* >( points->GetData() )->GetPointer( 0 );
+  const vtkIdType nbPnts = std::min( (vtkIdType) coords.Size(), points->GetNumberOfPoints() );
+
+  std::vector<const SMDS_MeshNode*> nodes;
+  std::vector<double>               xyz;
+  for ( vtkIdType i = 0; i < nbPnts; ++i )
+  {
+    const double* p = pntXYZ + 3 * i;
+    if ( p[0] == coords.X( i ) && p[1] == coords.Y( i ) && p[2] == coords.Z( i ))
+      continue;
+    if ( const SMDS_MeshNode* node = FindNodeVtk( i ))
+    {
+      nodes.push_back( node );
+      xyz.push_back( coords.X( i ));
+      xyz.push_back( coords.Y( i ));
+      xyz.push_back( coords.Z( i ));
+    }
+  }
+  MoveNodes( nodes, xyz );
+
+  return nodes.size();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Return the node whose SMDS ID is 'ID'.
 ///////////////////////////////////////////////////////////////////////////////
@@ -1084,6 +1163,9 @@ bool SMDS_Mesh::ChangePolyhedronNodes(const SMDS_MeshElement *                 e
   // keep current nodes of element
   std::set<const SMDS_MeshNode*> oldNodes( element->begin_nodes(), element->end_nodes() );
 
+  if ( !myChangeTrackers.empty() )
+    notifyChangeTrackers( element, SMDS_ElementHolder::ELEM_MODIFIED );
+
   bool Ok = false;
 
   // change vtkUnstructuredGrid::Faces
@@ -1120,6 +1202,9 @@ bool SMDS_Mesh::ChangeElementNodes(const SMDS_MeshElement * element,
   // keep current nodes of element
   std::set<const SMDS_MeshNode*> oldNodes( element->begin_nodes(), element->end_nodes() );
 
+  if ( !myChangeTrackers.empty() )
+    notifyChangeTrackers( element, SMDS_ElementHolder::ELEM_MODIFIED );
+
   // change nodes
   bool Ok = false;
   if ( SMDS_MeshCell* cell = dynamic_cast<SMDS_MeshCell*>((SMDS_MeshElement*) element))
@@ -1592,6 +1677,7 @@ void SMDS_Mesh::Clear()
 
   myModified = false;
   myModifTime++;
+  myNodesModifTime++;
   xmin = 0; xmax = 0;
   ymin = 0; ymax = 0;
   zmin = 0; zmax = 0;
@@ -1710,6 +1796,35 @@ SMDS_ElemIteratorPtr SMDS_Mesh::shapeElementsIterator(int                     sh
   return myCellFactory->GetShapeIterator< SMDS_ElemIterator >( shapeID, nbElemsToReturn, sm1stElem );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// Return ranges of elements, to use in range-based for loops
+///////////////////////////////////////////////////////////////////////////////
+
+SMDS_NodeRange SMDS_Mesh::nodesRange() const
+{
+  return SMDS_NodeRange( myNodeFactory->GetChunks() );
+}
+
+SMDS_ElemRange SMDS_Mesh::elementsRange(SMDSAbs_ElementType type) const
+{
+  return SMDS_ElemRange( myCellFactory->GetChunks(), SMDS_RangeFilter::Type( type ));
+}
+
+SMDS_EntityRange SMDS_Mesh::elementEntityRange(SMDSAbs_EntityType type) const
+{
+  return SMDS_EntityRange( myCellFactory->GetChunks(), SMDS_RangeFilter::Entity( type ));
+}
+
+SMDS_ShapeNodeRange SMDS_Mesh::shapeNodesRange(int shapeID) const
+{
+  return SMDS_ShapeNodeRange( myNodeFactory->GetChunks(), SMDS_RangeFilter::All(), shapeID );
+}
+
+SMDS_ShapeElemRange SMDS_Mesh::shapeElementsRange(int shapeID) const
+{
+  return SMDS_ShapeElemRange( myCellFactory->GetChunks(), SMDS_RangeFilter::All(), shapeID );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Do intersection of sets (more than 2)
 ///////////////////////////////////////////////////////////////////////////////
@@ -3016,6 +3131,8 @@ void SMDS_Mesh::CompactMesh()
   smIdType newNodeSize = myNodeFactory->NbUsedElements();
   smIdType newCellSize = myCellFactory->NbUsedElements();
   myGrid->compactGrid( idNodesOldToNew, newNodeSize, idCellsNewToOld, newCellSize );
+  if ( idsChange )
+    setNodesModified();
 
   if ( idsChange && !myElemHolders.empty() )
   {
@@ -3082,7 +3199,113 @@ bool SMDS_Mesh::HasNumerationHoles()
            myCellFactory->CompactChangePointers() );
 }
 
+namespace
+{
+  //! nb of elements to sample to estimate size of poly elements
+  const smIdType theNbSamples = 1000;
+
+  //================================================================================
+  /*!
+   * \brief Return nb of ids in VTK connectivity of elements of a variable size
+   */
+  //================================================================================
+
+  size_t nbConnectivityIDs( SMDS_ElemIteratorPtr elemIt,
+                            const smIdType       nbElems,
+                            const bool           sampling,
+                            SMDS_MemoryUsage&    usage )
+  {
+    size_t nbIDs = 0;
+    smIdType nbVisited = 0;
+    for ( ; elemIt->more(); ++nbVisited )
+    {
+      if ( sampling && nbVisited == theNbSamples )
+        break;
+      const SMDS_MeshElement* elem = elemIt->next();
+      nbIDs += elem->NbNodes();
+      if ( const SMDS_MeshVolume* poly = SMDS_Mesh::DownCast< SMDS_MeshVolume >( elem ))
+      {
+        // polyhedron face stream: nb of faces and nodes of each face preceded by their nb
+        std::vector<int> quantities = poly->GetQuantities();
+        nbIDs += 1 + quantities.size();
+        for ( int nbFaceNodes : quantities )
+          nbIDs += nbFaceNodes;
+      }
+    }
+    if ( nbVisited < nbElems && nbVisited > 0 )
+    {
+      nbIDs = size_t( double( nbIDs ) / double( nbVisited ) * double( nbElems ));
+      usage.SetSampled( true );
+    }
+    return nbIDs;
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Return memory used by the mesh split by data structure and by entity type
+ */
+//================================================================================
+
+void SMDS_Mesh::GetMemoryUsage( SMDS_MemoryUsage& usage, bool sampling ) const
+{
+  // data structures
+
+  usage.Add( "node factory",  myNodeFactory->GetMemorySize() );
+  usage.Add( "node ID maps",  myNodeFactory->GetIDMapsMemorySize() );
+  usage.Add( "cell factory",  myCellFactory->GetMemorySize() );
+  usage.Add( "cell ID maps",  myCellFactory->GetIDMapsMemorySize() );
+
+  const size_t kB = 1024;
+  size_t gridSize   = myGrid->GetActualMemorySize() * kB;
+  size_t pointsSize = myGrid->GetPoints() ? myGrid->GetPoints()->GetActualMemorySize() * kB : 0;
+  size_t linksSize  = myGrid->HasLinks()  ? myGrid->GetLinks()->GetActualMemorySize()  * kB : 0;
+  usage.Add( "vtk points", pointsSize );
+  usage.Add( "vtk links",  linksSize );
+  usage.Add( "vtk cells",  gridSize > pointsSize + linksSize ? gridSize - pointsSize - linksSize : 0 );
+  usage.Add( "downward connectivity", myGrid->GetDownwardMemorySize() );
+
+  // entities: element objects, VTK connectivity and ID maps
+
+  const size_t idMapsSize = sizeof( vtkIdType ) + sizeof( smIdType );
+  usage.AddEntity( SMDSEntity_Node,
+                   myInfo.NbNodes() * ( sizeof( SMDS_MeshNode ) + 3 * sizeof( double ) + idMapsSize ));
+
+  const size_t cellSize = sizeof( SMDS_MeshCell ) + idMapsSize +
+                          sizeof( vtkIdType ) + sizeof( unsigned char ); // offset and type
+  for ( int iEnt = SMDSEntity_Node + 1; iEnt < SMDSEntity_Last; ++iEnt )
+  {
+    SMDSAbs_EntityType entity = SMDSAbs_EntityType( iEnt );
+    smIdType nbElems = myInfo.NbEntities( entity );
+    if ( nbElems == 0 )
+      continue;
+
+    size_t nbIDs;
+    if ( entity == SMDSEntity_Polygon ||
+         entity == SMDSEntity_Quad_Polygon ||
+         entity == SMDSEntity_Polyhedra )
+      nbIDs = nbConnectivityIDs( elementEntityIterator( entity ), nbElems, sampling, usage );
+    else
+      nbIDs = nbElems * SMDS_MeshCell::NbNodes( entity );
+
+    usage.AddEntity( entity, nbElems * cellSize + nbIDs * sizeof( vtkIdType ));
+  }
+}
+
 void SMDS_Mesh::setNbShapes( size_t nbShapes )
 {
   myNodeFactory->SetNbShapes( nbShapes );
 }
+
+//================================================================================
+/*!
+ * \brief Notify element holders tracking changes of a change of an element
+ */
+//================================================================================
+
+void SMDS_Mesh::notifyChangeTrackers( const SMDS_MeshElement*     elem,
+                                      SMDS_ElementHolder::TChange change )
+{
+  for ( size_t i = 0; i < myChangeTrackers.size(); ++i )
+    myChangeTrackers[ i ]->elementChanged( elem, change );
+}
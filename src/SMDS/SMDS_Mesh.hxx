@@ -31,10 +31,13 @@
 
 #include "SMDS_BallElement.hxx"
 #include "SMDS_ElemIterator.hxx"
+#include "SMDS_ElementHolder.hxx"
+#include "SMDS_ElementRange.hxx"
 #include "SMDS_Mesh0DElement.hxx"
 #include "SMDS_MeshCell.hxx"
 #include "SMDS_MeshEdge.hxx"
 #include "SMDS_MeshFace.hxx"
+#include "SMDS_MemoryUsage.hxx"
 #include "SMDS_MeshInfo.hxx"
 #include "SMDS_MeshNode.hxx"
 #include "SMDS_MeshVolume.hxx"
@@ -45,9 +48,15 @@
 #include <vector>
 #include <smIdType.hxx>
 
-class SMDS_ElementHolder;
 class SMDS_ElementFactory;
 class SMDS_NodeFactory;
+class SMDS_NodeCoords;
+
+typedef SMDS_ElementRange< SMDS_MeshNode >                                      SMDS_NodeRange;
+typedef SMDS_ElementRange< SMDS_MeshElement, SMDS_RangeFilter::Type >           SMDS_ElemRange;
+typedef SMDS_ElementRange< SMDS_MeshElement, SMDS_RangeFilter::Entity >         SMDS_EntityRange;
+typedef SMDS_ElementRange< SMDS_MeshNode, SMDS_RangeFilter::All, SMDS_ShapeSelector > SMDS_ShapeNodeRange;
+typedef SMDS_ElementRange< SMDS_MeshElement, SMDS_RangeFilter::All, SMDS_ShapeSelector > SMDS_ShapeElemRange;
 
 class SMDS_EXPORT SMDS_Mesh : public SMDS_MeshObject
 {
@@ -74,6 +83,16 @@ public:
                                                      size_t                  nbElemsToReturn=-1,
                                                      const SMDS_MeshElement* sm1stElem=0) const;
 
+  // Ranges of elements for range-based for loops, see SMDS_ElementRange.hxx.
+  // They are faster than the iterators above but the mesh must not be modified
+  // during iteration
+
+  SMDS_NodeRange      nodesRange() const;
+  SMDS_ElemRange      elementsRange(SMDSAbs_ElementType type=SMDSAbs_All) const; //!< not nodes
+  SMDS_EntityRange    elementEntityRange(SMDSAbs_EntityType type) const;      //!< not nodes
+  SMDS_ShapeNodeRange shapeNodesRange(int shapeID) const;
+  SMDS_ShapeElemRange shapeElementsRange(int shapeID) const;
+
   SMDSAbs_ElementType GetElementType( const smIdType id, const bool iselem ) const;
 
   SMDS_Mesh *AddSubMesh();
@@ -593,6 +612,20 @@ public:
 
   virtual void MoveNode(const SMDS_MeshNode *n, double x, double y, double z);
 
+  /*!
+   * \brief Move several nodes at once; the mesh is marked modified once.
+   *  \param nodes - nodes to move, each node must be present once
+   *  \param xyz - new coordinates, 3 values per node
+   */
+  virtual void MoveNodes(const std::vector<const SMDS_MeshNode*>& nodes,
+                         const std::vector<double>&               xyz);
+
+  /*!
+   * \brief Set coordinates of nodes changed in a view loaded from this mesh
+   *  \retval smIdType - number of moved nodes
+   */
+  smIdType MoveNodes(const SMDS_NodeCoords& coords);
+
   virtual void RemoveElement(const SMDS_MeshElement *               elem,
                              std::vector<const SMDS_MeshElement *>& removedElems,
                              std::vector<const SMDS_MeshElement *>& removedNodes,
@@ -628,6 +661,13 @@ public:
   virtual bool IsCompacted();
   virtual bool HasNumerationHoles();
 
+  /*!
+   * \brief Return memory used by the mesh split by data structure and by entity type.
+   *  \param [in] sampling - if true, sizes of poly elements are extrapolated
+   *         from a limited number of elements, so that the method is cheap
+   */
+  virtual void GetMemoryUsage( SMDS_MemoryUsage& usage, bool sampling=false ) const;
+
   template<class ELEMTYPE>
     static const ELEMTYPE* DownCast( const SMDS_MeshElement* e )
   {
@@ -712,9 +752,24 @@ public:
   //! low level modification: add, change or remove node or element
   inline void setMyModified() { this->myModified = true; }
 
+  //! low level modification of an element; notify element holders tracking changes
+  inline void setMyModified( const SMDS_MeshElement* elem, SMDS_ElementHolder::TChange change )
+  {
+    this->myModified = true;
+    if ( !myChangeTrackers.empty() )
+      notifyChangeTrackers( elem, change );
+  }
+
   void Modified();
   vtkMTimeType GetMTime() const;
 
+  //! low level modification: add node or change node coordinates
+  inline void setNodesModified() { ++this->myNodesModifTime; }
+
+  //! get last modification timeStamp of node coordinates, unlike GetMTime()
+  //! it is increased by any node move
+  vtkMTimeType GetNodesMTime() const { return this->myNodesModifTime; }
+
  protected:
   SMDS_Mesh(SMDS_Mesh * parent);
 
@@ -739,6 +794,8 @@ public:
 
   void setNbShapes( size_t nbShapes );  
 
+  void notifyChangeTrackers( const SMDS_MeshElement* elem, SMDS_ElementHolder::TChange change );
+
   // Fields PRIVATE
 
   //! actual nodes coordinates, cells definition and reverse connectivity are stored in a vtkUnstructuredGrid
@@ -756,9 +813,12 @@ public:
   bool                   myModified;
   //! use a counter to keep track of modifications
   unsigned long          myModifTime, myCompactTime;
+  //! counter of additions and moves of nodes
+  vtkMTimeType           myNodesModifTime;
 
   friend class SMDS_ElementHolder;
   std::set< SMDS_ElementHolder* > myElemHolders;
+  std::vector< SMDS_ElementHolder* > myChangeTrackers; //!< holders notified of element changes
 
   double xmin;
   double xmax;
@@ -31,13 +31,107 @@
 
 #include "SMDS_MeshGroup.hxx"
 
-#include "SMDS_SetIterator.hxx"
 #include "ObjectPool.hxx"
 
 #include <utilities.h>
 
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+  // min nb of pending IDs to merge into the sorted IDs
+  const size_t theMinNbPendingToMerge = 64;
+
+  // min nb of IDs to consider storing them in a bit set
+  const size_t theMinNbIDsForBitSet = 64;
+
+  //================================================================================
+  /*!
+   * \brief Compare IDs ignoring a sign marking removed ones
+   */
+  //================================================================================
+
+  struct AbsLess
+  {
+    bool operator()( const smIdType id1, const smIdType id2 ) const
+    {
+      return std::abs( id1 ) < std::abs( id2 );
+    }
+  };
+
+  //================================================================================
+  /*!
+   * \brief Return an element of a given type by ID
+   */
+  //================================================================================
+
+  const SMDS_MeshElement* findElement( const SMDS_Mesh*          mesh,
+                                       const SMDSAbs_ElementType type,
+                                       const smIdType            id )
+  {
+    const SMDS_MeshElement* e = 0;
+    if ( type == SMDSAbs_Node )
+      e = mesh->FindNode( id );
+    else
+      e = mesh->FindElement( id );
+    return ( e && e->GetType() == type ) ? e : 0;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Iterator on elements of a group in ID order. Skips IDs of removed elements.
+   */
+  //================================================================================
+
+  struct GroupIterator : public SMDS_ElemIterator
+  {
+    const SMDS_Mesh*               myMesh;
+    SMDSAbs_ElementType            myType;
+    const std::vector< smIdType >* myIDs;
+    const boost::dynamic_bitset<>* myBits;
+    size_t                         myIndex;
+    smIdType                       myMinID;
+    const SMDS_MeshElement*        myElem;
+
+    GroupIterator( const SMDS_Mesh*               mesh,
+                   SMDSAbs_ElementType            type,
+                   const std::vector< smIdType >* ids,
+                   const boost::dynamic_bitset<>* bits,
+                   smIdType                       minID )
+      : myMesh( mesh ), myType( type ), myIDs( ids ), myBits( bits ), myIndex( 0 ),
+        myMinID( minID ), myElem( 0 )
+    {
+      if ( myBits )
+        myIndex = myBits->find_first();
+      findNext();
+    }
+    virtual bool more()
+    {
+      return myElem;
+    }
+    virtual const SMDS_MeshElement* next()
+    {
+      const SMDS_MeshElement* e = myElem;
+      findNext();
+      return e;
+    }
+    void findNext()
+    {
+      myElem = 0;
+      if ( myBits )
+        for ( ; !myElem && myIndex < myBits->size(); myIndex = myBits->find_next( myIndex ))
+          myElem = findElement( myMesh, myType, myMinID + myIndex );
+      else
+        for ( ; !myElem && myIndex < myIDs->size(); ++myIndex )
+          if ( (*myIDs)[ myIndex ] > 0 )
+            myElem = findElement( myMesh, myType, (*myIDs)[ myIndex ]);
+    }
+  };
+}
+
 //=======================================================================
 //function : SMDS_MeshGroup
 //purpose  :
@@ -45,7 +139,8 @@
 
 SMDS_MeshGroup::SMDS_MeshGroup(const SMDS_Mesh *         theMesh,
                                const SMDSAbs_ElementType theType)
-  : SMDS_ElementHolder( theMesh ), myType( theType ), myTic( 0 )
+  : SMDS_ElementHolder( theMesh ), myMesh( theMesh ), myType( theType ), myNbElements( 0 ),
+    myNbRemoved( 0 ), myIsBitSet( false ), myMinID( 0 ), myTic( 0 )
 {
 }
 
@@ -56,7 +151,7 @@ SMDS_MeshGroup::SMDS_MeshGroup(const SMDS_Mesh *         theMesh,
 
 void SMDS_MeshGroup::Clear()
 {
-  clearVector( myElements );
+  tmpClear();
   myType = SMDSAbs_All;
   ++myTic;
 }
@@ -68,8 +163,14 @@ void SMDS_MeshGroup::Clear()
 
 bool SMDS_MeshGroup::Add(const SMDS_MeshElement * theElem)
 {
+  // elements are stored by IDs, so they must belong to the mesh
+  if ( myMesh && !myMesh->Contains( theElem )) {
+    MESSAGE("SMDS_MeshGroup::Add : element of other mesh");
+    return false;
+  }
+
   // the type of the group is determined by the first element added
-  if ( myElements.empty() ) {
+  if ( IsEmpty() ) {
     myType = theElem->GetType();
   }
   else if ( theElem->GetType() != myType ) {
@@ -77,7 +178,9 @@ bool SMDS_MeshGroup::Add(const SMDS_MeshElement * theElem)
     return false;
   }
 
-  bool added = myElements.insert( theElem ).second;
+  bool added = addID( theElem->GetID() );
+  if ( added )
+    trackChanges( true ); // to purge IDs of elements freed without Remove()
 
   ++myTic;
 
@@ -91,11 +194,9 @@ bool SMDS_MeshGroup::Add(const SMDS_MeshElement * theElem)
 
 bool SMDS_MeshGroup::Remove( const SMDS_MeshElement * theElem )
 {
-  TElementSet::iterator found = myElements.find(theElem);
-  if ( found != myElements.end() ) {
-    myElements.erase( found );
-    if ( myElements.empty() ) myType = SMDSAbs_All;
-    ++myTic;
+  if ( theElem && theElem->GetType() == myType && removeID( theElem->GetID() )) {
+    if ( IsEmpty() ) Clear();
+    else             ++myTic;
     return true;
   }
   return false;
@@ -108,7 +209,8 @@ bool SMDS_MeshGroup::Remove( const SMDS_MeshElement * theElem )
 
 bool SMDS_MeshGroup::Contains(const SMDS_MeshElement * theElem) const
 {
-  return myElements.find( theElem ) != myElements.end();
+  return ( theElem && theElem->GetType() == myType && containsID( theElem->GetID() ) &&
+           ( !myMesh || myMesh->Contains( theElem )));
 }
 
 //=======================================================================
@@ -129,8 +231,11 @@ void SMDS_MeshGroup::SetType(const SMDSAbs_ElementType theType)
 
 SMDS_ElemIteratorPtr SMDS_MeshGroup::GetElements() const
 {
-  typedef SMDS_SetIterator< const SMDS_MeshElement*, TIterator > TSetIterator;
-  return boost::make_shared< TSetIterator >( myElements.begin(), myElements.end() );
+  if ( myIsBitSet )
+    return boost::make_shared< GroupIterator >( myMesh, myType, &myIDs, &myBits, myMinID );
+
+  flush();
+  return boost::make_shared< GroupIterator >( myMesh, myType, &myIDs, nullptr, 0 );
 }
 
 //=======================================================================
@@ -140,10 +245,19 @@ SMDS_ElemIteratorPtr SMDS_MeshGroup::GetElements() const
 
 void SMDS_MeshGroup::operator=( SMDS_MeshGroup && other )
 {
-  myMesh = other.myMesh;
-  myType = other.myType;
-  myElements = std::move( other.myElements );
+  myMesh       = other.myMesh;
+  myType       = other.myType;
+  myNbElements = other.myNbElements;
+  myIDs        = std::move( other.myIDs );
+  myPendingIDs = std::move( other.myPendingIDs );
+  myNbRemoved  = other.myNbRemoved;
+  myIsBitSet   = other.myIsBitSet;
+  myBits       = std::move( other.myBits );
+  myMinID      = other.myMinID;
   ++myTic;
+
+  other.tmpClear();
+  trackChanges( myNbElements > 0 );
 }
 
 //=======================================================================
@@ -153,5 +267,292 @@ void SMDS_MeshGroup::operator=( SMDS_MeshGroup && other )
 
 void SMDS_MeshGroup::tmpClear()
 {
-  myElements.clear();
+  clearVector( myIDs );
+  clearVector( myPendingIDs );
+  myBits.clear();
+  myBits.shrink_to_fit();
+  myNbElements = 0;
+  myNbRemoved  = 0;
+  myIsBitSet   = false;
+  myMinID      = 0;
+  trackChanges( false );
+}
+
+//=======================================================================
+//function : compact
+//purpose  : sort IDs changed by mesh compacting
+//=======================================================================
+
+void SMDS_MeshGroup::compact()
+{
+  flush();
+  chooseStorage();
+}
+
+//=======================================================================
+//function : elementChanged
+//purpose  : remove ID of an element being removed from the mesh; it is notified
+//           before the element is freed, when its ID is still valid
+//=======================================================================
+
+void SMDS_MeshGroup::elementChanged( const SMDS_MeshElement* element, TChange change )
+{
+  if ( change == ELEM_REMOVED && element->GetType() == myType && removeID( element->GetID() ))
+    ++myTic;
+}
+
+//=======================================================================
+//function : GetMemorySize
+//purpose  : Return bytes allocated for the group
+//=======================================================================
+
+size_t SMDS_MeshGroup::GetMemorySize() const
+{
+  return ( sizeof( *this ) +
+           ( myIDs.capacity() + myPendingIDs.capacity() ) * sizeof( smIdType ) +
+           myBits.num_blocks() * sizeof( boost::dynamic_bitset<>::block_type ));
+}
+
+//=======================================================================
+//function : addID
+//purpose  : store an ID; return false if it is already stored
+//=======================================================================
+
+bool SMDS_MeshGroup::addID( const smIdType id )
+{
+  if ( id < 1 )
+    return false;
+
+  if ( myIsBitSet )
+  {
+    const smIdType maxID = myMinID + (smIdType) myBits.size() - 1;
+    if ( myMinID <= id && id <= maxID )
+    {
+      if ( myBits.test( id - myMinID ))
+        return false;
+      myBits.set( id - myMinID );
+      ++myNbElements;
+      return true;
+    }
+    // extend the range if the bit set remains not larger than IDs
+    const smIdType newRange = std::max( maxID, id ) - std::min( myMinID, id ) + 1;
+    if ( newRange / 8 <= (smIdType) sizeof( smIdType ) * ( myNbElements + 1 ) * 2 )
+    {
+      if ( id < myMinID )
+      {
+        myBits.resize( newRange );
+        myBits <<= ( myMinID - id );
+        myMinID = id;
+      }
+      else
+      {
+        myBits.resize( newRange );
+      }
+      myBits.set( id - myMinID );
+      ++myNbElements;
+      return true;
+    }
+    toVector();
+  }
+
+  // append an ID greater than all stored ones
+  if ( myPendingIDs.empty() && ( myIDs.empty() || id > std::abs( myIDs.back() )))
+  {
+    if ( myIDs.size() == myIDs.capacity() && myIDs.size() > theMinNbIDsForBitSet )
+    {
+      chooseStorage();
+      if ( myIsBitSet )
+        return addID( id );
+    }
+    myIDs.push_back( id );
+    ++myNbElements;
+    return true;
+  }
+
+  // restore a removed ID
+  std::vector< smIdType >::iterator i = std::lower_bound( myIDs.begin(), myIDs.end(), id, AbsLess() );
+  if ( i != myIDs.end() && std::abs( *i ) == id )
+  {
+    if ( *i > 0 )
+      return false;
+    *i = id;
+    --myNbRemoved;
+    ++myNbElements;
+    return true;
+  }
+
+  // add to the pending IDs
+  i = std::lower_bound( myPendingIDs.begin(), myPendingIDs.end(), id );
+  if ( i != myPendingIDs.end() && *i == id )
+    return false;
+  myPendingIDs.insert( i, id );
+  ++myNbElements;
+
+  // merge pending IDs when insertion into them becomes slower than a merge;
+  // many IDs added out of order may make a bit set preferable
+  if ( myPendingIDs.size() > theMinNbPendingToMerge &&
+       myPendingIDs.size() * myPendingIDs.size() > myIDs.size() )
+    chooseStorage();
+
+  return true;
+}
+
+//=======================================================================
+//function : removeID
+//purpose  : remove an ID; return false if it is not stored
+//=======================================================================
+
+bool SMDS_MeshGroup::removeID( const smIdType id )
+{
+  if ( id < 1 )
+    return false;
+
+  if ( myIsBitSet )
+  {
+    if ( id < myMinID || id - myMinID >= (smIdType) myBits.size() || !myBits.test( id - myMinID ))
+      return false;
+    myBits.reset( id - myMinID );
+    --myNbElements;
+    if ( myNbElements > 0 &&
+         myBits.size() / 8 > (size_t) myNbElements * sizeof( smIdType ) * 2 )
+      chooseStorage();
+    return true;
+  }
+
+  std::vector< smIdType >::iterator i = std::lower_bound( myIDs.begin(), myIDs.end(), id, AbsLess() );
+  if ( i != myIDs.end() && *i == id )
+  {
+    *i = -id;
+    ++myNbRemoved;
+    --myNbElements;
+    if ( myNbRemoved > (smIdType) myIDs.size() / 2 )
+      flush();
+    return true;
+  }
+
+  i = std::lower_bound( myPendingIDs.begin(), myPendingIDs.end(), id );
+  if ( i != myPendingIDs.end() && *i == id )
+  {
+    myPendingIDs.erase( i );
+    --myNbElements;
+    return true;
+  }
+  return false;
+}
+
+//=======================================================================
+//function : containsID
+//purpose  : 
+//=======================================================================
+
+bool SMDS_MeshGroup::containsID( const smIdType id ) const
+{
+  if ( id < 1 )
+    return false;
+
+  if ( myIsBitSet )
+    return ( id >= myMinID && id - myMinID < (smIdType) myBits.size() && myBits.test( id - myMinID ));
+
+  std::vector< smIdType >::const_iterator i =
+    std::lower_bound( myIDs.begin(), myIDs.end(), id, AbsLess() );
+  if ( i != myIDs.end() && std::abs( *i ) == id )
+    return *i > 0;
+
+  return std::binary_search( myPendingIDs.begin(), myPendingIDs.end(), id );
+}
+
+//=======================================================================
+//function : flush
+//purpose  : merge pending IDs into sorted ones and erase removed IDs
+//=======================================================================
+
+void SMDS_MeshGroup::flush() const
+{
+  if ( myIsBitSet )
+    return;
+
+  if ( myNbRemoved > 0 )
+  {
+    myIDs.erase( std::remove_if( myIDs.begin(), myIDs.end(),
+                                 []( smIdType id ) { return id < 0; }), myIDs.end() );
+    myNbRemoved = 0;
+  }
+  if ( !myPendingIDs.empty() )
+  {
+    size_t nbSorted = myIDs.size();
+    myIDs.insert( myIDs.end(), myPendingIDs.begin(), myPendingIDs.end() );
+    std::inplace_merge( myIDs.begin(), myIDs.begin() + nbSorted, myIDs.end() );
+    clearVector( myPendingIDs );
+  }
+}
+
+//=======================================================================
+//function : chooseStorage
+//purpose  : store IDs in a bit set if it is twice smaller than a vector of IDs
+//           and vice versa; trim the bit set to the range of stored IDs
+//=======================================================================
+
+void SMDS_MeshGroup::chooseStorage()
+{
+  if ( myNbElements == 0 )
+    return;
+
+  if ( myIsBitSet )
+  {
+    size_t first = myBits.find_first(), last = first;
+    for ( size_t i = first; i < myBits.size(); i = myBits.find_next( i ))
+      last = i;
+    const size_t range = last - first + 1;
+    if ( range / 8 > (size_t) myNbElements * sizeof( smIdType ) * 2 )
+    {
+      toVector();
+    }
+    else if ( range < myBits.size() )
+    {
+      myBits >>= first;
+      myBits.resize( range );
+      myMinID += (smIdType) first;
+    }
+  }
+  else
+  {
+    flush();
+    const size_t range = myIDs.back() - myIDs.front() + 1;
+    if ( range / 8 < (size_t) myNbElements * sizeof( smIdType ) / 2 )
+      toBitSet();
+  }
+}
+
+//=======================================================================
+//function : toBitSet
+//purpose  : move sorted IDs to a bit set
+//=======================================================================
+
+void SMDS_MeshGroup::toBitSet()
+{
+  flush();
+  myMinID = myIDs.front();
+  myBits.clear();
+  myBits.resize( myIDs.back() - myMinID + 1 );
+  for ( const smIdType id : myIDs )
+    myBits.set( id - myMinID );
+  clearVector( myIDs );
+  myIsBitSet = true;
+}
+
+//=======================================================================
+//function : toVector
+//purpose  : move IDs from a bit set to a sorted vector
+//=======================================================================
+
+void SMDS_MeshGroup::toVector()
+{
+  myIDs.clear();
+  myIDs.reserve( myNbElements );
+  for ( size_t i = myBits.find_first(); i < myBits.size(); i = myBits.find_next( i ))
+    myIDs.push_back( myMinID + (smIdType) i );
+  myBits.clear();
+  myBits.shrink_to_fit();
+  myMinID    = 0;
+  myIsBitSet = false;
 }
@@ -31,8 +31,23 @@
 
 #include "SMDS_ElementHolder.hxx"
 #include "SMDS_Mesh.hxx"
-#include <set>
 
+#include <boost/dynamic_bitset.hpp>
+
+#include <vector>
+
+/*!
+ * \brief Group of elements of one type.
+ *
+ * Elements are stored by IDs, either in a vector sorted by ID or in a bit set
+ * over a range of IDs, whichever takes less memory; the storage is chosen
+ * automatically. IDs added not in increasing order are kept in a small sorted
+ * vector merged into the main one on demand; removed IDs are negated and erased
+ * on demand. So elements are iterated in ID order; each ID is resolved through
+ * the mesh (SMDS_Mesh::FindElement()), which is slower than iterating pointers.
+ * A non-empty group tracks removal of elements from the mesh, so that IDs of
+ * elements freed not via Remove() are purged before they can be reused.
+ */
 class SMDS_EXPORT SMDS_MeshGroup: public SMDS_MeshObject, SMDS_ElementHolder
 {
  public:
@@ -41,17 +56,18 @@ class SMDS_EXPORT SMDS_MeshGroup: public SMDS_MeshObject, SMDS_ElementHolder
 
   void SetType (const SMDSAbs_ElementType theType);
   void Clear();
-  void Reserve(size_t /*nbElems*/) {}
+  void Reserve(size_t nbElems) { if ( !myIsBitSet ) myIDs.reserve( nbElems ); }
   bool Add(const SMDS_MeshElement * theElem);
   bool Remove(const SMDS_MeshElement * theElem);
-  bool IsEmpty() const { return myElements.empty(); }
-  smIdType  Extent() const { return (smIdType) myElements.size(); }
+  bool IsEmpty() const { return myNbElements == 0; }
+  smIdType  Extent() const { return myNbElements; }
   int  Tic() const { return myTic; }
   bool Contains(const SMDS_MeshElement * theElem) const;
 
   const SMDS_Mesh*     GetMesh() const { return myMesh; }
   SMDSAbs_ElementType  GetType() const { return myType; }
   SMDS_ElemIteratorPtr GetElements() const; // WARNING: iterator becomes invalid if group changes
+  size_t               GetMemorySize() const; // bytes allocated for the group
 
   void operator=( SMDS_MeshGroup && other );
 
@@ -60,16 +76,29 @@ class SMDS_EXPORT SMDS_MeshGroup: public SMDS_MeshObject, SMDS_ElementHolder
   virtual SMDS_ElemIteratorPtr getElements() { return GetElements(); }
   virtual void tmpClear();
   virtual void add( const SMDS_MeshElement* element ) { Add( element ); }
-  virtual void compact() {}
+  virtual void compact();
+  virtual void clear() { tmpClear(); ++myTic; }
+  virtual void elementChanged( const SMDS_MeshElement* element, TChange change );
 
  private:
 
-  typedef std::set< const SMDS_MeshElement* > TElementSet;
-  typedef TElementSet::const_iterator         TIterator;
+  bool addID     ( const smIdType id );
+  bool removeID  ( const smIdType id );
+  bool containsID( const smIdType id ) const;
+  void flush() const;     // merge pending IDs into myIDs and erase removed ones
+  void chooseStorage();   // switch between sorted IDs and bit set
+  void toBitSet();
+  void toVector();
 
-  const SMDS_Mesh *   myMesh;
-  SMDSAbs_ElementType myType;
-  TElementSet         myElements; // not sorted by ID because it can contain deleted elements
-  int                 myTic;      // to track changes
+  const SMDS_Mesh *               myMesh;
+  SMDSAbs_ElementType             myType;
+  smIdType                        myNbElements;
+  mutable std::vector< smIdType > myIDs;        // sorted IDs, negative if removed
+  mutable std::vector< smIdType > myPendingIDs; // sorted IDs to merge into myIDs
+  mutable smIdType                myNbRemoved;  // nb of negative IDs in myIDs
+  bool                            myIsBitSet;   // elements are stored in myBits
+  boost::dynamic_bitset<>         myBits;       // myBits[ ID - myMinID ]
+  smIdType                        myMinID;
+  int                             myTic;        // to track changes
 };
 #endif
@@ -45,6 +45,7 @@ void SMDS_MeshNode::init(double x, double y, double z)
   SMDS_UnstructuredGrid * grid = getGrid();
   vtkPoints *points = grid->GetPoints();
   points->InsertPoint( GetVtkID(), x, y, z );
+  GetMesh()->setNodesModified();
   if ( grid->HasLinks() )
     grid->GetLinks()->ResizeForPoint( GetVtkID() );
 }
@@ -246,10 +247,11 @@ void SMDS_MeshNode::GetXYZ(double xyz[3]) const
 //================================================================================
 void SMDS_MeshNode::setXYZ( double x, double y, double z )
 {
+  GetMesh()->setMyModified( this, SMDS_ElementHolder::ELEM_MODIFIED );
   vtkPoints *points = getGrid()->GetPoints();
   points->InsertPoint( GetVtkID(), x, y, z );
   //GetMesh()->adjustBoundingBox(x, y, z);
-  GetMesh()->setMyModified();
+  GetMesh()->setNodesModified();
 }
 
 //=======================================================================
@@ -0,0 +1,128 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : SMDS_NodeCoords.cxx
+//  Module : SMESH
+//
+
+#include "SMDS_NodeCoords.hxx"
+
+#include "SMDS_ElementRange.hxx"
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+
+#include <vtkDoubleArray.h>
+#include <vtkPoints.h>
+
+//================================================================================
+/*!
+ * \brief Empty view
+ */
+//================================================================================
+
+SMDS_NodeCoords::SMDS_NodeCoords(): myMesh( 0 ), myMTime( 0 ), myNodesMTime( 0 )
+{
+}
+
+//================================================================================
+/*!
+ * \brief Load coordinates of nodes of a mesh
+ */
+//================================================================================
+
+SMDS_NodeCoords::SMDS_NodeCoords( const SMDS_Mesh* mesh ): myMesh( 0 ), myMTime( 0 ), myNodesMTime( 0 )
+{
+  Load( mesh );
+}
+
+//================================================================================
+/*!
+ * \brief Copy coordinates of nodes of a mesh
+ */
+//================================================================================
+
+void SMDS_NodeCoords::Load( const SMDS_Mesh* mesh )
+{
+  myMesh = mesh;
+  myX.clear();
+  myY.clear();
+  myZ.clear();
+  if ( !mesh )
+    return;
+
+  myMTime      = mesh->GetMTime();
+  myNodesMTime = mesh->GetNodesMTime();
+
+  vtkPoints*   points = const_cast< SMDS_Mesh* >( mesh )->GetGrid()->GetPoints();
+  const size_t nbPnts = points ? points->GetNumberOfPoints() : 0;
+  myX.resize( nbPnts );
+  myY.resize( nbPnts );
+  myZ.resize( nbPnts );
+  if ( nbPnts == 0 )
+    return;
+
+  // points are stored as double (see SMDS_Mesh constructor), read the raw array
+  // rather than call vtkPoints::GetPoint() which is not thread safe
+  const double* xyz = static_cast< vtkDoubleArray* >( points->GetData() )->GetPointer( 0 );
+  double *x = myX.data(), *y = myY.data(), *z = myZ.data();
+  SMDS_ParallelFor( nbPnts, [&]( size_t i )
+                    {
+                      x[i] = xyz[ 3 * i + 0 ];
+                      y[i] = xyz[ 3 * i + 1 ];
+                      z[i] = xyz[ 3 * i + 2 ];
+                    });
+}
+
+//================================================================================
+/*!
+ * \brief Return true if the mesh has not been modified since Load()
+ *
+ * Mesh modification time is not increased by SMDS_Mesh::MoveNode(), so
+ * node modification time is also checked.
+ */
+//================================================================================
+
+bool SMDS_NodeCoords::IsUpToDate() const
+{
+  return ( myMesh &&
+           myMTime      == myMesh->GetMTime() &&
+           myNodesMTime == myMesh->GetNodesMTime() &&
+           Size()  == (size_t) const_cast< SMDS_Mesh* >( myMesh )->GetGrid()->GetNumberOfPoints() );
+}
+
+//================================================================================
+/*!
+ * \brief Return index of a node
+ */
+//================================================================================
+
+vtkIdType SMDS_NodeCoords::Index( const SMDS_MeshNode* node )
+{
+  return node->GetVtkID();
+}
+
+//================================================================================
+/*!
+ * \brief Return a node by index; NULL if there is no node with such index
+ */
+//================================================================================
+
+const SMDS_MeshNode* SMDS_NodeCoords::Node( vtkIdType index ) const
+{
+  return myMesh ? myMesh->FindNodeVtk( index ) : 0;
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : SMDS_NodeCoords.hxx
+//  Module : SMESH
+//
+#ifndef _SMDS_NodeCoords_HeaderFile
+#define _SMDS_NodeCoords_HeaderFile
+
+#include "SMESH_SMDS.hxx"
+
+#include <vtkType.h>
+
+#include <vector>
+
+class SMDS_Mesh;
+class SMDS_MeshNode;
+
+//------------------------------------------------------------------------------------
+/*!
+ * \brief Copy of coordinates of all nodes of a mesh stored as three contiguous
+ *        arrays (X, Y and Z) indexed by vtk ID of nodes.
+ *
+ * Unlike SMDS_MeshNode::X(), reading coordinates from SMDS_NodeCoords is thread safe,
+ * so the view can be shared by threads doing geometric computations over many nodes.
+ * Coordinates modified in the view are written back to the mesh by
+ * SMDS_Mesh::MoveNodes( const SMDS_NodeCoords& ), which updates the mesh once.
+ *
+ * The view is not updated when nodes are added, removed or moved, Load() it again
+ * if IsUpToDate() returns false. Changes of coordinates in the view do not make
+ * it out of date.
+ */
+//------------------------------------------------------------------------------------
+
+class SMDS_EXPORT SMDS_NodeCoords
+{
+public:
+
+  SMDS_NodeCoords();
+  SMDS_NodeCoords( const SMDS_Mesh* mesh );
+
+  //! Copy coordinates of nodes of a mesh
+  void Load( const SMDS_Mesh* mesh );
+
+  //! Return the mesh coordinates are loaded from
+  const SMDS_Mesh* GetMesh() const { return myMesh; }
+
+  //! Return true if neither the mesh nor its nodes have been modified since Load()
+  bool IsUpToDate() const;
+
+  //! Return number of stored points; index of a point is in [0,Size())
+  size_t Size() const { return myX.size(); }
+
+  //! Return index of a node
+  static vtkIdType Index( const SMDS_MeshNode* node );
+
+  //! Return a node by index; NULL if there is no node with such index
+  const SMDS_MeshNode* Node( vtkIdType index ) const;
+
+  double X( vtkIdType index ) const { return myX[ index ]; }
+  double Y( vtkIdType index ) const { return myY[ index ]; }
+  double Z( vtkIdType index ) const { return myZ[ index ]; }
+
+  double X( const SMDS_MeshNode* node ) const { return myX[ Index( node )]; }
+  double Y( const SMDS_MeshNode* node ) const { return myY[ Index( node )]; }
+  double Z( const SMDS_MeshNode* node ) const { return myZ[ Index( node )]; }
+
+  void GetXYZ( vtkIdType index, double xyz[3] ) const
+  {
+    xyz[0] = myX[ index ]; xyz[1] = myY[ index ]; xyz[2] = myZ[ index ];
+  }
+
+  //! Change coordinates of a point in the view only; the mesh is not changed
+  //! until SMDS_Mesh::MoveNodes( *this ), which notifies holders tracking changes
+  void SetXYZ( vtkIdType index, double x, double y, double z )
+  {
+    myX[ index ] = x; myY[ index ] = y; myZ[ index ] = z;
+  }
+
+  //! Return arrays of coordinates
+  const double* XArray() const { return myX.data(); }
+  const double* YArray() const { return myY.data(); }
+  const double* ZArray() const { return myZ.data(); }
+
+private:
+
+  const SMDS_Mesh*    myMesh;
+  vtkMTimeType        myMTime;      // mesh modification time at Load()
+  vtkMTimeType        myNodesMTime; // nodes modification time at Load()
+  std::vector<double> myX, myY, myZ;
+};
+
+#endif
@@ -27,6 +27,7 @@
 #include "chrono.hxx"
 
 #include <vtkCellArray.h>
+#include <vtkCellType.h>
 #include <vtkCellData.h>
 #include <vtkCellLinks.h>
 #include <vtkDoubleArray.h>
@@ -34,9 +35,14 @@
 #include <vtkUnsignedCharArray.h>
 #include <vtkVersionMacros.h>
 
+#include <algorithm>
 #include <list>
 #include <climits>
 
+#ifdef WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
 SMDS_CellLinks* SMDS_CellLinks::New()
 {
   return new SMDS_CellLinks();
@@ -421,9 +427,139 @@ void SMDS_UnstructuredGrid::CleanDownwardConnectivity()
   _cellIdToDownId.clear();
 }
 
+/*! Return bytes allocated for downward connectivity
+ */
+size_t SMDS_UnstructuredGrid::GetDownwardMemorySize() const
+{
+  size_t size = _cellIdToDownId.capacity() * sizeof(int) + _downTypes.capacity();
+  for (size_t i = 0; i < _downArray.size(); i++)
+    if (_downArray[i])
+      size += _downArray[i]->getMemorySize();
+  return size;
+}
+
+namespace
+{
+  const unsigned char theCellIndex = 255; //!< TDownKey::myIndex of a key of a vtk cell
+
+  //! return vtk type used to compare faces: bi-quadratic faces match quadratic ones
+  unsigned char keyType( unsigned char vtkType )
+  {
+    switch ( vtkType ) {
+    case VTK_BIQUADRATIC_TRIANGLE: return VTK_QUADRATIC_TRIANGLE;
+    case VTK_BIQUADRATIC_QUAD:     return VTK_QUADRATIC_QUAD;
+    default:;
+    }
+    return vtkType;
+  }
+
+  //! return number of corner nodes of a face or an edge
+  int nbCorners( unsigned char vtkType )
+  {
+    switch ( SMDS_Downward::getCellDimension( vtkType )) {
+    case 1: return 2;
+    case 2: return ( vtkType == VTK_TRIANGLE ||
+                     vtkType == VTK_QUADRATIC_TRIANGLE ||
+                     vtkType == VTK_BIQUADRATIC_TRIANGLE ) ? 3 : 4;
+    default:;
+    }
+    return 0;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Face or edge described by its sorted corner nodes. After sorting,
+   *        keys of a same face or edge met in different cells become neighbors.
+   *        Within a group of equal keys, keys of vtk cells go first.
+   */
+  //================================================================================
+
+  struct TDownKey
+  {
+    int           myNodes[4];  //!< sorted corner nodes, unused ones are -1
+    int           myOwner;     //!< vtk ID of a volume or a cell, or down ID of a face
+    unsigned char myType;      //!< vtk type of face or edge, see keyType()
+    unsigned char myOwnerType; //!< vtk type of the owner
+    unsigned char myIndex;     //!< index of face or edge in the owner or theCellIndex
+
+    template< typename TId >
+    void Set( const TId* nodes, unsigned char type,
+              int owner, unsigned char ownerType, unsigned char index )
+    {
+      const int nb = nbCorners( type );
+      for ( int i = 0; i < 4; ++i )
+        myNodes[i] = ( i < nb ) ? int( nodes[i] ) : -1;
+      std::sort( myNodes, myNodes + nb );
+      myType      = keyType( type );
+      myOwner     = owner;
+      myOwnerType = ownerType;
+      myIndex     = index;
+    }
+    void SetVoid()
+    {
+      myNodes[0] = myNodes[1] = myNodes[2] = myNodes[3] = -1;
+      myType = myOwnerType = VTK_EMPTY_CELL;
+      myOwner = -1;
+      myIndex = theCellIndex;
+    }
+    bool IsVoid() const { return myType == VTK_EMPTY_CELL; }
+    bool IsCell() const { return myIndex == theCellIndex; }
+    bool IsSame( const TDownKey& o ) const
+    {
+      return ( myType     == o.myType     &&
+               myNodes[0] == o.myNodes[0] && myNodes[1] == o.myNodes[1] &&
+               myNodes[2] == o.myNodes[2] && myNodes[3] == o.myNodes[3] );
+    }
+    bool IsSameOwner( const TDownKey& o ) const
+    {
+      return myOwner == o.myOwner && myOwnerType == o.myOwnerType;
+    }
+    bool operator<( const TDownKey& o ) const
+    {
+      for ( int i = 0; i < 4; ++i )
+        if ( myNodes[i] != o.myNodes[i] )
+          return myNodes[i] < o.myNodes[i];
+      if ( myType != o.myType )
+        return myType < o.myType;
+      if ( IsCell() != o.IsCell() )
+        return IsCell();
+      if ( myOwnerType != o.myOwnerType )
+        return myOwnerType < o.myOwnerType;
+      if ( myOwner != o.myOwner )
+        return myOwner < o.myOwner;
+      return myIndex < o.myIndex;
+    }
+  };
+
+  //================================================================================
+  /*!
+   * \brief Sort keys and return indices of first keys of groups of equal keys
+   *        (plus keys.size() at the end)
+   */
+  //================================================================================
+
+  void sortKeys( std::vector< TDownKey >& keys, std::vector< size_t >& groups )
+  {
+#ifdef WITH_TBB
+    tbb::parallel_sort( keys.begin(), keys.end() );
+#else
+    std::sort( keys.begin(), keys.end() );
+#endif
+    groups.clear();
+    for ( size_t i = 0; i < keys.size(); ++i )
+      if ( i == 0 || !keys[ i ].IsSame( keys[ i - 1 ]))
+        groups.push_back( i );
+    groups.push_back( keys.size() );
+  }
+}
+
 /*! Build downward connectivity: to do only when needed because heavy memory load.
  *  Downward connectivity is no more valid if vtkUnstructuredGrid is modified.
  *
+ *  Faces (resp. edges) are found by sorting keys made of sorted corner nodes of
+ *  all the facets of volumes (resp. all the edges of faces) and of vtk faces (resp. edges),
+ *  so that a face shared by several cells is identified by a group of equal keys.
+ *  Computation of keys and sorting are done in parallel if TBB is available.
  */
 void SMDS_UnstructuredGrid::BuildDownwardConnectivity(bool /*withEdges*/)
 {
@@ -457,333 +593,294 @@ void SMDS_UnstructuredGrid::BuildDownwardConnectivity(bool /*withEdges*/)
   _downArray[VTK_TRIQUADRATIC_HEXAHEDRON] = new SMDS_DownQuadHexa(this);
   _downArray[VTK_HEXAGONAL_PRISM]         = new SMDS_DownPenta(this);
 
-  // --- get detailed info of number of cells of each type, allocate SMDS_downward structures
-
-  const SMDS_MeshInfo &meshInfo = _mesh->GetMeshInfo();
-
-  int nbLinTetra  = FromSmIdType<int>(meshInfo.NbTetras  (ORDER_LINEAR));
-  int nbQuadTetra = FromSmIdType<int>(meshInfo.NbTetras  (ORDER_QUADRATIC));
-  int nbLinPyra   = FromSmIdType<int>(meshInfo.NbPyramids(ORDER_LINEAR));
-  int nbQuadPyra  = FromSmIdType<int>(meshInfo.NbPyramids(ORDER_QUADRATIC));
-  int nbLinPrism  = FromSmIdType<int>(meshInfo.NbPrisms  (ORDER_LINEAR));
-  int nbQuadPrism = FromSmIdType<int>(meshInfo.NbPrisms  (ORDER_QUADRATIC));
-  int nbLinHexa   = FromSmIdType<int>(meshInfo.NbHexas   (ORDER_LINEAR));
-  int nbQuadHexa  = FromSmIdType<int>(meshInfo.NbHexas   (ORDER_QUADRATIC));
-  int nbHexPrism  = FromSmIdType<int>(meshInfo.NbHexPrisms());
-
-  int nbLineGuess     = int((4.0 / 3.0) * nbLinTetra + 2 * nbLinPrism + 2.5 * nbLinPyra + 3 * nbLinHexa);
-  int nbQuadEdgeGuess = int((4.0 / 3.0) * nbQuadTetra + 2 * nbQuadPrism + 2.5 * nbQuadPyra + 3 * nbQuadHexa);
-  int nbLinTriaGuess  = 2 * nbLinTetra + nbLinPrism + 2 * nbLinPyra;
-  int nbQuadTriaGuess = 2 * nbQuadTetra + nbQuadPrism + 2 * nbQuadPyra;
-  int nbLinQuadGuess  = int((2.0 / 3.0) * nbLinPrism + (1.0 / 2.0) * nbLinPyra + 3 * nbLinHexa);
-  int nbQuadQuadGuess = int((2.0 / 3.0) * nbQuadPrism + (1.0 / 2.0) * nbQuadPyra + 3 * nbQuadHexa);
-
-  int GuessSize[VTK_MAXTYPE];
-  GuessSize[VTK_LINE]                    = nbLineGuess;
-  GuessSize[VTK_QUADRATIC_EDGE]          = nbQuadEdgeGuess;
-  GuessSize[VTK_TRIANGLE]                = nbLinTriaGuess;
-  GuessSize[VTK_QUADRATIC_TRIANGLE]      = nbQuadTriaGuess;
-  GuessSize[VTK_BIQUADRATIC_TRIANGLE]    = nbQuadTriaGuess;
-  GuessSize[VTK_QUAD]                    = nbLinQuadGuess;
-  GuessSize[VTK_QUADRATIC_QUAD]          = nbQuadQuadGuess;
-  GuessSize[VTK_BIQUADRATIC_QUAD]        = nbQuadQuadGuess;
-  GuessSize[VTK_TETRA]                   = nbLinTetra;
-  GuessSize[VTK_QUADRATIC_TETRA]         = nbQuadTetra;
-  GuessSize[VTK_PYRAMID]                 = nbLinPyra;
-  GuessSize[VTK_QUADRATIC_PYRAMID]       = nbQuadPyra;
-  GuessSize[VTK_WEDGE]                   = nbLinPrism;
-  GuessSize[VTK_QUADRATIC_WEDGE]         = nbQuadPrism;
-  GuessSize[VTK_HEXAHEDRON]              = nbLinHexa;
-  GuessSize[VTK_QUADRATIC_HEXAHEDRON]    = nbQuadHexa;
-  GuessSize[VTK_TRIQUADRATIC_HEXAHEDRON] = nbQuadHexa;
-  GuessSize[VTK_HEXAGONAL_PRISM]         = nbHexPrism;
-  (void)GuessSize; // unused in Release mode
-
-  _downArray[VTK_LINE]                   ->allocate(nbLineGuess);
-  _downArray[VTK_QUADRATIC_EDGE]         ->allocate(nbQuadEdgeGuess);
-  _downArray[VTK_TRIANGLE]               ->allocate(nbLinTriaGuess);
-  _downArray[VTK_QUADRATIC_TRIANGLE]     ->allocate(nbQuadTriaGuess);
-  _downArray[VTK_BIQUADRATIC_TRIANGLE]   ->allocate(nbQuadTriaGuess);
-  _downArray[VTK_QUAD]                   ->allocate(nbLinQuadGuess);
-  _downArray[VTK_QUADRATIC_QUAD]         ->allocate(nbQuadQuadGuess);
-  _downArray[VTK_BIQUADRATIC_QUAD]       ->allocate(nbQuadQuadGuess);
-  _downArray[VTK_TETRA]                  ->allocate(nbLinTetra);
-  _downArray[VTK_QUADRATIC_TETRA]        ->allocate(nbQuadTetra);
-  _downArray[VTK_PYRAMID]                ->allocate(nbLinPyra);
-  _downArray[VTK_QUADRATIC_PYRAMID]      ->allocate(nbQuadPyra);
-  _downArray[VTK_WEDGE]                  ->allocate(nbLinPrism);
-  _downArray[VTK_QUADRATIC_WEDGE]        ->allocate(nbQuadPrism);
-  _downArray[VTK_HEXAHEDRON]             ->allocate(nbLinHexa);
-  _downArray[VTK_QUADRATIC_HEXAHEDRON]   ->allocate(nbQuadHexa);
-  _downArray[VTK_TRIQUADRATIC_HEXAHEDRON]->allocate(nbQuadHexa);
-  _downArray[VTK_HEXAGONAL_PRISM]        ->allocate(nbHexPrism);
-
-  // --- iteration on vtkUnstructuredGrid cells, only faces
-  //     for each vtk face:
-  //       create a downward face entry with its downward id.
-  //       compute vtk volumes, create downward volumes entry.
-  //       mark face in downward volumes
-  //       mark volumes in downward face
-
-  MESSAGE("--- iteration on vtkUnstructuredGrid cells, only faces");CHRONO(20);
+  // --- register vtk cells in SMDS_Downward structures, in the order of vtk IDs.
+  //     Count cells of each type first to allocate SMDS_Downward structures only once
+
+  MESSAGE("--- registration of vtkUnstructuredGrid cells");CHRONO(20);
   int cellSize = this->Types->GetNumberOfTuples();
   _cellIdToDownId.resize(cellSize, -1);
 
+  std::vector<int> nbCellsOfType(VTK_MAXTYPE + 1, 0);
+  std::vector<int> volumes, faces, edges; // vtk IDs
   for (int i = 0; i < cellSize; i++)
     {
-      int vtkFaceType = this->GetCellType(i);
-      if (SMDS_Downward::getCellDimension(vtkFaceType) == 2)
+      unsigned char vtkType = this->GetCellType(i);
+      if (!_downArray[vtkType])
+        continue;
+      nbCellsOfType[vtkType]++;
+      switch (SMDS_Downward::getCellDimension(vtkType))
         {
-          int vtkFaceId = i;
-          //ASSERT(_downArray[vtkFaceType]);
-          int connFaceId = _downArray[vtkFaceType]->addCell(vtkFaceId);
-          SMDS_Down2D* downFace = static_cast<SMDS_Down2D*> (_downArray[vtkFaceType]);
-          downFace->setTempNodes(connFaceId, vtkFaceId);
-          int vols[2] = { -1, -1 };
-          int nbVolumes = downFace->computeVolumeIds(vtkFaceId, vols);
-          //MESSAGE("nbVolumes="<< nbVolumes);
-          for (int ivol = 0; ivol < nbVolumes; ivol++)
-            {
-              int vtkVolId = vols[ivol];
-              int vtkVolType = this->GetCellType(vtkVolId);
-              //ASSERT(_downArray[vtkVolType]);
-              int connVolId = _downArray[vtkVolType]->addCell(vtkVolId);
-              _downArray[vtkVolType]->addDownCell(connVolId, connFaceId, vtkFaceType);
-              _downArray[vtkFaceType]->addUpCell(connFaceId, connVolId, vtkVolType);
-              // MESSAGE("Face " << vtkFaceId << " belongs to volume " << vtkVolId);
-            }
+        case 3: volumes.push_back(i); break;
+        case 2: faces.push_back(i);   break;
+        case 1: edges.push_back(i);   break;
+        default:;
         }
     }
+  for (int vtkType = 0; vtkType <= VTK_MAXTYPE; vtkType++)
+    if (_downArray[vtkType])
+      _downArray[vtkType]->allocate(nbCellsOfType[vtkType]);
 
-  // --- iteration on vtkUnstructuredGrid cells, only volumes
-  //     for each vtk volume:
-  //       create downward volumes entry if not already done
-  //       build a temporary list of faces described with their nodes
-  //       for each face
-  //         compute the vtk volumes containing this face
-  //         check if the face is already listed in the volumes (comparison of ordered list of nodes)
-  //         if not, create a downward face entry (resizing of structure required)
-  //         (the downward faces store a temporary list of nodes to ease the comparison)
-  //         create downward volumes entry if not already done
-  //         mark volumes in downward face
-  //         mark face in downward volumes
+  for (size_t i = 0; i < volumes.size(); i++)
+    _downArray[this->GetCellType(volumes[i])]->addCell(volumes[i]);
+
+  for (size_t i = 0; i < faces.size(); i++)
+    {
+      SMDS_Down2D* downFace = static_cast<SMDS_Down2D*> (_downArray[this->GetCellType(faces[i])]);
+      downFace->setTempNodes(downFace->addCell(faces[i]), faces[i]);
+    }
+  for (size_t i = 0; i < edges.size(); i++)
+    {
+      SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[this->GetCellType(edges[i])]);
+      downEdge->setNodes(downEdge->addCell(edges[i]), edges[i]);
+    }
+
+  // --- faces: make keys of all the facets of vtk volumes and of vtk faces.
+  //     For each group of equal keys:
+  //       take the vtk face or create a downward face,
+  //       mark face in downward volumes (2 volumes max.),
+  //       mark volumes in downward face.
+  //     (the downward faces store a temporary list of nodes used to compute edges)
+  //     Note: vtkUnstructuredGrid cells are read concurrently which is safe as
+  //     connectivity is stored in vtkIdTypeArray's
 
   CHRONOSTOP(20);
-  MESSAGE("--- iteration on vtkUnstructuredGrid cells, only volumes");CHRONO(21);
+  MESSAGE("--- downward faces");CHRONO(21);
 
-  for (int i = 0; i < cellSize; i++)
-    {
-      int vtkType = this->GetCellType(i);
-      if (SMDS_Downward::getCellDimension(vtkType) == 3)
-        {
-          //CHRONO(31);
-          int vtkVolId = i;
-          // MESSAGE("vtk volume " << vtkVolId);
-          //ASSERT(_downArray[vtkType]);
-          /*int connVolId = */_downArray[vtkType]->addCell(vtkVolId);
-
-          // --- find all the faces of the volume, describe the faces by their nodes
-
-          SMDS_Down3D* downVol = static_cast<SMDS_Down3D*> (_downArray[vtkType]);
-          ListElemByNodesType facesWithNodes;
-          downVol->computeFacesWithNodes(vtkVolId, facesWithNodes);
-          // MESSAGE("vtk volume " << vtkVolId << " contains " << facesWithNodes.nbElems << " faces");
-          //CHRONOSTOP(31);
-          for (int iface = 0; iface < facesWithNodes.nbElems; iface++)
-            {
-              // --- find the volumes containing the face
-
-              //CHRONO(32);
-              int vtkFaceType = facesWithNodes.elems[iface].vtkType;
-              SMDS_Down2D* downFace = static_cast<SMDS_Down2D*> (_downArray[vtkFaceType]);
-              int vols[2] = { -1, -1 };
-              int *nodes = &facesWithNodes.elems[iface].nodeIds[0];
-              int lg = facesWithNodes.elems[iface].nbNodes;
-              int nbVolumes = downFace->computeVolumeIdsFromNodesFace(nodes, lg, vols);
-              // MESSAGE("vtk volume " << vtkVolId << " face " << iface << " belongs to " << nbVolumes << " volumes");
-
-              // --- check if face is registered in the volumes
-              //CHRONOSTOP(32);
-
-              //CHRONO(33);
-              int connFaceId = -1;
-              for (int ivol = 0; ivol < nbVolumes; ivol++)
-                {
-                  int vtkVolId2 = vols[ivol];
-                  int vtkVolType = this->GetCellType(vtkVolId2);
-                  //ASSERT(_downArray[vtkVolType]);
-                  int connVolId2 = _downArray[vtkVolType]->addCell(vtkVolId2);
-                  SMDS_Down3D* downVol2 = static_cast<SMDS_Down3D*> (_downArray[vtkVolType]);
-                  connFaceId = downVol2->FindFaceByNodes(connVolId2, facesWithNodes.elems[iface]);
-                  if (connFaceId >= 0)
-                    break; // --- face already created
-                }//CHRONOSTOP(33);
-
-              // --- if face is not registered in the volumes, create face
-
-              //CHRONO(34);
-              if (connFaceId < 0)
-                {
-                  connFaceId = _downArray[vtkFaceType]->addCell();
-                  downFace->setTempNodes(connFaceId, facesWithNodes.elems[iface]);
-                }//CHRONOSTOP(34);
+  std::vector<size_t> keyOffset(volumes.size() + 1, 0); // of facets of each volume
+  for (size_t iV = 0; iV < volumes.size(); iV++)
+    keyOffset[iV + 1] = keyOffset[iV] + _downArray[this->GetCellType(volumes[iV])]->_nbDownCells;
+  const size_t nbFacets = keyOffset.back();
 
-              // --- mark volumes in downward face and mark face in downward volumes
+  std::vector<TDownKey> keys(nbFacets + faces.size());
+  std::vector<size_t> groups;
 
-              //CHRONO(35);
-              for (int ivol = 0; ivol < nbVolumes; ivol++)
-                {
-                  int vtkVolId2 = vols[ivol];
-                  int vtkVolType = this->GetCellType(vtkVolId2);
-                  //ASSERT(_downArray[vtkVolType]);
-                  int connVolId2 = _downArray[vtkVolType]->addCell(vtkVolId2);
-                  _downArray[vtkVolType]->addDownCell(connVolId2, connFaceId, vtkFaceType);
-                  _downArray[vtkFaceType]->addUpCell(connFaceId, connVolId2, vtkVolType);
-                  // MESSAGE(" From volume " << vtkVolId << " face " << connFaceId << " belongs to volume " << vtkVolId2);
-                }//CHRONOSTOP(35);
-            }
-        }
-    }
+  SMDS_ParallelFor(volumes.size(), [&](size_t iV)
+  {
+    int vtkVolId = volumes[iV];
+    unsigned char vtkVolType = this->GetCellType(vtkVolId);
+    ListElemByNodesType facesWithNodes;
+    static_cast<SMDS_Down3D*> (_downArray[vtkVolType])->computeFacesWithNodes(vtkVolId, facesWithNodes);
+    TDownKey* volKeys = & keys[keyOffset[iV]];
+    int nbSlots = int(keyOffset[iV + 1] - keyOffset[iV]);
+    for (int iF = 0; iF < nbSlots; iF++)
+      if (iF < facesWithNodes.nbElems)
+        volKeys[iF].Set(facesWithNodes.elems[iF].nodeIds, facesWithNodes.elems[iF].vtkType,
+                        vtkVolId, vtkVolType, iF);
+      else
+        volKeys[iF].SetVoid();
+  });
+  SMDS_ParallelFor(faces.size(), [&](size_t iF)
+  {
+    vtkIdType npts = 0;
+    vtkIdType const *pts(nullptr);
+    this->GetCellPoints(faces[iF], npts, pts);
+    unsigned char vtkFaceType = this->GetCellType(faces[iF]);
+    keys[nbFacets + iF].Set(pts, vtkFaceType, faces[iF], vtkFaceType, theCellIndex);
+  });
 
-  // --- iteration on vtkUnstructuredGrid cells, only edges
-  //     for each vtk edge:
-  //       create downward edge entry
-  //       store the nodes id's in downward edge (redundant with vtkUnstructuredGrid)
-  //       find downward faces
-  //       (from vtk faces or volumes, get downward faces, they have a temporary list of nodes)
-  //       mark edge in downward faces
-  //       mark faces in downward edge
+  sortKeys(keys, groups);
 
-  CHRONOSTOP(21);
-  MESSAGE("--- iteration on vtkUnstructuredGrid cells, only edges");CHRONO(22);
+  std::vector<int> nbNewOfType(VTK_MAXTYPE + 1, 0);
+  for (size_t iG = 0; iG + 1 < groups.size(); iG++)
+    {
+      const TDownKey& key = keys[groups[iG]];
+      if (!key.IsVoid() && !key.IsCell())
+        nbNewOfType[key.myType]++;
+    }
+  for (int vtkType = 0; vtkType <= VTK_MAXTYPE; vtkType++)
+    if (nbNewOfType[vtkType])
+      _downArray[vtkType]->allocate(_downArray[vtkType]->getMaxId() + nbNewOfType[vtkType]);
 
-  for (int i = 0; i < cellSize; i++)
+  std::vector< std::pair<size_t, int> > newFaces; // key index, downward face id
+  for (size_t iG = 0; iG + 1 < groups.size(); iG++)
     {
-      int vtkEdgeType = this->GetCellType(i);
-      if (SMDS_Downward::getCellDimension(vtkEdgeType) == 1)
+      size_t iK = groups[iG], iEnd = groups[iG + 1];
+      if (keys[iK].IsVoid())
+        continue;
+      int connFaceId;
+      unsigned char vtkFaceType;
+      if (keys[iK].IsCell())
         {
-          int vtkEdgeId = i;
-          //ASSERT(_downArray[vtkEdgeType]);
-          SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkEdgeType]);
-          int connEdgeId = downEdge->addCell(vtkEdgeId);
-          downEdge->setNodes(connEdgeId, vtkEdgeId);
-          std::vector<int> vtkIds;
-          int nbVtkCells = downEdge->computeVtkCells(connEdgeId, vtkIds);
-          int downFaces[1000];
-          unsigned char downTypes[1000];
-          int nbDownFaces = downEdge->computeFaces(connEdgeId, &vtkIds[0], nbVtkCells, downFaces, downTypes);
-          int nodeSet[3];
-          int npts = downEdge->getNodeSet(connEdgeId, nodeSet);
-          for (int n = 0; n < nbDownFaces; n++)
-          {
-            // Check for duplicated edges, because multiple edges
-            // can already exist in the mesh on the same set of nodes.
-            // And if we add duplicated edge, we could not then add all
-            // required edges, as we have fixed number of slots in the face.
-            int connFaceId = downFaces[n];
-            int vtkFaceType = downTypes[n];
-            SMDS_Down2D* downFace = static_cast<SMDS_Down2D*>(_downArray[vtkFaceType]);
-            if (downFace->FindEdgeByNodesSet(connFaceId, nodeSet, vtkEdgeType) < 0)
-            {
-              downFace->addDownCell(connFaceId, connEdgeId, vtkEdgeType);
-              downEdge->addUpCell  (connEdgeId, connFaceId, vtkFaceType);
-            }
-          }
+          vtkFaceType = keys[iK].myOwnerType;
+          connFaceId  = _cellIdToDownId[keys[iK].myOwner];
+          while (iK < iEnd && keys[iK].IsCell()) // skip duplicated vtk faces
+            iK++;
+        }
+      else
+        {
+          vtkFaceType = keys[iK].myType;
+          connFaceId  = _downArray[vtkFaceType]->addCell();
+          newFaces.push_back(std::make_pair(iK, connFaceId));
+        }
+      for (int nbVol = 0; iK < iEnd && nbVol < 2; iK++, nbVol++)
+        {
+          int connVolId = _cellIdToDownId[keys[iK].myOwner];
+          _downArray[keys[iK].myOwnerType]->addDownCell(connVolId, connFaceId, vtkFaceType);
+          _downArray[vtkFaceType]->addUpCell(connFaceId, connVolId, keys[iK].myOwnerType);
         }
     }
 
-  // --- iteration on downward faces (they are all listed now)
-  //     for each downward face:
-  //       build a temporary list of edges with their ordered list of nodes
-  //       for each edge:
-  //         find all the vtk cells containing this edge
-  //         then identify all the downward faces containing the edge, from the vtk cells
-  //         check if the edge is already listed in the faces (comparison of ordered list of nodes)
-  //         if not, create a downward edge entry with the node id's
-  //         mark edge in downward faces
-  //         mark downward faces in edge (size of list unknown, to be allocated)
+  SMDS_ParallelFor(newFaces.size(), [&](size_t i)
+  {
+    const TDownKey& key = keys[newFaces[i].first];
+    ListElemByNodesType facesWithNodes;
+    static_cast<SMDS_Down3D*> (_downArray[key.myOwnerType])->computeFacesWithNodes(key.myOwner, facesWithNodes);
+    static_cast<SMDS_Down2D*> (_downArray[key.myType])->setTempNodes(newFaces[i].second,
+                                                                     facesWithNodes.elems[key.myIndex]);
+  });
+  std::vector< std::pair<size_t, int> >().swap(newFaces);
+
+  // --- edges: make keys of all the edges of downward faces (they are all listed now)
+  //     and of vtk edges. For each group of equal keys:
+  //       take the vtk edge or create a downward edge with the node id's,
+  //       mark edge in downward faces,
+  //       mark faces in downward edge, in compressed storage (number of faces is unknown)
 
-  CHRONOSTOP(22);CHRONO(23);
+  CHRONOSTOP(21);
+  MESSAGE("--- downward edges");CHRONO(22);
 
-  for (int vtkFaceType = 0; vtkFaceType < VTK_QUADRATIC_PYRAMID; vtkFaceType++)
-    {
-      if (SMDS_Downward::getCellDimension(vtkFaceType) != 2)
-        continue;
+  std::vector<unsigned char> faceTypes;
+  keyOffset.assign(1, 0); // of edges of faces of each type
+  for (int vtkType = 0; vtkType <= VTK_MAXTYPE; vtkType++)
+    if (_downArray[vtkType] && SMDS_Downward::getCellDimension(vtkType) == 2)
+      {
+        faceTypes.push_back(vtkType);
+        SMDS_Downward* downFace = _downArray[vtkType];
+        keyOffset.push_back(keyOffset.back() + size_t(downFace->getMaxId()) * downFace->_nbDownCells);
+      }
+  const size_t nbFaceEdges = keyOffset.back();
 
-      // --- find all the edges of the face, describe the edges by their nodes
+  keys.resize(nbFaceEdges + edges.size());
 
+  for (size_t iT = 0; iT < faceTypes.size(); iT++)
+    {
+      unsigned char vtkFaceType = faceTypes[iT];
       SMDS_Down2D* downFace = static_cast<SMDS_Down2D*> (_downArray[vtkFaceType]);
-      int maxId = downFace->getMaxId();
-      for (int faceId = 0; faceId < maxId; faceId++)
-        {
-          //CHRONO(40);
-          ListElemByNodesType edgesWithNodes;
-          downFace->computeEdgesWithNodes(faceId, edgesWithNodes);
-          // MESSAGE("downward face type " << vtkFaceType << " num " << faceId << " contains " << edgesWithNodes.nbElems << " edges");
+      TDownKey* typeKeys = keys.data() + keyOffset[iT];
+      int nbSlots = downFace->_nbDownCells;
+      SMDS_ParallelFor(downFace->getMaxId(), [&](size_t iF)
+      {
+        ListElemByNodesType edgesWithNodes;
+        downFace->computeEdgesWithNodes(int(iF), edgesWithNodes);
+        TDownKey* faceKeys = typeKeys + iF * nbSlots;
+        for (int iE = 0; iE < nbSlots; iE++)
+          if (iE < edgesWithNodes.nbElems)
+            faceKeys[iE].Set(edgesWithNodes.elems[iE].nodeIds, edgesWithNodes.elems[iE].vtkType,
+                             int(iF), vtkFaceType, iE);
+          else
+            faceKeys[iE].SetVoid();
+      });
+    }
+  SMDS_ParallelFor(edges.size(), [&](size_t iE)
+  {
+    vtkIdType npts = 0;
+    vtkIdType const *pts(nullptr);
+    this->GetCellPoints(edges[iE], npts, pts);
+    unsigned char vtkEdgeType = this->GetCellType(edges[iE]);
+    keys[nbFaceEdges + iE].Set(pts, vtkEdgeType, edges[iE], vtkEdgeType, theCellIndex);
+  });
 
-          //CHRONOSTOP(40);
-          for (int iedge = 0; iedge < edgesWithNodes.nbElems; iedge++)
-            {
+  sortKeys(keys, groups);
 
-              // --- check if the edge is already registered by exploration of the faces
-
-              //CHRONO(41);
-              std::vector<int> vtkIds;
-              unsigned char vtkEdgeType = edgesWithNodes.elems[iedge].vtkType;
-              int *pts = &edgesWithNodes.elems[iedge].nodeIds[0];
-              SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkEdgeType]);
-              int nbVtkCells = downEdge->computeVtkCells(pts, vtkIds);
-              //CHRONOSTOP(41);CHRONO(42);
-              int downFaces[1000];
-              unsigned char downTypes[1000];
-              int nbDownFaces = downEdge->computeFaces(pts, &vtkIds[0], nbVtkCells, downFaces, downTypes);
-              //CHRONOSTOP(42);
-
-              //CHRONO(43);
-              int connEdgeId = -1;
-              for (int idf = 0; idf < nbDownFaces; idf++)
-                {
-                  int faceId2 = downFaces[idf];
-                  int faceType = downTypes[idf];
-                  //ASSERT(_downArray[faceType]);
-                  SMDS_Down2D* downFace2 = static_cast<SMDS_Down2D*> (_downArray[faceType]);
-                  connEdgeId = downFace2->FindEdgeByNodes(faceId2, edgesWithNodes.elems[iedge]);
-                  if (connEdgeId >= 0)
-                    break; // --- edge already created
-                }//CHRONOSTOP(43);
-
-              // --- if edge is not registered in the faces, create edge
-
-              if (connEdgeId < 0)
-                {
-                  //CHRONO(44);
-                  connEdgeId = _downArray[vtkEdgeType]->addCell();
-                  downEdge->setNodes(connEdgeId, edgesWithNodes.elems[iedge].nodeIds);
-                  //CHRONOSTOP(44);
-                }
+  nbNewOfType.assign(VTK_MAXTYPE + 1, 0);
+  for (size_t iG = 0; iG + 1 < groups.size(); iG++)
+    {
+      const TDownKey& key = keys[groups[iG]];
+      if (!key.IsVoid() && !key.IsCell())
+        nbNewOfType[key.myType]++;
+    }
+  for (int vtkType = 0; vtkType <= VTK_MAXTYPE; vtkType++)
+    if (SMDS_Downward::getCellDimension(vtkType) == 1 && _downArray[vtkType])
+      {
+        SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkType]);
+        int nbEdges = downEdge->getMaxId() + nbNewOfType[vtkType];
+        downEdge->allocate(nbEdges);
+        downEdge->_upCellIndex.assign(nbEdges + 1, 0);
+      }
 
-              // --- mark faces in downward edge and mark edge in downward faces
+  // create edges, mark them in faces and count faces of each edge
 
-              //CHRONO(45);
-              for (int idf = 0; idf < nbDownFaces; idf++)
-                {
-                  int faceId2 = downFaces[idf];
-                  int faceType = downTypes[idf];
-                  //ASSERT(_downArray[faceType]);
-                  //SMDS_Down2D* downFace2 = static_cast<SMDS_Down2D*> (_downArray[faceType]);
-                  _downArray[vtkEdgeType]->addUpCell(connEdgeId, faceId2, faceType);
-                  _downArray[faceType]->addDownCell(faceId2, connEdgeId, vtkEdgeType);
-                  // MESSAGE(" From face t:" << vtkFaceType << " " << faceId <<
-                  //  " edge " << connEdgeId << " belongs to face t:" << faceType << " " << faceId2);
-                }//CHRONOSTOP(45);
-            }
+  std::vector<int> groupEdgeId(groups.size(), -1);
+  std::vector< std::pair<size_t, int> > newEdges; // key index, downward edge id
+  for (size_t iG = 0; iG + 1 < groups.size(); iG++)
+    {
+      size_t iK = groups[iG], iEnd = groups[iG + 1];
+      if (keys[iK].IsVoid())
+        continue;
+      int connEdgeId;
+      unsigned char vtkEdgeType;
+      if (keys[iK].IsCell())
+        {
+          // multiple edges can already exist in the mesh on the same set of nodes,
+          // only the first one is connected to faces
+          vtkEdgeType = keys[iK].myOwnerType;
+          connEdgeId  = _cellIdToDownId[keys[iK].myOwner];
+          while (iK < iEnd && keys[iK].IsCell())
+            iK++;
+        }
+      else
+        {
+          vtkEdgeType = keys[iK].myType;
+          connEdgeId  = _downArray[vtkEdgeType]->addCell();
+          newEdges.push_back(std::make_pair(iK, connEdgeId));
+        }
+      groupEdgeId[iG] = connEdgeId;
+      SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkEdgeType]);
+      for (size_t iFirst = iK; iK < iEnd; iK++)
+        {
+          const TDownKey& key = keys[iK];
+          if (iK > iFirst && key.IsSameOwner(keys[iK - 1]))
+            continue; // degenerated face
+          _downArray[key.myOwnerType]->addDownCell(key.myOwner, connEdgeId, vtkEdgeType);
+          downEdge->_upCellIndex[connEdgeId + 1]++;
+        }
+    }
+
+  // fill compressed storage of faces of edges
+
+  for (int vtkType = 0; vtkType <= VTK_MAXTYPE; vtkType++)
+    if (SMDS_Downward::getCellDimension(vtkType) == 1 && _downArray[vtkType])
+      {
+        SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkType]);
+        for (size_t i = 1; i < downEdge->_upCellIndex.size(); i++)
+          downEdge->_upCellIndex[i] += downEdge->_upCellIndex[i - 1];
+        downEdge->_upCellIds.resize(downEdge->_upCellIndex.back(), -1);
+        downEdge->_upCellTypes.resize(downEdge->_upCellIndex.back());
+      }
+  for (size_t iG = 0; iG + 1 < groups.size(); iG++)
+    {
+      if (groupEdgeId[iG] < 0)
+        continue;
+      size_t iK = groups[iG], iEnd = groups[iG + 1];
+      unsigned char vtkEdgeType = keys[iK].IsCell() ? keys[iK].myOwnerType : keys[iK].myType;
+      while (iK < iEnd && keys[iK].IsCell())
+        iK++;
+      SMDS_Down1D* downEdge = static_cast<SMDS_Down1D*> (_downArray[vtkEdgeType]);
+      int current = downEdge->_upCellIndex[groupEdgeId[iG]];
+      for (size_t iFirst = iK; iK < iEnd; iK++)
+        {
+          const TDownKey& key = keys[iK];
+          if (iK > iFirst && key.IsSameOwner(keys[iK - 1]))
+            continue;
+          downEdge->_upCellIds[current] = key.myOwner;
+          downEdge->_upCellTypes[current] = key.myOwnerType;
+          current++;
         }
     }
 
-  CHRONOSTOP(23);CHRONO(24);
+  SMDS_ParallelFor(newEdges.size(), [&](size_t i)
+  {
+    const TDownKey& key = keys[newEdges[i].first];
+    ListElemByNodesType edgesWithNodes;
+    static_cast<SMDS_Down2D*> (_downArray[key.myOwnerType])->computeEdgesWithNodes(key.myOwner, edgesWithNodes);
+    static_cast<SMDS_Down1D*> (_downArray[key.myType])->setNodes(newEdges[i].second,
+                                                                 edgesWithNodes.elems[key.myIndex].nodeIds);
+  });
+  std::vector<TDownKey>().swap(keys);
+
+  CHRONOSTOP(22);CHRONO(23);
 
-  // compact downward connectivity structure: adjust downward arrays size, replace std::vector<vector int>> by a single std::vector<int>
-  // 3D first then 2D and last 1D to release memory before edge upCells reorganization, (temporary memory use)
+  // compact downward connectivity structure: adjust downward arrays size
 
   for (int vtkType = VTK_QUADRATIC_PYRAMID; vtkType >= 0; vtkType--)
     {
@@ -801,11 +898,10 @@ void SMDS_UnstructuredGrid::BuildDownwardConnectivity(bool /*withEdges*/)
         {
           if (down->getMaxId())
             {
-              MESSAGE("Cells of Type " << vtkType << " : number of entities, est: "
-                  << GuessSize[vtkType] << " real: " << down->getMaxId());
+              MESSAGE("Cells of Type " << vtkType << " : number of entities " << down->getMaxId());
             }
         }
-    }CHRONOSTOP(24);CHRONOSTOP(2);
+    }CHRONOSTOP(23);CHRONOSTOP(2);
   counters::stats();
 }
 
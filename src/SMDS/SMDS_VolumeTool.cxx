@@ -370,6 +370,67 @@ static int TriQuadHexa_RE [6][9] = {  // REVERSED -> EXTERNAL
   { 0, 16,4, 15,7, 19,3, 11, 24 }};
 static int TriQuadHexa_nbN [] = { 9, 9, 9, 9, 9, 9 };
 
+// ========================================================
+// facet tables of a volume type
+// ========================================================
+struct FacetTables
+{
+  const int* myNodeIndices_F;  // facets of a forward volume
+  const int* myNodeIndices_RE; // facets of a reversed volume
+  const int* myNbNodes;        // nb of nodes of each facet
+  int        myMaxNbNodes;     // length of a row of facet tables
+  int        myNbFacets;
+  int        myTopNode;        // index of a top corner node linked to the 0-th one
+};
+
+template< int NB_FACETS, int ROW_LEN >
+static void setFacetTables( FacetTables& tables,
+                            int          (&F) [NB_FACETS][ROW_LEN],
+                            int          (&RE)[NB_FACETS][ROW_LEN],
+                            int*         nbN,
+                            int          topNode )
+{
+  tables.myNodeIndices_F  = &F [0][0];
+  tables.myNodeIndices_RE = &RE[0][0];
+  tables.myNbNodes        = nbN;
+  tables.myMaxNbNodes     = ROW_LEN;
+  tables.myNbFacets       = NB_FACETS;
+  tables.myTopNode        = topNode;
+}
+
+//================================================================================
+/*!
+ * \brief Return facet tables of a volume with a given nb of nodes
+ */
+//================================================================================
+
+static bool getFacetTables( const size_t nbVolumeNodes,
+                            const bool   ignoreCentralNodes,
+                            FacetTables& tables )
+{
+  switch ( nbVolumeNodes ) {
+  case 4:  setFacetTables( tables, Tetra_F,     Tetra_RE,     Tetra_nbN,     3 ); break;
+  case 5:  setFacetTables( tables, Pyramid_F,   Pyramid_RE,   Pyramid_nbN,   4 ); break;
+  case 6:  setFacetTables( tables, Penta_F,     Penta_RE,     Penta_nbN,     3 ); break;
+  case 8:  setFacetTables( tables, Hexa_F,      Hexa_RE,      Hexa_nbN,      4 ); break;
+  case 10: setFacetTables( tables, QuadTetra_F, QuadTetra_RE, QuadTetra_nbN, 3 ); break;
+  case 13: setFacetTables( tables, QuadPyram_F, QuadPyram_RE, QuadPyram_nbN, 4 ); break;
+  case 15:
+  case 18: setFacetTables( tables, QuadPenta_F, QuadPenta_RE, QuadPenta_nbN, 3 ); break;
+  case 20: setFacetTables( tables, QuadHexa_F,  QuadHexa_RE,  QuadHexa_nbN,  4 ); break;
+  case 27:
+    if ( ignoreCentralNodes )
+      setFacetTables( tables, QuadHexa_F,    QuadHexa_RE,    QuadHexa_nbN,    4 );
+    else
+      setFacetTables( tables, TriQuadHexa_F, TriQuadHexa_RE, TriQuadHexa_nbN, 4 );
+    break;
+  case 12: setFacetTables( tables, HexPrism_F,  HexPrism_RE,  HexPrism_nbN,  6 ); break;
+  default:
+    return false;
+  }
+  return true;
+}
+
 
 // ========================================================
 // to perform some calculations without linkage to CASCADE
@@ -381,7 +442,7 @@ struct XYZ {
   XYZ()                               { x = 0; y = 0; z = 0; }
   XYZ( double X, double Y, double Z ) { x = X; y = Y; z = Z; }
   XYZ( const XYZ& other )             { x = other.x; y = other.y; z = other.z; }
-  XYZ( const SMDS_MeshNode* n )       { x = n->X(); y = n->Y(); z = n->Z(); }
+  XYZ( const SMDS_MeshNode* n )       { n->GetXYZ( data() ); } // thread safe getting coords
   double* data()                      { return &x; }
   inline XYZ operator-( const XYZ& other );
   inline XYZ operator+( const XYZ& other );
@@ -573,9 +634,7 @@ bool SMDS_VolumeTool::Set (const SMDS_MeshElement*                  theVolume,
       int topNodeIndex = myVolume->NbCornerNodes() - 1;
       while ( !IsLinked( 0, topNodeIndex, /*ignoreMediumNodes=*/true )) --topNodeIndex;
       const SMDS_MeshNode* topNode = myVolumeNodes[ topNodeIndex ];
-      XYZ upDir (topNode->X() - botNode->X(),
-                 topNode->Y() - botNode->Y(),
-                 topNode->Z() - botNode->Z() );
+      XYZ upDir( XYZ( topNode ) - XYZ( botNode ));
       myVolForward = ( botNormal.Dot( upDir ) < 0 );
     }
     if ( !myVolForward )
@@ -1227,9 +1286,10 @@ bool SMDS_VolumeTool::GetBaryCenter(double & X, double & Y, double & Z) const
     return false;
 
   for ( size_t i = 0; i < myVolumeNodes.size(); i++ ) {
-    X += myVolumeNodes[ i ]->X();
-    Y += myVolumeNodes[ i ]->Y();
-    Z += myVolumeNodes[ i ]->Z();
+    XYZ p( myVolumeNodes[ i ]);
+    X += p.x;
+    Y += p.y;
+    Z += p.z;
   }
   X /= myVolumeNodes.size();
   Y /= myVolumeNodes.size();
@@ -1612,9 +1672,10 @@ bool SMDS_VolumeTool::GetFaceBaryCenter (int faceIndex, double & X, double & Y,
   X = Y = Z = 0.0;
   for ( int i = 0; i < myCurFace.myNbNodes; ++i )
   {
-    X += myCurFace.myNodes[i]->X() / myCurFace.myNbNodes;
-    Y += myCurFace.myNodes[i]->Y() / myCurFace.myNbNodes;
-    Z += myCurFace.myNodes[i]->Z() / myCurFace.myNbNodes;
+    XYZ p( myCurFace.myNodes[i] );
+    X += p.x / myCurFace.myNbNodes;
+    Y += p.y / myCurFace.myNbNodes;
+    Z += p.z / myCurFace.myNbNodes;
   }
   return true;
 }
@@ -2460,83 +2521,13 @@ bool SMDS_VolumeTool::setFace( int faceIndex ) const
     if ( !myAllFacesNodeIndices_F )
     {
       // choose data for an element type
-      switch ( myVolumeNodes.size() ) {
-      case 4:
-        myAllFacesNodeIndices_F  = &Tetra_F [0][0];
-        //myAllFacesNodeIndices_FE = &Tetra_F [0][0];
-        myAllFacesNodeIndices_RE = &Tetra_RE[0][0];
-        myAllFacesNbNodes        = Tetra_nbN;
-        myMaxFaceNbNodes         = sizeof(Tetra_F[0])/sizeof(Tetra_F[0][0]);
-        break;
-      case 5:
-        myAllFacesNodeIndices_F  = &Pyramid_F [0][0];
-        //myAllFacesNodeIndices_FE = &Pyramid_F [0][0];
-        myAllFacesNodeIndices_RE = &Pyramid_RE[0][0];
-        myAllFacesNbNodes        = Pyramid_nbN;
-        myMaxFaceNbNodes         = sizeof(Pyramid_F[0])/sizeof(Pyramid_F[0][0]);
-        break;
-      case 6:
-        myAllFacesNodeIndices_F  = &Penta_F [0][0];
-        //myAllFacesNodeIndices_FE = &Penta_FE[0][0];
-        myAllFacesNodeIndices_RE = &Penta_RE[0][0];
-        myAllFacesNbNodes        = Penta_nbN;
-        myMaxFaceNbNodes         = sizeof(Penta_F[0])/sizeof(Penta_F[0][0]);
-        break;
-      case 8:
-        myAllFacesNodeIndices_F  = &Hexa_F [0][0];
-        ///myAllFacesNodeIndices_FE = &Hexa_FE[0][0];
-        myAllFacesNodeIndices_RE = &Hexa_RE[0][0];
-        myAllFacesNbNodes        = Hexa_nbN;
-        myMaxFaceNbNodes         = sizeof(Hexa_F[0])/sizeof(Hexa_F[0][0]);
-        break;
-      case 10:
-        myAllFacesNodeIndices_F  = &QuadTetra_F [0][0];
-        //myAllFacesNodeIndices_FE = &QuadTetra_F [0][0];
-        myAllFacesNodeIndices_RE = &QuadTetra_RE[0][0];
-        myAllFacesNbNodes        = QuadTetra_nbN;
-        myMaxFaceNbNodes         = sizeof(QuadTetra_F[0])/sizeof(QuadTetra_F[0][0]);
-        break;
-      case 13:
-        myAllFacesNodeIndices_F  = &QuadPyram_F [0][0];
-        //myAllFacesNodeIndices_FE = &QuadPyram_F [0][0];
-        myAllFacesNodeIndices_RE = &QuadPyram_RE[0][0];
-        myAllFacesNbNodes        = QuadPyram_nbN;
-        myMaxFaceNbNodes         = sizeof(QuadPyram_F[0])/sizeof(QuadPyram_F[0][0]);
-        break;
-      case 15:
-      case 18:
-        myAllFacesNodeIndices_F  = &QuadPenta_F [0][0];
-        //myAllFacesNodeIndices_FE = &QuadPenta_FE[0][0];
-        myAllFacesNodeIndices_RE = &QuadPenta_RE[0][0];
-        myAllFacesNbNodes        = QuadPenta_nbN;
-        myMaxFaceNbNodes         = sizeof(QuadPenta_F[0])/sizeof(QuadPenta_F[0][0]);
-        break;
-      case 20:
-      case 27:
-        myAllFacesNodeIndices_F  = &QuadHexa_F [0][0];
-        //myAllFacesNodeIndices_FE = &QuadHexa_FE[0][0];
-        myAllFacesNodeIndices_RE = &QuadHexa_RE[0][0];
-        myAllFacesNbNodes        = QuadHexa_nbN;
-        myMaxFaceNbNodes         = sizeof(QuadHexa_F[0])/sizeof(QuadHexa_F[0][0]);
-        if ( !myIgnoreCentralNodes && myVolumeNodes.size() == 27 )
-        {
-          myAllFacesNodeIndices_F  = &TriQuadHexa_F [0][0];
-          //myAllFacesNodeIndices_FE = &TriQuadHexa_FE[0][0];
-          myAllFacesNodeIndices_RE = &TriQuadHexa_RE[0][0];
-          myAllFacesNbNodes        = TriQuadHexa_nbN;
-          myMaxFaceNbNodes         = sizeof(TriQuadHexa_F[0])/sizeof(TriQuadHexa_F[0][0]);
-        }
-        break;
-      case 12:
-        myAllFacesNodeIndices_F  = &HexPrism_F [0][0];
-        //myAllFacesNodeIndices_FE = &HexPrism_FE[0][0];
-        myAllFacesNodeIndices_RE = &HexPrism_RE[0][0];
-        myAllFacesNbNodes        = HexPrism_nbN;
-        myMaxFaceNbNodes         = sizeof(HexPrism_F[0])/sizeof(HexPrism_F[0][0]);
-        break;
-      default:
+      FacetTables tables;
+      if ( !getFacetTables( myVolumeNodes.size(), myIgnoreCentralNodes, tables ))
         return false;
-      }
+      myAllFacesNodeIndices_F  = tables.myNodeIndices_F;
+      myAllFacesNodeIndices_RE = tables.myNodeIndices_RE;
+      myAllFacesNbNodes        = tables.myNbNodes;
+      myMaxFaceNbNodes         = tables.myMaxNbNodes;
     }
     myCurFace.myNbNodes = myAllFacesNbNodes[ faceIndex ];
     // if ( myExternalFaces )
@@ -2698,3 +2689,146 @@ smIdType SMDS_VolumeTool::ID() const
 {
   return myVolume ? myVolume->GetID() : 0;
 }
+
+//================================================================================
+/*!
+ * \brief Initialize the iterator and set it to the first facet
+ */
+//================================================================================
+
+SMDS_VolumeFacetIterator::SMDS_VolumeFacetIterator( SMDS_ElemIteratorPtr volumes,
+                                                    const bool           ignoreCentralNodes )
+  : myVolumes( volumes ),
+    myIgnoreCentralNodes( ignoreCentralNodes ),
+    myVolume( 0 ),
+    myFacet( 0 ),
+    myNbFacets( 0 ),
+    myNbFacetNodes( 0 )
+{
+  next();
+}
+
+//================================================================================
+/*!
+ * \brief Go to the next facet
+ */
+//================================================================================
+
+void SMDS_VolumeFacetIterator::next()
+{
+  if ( myVolume && ++myFacet < myNbFacets )
+  {
+    setFacet();
+    return;
+  }
+  myVolume = 0;
+  while ( myVolumes && myVolumes->more() )
+  {
+    if ( setVolume( myVolumes->next() ))
+    {
+      myFacet = 0;
+      setFacet();
+      return;
+    }
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Take nodes of a volume and choose facet tables according to its orientation
+ */
+//================================================================================
+
+bool SMDS_VolumeFacetIterator::setVolume( const SMDS_MeshElement* volume )
+{
+  if ( !volume || volume->GetType() != SMDSAbs_Volume || volume->IsPoly() )
+    return false;
+
+  myVolumeNodes.assign( volume->begin_nodes(), volume->end_nodes() );
+
+  FacetTables tables;
+  if ( !getFacetTables( myVolumeNodes.size(), myIgnoreCentralNodes, tables ))
+    return false;
+
+  // define volume orientation as SMDS_VolumeTool::Set() does
+  bool isForward = true;
+  {
+    const int*  bottom = tables.myNodeIndices_F;
+    const int     nbN = tables.myNbNodes[0];
+    const int   iQuad = ( nbN > 6 ) ? 2 : 1;
+    XYZ p1( myVolumeNodes[ bottom[ 0*iQuad ]]);
+    XYZ p2( myVolumeNodes[ bottom[ 1*iQuad ]]);
+    XYZ p3( myVolumeNodes[ bottom[ 2*iQuad ]]);
+    XYZ aVec13( p3 - p1 );
+    XYZ botNormal = ( p2 - p1 ).Crossed( aVec13 );
+    for ( int i = 3*iQuad; i < nbN; i += iQuad )
+    {
+      XYZ aVec14( XYZ( myVolumeNodes[ bottom[ i ]]) - p1 );
+      botNormal = botNormal + aVec13.Crossed( aVec14 );
+      aVec13 = aVec14;
+    }
+    if ( botNormal.Magnitude() > std::numeric_limits<double>::min() )
+    {
+      XYZ upDir( XYZ( myVolumeNodes[ tables.myTopNode ]) - XYZ( myVolumeNodes[ 0 ]));
+      isForward = ( botNormal.Dot( upDir ) < 0 );
+    }
+  }
+
+  myVolume           = volume;
+  myNbFacets         = tables.myNbFacets;
+  myFacetNodeIndices = isForward ? tables.myNodeIndices_F : tables.myNodeIndices_RE;
+  myFacetNbNodes     = tables.myNbNodes;
+  myMaxFacetNbNodes  = tables.myMaxNbNodes;
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief Fill nodes of the current facet
+ */
+//================================================================================
+
+void SMDS_VolumeFacetIterator::setFacet()
+{
+  const int* indices = myFacetNodeIndices + myFacet * myMaxFacetNbNodes;
+  myNbFacetNodes = myFacetNbNodes[ myFacet ];
+  myFacetNodes.resize( myNbFacetNodes + 1 );
+  for ( int iNode = 0; iNode < myNbFacetNodes; iNode++ )
+    myFacetNodes[ iNode ] = myVolumeNodes[ indices[ iNode ]];
+  myFacetNodes[ myNbFacetNodes ] = myFacetNodes[ 0 ];
+}
+
+//================================================================================
+/*!
+ * \brief Fast check that only one volume is built on nodes of the current facet
+ */
+//================================================================================
+
+bool SMDS_VolumeFacetIterator::IsFree( const SMDS_MeshElement** otherVol ) const
+{
+  const bool isFree = true;
+  if ( !myVolume )
+    return !isFree;
+
+  const int  di = myVolume->IsQuadratic() ? 2 : 1;
+  const int nbN = ( myNbFacetNodes/di <= 4 ) ? 3 : myNbFacetNodes/di; // nb nodes to check
+
+  SMDS_ElemIteratorPtr eIt = myFacetNodes[0]->GetInverseElementIterator( SMDSAbs_Volume );
+  while ( eIt->more() )
+  {
+    const SMDS_MeshElement* vol = eIt->next();
+    if ( vol == myVolume )
+      continue;
+    int iN;
+    for ( iN = 1; iN < nbN; ++iN )
+      if ( vol->GetNodeIndex( myFacetNodes[ iN*di ]) < 0 )
+        break;
+    if ( iN == nbN ) // nbN nodes are shared with vol
+    {
+      if ( otherVol ) *otherVol = vol;
+      return !isFree;
+    }
+  }
+  if ( otherVol ) *otherVol = 0;
+  return isFree;
+}
@@ -31,6 +31,8 @@
 
 #include "SMESH_SMDS.hxx"
 
+#include "SMDS_ElemIterator.hxx"
+
 #include <smIdType.hxx>
 
 class SMDS_MeshElement;
@@ -300,6 +302,67 @@ class SMDS_EXPORT SMDS_VolumeTool
   mutable Facet           myCurFace;
 
 };
+
+// =========================================================================
+//
+// Iterator on facets of volumes. Facet nodes are taken from the tables
+// used by SMDS_VolumeTool and from connectivity of volumes, without
+// setting SMDS_VolumeTool to each volume. Polyhedra are skipped.
+// As by SMDS_VolumeTool, all facets have external normals.
+//
+// =========================================================================
+
+class SMDS_EXPORT SMDS_VolumeFacetIterator
+{
+ public:
+
+  SMDS_VolumeFacetIterator( SMDS_ElemIteratorPtr volumes,
+                            const bool           ignoreCentralNodes = true );
+  // Iterate on facets of volumes returned by a given iterator,
+  // e.g. SMDS_Mesh::elementGeomIterator( SMDSGeom_HEXA ).
+  // ignoreCentralNodes makes skip nodes at face centers of SMDSEntity_TriQuad_Hexa
+
+  bool more() const { return myVolume; }
+  // Return true if the iterator points to a facet
+
+  void next();
+  // Go to the next facet
+
+  const SMDS_MeshElement* Volume() const { return myVolume; }
+  // Return a volume of the current facet
+
+  int FacetIndex() const { return myFacet; }
+  // Return index of the current facet within its volume, as in SMDS_VolumeTool
+
+  int NbFacetNodes() const { return myNbFacetNodes; }
+  // Return number of nodes of the current facet
+
+  const SMDS_MeshNode** FacetNodes() const { return (const SMDS_MeshNode**) &myFacetNodes[0]; }
+  // Return the array of facet nodes; as in SMDS_VolumeTool, the array
+  // length == NbFacetNodes() + 1 and the last node == the first one
+
+  bool IsFree( const SMDS_MeshElement** otherVol = 0 ) const;
+  // Fast check that only one volume is built on nodes of the current facet,
+  // the same as SMDS_VolumeTool::IsFreeFace()
+
+ private:
+
+  bool setVolume( const SMDS_MeshElement* volume );
+  void setFacet();
+
+  SMDS_ElemIteratorPtr              myVolumes;
+  bool                              myIgnoreCentralNodes;
+  const SMDS_MeshElement*           myVolume;
+  int                               myFacet;
+  int                               myNbFacets;
+  int                               myNbFacetNodes;
+  const int*                        myFacetNodeIndices; // of facets of myVolume
+  const int*                        myFacetNbNodes;
+  int                               myMaxFacetNbNodes;
+  std::vector<const SMDS_MeshNode*> myVolumeNodes;
+  std::vector<const SMDS_MeshNode*> myFacetNodes;
+};
+
 #endif
 
 
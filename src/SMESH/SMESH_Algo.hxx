@@ -166,6 +166,18 @@ class SMESH_EXPORT SMESH_Algo : public SMESH_Hypothesis
    */
   virtual bool Compute(SMESH_Mesh & aMesh, SMESH_MesherHelper* aHelper);
 
+  /*!
+   * \brief Called before sequential computation of sub-meshes assigned to this algorithm
+    * \param aMesh - the mesh
+    * \param subMeshes - sub-meshes to be computed; empty after the computation
+    *
+    * An algorithm can prepare in advance data, which Compute() will use, for
+    * several sub-meshes at once, e.g. in parallel. Empty \a subMeshes means
+    * that prepared data is not needed any more.
+   */
+  virtual void PrepareCompute(SMESH_Mesh &                         aMesh,
+                              const std::vector< SMESH_subMesh* >& subMeshes) {}
+
   /*!
    * \brief Return true if the algorithm can mesh a given shape
    *  \param [in] aShape - shape to check
@@ -0,0 +1,482 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SMESH_ComputeProfiler.cxx
+//  Module : SMESH
+//
+#include "SMESH_ComputeProfiler.hxx"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace
+{
+  // innermost recording scope of a thread
+  thread_local SMESH_ComputeProfiler::Scope* theCurrentScope = 0;
+
+  // default max number of kept records
+  const size_t theDefaultMaxNbRecords = 100000;
+
+  //================================================================================
+  /*!
+   * \brief Return CPU time of the calling thread in seconds
+   *
+   * Stages of different sub-meshes can be computed in parallel, so CPU time of
+   * the process can't be attributed to a stage.
+   */
+  //================================================================================
+
+  double cpuTime()
+  {
+#ifdef WIN32
+    FILETIME creation, exit, kernel, user;
+    if ( !GetThreadTimes( GetCurrentThread(), &creation, &exit, &kernel, &user ))
+      return 0.;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime; k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;   u.HighPart = user.dwHighDateTime;
+    return double( k.QuadPart + u.QuadPart ) * 1e-7; // 100-nanosecond intervals
+#else
+    struct timespec t;
+    if ( clock_gettime( CLOCK_THREAD_CPUTIME_ID, &t ) != 0 )
+      return 0.;
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+#endif
+  }
+
+  //================================================================================
+  /*!
+   * \brief Write a string in quotes escaping special characters
+   */
+  //================================================================================
+
+  void writeString( std::ostream& stream, const std::string& str )
+  {
+    stream << '"';
+    for ( char c : str )
+    {
+      switch ( c ) {
+      case '"':  stream << "\\\""; break;
+      case '\\': stream << "\\\\"; break;
+      case '\n': stream << "\\n";  break;
+      case '\t': stream << "\\t";  break;
+      default:
+        if ( (unsigned char) c < 0x20 ) stream << ' ';
+        else                            stream << c;
+      }
+    }
+    stream << '"';
+  }
+
+  //================================================================================
+  /*!
+   * \brief Write record data as members of a JSON object
+   */
+  //================================================================================
+
+  void writeRecordData( std::ostream& stream, const SMESH_ComputeProfiler::Record& r )
+  {
+    stream << "\"stage\": \"" << SMESH_ComputeProfiler::StageName( r._stage ) << "\""
+           << ", \"mesh\": "        << r._meshID
+           << ", \"shape\": "       << r._shapeID
+           << ", \"shape_type\": "  << r._shapeType
+           << ", \"ok\": "          << ( r._isOK ? "true" : "false" )
+           << ", \"depth\": "       << r._depth
+           << ", \"wall_time\": "   << r._wallTime
+           << ", \"self_time\": "   << r._selfTime
+           << ", \"cpu_time\": "    << r._cpuTime
+           << ", \"cpu_usage\": "   << r.CpuUsage()
+           << ", \"nb_nodes\": "    << r._nbNodes
+           << ", \"nb_elements\": " << r._nbElements;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Write a record as a Chrome trace event
+   */
+  //================================================================================
+
+  void writeTraceEvent( std::ostream& stream, const SMESH_ComputeProfiler::Record& r )
+  {
+    stream << "{\"name\": ";
+    writeString( stream, r._shapeID > 0 ? r._name + " #" + std::to_string( r._shapeID ) : r._name );
+    stream << ", \"cat\": \"" << SMESH_ComputeProfiler::StageName( r._stage ) << "\""
+           << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << r._thread
+           << ", \"ts\": "  << r._start    * 1e6
+           << ", \"dur\": " << r._wallTime * 1e6
+           << ", \"args\": {";
+    writeRecordData( stream, r );
+    stream << "}}";
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Start recording a stage
+ */
+//================================================================================
+
+SMESH_ComputeProfiler::Scope::Scope( SMESH_ComputeProfiler* profiler,
+                                     Stage                  stage,
+                                     const char*            name,
+                                     int                    meshID,
+                                     int                    shapeID,
+                                     int                    shapeType )
+  : _profiler( profiler && profiler->IsEnabled() ? profiler : 0 ), _parent( 0 )
+{
+  if ( !_profiler )
+    return;
+  _parent = theCurrentScope;
+  theCurrentScope = this;
+
+  _record._stage      = stage;
+  _record._name       = name;
+  _record._meshID     = meshID;
+  _record._shapeID    = shapeID;
+  _record._shapeType  = shapeType;
+  _record._depth      = _parent ? _parent->_record._depth + 1 : 0;
+  _record._isOK       = false;
+  _record._nbNodes    = 0;
+  _record._nbElements = 0;
+  _record._start      = _profiler->now();
+  _cpuStart           = cpuTime();
+  _nestedTime         = 0.;
+}
+
+//================================================================================
+/*!
+ * \brief Set result of the recorded stage
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::Scope::SetResult( bool isOK, smIdType nbNodes, smIdType nbElements )
+{
+  _record._isOK       = isOK;
+  _record._nbNodes    = nbNodes;
+  _record._nbElements = nbElements;
+}
+
+//================================================================================
+/*!
+ * \brief Store the record and exclude its time from self time of the enclosing one
+ */
+//================================================================================
+
+SMESH_ComputeProfiler::Scope::~Scope()
+{
+  if ( !_profiler )
+    return;
+  _record._wallTime = _profiler->now() - _record._start;
+  _record._selfTime = _record._wallTime - _nestedTime;
+  _record._cpuTime  = cpuTime() - _cpuStart;
+  _profiler->add( _record );
+
+  if ( _parent )
+    _parent->_nestedTime += _record._wallTime;
+  theCurrentScope = _parent;
+}
+
+//================================================================================
+/*!
+ * \brief Constructor; enable the profiler if SMESH_COMPUTE_PROFILE is set
+ */
+//================================================================================
+
+SMESH_ComputeProfiler::SMESH_ComputeProfiler()
+  : _isEnabled( false ), _isTraceStarted( false ), _nbTraceEvents( 0 ),
+    _origin( std::chrono::steady_clock::now() ),
+    _maxNbRecords( theDefaultMaxNbRecords ), _nbRemovedRecords( 0 )
+{
+  if ( const char* env = getenv( "SMESH_COMPUTE_PROFILE" ))
+    if ( env[0] )
+    {
+      _isEnabled = true;
+      if ( std::string( env ) != "1" )
+        _traceFile = env;
+    }
+}
+
+//================================================================================
+/*!
+ * \brief Remove all records and totals
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::Clear()
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  _records.clear();
+  _totals.clear();
+  _threads.clear();
+  _nbRemovedRecords = 0;
+  _origin = std::chrono::steady_clock::now();
+}
+
+//================================================================================
+/*!
+ * \brief Set max number of kept records and remove older ones exceeding it
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::SetMaxNbRecords( size_t nb )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  _maxNbRecords = nb;
+  while ( _records.size() > _maxNbRecords )
+  {
+    _records.pop_front();
+    ++_nbRemovedRecords;
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Return a copy of records
+ */
+//================================================================================
+
+std::vector< SMESH_ComputeProfiler::Record > SMESH_ComputeProfiler::GetRecords() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return std::vector< Record >( _records.begin(), _records.end() );
+}
+
+//================================================================================
+/*!
+ * \brief Return totals of all records since Clear(), including removed ones
+ */
+//================================================================================
+
+SMESH_ComputeProfiler::TTotals SMESH_ComputeProfiler::GetTotals() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _totals;
+}
+
+//================================================================================
+/*!
+ * \brief Return number of records removed since Clear() to keep GetMaxNbRecords() ones
+ */
+//================================================================================
+
+size_t SMESH_ComputeProfiler::GetNbRemovedRecords() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _nbRemovedRecords;
+}
+
+//================================================================================
+/*!
+ * \brief Store a record, add it to totals and remove the oldest record if
+ *        there are too many
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::add( Record& record )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  auto id2index = _threads.insert( std::make_pair( std::this_thread::get_id(), (int)_threads.size() ));
+  record._thread = id2index.first->second;
+
+  Total& t = _totals[ std::make_pair( record._stage, record._name )];
+  t._nb         += 1;
+  t._wallTime   += record._wallTime;
+  t._selfTime   += record._selfTime;
+  t._cpuTime    += record._cpuTime;
+  t._nbNodes    += record._nbNodes;
+  t._nbElements += record._nbElements;
+
+  if ( _maxNbRecords == 0 )
+  {
+    ++_nbRemovedRecords;
+    return;
+  }
+  if ( _records.size() >= _maxNbRecords )
+  {
+    _records.pop_front();
+    ++_nbRemovedRecords;
+  }
+  _records.push_back( record );
+}
+
+//================================================================================
+/*!
+ * \brief Return wall time since the profiler creation, in seconds
+ */
+//================================================================================
+
+double SMESH_ComputeProfiler::now() const
+{
+  return std::chrono::duration< double >( std::chrono::steady_clock::now() - _origin ).count();
+}
+
+//================================================================================
+/*!
+ * \brief Return a name of a stage
+ */
+//================================================================================
+
+const char* SMESH_ComputeProfiler::StageName( Stage stage )
+{
+  switch ( stage ) {
+  case CHECK_HYPOTHESIS: return "CheckHypothesis";
+  case COMPUTE:          return "Compute";
+  case EVALUATE:         return "Evaluate";
+  case EXPORT:           return "Export";
+  default:;
+  }
+  return "";
+}
+
+//================================================================================
+/*!
+ * \brief Write records and totals per stage and algorithm in JSON format
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::WriteJSON( std::ostream& stream ) const
+{
+  std::vector< Record > records;
+  TTotals               totals;
+  size_t                nbRemoved;
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+    records.assign( _records.begin(), _records.end() );
+    totals    = _totals;
+    nbRemoved = _nbRemovedRecords;
+  }
+
+  std::streamsize precision = stream.precision( 9 );
+
+  stream << "{\n  \"records\": [";
+  for ( size_t i = 0; i < records.size(); ++i )
+  {
+    const Record& r = records[i];
+    stream << ( i ? ",\n    {" : "\n    {" ) << "\"name\": ";
+    writeString( stream, r._name );
+    stream << ", \"start\": " << r._start << ", \"thread\": " << r._thread << ", ";
+    writeRecordData( stream, r );
+    stream << "}";
+  }
+  stream << "\n  ],\n  \"nb_removed_records\": " << nbRemoved << ",\n  \"totals\": [";
+  for ( auto t = totals.begin(); t != totals.end(); ++t )
+  {
+    stream << ( t == totals.begin() ? "\n    {" : ",\n    {" )
+           << "\"stage\": \"" << StageName( t->first.first ) << "\", \"name\": ";
+    writeString( stream, t->first.second );
+    stream << ", \"count\": "       << t->second._nb
+           << ", \"wall_time\": "   << t->second._wallTime
+           << ", \"self_time\": "   << t->second._selfTime
+           << ", \"cpu_time\": "    << t->second._cpuTime
+           << ", \"nb_nodes\": "    << t->second._nbNodes
+           << ", \"nb_elements\": " << t->second._nbElements << "}";
+  }
+  stream << "\n  ]\n}\n";
+
+  stream.precision( precision );
+}
+
+//================================================================================
+/*!
+ * \brief Write records in Chrome trace event format
+ */
+//================================================================================
+
+void SMESH_ComputeProfiler::WriteChromeTrace( std::ostream& stream ) const
+{
+  std::vector< Record > records = GetRecords();
+
+  std::streamsize precision = stream.precision( 15 );
+
+  stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for ( size_t i = 0; i < records.size(); ++i )
+  {
+    stream << ( i ? ",\n" : "\n" );
+    writeTraceEvent( stream, records[i] );
+  }
+  stream << "\n]}\n";
+
+  stream.precision( precision );
+}
+
+//================================================================================
+/*!
+ * \brief Write records to a file
+ *  \param [in] fileName - file to write
+ *  \param [in] chromeTrace - if true, use Chrome trace format, else JSON
+ *  \return bool - false if the file can't be opened
+ */
+//================================================================================
+
+bool SMESH_ComputeProfiler::Write( const std::string& fileName, bool chromeTrace ) const
+{
+  std::ofstream file( fileName.c_str() );
+  if ( !file )
+    return false;
+  if ( chromeTrace )
+    WriteChromeTrace( file );
+  else
+    WriteJSON( file );
+  return file.good();
+}
+
+//================================================================================
+/*!
+ * \brief Append records to a file in Chrome trace array format and remove them
+ *  \param [in] fileName - file to write
+ *  \return bool - false if the file can't be opened
+ *
+ * The file is re-written at the first call. The closing bracket is not written,
+ * which is allowed by the array format, so that next records can be appended.
+ */
+//================================================================================
+
+bool SMESH_ComputeProfiler::AppendChromeTrace( const std::string& fileName )
+{
+  std::ofstream file( fileName.c_str(), _isTraceStarted ? std::ios::app : std::ios::trunc );
+  if ( !file )
+    return false;
+
+  std::deque< Record > records;
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+    records.swap( _records );
+  }
+
+  file.precision( 15 );
+  if ( !_isTraceStarted )
+    file << "[";
+  _isTraceStarted = true;
+
+  for ( const Record& r : records )
+  {
+    file << ( _nbTraceEvents++ ? ",\n" : "\n" );
+    writeTraceEvent( file, r );
+  }
+  file.flush();
+  return file.good();
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SMESH_ComputeProfiler.hxx
+//  Module : SMESH
+//
+#ifndef _SMESH_COMPUTEPROFILER_HXX_
+#define _SMESH_COMPUTEPROFILER_HXX_
+
+#include "SMESH_SMESH.hxx"
+
+#include <smIdType.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//=======================================================================
+/*!
+ * \brief Collects timing of mesh computation stages: algorithm compute and
+ *        evaluation, hypothesis checks, export
+ *
+ * Recording is off by default. It is switched on either by SetEnabled() or by
+ * SMESH_COMPUTE_PROFILE environment variable; if the variable value is not "1",
+ * it is a file where records are appended in Chrome trace format
+ * (chrome://tracing, Perfetto) and then removed after each call of
+ * SMESH_Gen::Compute(). Else at most GetMaxNbRecords() latest records are kept
+ * till Clear(); totals per stage and algorithm include all records anyway.
+ *
+ * Stages can be nested, e.g. an algorithm computing sub-meshes of its shape;
+ * wall time of a stage includes nested stages, self time does not.
+ * CPU time is that of the thread running the stage, so it does not include
+ * work of threads the stage runs in parallel.
+ */
+//=======================================================================
+
+class SMESH_EXPORT SMESH_ComputeProfiler
+{
+public:
+
+  enum Stage { CHECK_HYPOTHESIS, COMPUTE, EVALUATE, EXPORT, NB_STAGES };
+
+  struct Record
+  {
+    Stage       _stage;
+    std::string _name;       // algorithm name or export format
+    int         _meshID;
+    int         _shapeID;    // 0 if not relevant
+    int         _shapeType;  // TopAbs_ShapeEnum, -1 if not relevant
+    int         _thread;     // index of a thread the stage is run by
+    int         _depth;      // number of enclosing stages run by the same thread
+    bool        _isOK;
+    double      _start;      // wall time since the profiler creation or Clear(), in seconds
+    double      _wallTime;   // in seconds
+    double      _selfTime;   // wall time excluding nested stages, in seconds
+    double      _cpuTime;    // CPU time of the thread running the stage, in seconds
+    smIdType    _nbNodes;    // produced nodes
+    smIdType    _nbElements; // produced elements
+
+    //! Ratio of CPU and wall times of the thread, less than 1 if the thread waits
+    double CpuUsage() const { return _wallTime > 0 ? _cpuTime / _wallTime : 0.; }
+  };
+
+  //! Sums of records of a stage of an algorithm
+  struct Total
+  {
+    int      _nb = 0;
+    double   _wallTime = 0, _selfTime = 0, _cpuTime = 0;
+    smIdType _nbNodes = 0, _nbElements = 0;
+  };
+  typedef std::map< std::pair< Stage, std::string >, Total > TTotals;
+
+  //! Records a stage from construction till destruction, if the profiler is enabled
+  class SMESH_EXPORT Scope
+  {
+  public:
+    Scope( SMESH_ComputeProfiler* profiler,
+           Stage                  stage,
+           const char*            name,
+           int                    meshID    = -1,
+           int                    shapeID   = 0,
+           int                    shapeType = -1 );
+    ~Scope();
+
+    void SetResult( bool isOK, smIdType nbNodes = 0, smIdType nbElements = 0 );
+
+  private:
+    SMESH_ComputeProfiler* _profiler;
+    Scope*                 _parent;    // enclosing scope of the same thread
+    Record                 _record;
+    double                 _cpuStart;
+    double                 _nestedTime; // wall time of nested scopes
+  };
+
+  SMESH_ComputeProfiler();
+
+  void SetEnabled( bool toEnable ) { _isEnabled = toEnable; }
+  bool IsEnabled() const { return _isEnabled; }
+
+  //! Remove all records and totals
+  void Clear();
+
+  //! Set max number of kept records; older records are removed
+  void   SetMaxNbRecords( size_t nb );
+  size_t GetMaxNbRecords() const { return _maxNbRecords; }
+
+  std::vector< Record > GetRecords() const;
+
+  //! Return totals of all records since Clear(), including removed ones
+  TTotals GetTotals() const;
+
+  //! Return number of records removed since Clear() to keep GetMaxNbRecords() ones
+  size_t GetNbRemovedRecords() const;
+
+  //! Write records and totals per algorithm in JSON format
+  void WriteJSON( std::ostream& stream ) const;
+
+  //! Write records in Chrome trace event format
+  void WriteChromeTrace( std::ostream& stream ) const;
+
+  //! Write records to a file; return false if the file can't be opened
+  bool Write( const std::string& fileName, bool chromeTrace ) const;
+
+  //! Append records to a Chrome trace file and remove them;
+  //! the file is re-written at the first call
+  bool AppendChromeTrace( const std::string& fileName );
+
+  //! Return a file defined by SMESH_COMPUTE_PROFILE environment variable
+  const std::string& GetTraceFile() const { return _traceFile; }
+
+  static const char* StageName( Stage stage );
+
+private:
+
+  void   add( Record& record );
+  double now() const;
+
+  std::atomic< bool >                   _isEnabled;
+  bool                                  _isTraceStarted; // AppendChromeTrace() called
+  size_t                                _nbTraceEvents;  // written by AppendChromeTrace()
+  std::string                           _traceFile;
+  std::chrono::steady_clock::time_point _origin;
+  std::deque< Record >                  _records;
+  size_t                                _maxNbRecords;
+  size_t                                _nbRemovedRecords; // to keep _maxNbRecords
+  TTotals                               _totals;
+  std::map< std::thread::id, int >      _threads;
+  mutable std::mutex                    _mutex;
+};
+
+#endif
@@ -31,10 +31,25 @@
 
 #include "SMESH_Mesh.hxx"
 #include "SMESH_Gen.hxx"
+#include "SMESH_MeshEditor.hxx"
+#include "SMESH_MesherHelper.hxx"
+#include "SMDS_MeshCell.hxx"
+#include "SMESHDS_Mesh.hxx"
+#include "SMESHDS_SubMesh.hxx"
 
 #include <MEDFileMesh.hxx>
 #include <MEDCouplingUMesh.hxx>
 
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <Utils_SALOME_Exception.hxx>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
 using namespace MEDCoupling;
 
 /**
@@ -103,3 +118,214 @@ int SMESH_DriverMesh::exportMesh(const std::string mesh_file, SMESH_Mesh& aMesh,
                   );
   return true;
 }
+
+namespace
+{
+  // header of a file of a solid boundary
+  const char   theBoundaryMagic[8] = { 'S','M','E','S','H','B','N','D' };
+  const int    theBoundaryVersion  = 1;
+
+  template< typename T > void writeValue( std::ofstream& file, const T& value )
+  {
+    file.write( (const char*) & value, sizeof( T ));
+  }
+  template< typename T > void writeArray( std::ofstream& file, const std::vector< T >& values )
+  {
+    file.write( (const char*) values.data(), values.size() * sizeof( T ));
+  }
+  template< typename T > void readValue( std::ifstream& file, T& value )
+  {
+    file.read( (char*) & value, sizeof( T ));
+  }
+  template< typename T > void readArray( std::ifstream& file, std::vector< T >& values, size_t size )
+  {
+    values.resize( size );
+    file.read( (char*) values.data(), size * sizeof( T ));
+  }
+  // number of bytes between the current position and the end of a file
+  size_t remainingSize( std::ifstream& file )
+  {
+    const std::streampos pos = file.tellg();
+    file.seekg( 0, std::ios::end );
+    const std::streampos end = file.tellg();
+    file.seekg( pos );
+    return ( pos < 0 || end < pos ) ? 0 : size_t( end - pos );
+  }
+}
+
+/**
+ * @brief Export the mesh of faces bounding a solid into a compact binary file.
+ * Face elements are oriented so that their normals point outside the solid.
+ *
+ * The file contains:
+ *  - header: "SMESHBND", version, sizeof(smIdType)
+ *  - number of nodes, node IDs, node coordinates (3 per node)
+ *  - number of faces, face IDs, number of nodes per face, face flags
+ *    (1 - polygon, 2 - quadratic), IDs of face nodes
+ *
+ * @param mesh_file the file
+ * @param aMesh the object
+ * @param aSolid the solid whose boundary is exported
+ *
+ * @return error code
+ */
+int SMESH_DriverMesh::exportSolidBoundary(const std::string mesh_file, SMESH_Mesh& aMesh, const TopoDS_Shape& aSolid){
+
+  MESSAGE("Exporting solid boundary to " << mesh_file);
+  SMESHDS_Mesh*      meshDS = aMesh.GetMeshDS();
+  SMESH_MesherHelper helper( aMesh );
+
+  std::vector< smIdType > faceIDs, nbFaceNodes, faceNodeIDs;
+  std::vector< char >     faceFlags; // poly | quadratic << 1
+  std::map< smIdType, const SMDS_MeshNode* > nodes;
+
+  std::vector< const SMDS_MeshNode* > elemNodes;
+  for ( TopExp_Explorer faceExp( aSolid, TopAbs_FACE ); faceExp.More(); faceExp.Next() )
+  {
+    const TopoDS_Face&  face = TopoDS::Face( faceExp.Current() );
+    SMESHDS_SubMesh* faceSM = meshDS->MeshElements( face );
+    if ( !faceSM )
+      continue;
+    const bool isReversed = helper.IsReversedSubMesh( face );
+
+    for ( SMDS_ElemIteratorPtr eIt = faceSM->GetElements(); eIt->more(); )
+    {
+      const SMDS_MeshElement* elem = eIt->next();
+      elemNodes.assign( elem->begin_nodes(), elem->end_nodes() );
+      if ( isReversed )
+        SMDS_MeshCell::applyInterlace
+          ( SMDS_MeshCell::reverseSmdsOrder( elem->GetEntityType(), elemNodes.size() ), elemNodes );
+
+      faceIDs.push_back( elem->GetID() );
+      nbFaceNodes.push_back( elemNodes.size() );
+      faceFlags.push_back( char( elem->IsPoly() ) | char( elem->IsQuadratic() ) << 1 );
+      for ( const SMDS_MeshNode* node : elemNodes )
+      {
+        faceNodeIDs.push_back( node->GetID() );
+        nodes.insert( std::make_pair( node->GetID(), node ));
+      }
+    }
+  }
+
+  std::vector< smIdType > nodeIDs;
+  std::vector< double >   nodeCoords;
+  nodeIDs.reserve( nodes.size() );
+  nodeCoords.reserve( 3 * nodes.size() );
+  for ( auto& id2node : nodes )
+  {
+    double xyz[3];
+    id2node.second->GetXYZ( xyz );
+    nodeIDs.push_back( id2node.first );
+    nodeCoords.insert( nodeCoords.end(), xyz, xyz + 3 );
+  }
+
+  std::ofstream file( mesh_file, std::ios::binary );
+  if ( !file )
+    throw SALOME_Exception("Writing error for " + mesh_file);
+
+  file.write( theBoundaryMagic, sizeof( theBoundaryMagic ));
+  writeValue( file, theBoundaryVersion );
+  writeValue( file, int( sizeof( smIdType )));
+
+  writeValue( file, smIdType( nodeIDs.size() ));
+  writeArray( file, nodeIDs );
+  writeArray( file, nodeCoords );
+
+  writeValue( file, smIdType( faceIDs.size() ));
+  writeArray( file, faceIDs );
+  writeArray( file, nbFaceNodes );
+  writeArray( file, faceFlags );
+  writeArray( file, faceNodeIDs );
+
+  if ( !file )
+    throw SALOME_Exception("Writing error for " + mesh_file);
+
+  return true;
+}
+
+/**
+ * @brief Import nodes and faces written by exportSolidBoundary() into a SMESH_Mesh.
+ * IDs of nodes and faces are preserved.
+ * Counts read from the file are checked against the file size before any allocation;
+ * a SALOME_Exception is raised if the file is corrupted or if a node or a face can't be added.
+ *
+ * @param mesh_file the file
+ * @param aMesh the object
+ *
+ * @return error code
+ */
+int SMESH_DriverMesh::importSolidBoundary(const std::string mesh_file, SMESH_Mesh& aMesh){
+
+  MESSAGE("Importing solid boundary from " << mesh_file);
+  std::ifstream file( mesh_file, std::ios::binary );
+
+  char magic[ sizeof( theBoundaryMagic )];
+  int  version = 0, idSize = 0;
+  file.read( magic, sizeof( magic ));
+  readValue( file, version );
+  readValue( file, idSize );
+  if ( !file ||
+       strncmp( magic, theBoundaryMagic, sizeof( magic )) != 0 ||
+       version != theBoundaryVersion ||
+       idSize  != int( sizeof( smIdType )))
+    throw SALOME_Exception("Wrong format of " + mesh_file);
+
+  // counts come from the file; check them against the size of data left in the file
+  // before allocating anything
+  const std::string wrongFormat = "Wrong format of " + mesh_file;
+  smIdType nbNodes = 0, nbFaces = 0;
+  std::vector< smIdType > nodeIDs, faceIDs, nbFaceNodes, faceNodeIDs;
+  std::vector< double >   nodeCoords;
+  std::vector< char >     faceFlags;
+
+  readValue( file, nbNodes );
+  if ( !file || nbNodes < 0 ||
+       remainingSize( file ) / ( sizeof( smIdType ) + 3 * sizeof( double )) < size_t( nbNodes ))
+    throw SALOME_Exception( wrongFormat );
+  readArray( file, nodeIDs, nbNodes );
+  readArray( file, nodeCoords, 3 * nbNodes );
+
+  readValue( file, nbFaces );
+  if ( !file || nbFaces < 0 ||
+       remainingSize( file ) / ( 2 * sizeof( smIdType ) + sizeof( char )) < size_t( nbFaces ))
+    throw SALOME_Exception( wrongFormat );
+  readArray( file, faceIDs, nbFaces );
+  readArray( file, nbFaceNodes, nbFaces );
+  readArray( file, faceFlags, nbFaces );
+  if ( !file )
+    throw SALOME_Exception("Reading error for " + mesh_file);
+
+  const size_t maxNbFaceNodeIDs = remainingSize( file ) / sizeof( smIdType );
+  size_t nbFaceNodeIDs = 0;
+  for ( smIdType i = 0; i < nbFaces; ++i )
+  {
+    if ( nbFaceNodes[ i ] < 3 || size_t( nbFaceNodes[ i ]) > maxNbFaceNodeIDs - nbFaceNodeIDs ||
+         faceFlags[ i ] & ~3 )
+      throw SALOME_Exception( wrongFormat );
+    nbFaceNodeIDs += nbFaceNodes[ i ];
+  }
+  readArray( file, faceNodeIDs, nbFaceNodeIDs );
+
+  if ( !file )
+    throw SALOME_Exception("Reading error for " + mesh_file);
+
+  SMESHDS_Mesh* meshDS = aMesh.GetMeshDS();
+  for ( smIdType i = 0; i < nbNodes; ++i )
+    if ( nodeIDs[ i ] < 1 ||
+         !meshDS->AddNodeWithID( nodeCoords[ 3 * i ], nodeCoords[ 3 * i + 1 ], nodeCoords[ 3 * i + 2 ],
+                                 nodeIDs[ i ]))
+      throw SALOME_Exception( wrongFormat + ": can't add node #" + std::to_string( nodeIDs[ i ]));
+
+  SMESH_MeshEditor editor( &aMesh );
+  SMESH_MeshEditor::ElemFeatures faceType;
+  std::vector< smIdType > elemNodeIDs;
+  for ( smIdType i = 0, iNode = 0; i < nbFaces; iNode += nbFaceNodes[ i++ ])
+  {
+    elemNodeIDs.assign( faceNodeIDs.begin() + iNode,
+                        faceNodeIDs.begin() + iNode + nbFaceNodes[ i ]);
+    faceType.Init( SMDSAbs_Face, faceFlags[ i ] & 1, faceFlags[ i ] & 2 ).SetID( faceIDs[ i ]);
+    if ( faceIDs[ i ] < 1 || !editor.AddElement( elemNodeIDs, faceType ))
+      throw SALOME_Exception( wrongFormat + ": can't add face #" + std::to_string( faceIDs[ i ]));
+  }
+  return true;
+}
@@ -33,6 +33,7 @@
 #include "SMESH_SMESH.hxx"
 
 class SMESH_Mesh;
+class TopoDS_Shape;
 class SMESH_EXPORT SMESH_DriverMesh{
   public:
     static bool diffMEDFile(const std::string mesh_file1,
@@ -43,5 +44,13 @@ class SMESH_EXPORT SMESH_DriverMesh{
     static int exportMesh(const std::string mesh_file,
                           SMESH_Mesh& aMesh,
                           const std::string meshName);
+    // Exchange of a solid boundary with an out-of-process mesher. Not used by
+    // SMESH_Gen::parallelComputeSubMeshes() yet, which exports a MED file for runners
+    // of mesher plugins; these runners have to learn reading the boundary file first.
+    static int exportSolidBoundary(const std::string mesh_file,
+                                   SMESH_Mesh& aMesh,
+                                   const TopoDS_Shape& aSolid);
+    static int importSolidBoundary(const std::string mesh_file,
+                                   SMESH_Mesh& aMesh);
 };
 #endif
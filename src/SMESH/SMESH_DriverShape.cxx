@@ -36,6 +36,7 @@
 // Brep include
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
+#include <BinTools.hxx>
 
 //Occ include
 #include <TopoDS.hxx>
@@ -139,6 +140,42 @@ int exportBREPShape(const std::string shape_file, const TopoDS_Shape& aShape){
   return false;
 }
 
+/**
+ * @brief Import the content of a binary shape file (BinTools) into a TopDS_Shape object
+ *
+ * @param shape_file the shape file
+ * @param aShape the object
+ *
+ * @return error code
+ */
+int importBinShape(const std::string shape_file, TopoDS_Shape& aShape){
+
+  MESSAGE("Importing binary shape from " << shape_file);
+  if ( !BinTools::Read(aShape, shape_file.c_str()) ){
+    throw SALOME_Exception("Reading error for " + shape_file);
+  }
+  return false;
+}
+
+/**
+ * @brief Export the content of a TopoDS_Shape into a binary shape file (BinTools).
+ * Much faster to write and read than BREP. SMESH_Gen still writes BREP files for
+ * mesher runners as they do not read .bin files yet
+ *
+ * @param shape_file the shape file
+ * @param aShape the object
+ *
+ * @return error code
+ */
+int exportBinShape(const std::string shape_file, const TopoDS_Shape& aShape){
+
+  MESSAGE("Exporting binary shape to " << shape_file);
+  if ( !BinTools::Write(aShape, shape_file.c_str()) ){
+    throw SALOME_Exception("Writing error for " + shape_file);
+  }
+  return false;
+}
+
 /**
  * @brief Import the content of a shape file into a TopDS_Shape object
  *
@@ -153,6 +190,8 @@ int SMESH_DriverShape::importShape(const std::string shape_file, TopoDS_Shape& a
   boost::algorithm::to_lower(type);
   if (type == ".brep"){
     return importBREPShape(shape_file, aShape);
+  } else if (type == ".bin"){
+    return importBinShape(shape_file, aShape);
   } else if (type == ".step"){
     return importSTEPShape(shape_file, aShape);
   } else {
@@ -177,6 +216,8 @@ int SMESH_DriverShape::exportShape(const std::string shape_file, const TopoDS_Sh
   boost::algorithm::to_lower(type);
   if (type == ".brep"){
     return exportBREPShape(shape_file, aShape);
+  } else if (type == ".bin"){
+    return exportBinShape(shape_file, aShape);
   } else if (type == ".step"){
     return exportSTEPShape(shape_file, aShape);
   } else {
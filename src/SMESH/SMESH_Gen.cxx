@@ -216,11 +216,26 @@ bool SMESH_Gen::sequentialComputeSubMeshes(
   SMESH_subMeshIteratorPtr smIt;
   SMESH_subMesh *shapeSM = aMesh.GetSubMesh(aShape);
 
+  std::vector< SMESH_subMesh* > subMeshes;
   smIt = shapeSM->getDependsOnIterator(includeSelf, !complexShapeFirst);
   while ( smIt->more() )
+    subMeshes.push_back( smIt->next() );
+
+  // let algorithms prepare computation of all their sub-meshes at once
+  std::map< SMESH_Algo*, std::vector< SMESH_subMesh* > > algo2subMeshes;
+  if ( computeEvent == SMESH_subMesh::COMPUTE )
   {
-    SMESH_subMesh* smToCompute = smIt->next();
+    for ( SMESH_subMesh* sm : subMeshes )
+      if ( sm->GetComputeState() == SMESH_subMesh::READY_TO_COMPUTE &&
+           ( !aShapesId || SMESH_Gen::GetShapeDim( sm->GetSubShape() ) <= (int)aDim ))
+        if ( SMESH_Algo* algo = sm->GetAlgo() )
+          algo2subMeshes[ algo ].push_back( sm );
+    for ( auto& algo2sm : algo2subMeshes )
+      algo2sm.first->PrepareCompute( aMesh, algo2sm.second );
+  }
 
+  for ( SMESH_subMesh* smToCompute : subMeshes )
+  {
     // do not mesh vertices of a pseudo shape
     const TopoDS_Shape&        shape = smToCompute->GetSubShape();
     const TopAbs_ShapeEnum shapeType = shape.ShapeType();
@@ -239,7 +254,10 @@ bool SMESH_Gen::sequentialComputeSubMeshes(
     if (smToCompute->GetComputeState() == SMESH_subMesh::READY_TO_COMPUTE)
     {
       if (_compute_canceled)
-        return false;
+      {
+        ret = false;
+        break; // let algorithms release data prepared by PrepareCompute()
+      }
       smToCompute->SetAllowedSubShapes( fillAllowed( shapeSM, aShapeOnly, allowedSubShapes ));
       setCurrentSubMesh( smToCompute );
       smToCompute->ComputeStateEngine( computeEvent );
@@ -254,6 +272,10 @@ bool SMESH_Gen::sequentialComputeSubMeshes(
     else if ( aShapesId )
       aShapesId->insert( smToCompute->GetId() );
   }
+
+  for ( auto& algo2sm : algo2subMeshes )
+    algo2sm.first->PrepareCompute( aMesh, std::vector< SMESH_subMesh* >() );
+
   //aMesh.GetMeshDS()->Modified();
   return ret;
 
@@ -409,6 +431,8 @@ bool SMESH_Gen::parallelComputeSubMeshes(
       if(file_name != "")
       {
         fs::path mesh_file = fs::path(aParMesh.GetTmpFolder()) / fs::path(file_name);
+        // runners of mesher plugins read a MED file; they are to be switched to
+        // SMESH_DriverMesh::exportSolidBoundary() written per solid
 	      SMESH_DriverMesh::exportMesh(mesh_file.string(), aMesh, "MESH");
         if (aParMesh.GetParallelismMethod() == ParallelismMethod::MultiNode) {
           this->send_mesh(aMesh, mesh_file.string());
@@ -748,6 +772,10 @@ bool SMESH_Gen::Compute(SMESH_Mesh &                aMesh,
     aMesh.GetMeshDS()->Modified();
     aMesh.GetMeshDS()->CompactMesh();
   }
+
+  if ( !_profiler.GetTraceFile().empty() )
+    _profiler.AppendChromeTrace( _profiler.GetTraceFile() );
+
   return ret;
 }
 
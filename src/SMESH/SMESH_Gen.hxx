@@ -34,6 +34,7 @@
 
 #include "SMESH_Algo.hxx"
 #include "SMESH_ComputeError.hxx"
+#include "SMESH_ComputeProfiler.hxx"
 #include "SMESH_subMesh.hxx"
 
 #include <map>
@@ -169,6 +170,11 @@ public:
 
   int GetANewId();
 
+  /*!
+   * \brief Return the recorder of timing of computation stages
+   */
+  SMESH_ComputeProfiler& GetComputeProfiler() { return _profiler; }
+
 public:
   void send_mesh(SMESH_Mesh & aMesh, std::string filename);
 
@@ -215,6 +221,8 @@ private:
 
   volatile bool               _compute_canceled;
   std::list< SMESH_subMesh* > _sm_current;
+
+  SMESH_ComputeProfiler       _profiler;
 };
 
 #endif
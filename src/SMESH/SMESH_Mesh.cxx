@@ -26,6 +26,7 @@
 //
 #include "SMESH_Mesh.hxx"
 #include "SMESH_MesherHelper.hxx"
+#include "SMDS_ElementRange.hxx"
 #include "SMDS_MeshVolume.hxx"
 #include "SMDS_SetIterator.hxx"
 #include "SMESHDS_Document.hxx"
@@ -59,15 +60,24 @@
 #include <GEOMUtils.hxx>
 
 //#undef _Precision_HeaderFile
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <Precision.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 
 #include "SMESH_TryCatch.hxx" // include after OCCT headers!
@@ -86,6 +96,8 @@
 namespace fs=boost::filesystem;
 #endif
 
+#include <algorithm>
+#include <limits>
 #include <unordered_set>
 
 // maximum stored group name length in MED file
@@ -182,6 +194,173 @@ namespace
     return 0;
   }
 #endif
+
+  //================================================================================
+  /*!
+   * \brief Geometric signature of a sub-shape used to find sub-shapes that
+   *        are not changed by modification of the shape to mesh
+   */
+  //================================================================================
+
+  struct TShapeSignature
+  {
+    TopAbs_ShapeEnum   _type;       // TopAbs_SHAPE if not comparable
+    TopAbs_Orientation _orientation;
+    int                _nbVertices;
+    double             _mass;       // length, area or volume
+    gp_XYZ             _center;     // center of mass or VERTEX point
+    gp_XYZ             _points[2];  // points at parameters of EDGE or FACE
+    double             _params[4];  // parametric range of EDGE or FACE
+
+    TShapeSignature(): _type( TopAbs_SHAPE ), _orientation( TopAbs_FORWARD ),
+                       _nbVertices( 0 ), _mass( 0 ) {}
+
+    void Init( const TopoDS_Shape& shape );
+    bool IsSame( const TShapeSignature& other, const double tol ) const;
+  };
+
+  void TShapeSignature::Init( const TopoDS_Shape& shape )
+  {
+    _type        = shape.ShapeType();
+    _orientation = TopAbs_FORWARD;
+    _points[0] = _points[1] = _center = gp_XYZ( 0, 0, 0 );
+    _params[0] = _params[1] = _params[2] = _params[3] = 0;
+
+    TopTools_IndexedMapOfShape vertices;
+    TopExp::MapShapes( shape, TopAbs_VERTEX, vertices );
+    _nbVertices = vertices.Extent();
+    if ( _nbVertices > 0 )
+      _center = BRep_Tool::Pnt( TopoDS::Vertex( vertices( 1 ))).XYZ();
+
+    GProp_GProps props;
+    switch ( _type )
+    {
+    case TopAbs_VERTEX:
+      return;
+    case TopAbs_EDGE:
+    {
+      const TopoDS_Edge& edge = TopoDS::Edge( shape );
+      if ( BRep_Tool::Degenerated( edge ))
+      {
+        BRep_Tool::Range( edge, _params[0], _params[1] );
+        return;
+      }
+      BRepGProp::LinearProperties( edge, props );
+      BRepAdaptor_Curve curve( edge );
+      _params[0] = curve.FirstParameter();
+      _params[1] = curve.LastParameter();
+      _points[0] = curve.Value( _params[0] ).XYZ();
+      _points[1] = curve.Value( 0.5 * ( _params[0] + _params[1] )).XYZ();
+      break;
+    }
+    case TopAbs_WIRE:
+      BRepGProp::LinearProperties( shape, props );
+      break;
+    case TopAbs_FACE:
+    {
+      // a reversed FACE has an opposite normal, so its mesh is not the same;
+      // orientation of other sub-shapes changes along with orientation of an ancestor
+      _orientation = shape.Orientation();
+      const TopoDS_Face& face = TopoDS::Face( shape );
+      BRepGProp::SurfaceProperties( face, props );
+      BRepTools::UVBounds( face, _params[0], _params[1], _params[2], _params[3] );
+      BRepAdaptor_Surface surface( face, /*restriction=*/false );
+      _points[0] = surface.Value( _params[0], _params[2] ).XYZ();
+      _points[1] = surface.Value( 0.5 * ( _params[0] + _params[1] ),
+                                  0.5 * ( _params[2] + _params[3] )).XYZ();
+      break;
+    }
+    case TopAbs_SHELL:
+      BRepGProp::SurfaceProperties( shape, props );
+      break;
+    case TopAbs_SOLID:
+      BRepGProp::VolumeProperties( shape, props );
+      break;
+    default: // compounds are compared via their sub-shapes
+      _type = TopAbs_SHAPE;
+      return;
+    }
+    _mass = props.Mass();
+    if ( Abs( _mass ) > std::numeric_limits<double>::min() )
+      _center = props.CentreOfMass().XYZ();
+  }
+
+  bool TShapeSignature::IsSame( const TShapeSignature& other, const double tol ) const
+  {
+    if ( _type != other._type || _type == TopAbs_SHAPE || _nbVertices != other._nbVertices ||
+         _orientation != other._orientation )
+      return false;
+    if ( Abs( _mass - other._mass ) > 1e-6 * std::max( Abs( _mass ), Abs( other._mass )))
+      return false;
+    const double tol2 = tol * tol;
+    if (( _center    - other._center    ).SquareModulus() > tol2 ||
+        ( _points[0] - other._points[0] ).SquareModulus() > tol2 ||
+        ( _points[1] - other._points[1] ).SquareModulus() > tol2 )
+      return false;
+    for ( int i = 0; i < 4; ++i )
+      if ( Abs( _params[i] - other._params[i] ) > Precision::PConfusion() * ( 1. + Abs( _params[i] )))
+        return false;
+    return true;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Find sub-shapes of a new shape geometrically equal to old sub-shapes
+   *  \param [in] oldShapes - old sub-shapes indexed by ID
+   *  \param [in] newShapes - new sub-shapes indexed by ID
+   *  \param [in] tol - distance tolerance
+   *  \return std::vector< int > - ID of a new sub-shape per ID of an old one;
+   *          zero if there is no equal new sub-shape
+   */
+  //================================================================================
+
+  std::vector< int > matchSubShapes( const TopTools_IndexedMapOfShape& oldShapes,
+                                     const TopTools_IndexedMapOfShape& newShapes,
+                                     const double                      tol )
+  {
+    std::vector< TShapeSignature > oldSign( oldShapes.Extent() + 1 );
+    std::vector< TShapeSignature > newSign( newShapes.Extent() + 1 );
+    SMDS_ParallelFor( oldShapes.Extent(), [&]( size_t i ) { oldSign[ i+1 ].Init( oldShapes( i+1 )); });
+    SMDS_ParallelFor( newShapes.Extent(), [&]( size_t i ) { newSign[ i+1 ].Init( newShapes( i+1 )); });
+
+    // sort new sub-shapes by type and X of center to find candidates by binary search
+    auto isLess = [&]( const TShapeSignature& s1, const TShapeSignature& s2 )
+    {
+      return ( s1._type < s2._type ) || ( s1._type == s2._type && s1._center.X() < s2._center.X() );
+    };
+    std::vector< int > newIDs( newShapes.Extent() );
+    for ( size_t i = 0; i < newIDs.size(); ++i )
+      newIDs[ i ] = (int) i + 1;
+    std::sort( newIDs.begin(), newIDs.end(), [&]( int id1, int id2 )
+               { return isLess( newSign[ id1 ], newSign[ id2 ]); });
+
+    std::vector< int >  old2new( oldSign.size(), 0 );
+    std::vector< bool > isUsed ( newSign.size(), false );
+    for ( size_t oldID = 1; oldID < oldSign.size(); ++oldID )
+    {
+      const TShapeSignature& oldS = oldSign[ oldID ];
+      if ( oldS._type == TopAbs_SHAPE )
+        continue;
+      TShapeSignature lowS = oldS;
+      lowS._center.SetX( oldS._center.X() - tol );
+      std::vector< int >::iterator newID =
+        std::lower_bound( newIDs.begin(), newIDs.end(), lowS, [&]( int id, const TShapeSignature& s )
+                          { return isLess( newSign[ id ], s ); });
+      for ( ; newID != newIDs.end(); ++newID )
+      {
+        const TShapeSignature& newS = newSign[ *newID ];
+        if ( newS._type != oldS._type || newS._center.X() > oldS._center.X() + tol )
+          break;
+        if ( !isUsed[ *newID ] && oldS.IsSame( newS, tol ))
+        {
+          old2new[ oldID ] = *newID;
+          isUsed[ *newID ] = true;
+          break;
+        }
+      }
+    }
+    return old2new;
+  }
 }
 
 //=============================================================================
@@ -480,6 +659,179 @@ void SMESH_Mesh::ClearSubMesh(const int theShapeId)
   }
 }
 
+//=======================================================================
+/*!
+ * \brief Before replacement of the shape to mesh, detach meshes of sub-shapes
+ *        that are found unchanged in the new shape and remove the rest of the mesh.
+ *
+ * A sub-shape is unchanged if it and all its sub-shapes have geometrically
+ * equal counterparts among sub-shapes of the new shape. Sub-meshes of changed
+ * sub-shapes are cleaned by the event engine, which also cleans sub-meshes
+ * depending on them.
+ *  \return int - nb of detached sub-meshes
+ */
+//=======================================================================
+
+int SMESH_Mesh::StoreUnchangedSubMeshes(const TopoDS_Shape & theNewShape)
+{
+  _keptSubMeshes.clear();
+
+  if ( !HasShapeToMesh() || theNewShape.IsNull() || _meshDS->NbNodes() == 0 )
+  {
+    Clear();
+    return 0;
+  }
+
+  TopTools_IndexedMapOfShape oldShapes, newShapes;
+  const int nbOldShapes = _meshDS->MaxShapeIndex();
+  for ( int shapeID = 1; shapeID <= nbOldShapes; ++shapeID )
+    oldShapes.Add( _meshDS->IndexToShape( shapeID ));
+  TopExp::MapShapes( theNewShape, newShapes ); // same indexing as in SMESHDS_Mesh
+
+  const double tol = std::max( Precision::Confusion(), 1e-7 * GetShapeDiagonalSize() );
+  std::vector< int > old2new = matchSubShapes( oldShapes, newShapes, tol );
+
+  // find unchanged sub-shapes whose sub-shapes are all matched to sub-shapes of a new one
+
+  std::vector< char > isUnchanged( nbOldShapes + 1, false );
+  SMDS_ParallelFor( nbOldShapes, [&]( size_t i )
+  {
+    const int oldID = (int) i + 1;
+    if ( !old2new[ oldID ])
+      return;
+    TopTools_IndexedMapOfShape oldSubs, newSubs;
+    TopExp::MapShapes( oldShapes( oldID ), oldSubs );
+    TopExp::MapShapes( newShapes( old2new[ oldID ]), newSubs );
+    if ( oldSubs.Extent() != newSubs.Extent() )
+      return;
+    for ( int iS = 1; iS <= oldSubs.Extent(); ++iS )
+    {
+      const int subID = oldShapes.FindIndex( oldSubs( iS ));
+      if ( subID < 1 || !old2new[ subID ] || !newSubs.Contains( newShapes( old2new[ subID ])))
+        return;
+    }
+    isUnchanged[ oldID ] = true;
+  });
+
+  // clean sub-meshes of changed sub-shapes along with dependent ones
+
+  for ( int shapeID = 1; shapeID <= nbOldShapes; ++shapeID )
+  {
+    if ( isUnchanged[ shapeID ] || oldShapes( shapeID ).ShapeType() <= TopAbs_COMPSOLID )
+      continue;
+    if ( SMESH_subMesh* sm = GetSubMeshContaining( shapeID ))
+      if ( !sm->IsEmpty() )
+        sm->ComputeStateEngine( SMESH_subMesh::CLEAN );
+  }
+
+  // remove nodes and elements not kept on unchanged sub-shapes
+
+  std::vector< char > isKept( nbOldShapes + 1, false );
+  for ( int shapeID = 1; shapeID <= nbOldShapes; ++shapeID )
+    if ( isUnchanged[ shapeID ])
+      if ( SMESHDS_SubMesh* smDS = _meshDS->MeshElements( shapeID ))
+        isKept[ shapeID ] = ( !smDS->IsComplexSubmesh() && ( smDS->NbNodes() || smDS->NbElements() ));
+
+  auto isOnKept = [&]( const SMDS_MeshElement* e )
+  {
+    const int shapeID = e->GetShapeID();
+    return ( shapeID > 0 && shapeID <= nbOldShapes && isKept[ shapeID ]);
+  };
+  std::vector< const SMDS_MeshElement* > toRemove;
+  for ( SMDS_ElemIteratorPtr eIt = _meshDS->elementsIterator(); eIt->more(); )
+  {
+    const SMDS_MeshElement* e = eIt->next();
+    if ( !isOnKept( e ))
+      toRemove.push_back( e );
+  }
+  for ( size_t i = 0; i < toRemove.size(); ++i )
+    _meshDS->RemoveFreeElement( toRemove[i], /*sm=*/0 );
+
+  std::vector< const SMDS_MeshNode* > nodesToRemove;
+  for ( SMDS_NodeIteratorPtr nIt = _meshDS->nodesIterator(); nIt->more(); )
+  {
+    const SMDS_MeshNode* n = nIt->next();
+    if ( !isOnKept( n ))
+      nodesToRemove.push_back( n );
+  }
+  for ( size_t i = 0; i < nodesToRemove.size(); ++i )
+  {
+    const SMDS_MeshNode* n = nodesToRemove[i];
+    if ( !_meshDS->RemoveFreeNode( n, /*sm=*/0 )) // used by kept elements, e.g. after MergeNodes()
+      if ( SMESHDS_SubMesh* smDS = _meshDS->MeshElements( n->GetShapeID() ))
+        smDS->RemoveNode( n );
+  }
+
+  // detach kept nodes and elements from old sub-meshes
+
+  for ( int shapeID = 1; shapeID <= nbOldShapes; ++shapeID )
+  {
+    if ( !isKept[ shapeID ])
+      continue;
+    SMESHDS_SubMesh* smDS = _meshDS->MeshElements( shapeID );
+    _keptSubMeshes.push_back( TKeptSubMesh() );
+    TKeptSubMesh& kept = _keptSubMeshes.back();
+    kept._newID = old2new[ shapeID ];
+    kept._nodes.reserve( smDS->NbNodes() );
+    kept._elems.reserve( smDS->NbElements() );
+    for ( SMDS_NodeIteratorPtr nIt = smDS->GetNodes(); nIt->more(); )
+      kept._nodes.push_back( nIt->next() );
+    for ( SMDS_ElemIteratorPtr eIt = smDS->GetElements(); eIt->more(); )
+      kept._elems.push_back( eIt->next() );
+    for ( size_t i = 0; i < kept._nodes.size(); ++i )
+      smDS->RemoveNode( kept._nodes[i] );
+    for ( size_t i = 0; i < kept._elems.size(); ++i )
+      smDS->RemoveElement( kept._elems[i] );
+  }
+
+  GetMeshDS()->Modified();
+
+  return (int) _keptSubMeshes.size();
+}
+
+//=======================================================================
+/*!
+ * \brief After ShapeToMesh( theNewShape ), bind meshes detached by
+ *        StoreUnchangedSubMeshes() to sub-shapes of the new shape.
+ *
+ * To be called before assigning hypotheses to the new shape, so that the
+ * event engine cleans the restored sub-meshes that algorithms mesh anew.
+ *  \return int - nb of restored sub-meshes
+ */
+//=======================================================================
+
+int SMESH_Mesh::RestoreUnchangedSubMeshes()
+{
+  int nbRestored = 0;
+  for ( size_t iK = 0; iK < _keptSubMeshes.size(); ++iK )
+  {
+    TKeptSubMesh& kept = _keptSubMeshes[ iK ];
+    if ( kept._newID > _meshDS->MaxShapeIndex() ) // not the shape given to StoreUnchangedSubMeshes()
+    {
+      for ( size_t i = 0; i < kept._elems.size(); ++i )
+        _meshDS->RemoveFreeElement( kept._elems[i], /*sm=*/0 );
+      for ( size_t i = 0; i < kept._nodes.size(); ++i )
+        if ( kept._nodes[i]->NbInverseElements() == 0 )
+          _meshDS->RemoveFreeNode( kept._nodes[i], /*sm=*/0 );
+      continue;
+    }
+    GetSubMesh( _meshDS->IndexToShape( kept._newID ));
+
+    SMESHDS_SubMesh* smDS = _meshDS->NewSubMesh( kept._newID );
+    for ( size_t i = 0; i < kept._nodes.size(); ++i )
+      smDS->AddNode( kept._nodes[i] );
+    for ( size_t i = 0; i < kept._elems.size(); ++i )
+      smDS->AddElement( kept._elems[i] );
+    ++nbRestored;
+  }
+  _keptSubMeshes.clear();
+
+  if ( nbRestored > 0 )
+    GetMeshDS()->Modified();
+
+  return nbRestored;
+}
+
 //=======================================================================
 //function : UNVToMesh
 //purpose  :
@@ -1547,7 +1899,13 @@ void SMESH_Mesh::exportMEDCommmon(DriverMED_W_SMESHDS_Mesh& theWriter,
     }
   }
   // Perform export
-  status = theWriter.Perform();
+  {
+    SMESH_ComputeProfiler::Scope exportScope( _gen ? &_gen->GetComputeProfiler() : 0,
+                                              SMESH_ComputeProfiler::EXPORT, "MED", _id );
+    status = theWriter.Perform();
+    const SMESHDS_Mesh* meshDS = theMeshPart ? theMeshPart : _meshDS;
+    exportScope.SetResult( status == Driver_Mesh::DRS_OK, meshDS->NbNodes(), meshDS->NbElements() );
+  }
 
   SMESH_CATCH( SMESH::throwSalomeEx );
 
@@ -64,6 +64,8 @@ class SMESHDS_Document;
 class SMESHDS_GroupBase;
 class SMESHDS_Hypothesis;
 class SMESHDS_Mesh;
+class SMDS_MeshElement;
+class SMDS_MeshNode;
 class SMESH_Gen;
 class SMESH_Group;
 class SMESH_HypoFilter;
@@ -127,6 +129,18 @@ class SMESH_EXPORT SMESH_Mesh
    * \brief Remove all nodes and elements of indicated shape
    */
   void ClearSubMesh(const int theShapeId);
+  /*!
+   * \brief Before replacement of the shape to mesh, detach meshes of sub-shapes
+   *        that are found unchanged in the new shape and remove the rest of the mesh.
+   *        Return nb of detached sub-meshes
+   */
+  int StoreUnchangedSubMeshes(const TopoDS_Shape & theNewShape);
+  /*!
+   * \brief After ShapeToMesh( theNewShape ), bind meshes detached by
+   *        StoreUnchangedSubMeshes() to sub-shapes of the new shape.
+   *        Return nb of restored sub-meshes
+   */
+  int RestoreUnchangedSubMeshes();
 
   /*!
    * consult DriverMED_R_SMESHDS_Mesh::ReadStatus for returned value
@@ -465,6 +479,16 @@ protected:
   // 2) to forget not loaded mesh data at hyp modification
   TCallUp*                    _callUp;
 
+private:
+  // mesh of a sub-shape kept at replacement of the shape to mesh
+  struct TKeptSubMesh
+  {
+    int                                    _newID; // ID of sub-shape in the new shape
+    std::vector< const SMDS_MeshNode* >    _nodes;
+    std::vector< const SMDS_MeshElement* > _elems;
+  };
+  std::vector< TKeptSubMesh > _keptSubMeshes; // filled by StoreUnchangedSubMeshes()
+
 protected:
   SMESH_Mesh();
   SMESH_Mesh(const SMESH_Mesh&) {};
@@ -93,10 +93,15 @@
 #include <limits>
 #include <algorithm>
 #include <sstream>
+#include <unordered_map>
 
 #include <boost/tuple/tuple.hpp>
 #include <boost/container/flat_set.hpp>
 
+#ifdef WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
 #include <Standard_Failure.hxx>
 #include <Standard_ErrorHandler.hxx>
 
@@ -4678,24 +4683,161 @@ namespace
       std::swap( theElemSets[0], theElemSets[1] );
     }
   }
+
+  //================================================================================
+  /*!
+   * \brief Check if medium nodes are to be created between corner ones swept from a node
+   */
+  //================================================================================
+
+  bool isMediumNodeNeeded( const SMDS_MeshNode*    node,
+                           const SMDS_MeshElement* elem,
+                           const TIDSortedElemSet& elems )
+  {
+    SMDS_ElemIteratorPtr it = node->GetInverseElementIterator();
+    while ( it->more() )
+    {
+      const SMDS_MeshElement* invElem = it->next();
+      if ( invElem != elem && !elems.count( invElem )) continue;
+      if ( invElem->IsQuadratic() && !invElem->IsMediumNode( node ))
+        return true;
+      if ( invElem->GetEntityType() == SMDSEntity_BiQuad_Quadrangle )
+        return true;
+    }
+    return false;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Makes columns of nodes generated by sweeping from source nodes.
+   *        Coordinates of new nodes of all columns are stored in one array at
+   *        same indices as the nodes, so that they can be computed in parallel
+   *        before the nodes are created.
+   */
+  //================================================================================
+
+  struct TSweptNodes
+  {
+    typedef SMESH_MeshEditor::TNodeColumns      TNodeColumns;
+    typedef SMESH_MeshEditor::TElemOfColumnsMap TElemOfColumnsMap;
+
+    TNodeColumns&         _columns;
+    std::vector< bool >   _withMedium; // are medium nodes to be created
+    std::vector< bool >   _isFixed;    // node is not moved by the sweep
+    std::vector< gp_XYZ > _xyz;        // coordinates of new nodes
+
+    TSweptNodes( TNodeColumns& columns ): _columns( columns ) {}
+
+    size_t               NbNodes()            const { return _columns.NbColumns(); }
+    const SMDS_MeshNode* SrcNode( size_t i )  const { return _columns.SrcNode( i ); }
+    gp_XYZ*              NewPoints( size_t i )      { return _xyz.data() + _columns.myBegin[ i ]; }
+
+    // add a column per node of elements, in the order the nodes are met in the elements,
+    // and store indices of columns of nodes of each element in elemColumns
+    void Collect( TIDSortedElemSet   elemSets[2],
+                  TElemOfColumnsMap& elemColumns,
+                  const bool         isQuadraticMesh )
+    {
+      std::unordered_map< const SMDS_MeshNode*, int > nodeColumn;
+      for ( int is2ndSet = 0; is2ndSet < 2; ++is2ndSet )
+      {
+        TIDSortedElemSet& elems = elemSets[ is2ndSet ];
+        TIDSortedElemSet::iterator itElem = elems.begin();
+        for ( ; itElem != elems.end(); itElem++ )
+        {
+          const SMDS_MeshElement* elem = *itElem;
+          if ( !elem || elem->GetType() == SMDSAbs_Volume )
+            continue;
+          std::vector< int >& columns = elemColumns[ elem ];
+          columns.reserve( elem->NbNodes() );
+          SMDS_NodeIteratorPtr itN = elem->nodeIterator();
+          while ( itN->more() )
+          {
+            const SMDS_MeshNode* node = itN->next();
+            auto it_isNew = nodeColumn.insert( std::make_pair( node, (int) NbNodes() ));
+            if ( it_isNew.second )
+            {
+              _columns.mySrcNodes.push_back( node );
+              _withMedium.push_back( isQuadraticMesh && isMediumNodeNeeded( node, elem, elems ));
+            }
+            columns.push_back( it_isNew.first->second );
+          }
+        }
+      }
+      _isFixed.resize( NbNodes(), false );
+      _columns.myBegin.resize( NbNodes(), 0 );
+      _columns.mySize.resize( NbNodes(), 0 );
+    }
+
+    // allocate new nodes and their coordinates; a fixed node is repeated nbSteps times
+    void Allocate( const int nbSteps )
+    {
+      size_t nbNewNodes = 0;
+      for ( size_t i = 0; i < NbNodes(); ++i )
+      {
+        _columns.myBegin[ i ] = nbNewNodes;
+        _columns.mySize [ i ] = nbSteps * ( 1 + ( _withMedium[i] && !_isFixed[i] ));
+        nbNewNodes += _columns.mySize[ i ];
+      }
+      _columns.myNodes.resize( nbNewNodes );
+      _xyz.resize( nbNewNodes );
+    }
+
+    // create new nodes column by column
+    void MakeNodes( SMESHDS_Mesh*            mesh,
+                    SMESH_SequenceOfElemPtr& newNodes,
+                    SMESH_SequenceOfElemPtr& srcNodes )
+    {
+      newNodes.reserve( newNodes.size() + _xyz.size() );
+      srcNodes.reserve( srcNodes.size() + _xyz.size() );
+      for ( size_t i = 0; i < NbNodes(); ++i )
+      {
+        const size_t iBeg = _columns.myBegin[ i ], iEnd = iBeg + _columns.mySize[ i ];
+        if ( _isFixed[i] )
+        {
+          std::fill( _columns.myNodes.begin() + iBeg, _columns.myNodes.begin() + iEnd, SrcNode( i ));
+          continue;
+        }
+        for ( size_t iN = iBeg; iN < iEnd; ++iN )
+        {
+          const gp_XYZ&        p = _xyz[ iN ];
+          const SMDS_MeshNode* n = mesh->AddNode( p.X(), p.Y(), p.Z() );
+          _columns.myNodes[ iN ] = n;
+          newNodes.push_back( n );
+          srcNodes.push_back( SrcNode( i ));
+        }
+      }
+      std::vector< gp_XYZ >().swap( _xyz );
+    }
+
+    // store nodes created from the i-th node one by one
+    void SetNodes( size_t i, const std::list< const SMDS_MeshNode* >& newNodes )
+    {
+      _columns.myBegin[ i ] = _columns.myNodes.size();
+      _columns.mySize [ i ] = newNodes.size();
+      _columns.myNodes.insert( _columns.myNodes.end(), newNodes.begin(), newNodes.end() );
+    }
+  };
 }
 
 //=======================================================================
 /*!
  * \brief Create elements by sweeping an element
  * \param elem - element to sweep
- * \param newNodesItVec - nodes generated from each node of the element
+ * \param columns - nodes generated from source nodes
+ * \param elemColumns - indices of columns of nodes of the element
  * \param newElems - generated elements
  * \param nbSteps - number of sweeping steps
  * \param srcElements - to append elem for each generated element
  */
 //=======================================================================
 
-void SMESH_MeshEditor::sweepElement(const SMDS_MeshElement*               elem,
-                                    const vector<TNodeOfNodeListMapItr> & newNodesItVec,
-                                    list<const SMDS_MeshElement*>&        newElems,
-                                    const size_t                          nbSteps,
-                                    SMESH_SequenceOfElemPtr&              srcElements)
+void SMESH_MeshEditor::sweepElement(const SMDS_MeshElement*        elem,
+                                    const TNodeColumns&            columns,
+                                    const vector<int>&             elemColumns,
+                                    list<const SMDS_MeshElement*>& newElems,
+                                    const size_t                   nbSteps,
+                                    SMESH_SequenceOfElemPtr&       srcElements)
 {
   SMESHDS_Mesh* aMesh = GetMeshDS();
 
@@ -4705,7 +4847,7 @@ void SMESH_MeshEditor::sweepElement(const SMDS_MeshElement*               elem,
                                                           polyhedron creation !!! */
   // Loop on elem nodes:
   // find new nodes and detect same nodes indices
-  vector < list< const SMDS_MeshNode* >::const_iterator > itNN( nbNodes );
+  vector < const SMDS_MeshNode* const* > itNN( nbNodes );
   vector<const SMDS_MeshNode*> prevNod( nbNodes );
   vector<const SMDS_MeshNode*> nextNod( nbNodes );
   vector<const SMDS_MeshNode*> midlNod( nbNodes );
@@ -4715,18 +4857,16 @@ void SMESH_MeshEditor::sweepElement(const SMDS_MeshElement*               elem,
   vector<bool> isSingleNode(nbNodes);
 
   for ( iNode = 0; iNode < nbNodes; iNode++ ) {
-    TNodeOfNodeListMapItr                        nnIt = newNodesItVec[ iNode ];
-    const SMDS_MeshNode*                         node = nnIt->first;
-    const list< const SMDS_MeshNode* > & listNewNodes = nnIt->second;
-    if ( listNewNodes.empty() )
+    const int iCol = elemColumns[ iNode ];
+    if ( columns.Size( iCol ) == 0 )
       return;
 
-    itNN   [ iNode ] = listNewNodes.begin();
-    prevNod[ iNode ] = node;
-    nextNod[ iNode ] = listNewNodes.front();
+    itNN   [ iNode ] = columns.Begin( iCol );
+    prevNod[ iNode ] = columns.SrcNode( iCol );
+    nextNod[ iNode ] = columns.Front( iCol );
 
-    isSingleNode[iNode] = (listNewNodes.size()==nbSteps); /* medium node of quadratic or
-                                                             corner node of linear */
+    isSingleNode[iNode] = ( columns.Size( iCol ) == (int) nbSteps ); /* medium node of quadratic or
+                                                                        corner node of linear */
     if ( prevNod[ iNode ] != nextNod [ iNode ])
       nbDouble += !isSingleNode[iNode];
 
@@ -5169,32 +5309,37 @@ void SMESH_MeshEditor::sweepElement(const SMDS_MeshElement*               elem,
 //=======================================================================
 /*!
  * \brief Create 1D and 2D elements around swept elements
- * \param mapNewNodes - source nodes and ones generated from them
+ * \param columns - source nodes and ones generated from them
  * \param newElemsMap - source elements and ones generated from them
- * \param elemNewNodesMap - nodes generated from each node of each element
+ * \param elemColumnsMap - indices of columns of nodes of each element
  * \param elemSet - all swept elements
  * \param nbSteps - number of sweeping steps
  * \param srcElements - to append elem for each generated element
  */
 //=======================================================================
 
-void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
+void SMESH_MeshEditor::makeWalls (const TNodeColumns&      columns,
                                   TTElemOfElemListMap &    newElemsMap,
-                                  TElemOfVecOfNnlmiMap &   elemNewNodesMap,
+                                  TElemOfColumnsMap &      elemColumnsMap,
                                   TIDSortedElemSet&        elemSet,
                                   const int                nbSteps,
                                   SMESH_SequenceOfElemPtr& srcElements)
 {
-  ASSERT( newElemsMap.size() == elemNewNodesMap.size() );
+  ASSERT( newElemsMap.size() == elemColumnsMap.size() );
   SMESHDS_Mesh* aMesh = GetMeshDS();
 
   // Find nodes belonging to only one initial element - sweep them into edges.
+  // Source nodes are sorted by pointer as they were in a node map, which defines
+  // the order of new edges
 
-  TNodeOfNodeListMapItr nList = mapNewNodes.begin();
-  for ( ; nList != mapNewNodes.end(); nList++ )
+  vector< int > nodeColumns( columns.NbColumns() );
+  for ( size_t iCol = 0; iCol < nodeColumns.size(); ++iCol )
+    nodeColumns[ iCol ] = iCol;
+  std::sort( nodeColumns.begin(), nodeColumns.end(), [&]( int iCol1, int iCol2 )
+             { return columns.SrcNode( iCol1 ) < columns.SrcNode( iCol2 ); });
+  for ( const int iCol : nodeColumns )
   {
-    const SMDS_MeshNode* node =
-      static_cast<const SMDS_MeshNode*>( nList->first );
+    const SMDS_MeshNode* node = columns.SrcNode( iCol );
     if ( newElemsMap.count( node ))
       continue; // node was extruded into edge
     SMDS_ElemIteratorPtr eIt = node->GetInverseElementIterator();
@@ -5218,9 +5363,9 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
     if ( nbInitElems == 1 ) {
       bool NotCreateEdge = el && el->IsMediumNode(node);
       if(!NotCreateEdge) {
-        vector<TNodeOfNodeListMapItr> newNodesItVec( 1, nList );
+        vector<int> nodeColumn( 1, iCol );
         list<const SMDS_MeshElement*> newEdges;
-        sweepElement( node, newNodesItVec, newEdges, nbSteps, srcElements );
+        sweepElement( node, columns, nodeColumn, newEdges, nbSteps, srcElements );
       }
     }
   }
@@ -5230,12 +5375,12 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
 
   ElemFeatures polyFace( SMDSAbs_Face, /*isPoly=*/true ), anyFace;
 
-  TTElemOfElemListMap::iterator  itElem      = newElemsMap.begin();
-  TElemOfVecOfNnlmiMap::iterator itElemNodes = elemNewNodesMap.begin();
+  TTElemOfElemListMap::iterator itElem      = newElemsMap.begin();
+  TElemOfColumnsMap::iterator   itElemNodes = elemColumnsMap.begin();
   for ( ; itElem != newElemsMap.end(); itElem++, itElemNodes++ )
   {
     const SMDS_MeshElement* elem = itElem->first;
-    vector<TNodeOfNodeListMapItr>& vecNewNodes = itElemNodes->second;
+    vector<int>&     vecNewNodes = itElemNodes->second; // columns of element nodes
 
     if(itElem->second.size()==0) continue;
 
@@ -5244,20 +5389,20 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
     if ( elem->GetType() == SMDSAbs_Edge ) {
       // create a ceiling edge
       if ( !isQuadratic ) {
-        if ( !aMesh->FindEdge( vecNewNodes[ 0 ]->second.back(),
-                               vecNewNodes[ 1 ]->second.back())) {
-          myLastCreatedElems.push_back(aMesh->AddEdge(vecNewNodes[ 0 ]->second.back(),
-                                                      vecNewNodes[ 1 ]->second.back()));
+        if ( !aMesh->FindEdge( columns.Back( vecNewNodes[ 0 ] ),
+                               columns.Back( vecNewNodes[ 1 ] ))) {
+          myLastCreatedElems.push_back(aMesh->AddEdge(columns.Back( vecNewNodes[ 0 ] ),
+                                                      columns.Back( vecNewNodes[ 1 ] )));
           srcElements.push_back( elem );
         }
       }
       else {
-        if ( !aMesh->FindEdge( vecNewNodes[ 0 ]->second.back(),
-                               vecNewNodes[ 1 ]->second.back(),
-                               vecNewNodes[ 2 ]->second.back())) {
-          myLastCreatedElems.push_back(aMesh->AddEdge(vecNewNodes[ 0 ]->second.back(),
-                                                      vecNewNodes[ 1 ]->second.back(),
-                                                      vecNewNodes[ 2 ]->second.back()));
+        if ( !aMesh->FindEdge( columns.Back( vecNewNodes[ 0 ] ),
+                               columns.Back( vecNewNodes[ 1 ] ),
+                               columns.Back( vecNewNodes[ 2 ] ))) {
+          myLastCreatedElems.push_back(aMesh->AddEdge(columns.Back( vecNewNodes[ 0 ] ),
+                                                      columns.Back( vecNewNodes[ 1 ] ),
+                                                      columns.Back( vecNewNodes[ 2 ] )));
           srcElements.push_back( elem );
         }
       }
@@ -5275,11 +5420,11 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
     if ( !isQuadratic ) {
       // loop on the face nodes
       for ( iNode = 0; iNode < nbNodes; iNode++ ) {
-        aFaceLastNodes.insert( vecNewNodes[ iNode ]->second.back() );
+        aFaceLastNodes.insert( columns.Back( vecNewNodes[ iNode ] ));
         // look for free links of the face
         int iNext = ( iNode + 1 == nbNodes ) ? 0 : iNode + 1;
-        const SMDS_MeshNode* n1 = vecNewNodes[ iNode ]->first;
-        const SMDS_MeshNode* n2 = vecNewNodes[ iNext ]->first;
+        const SMDS_MeshNode* n1 = columns.SrcNode( vecNewNodes[ iNode ] );
+        const SMDS_MeshNode* n2 = columns.SrcNode( vecNewNodes[ iNext ] );
         // check if a link n1-n2 is free
         if ( ! SMESH_MeshAlgos::FindFaceInSet ( n1, n2, elemSet, avoidSet )) {
           hasFreeLinks = true;
@@ -5289,8 +5434,8 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
             myLastCreatedElems.push_back( edge = aMesh->AddEdge( n1, n2 )); // free link edge
             srcElements.push_back( myLastCreatedElems.back() );
           }
-          n1 = vecNewNodes[ iNode ]->second.back();
-          n2 = vecNewNodes[ iNext ]->second.back();
+          n1 = columns.Back( vecNewNodes[ iNode ] );
+          n2 = columns.Back( vecNewNodes[ iNext ] );
           if ( !aMesh->FindEdge( n1, n2 )) {
             myLastCreatedElems.push_back(aMesh->AddEdge( n1, n2 )); // new edge ceiling
             srcElements.push_back( edge );
@@ -5301,11 +5446,11 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
     else { // elem is quadratic face
       int nbn = nbNodes/2;
       for ( iNode = 0; iNode < nbn; iNode++ ) {
-        aFaceLastNodes.insert( vecNewNodes[ iNode ]->second.back() );
+        aFaceLastNodes.insert( columns.Back( vecNewNodes[ iNode ] ));
         int iNext = ( iNode + 1 == nbn ) ? 0 : iNode + 1;
-        const SMDS_MeshNode* n1 = vecNewNodes[ iNode ]->first;
-        const SMDS_MeshNode* n2 = vecNewNodes[ iNext ]->first;
-        const SMDS_MeshNode* n3 = vecNewNodes[ iNode+nbn ]->first;
+        const SMDS_MeshNode* n1 = columns.SrcNode( vecNewNodes[ iNode ] );
+        const SMDS_MeshNode* n2 = columns.SrcNode( vecNewNodes[ iNext ] );
+        const SMDS_MeshNode* n3 = columns.SrcNode( vecNewNodes[ iNode+nbn ] );
         // check if a link is free
         if ( ! SMESH_MeshAlgos::FindFaceInSet ( n1, n2, elemSet, avoidSet ) &&
              ! SMESH_MeshAlgos::FindFaceInSet ( n1, n3, elemSet, avoidSet ) &&
@@ -5317,9 +5462,9 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
             myLastCreatedElems.push_back(aMesh->AddEdge( n1, n2, n3 )); // free link edge
             srcElements.push_back( elem );
           }
-          n1 = vecNewNodes[ iNode ]->second.back();
-          n2 = vecNewNodes[ iNext ]->second.back();
-          n3 = vecNewNodes[ iNode+nbn ]->second.back();
+          n1 = columns.Back( vecNewNodes[ iNode ] );
+          n2 = columns.Back( vecNewNodes[ iNext ] );
+          n3 = columns.Back( vecNewNodes[ iNode+nbn ] );
           if ( !aMesh->FindEdge( n1, n2, n3 )) {
             myLastCreatedElems.push_back(aMesh->AddEdge( n1, n2, n3 )); // ceiling edge
             srcElements.push_back( elem );
@@ -5327,7 +5472,7 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
         }
       }
       for ( iNode = nbn; iNode < nbNodes; iNode++ ) {
-        aFaceLastNodes.insert( vecNewNodes[ iNode ]->second.back() );
+        aFaceLastNodes.insert( columns.Back( vecNewNodes[ iNode ] ));
       }
     }
 
@@ -5340,12 +5485,12 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
       set<const SMDS_MeshNode*> initNodeSet, topNodeSet, faceNodeSet;
       set<const SMDS_MeshNode*> initNodeSetNoCenter/*, topNodeSetNoCenter*/;
       for ( iNode = 0; iNode < nbNodes; iNode++ ) {
-        initNodeSet.insert( vecNewNodes[ iNode ]->first );
-        topNodeSet .insert( vecNewNodes[ iNode ]->second.back() );
+        initNodeSet.insert( columns.SrcNode( vecNewNodes[ iNode ] ));
+        topNodeSet .insert( columns.Back( vecNewNodes[ iNode ] ));
       }
       if ( isQuadratic && nbNodes % 2 ) {  // node set for the case of a biquadratic
         initNodeSetNoCenter = initNodeSet; // swept face and a not biquadratic volume
-        initNodeSetNoCenter.erase( vecNewNodes.back()->first );
+        initNodeSetNoCenter.erase( columns.SrcNode( vecNewNodes.back() ));
       }
       for ( volNb = 0; volNb < nbVolumesByStep; volNb++ ) {
         list<const SMDS_MeshElement*>::iterator v = newVolumes.begin();
@@ -5542,7 +5687,7 @@ void SMESH_MeshEditor::makeWalls (TNodeOfNodeListMap &     mapNewNodes,
     int iF = lastVol.GetFaceIndex( aFaceLastNodes );
 
     if ( iF < 0 && isQuadratic && nbNodes % 2 ) { // remove a central node of biquadratic
-      aFaceLastNodes.erase( vecNewNodes.back()->second.back() );
+      aFaceLastNodes.erase( columns.Back( vecNewNodes.back() ));
       iF = lastVol.GetFaceIndex( aFaceLastNodes );
     }
     if ( iF >= 0 )
@@ -5602,13 +5747,47 @@ SMESH_MeshEditor::RotationSweep(TIDSortedElemSet   theElemSets[2],
 
   SMESHDS_Mesh* aMesh = GetMeshDS();
 
-  TNodeOfNodeListMap mapNewNodes;
-  TElemOfVecOfNnlmiMap mapElemNewNodes;
+  TNodeColumns        columns;
+  TElemOfColumnsMap   elemColumnsMap;
   TTElemOfElemListMap newElemsMap;
 
   const bool isQuadraticMesh = bool( myMesh->NbEdges(ORDER_QUADRATIC) +
                                      myMesh->NbFaces(ORDER_QUADRATIC) +
                                      myMesh->NbVolumes(ORDER_QUADRATIC) );
+
+  // make new nodes: compute their coordinates in parallel and create them in the
+  // order the source nodes are met in the swept elements
+
+  TSweptNodes sweptNodes( columns );
+  sweptNodes.Collect( theElemSets, elemColumnsMap, isQuadraticMesh );
+  for ( size_t i = 0; i < sweptNodes.NbNodes(); ++i )
+    sweptNodes._isFixed[i] = ( aLine.SquareDistance( SMESH_NodeXYZ( sweptNodes.SrcNode( i ))) <= aSqTol );
+  sweptNodes.Allocate( theNbSteps );
+
+  SMDS_ParallelFor( sweptNodes.NbNodes(), [&]( size_t i )
+                    {
+                      if ( sweptNodes._isFixed[i] )
+                        return;
+                      gp_XYZ      xyz = SMESH_NodeXYZ( sweptNodes.SrcNode( i ));
+                      gp_XYZ* newXYZ = sweptNodes.NewPoints( i );
+                      for ( int iStep = 0; iStep < theNbSteps; ++iStep )
+                      {
+                        if ( sweptNodes._withMedium[i] ) // a medium node
+                        {
+                          aTrsf2.Transforms( xyz );
+                          *newXYZ++ = xyz;
+                          aTrsf2.Transforms( xyz );
+                        }
+                        else
+                        {
+                          aTrsf.Transforms( xyz );
+                        }
+                        *newXYZ++ = xyz; // a corner node
+                      }
+                    });
+
+  sweptNodes.MakeNodes( aMesh, myLastCreatedNodes, srcNodes );
+
   // loop on theElemSets
   TIDSortedElemSet::iterator itElem;
   for ( int is2ndSet = 0; is2ndSet < 2; ++is2ndSet )
@@ -5618,79 +5797,13 @@ SMESH_MeshEditor::RotationSweep(TIDSortedElemSet   theElemSets[2],
       const SMDS_MeshElement* elem = *itElem;
       if ( !elem || elem->GetType() == SMDSAbs_Volume )
         continue;
-      vector<TNodeOfNodeListMapItr> & newNodesItVec = mapElemNewNodes[ elem ];
-      newNodesItVec.reserve( elem->NbNodes() );
-
-      // loop on elem nodes
-      SMDS_ElemIteratorPtr itN = elem->nodesIterator();
-      while ( itN->more() )
-      {
-        const SMDS_MeshNode* node = cast2Node( itN->next() );
-
-        gp_XYZ aXYZ( node->X(), node->Y(), node->Z() );
-        double coord[3];
-        aXYZ.Coord( coord[0], coord[1], coord[2] );
-        bool isOnAxis = ( aLine.SquareDistance( aXYZ ) <= aSqTol );
-
-        // check if a node has been already sweeped
-        TNodeOfNodeListMapItr nIt =
-          mapNewNodes.insert( make_pair( node, list<const SMDS_MeshNode*>() )).first;
-        list<const SMDS_MeshNode*>& listNewNodes = nIt->second;
-        if ( listNewNodes.empty() )
-        {
-          // check if we are to create medium nodes between corner ones
-          bool needMediumNodes = false;
-          if ( isQuadraticMesh )
-          {
-            SMDS_ElemIteratorPtr it = node->GetInverseElementIterator();
-            while (it->more() && !needMediumNodes )
-            {
-              const SMDS_MeshElement* invElem = it->next();
-              if ( invElem != elem && !theElems.count( invElem )) continue;
-              needMediumNodes = ( invElem->IsQuadratic() && !invElem->IsMediumNode(node) );
-              if ( !needMediumNodes && invElem->GetEntityType() == SMDSEntity_BiQuad_Quadrangle )
-                needMediumNodes = true;
-            }
-          }
-
-          // make new nodes
-          const SMDS_MeshNode * newNode = node;
-          for ( int i = 0; i < theNbSteps; i++ ) {
-            if ( !isOnAxis ) {
-              if ( needMediumNodes )  // create a medium node
-              {
-                aTrsf2.Transforms( coord[0], coord[1], coord[2] );
-                newNode = aMesh->AddNode( coord[0], coord[1], coord[2] );
-                myLastCreatedNodes.push_back(newNode);
-                srcNodes.push_back( node );
-                listNewNodes.push_back( newNode );
-                aTrsf2.Transforms( coord[0], coord[1], coord[2] );
-              }
-              else {
-                aTrsf.Transforms( coord[0], coord[1], coord[2] );
-              }
-              // create a corner node
-              newNode = aMesh->AddNode( coord[0], coord[1], coord[2] );
-              myLastCreatedNodes.push_back(newNode);
-              srcNodes.push_back( node );
-              listNewNodes.push_back( newNode );
-            }
-            else {
-              listNewNodes.push_back( newNode );
-              // if ( needMediumNodes )
-              //   listNewNodes.push_back( newNode );
-            }
-          }
-        }
-        newNodesItVec.push_back( nIt );
-      }
       // make new elements
-      sweepElement( elem, newNodesItVec, newElemsMap[elem], theNbSteps, srcElems );
+      sweepElement( elem, columns, elemColumnsMap[ elem ], newElemsMap[elem], theNbSteps, srcElems );
     }
   }
 
   if ( theMakeWalls )
-    makeWalls( mapNewNodes, newElemsMap, mapElemNewNodes, theElemSets[0], theNbSteps, srcElems );
+    makeWalls( columns, newElemsMap, elemColumnsMap, theElemSets[0], theNbSteps, srcElems );
 
   PGroupIDs newGroupIDs;
   if ( theMakeGroups )
@@ -5958,62 +6071,72 @@ double SMESH_MeshEditor::ExtrusParam::nextStep()
 }
 
 //=======================================================================
-//function : ExtrusParam::makeNodesByDir
-//purpose  : create nodes for standard extrusion
+//function : ExtrusParam::ComputeNodeCoords
+//purpose  : compute coordinates of nodes of standard extrusion
 //=======================================================================
 
-int SMESH_MeshEditor::ExtrusParam::
-makeNodesByDir( SMESHDS_Mesh*                     mesh,
-                const SMDS_MeshNode*              srcNode,
-                std::list<const SMDS_MeshNode*> & newNodes,
-                const bool                        makeMediumNodes)
+int SMESH_MeshEditor::ExtrusParam::ComputeNodeCoords( const gp_XYZ& srcPoint,
+                                                      const bool    makeMediumNodes,
+                                                      gp_XYZ*       newPoints ) const
 {
-  gp_XYZ p = SMESH_NodeXYZ( srcNode );
+  const int nbNodesPerStep = 1 + makeMediumNodes;
 
-  int nbNodes = 0;
-  for ( beginStepIter( makeMediumNodes ); moreSteps(); ++nbNodes ) // loop on steps
-  {
-    p += myDir.XYZ() * nextStep();
-    const SMDS_MeshNode * newNode = mesh->AddNode( p.X(), p.Y(), p.Z() );
-    newNodes.push_back( newNode );
-  }
+  gp_XYZ  p      = srcPoint;
+  gp_XYZ  center = myBaseP;
+  gp_Ax1  ratationAxis( center, myDir );
+  gp_Trsf rotation;
+  bool    toMove = ( !myScales.empty() || !myAngles.empty() );
 
-  if ( !myScales.empty() || !myAngles.empty() )
+  int    nbNodes = 0;
+  size_t       i = !makeMediumNodes; // index in myScales and myAngles
+  for ( int iStep = 1; iStep <= mySteps->Length(); ++iStep ) // loop on steps
   {
-    gp_XYZ  center = myBaseP;
-    gp_Ax1  ratationAxis( center, myDir );
-    gp_Trsf rotation;
-
-    std::list<const SMDS_MeshNode*>::iterator nIt = newNodes.begin();
-    size_t i = !makeMediumNodes;
-    for ( beginStepIter( makeMediumNodes );
-          moreSteps();
-          ++nIt, i += 1 + !makeMediumNodes )
+    const double step = mySteps->Value( iStep ) / nbNodesPerStep;
+    for ( int iN = 0; iN < nbNodesPerStep; ++iN, ++nbNodes, i += 1 + !makeMediumNodes )
     {
-      center += myDir.XYZ() * nextStep();
+      p += myDir.XYZ() * step;
+      gp_XYZ& xyz = newPoints[ nbNodes ] = p;
+      if ( !toMove )
+        continue;
 
-      gp_XYZ xyz = SMESH_NodeXYZ( *nIt );
-      bool moved = false;
+      center += myDir.XYZ() * step;
+      toMove = false;
       if ( i < myScales.size() )
       {
         xyz = ( myScales[i] * ( xyz - center )) + center;
-        moved = true;
+        toMove = true;
       }
       if ( !myAngles.empty() )
       {
         rotation.SetRotation( ratationAxis, myAngles[i] );
         rotation.Transforms( xyz );
-        moved = true;
+        toMove = true;
       }
-      if ( moved )
-        mesh->MoveNode( *nIt, xyz.X(), xyz.Y(), xyz.Z() );
-      else
-        break;
     }
   }
   return nbNodes;
 }
 
+//=======================================================================
+//function : ExtrusParam::makeNodesByDir
+//purpose  : create nodes for standard extrusion
+//=======================================================================
+
+int SMESH_MeshEditor::ExtrusParam::
+makeNodesByDir( SMESHDS_Mesh*                     mesh,
+                const SMDS_MeshNode*              srcNode,
+                std::list<const SMDS_MeshNode*> & newNodes,
+                const bool                        makeMediumNodes)
+{
+  std::vector< gp_XYZ > points( NbSteps() * ( 1 + makeMediumNodes ));
+
+  int nbNodes = ComputeNodeCoords( SMESH_NodeXYZ( srcNode ), makeMediumNodes, points.data() );
+  for ( int i = 0; i < nbNodes; ++i )
+    newNodes.push_back( mesh->AddNode( points[i].X(), points[i].Y(), points[i].Z() ));
+
+  return nbNodes;
+}
+
 //=======================================================================
 //function : ExtrusParam::makeNodesByDirAndSew
 //purpose  : create nodes for standard extrusion with sewing
@@ -6332,12 +6455,33 @@ SMESH_MeshEditor::ExtrusionSweep (TIDSortedElemSet     theElemSets[2],
   const int nbSteps = theParams.NbSteps();
   theParams.SetElementsToUse( theElemSets[0], theElemSets[1] );
 
-  TNodeOfNodeListMap   mapNewNodes;
-  TElemOfVecOfNnlmiMap mapElemNewNodes;
+  TNodeColumns      columns;
+  TElemOfColumnsMap elemColumnsMap;
 
   const bool isQuadraticMesh = bool( myMesh->NbEdges(ORDER_QUADRATIC) +
                                      myMesh->NbFaces(ORDER_QUADRATIC) +
                                      myMesh->NbVolumes(ORDER_QUADRATIC) );
+
+  TSweptNodes sweptNodes( columns );
+  sweptNodes.Collect( theElemSets, elemColumnsMap, isQuadraticMesh );
+
+  if ( theParams.IsMadeByDir() && nbSteps > 0 )
+  {
+    // make new nodes: compute their coordinates in parallel and create them in the
+    // order the source nodes are met in the swept elements
+
+    sweptNodes.Allocate( nbSteps );
+
+    SMDS_ParallelFor( sweptNodes.NbNodes(), [&]( size_t i )
+                      {
+                        theParams.ComputeNodeCoords( SMESH_NodeXYZ( sweptNodes.SrcNode( i )),
+                                                     sweptNodes._withMedium[i],
+                                                     sweptNodes.NewPoints( i ));
+                      });
+
+    sweptNodes.MakeNodes( GetMeshDS(), myLastCreatedNodes, srcNodes );
+  }
+
   // loop on theElems
   TIDSortedElemSet::iterator itElem;
   for ( int is2ndSet = 0; is2ndSet < 2; ++is2ndSet )
@@ -6350,40 +6494,22 @@ SMESH_MeshEditor::ExtrusionSweep (TIDSortedElemSet     theElemSets[2],
       if ( !elem  || elem->GetType() == SMDSAbs_Volume )
         continue;
 
-      const size_t nbNodes = elem->NbNodes();
-      vector<TNodeOfNodeListMapItr> & newNodesItVec = mapElemNewNodes[ elem ];
-      newNodesItVec.reserve( nbNodes );
+      const vector<int>& elemColumns = elemColumnsMap[ elem ];
+      bool isSwept = true;
 
       // loop on elem nodes
-      SMDS_NodeIteratorPtr itN = elem->nodeIterator();
-      while ( itN->more() )
+      for ( size_t iN = 0; iN < elemColumns.size() && isSwept; ++iN )
       {
         // check if a node has been already sweeped
-        const SMDS_MeshNode* node = itN->next();
-        TNodeOfNodeListMap::iterator nIt =
-          mapNewNodes.insert( make_pair( node, list<const SMDS_MeshNode*>() )).first;
-        list<const SMDS_MeshNode*>& listNewNodes = nIt->second;
-        if ( listNewNodes.empty() )
+        const int            iCol = elemColumns[ iN ];
+        const SMDS_MeshNode* node = columns.SrcNode( iCol );
+        if ( columns.Size( iCol ) == 0 )
         {
-          // make new nodes
-
-          // check if we are to create medium nodes between corner ones
-          bool needMediumNodes = false;
-          if ( isQuadraticMesh )
-          {
-            SMDS_ElemIteratorPtr it = node->GetInverseElementIterator();
-            while (it->more() && !needMediumNodes )
-            {
-              const SMDS_MeshElement* invElem = it->next();
-              if ( invElem != elem && !theElems.count( invElem )) continue;
-              needMediumNodes = ( invElem->IsQuadratic() && !invElem->IsMediumNode(node) );
-              if ( !needMediumNodes && invElem->GetEntityType() == SMDSEntity_BiQuad_Quadrangle )
-                needMediumNodes = true;
-            }
-          }
-          // create nodes for all steps
-          if ( theParams.MakeNodes( GetMeshDS(), node, listNewNodes, needMediumNodes ))
+          // make new nodes for all steps
+          list<const SMDS_MeshNode*> listNewNodes;
+          if ( theParams.MakeNodes( GetMeshDS(), node, listNewNodes, sweptNodes._withMedium[ iCol ]))
           {
+            sweptNodes.SetNodes( iCol, listNewNodes );
             list<const SMDS_MeshNode*>::iterator newNodesIt = listNewNodes.begin();
             for ( ; newNodesIt != listNewNodes.end(); ++newNodesIt )
             {
@@ -6398,19 +6524,18 @@ SMESH_MeshEditor::ExtrusionSweep (TIDSortedElemSet     theElemSets[2],
               GetMeshDS()->Modified();
               throw SALOME_Exception( SMESH_Comment("Can't extrude node #") << node->GetID() );
             }
-            break; // newNodesItVec will be shorter than nbNodes
+            isSwept = false;
           }
         }
-        newNodesItVec.push_back( nIt );
       }
       // make new elements
-      if ( newNodesItVec.size() == nbNodes )
-        sweepElement( elem, newNodesItVec, newElemsMap[elem], nbSteps, srcElems );
+      if ( isSwept )
+        sweepElement( elem, columns, elemColumns, newElemsMap[elem], nbSteps, srcElems );
     }
   }
 
   if ( theParams.ToMakeBoundary() ) {
-    makeWalls( mapNewNodes, newElemsMap, mapElemNewNodes, theElemSets[0], nbSteps, srcElems );
+    makeWalls( columns, newElemsMap, elemColumnsMap, theElemSets[0], nbSteps, srcElems );
   }
   PGroupIDs newGroupIDs;
   if ( theParams.ToMakeGroups() )
@@ -6684,6 +6809,11 @@ void SMESH_MeshEditor::linearScaleVariation(const int          theNbSteps,
  *  \param theMakeGroups - if true and theCopy, create translated groups
  *  \param theTargetMesh - mesh to copy translated elements into
  *  \return SMESH_MeshEditor::PGroupIDs - list of ids of created groups
+ *
+ * New nodes are created in the following order:
+ * - for the whole mesh, in the order of IDs of source nodes, free nodes included;
+ * - else, in the order of the first occurrence of source nodes in theElems sorted by ID.
+ * New elements are created in the order of IDs of source elements.
  */
 //================================================================================
 
@@ -6735,101 +6865,126 @@ SMESH_MeshEditor::Transform (TIDSortedElemSet & theElems,
   SMESH_MeshEditor* editor = theTargetMesh ? & targetMeshEditor : theCopy ? this : 0;
   SMESH_MeshEditor::ElemFeatures elemType;
 
-  // map old node to new one
-  TNodeNodeMap nodeMap;
+  const bool isWholeMesh = theElems.empty();
+
+  // map old node to new one; old nodes are indexed by ID in a vector if a large part
+  // of the mesh is transformed, else hashed not to allocate MaxNodeID() items
+  // for a small selection, e.g. a sub-mesh
+  const bool isDenseMap = ( isWholeMesh || 4 * (smIdType) theElems.size() > aMesh->NbElements() );
+  std::vector< const SMDS_MeshNode* >                  nodeVec;
+  std::unordered_map< smIdType, const SMDS_MeshNode* > nodeHash;
+  if ( isDenseMap )
+    nodeVec.resize( aMesh->MaxNodeID() + 1, 0 );
+  else
+    nodeHash.reserve( 2 * theElems.size() );
+  auto mappedNode = [&]( const SMDS_MeshNode* node ) -> const SMDS_MeshNode*&
+  {
+    if ( !isDenseMap )
+      return nodeHash[ node->GetID() ]; // a new item is NULL
+    if ( node->GetID() >= (smIdType) nodeVec.size() )
+      nodeVec.resize( node->GetID() + 1, 0 );
+    return nodeVec[ node->GetID() ];
+  };
+
+  // nodes to transform
+  std::vector< const SMDS_MeshNode* > trsfNodes;
 
-  // elements sharing moved nodes; those of them which have all
-  // nodes mirrored but are not in theElems are to be reversed
-  TIDSortedElemSet inverseElemSet;
+  // elements to copy or reverse
+  std::vector< const SMDS_MeshElement* > elements;
 
   // source elements for each generated one
   SMESH_SequenceOfElemPtr srcElems, srcNodes;
 
-  // issue 021015: EDF 1578 SMESH: Free nodes are removed when translating a mesh
-  TIDSortedElemSet orphanNode;
-
-  if ( theElems.empty() ) // transform the whole mesh
+  if ( isWholeMesh )
   {
-    // add all elements
-    SMDS_ElemIteratorPtr eIt = aMesh->elementsIterator();
-    while ( eIt->more() ) theElems.insert( eIt->next() );
-    // add orphan nodes
-    SMDS_NodeIteratorPtr nIt = aMesh->nodesIterator();
-    while ( nIt->more() )
+    // take all nodes including free ones
+    // (issue 021015: EDF 1578 SMESH: Free nodes are removed when translating a mesh)
+    trsfNodes.reserve( aMesh->NbNodes() );
+    for ( const SMDS_MeshNode* node : aMesh->nodesRange() )
     {
-      const SMDS_MeshNode* node = nIt->next();
-      if ( node->NbInverseElements() == 0)
-        orphanNode.insert( node );
+      trsfNodes.push_back( node );
+      mappedNode( node ) = node;
     }
+    elements.reserve( aMesh->NbElements() );
+    for ( const SMDS_MeshElement* elem : aMesh->elementsRange() )
+      elements.push_back( elem );
   }
-
-  // loop on elements to transform nodes : first orphan nodes then elems
-  TIDSortedElemSet::iterator itElem;
-  TIDSortedElemSet *elements[] = { &orphanNode, &theElems };
-  for (int i=0; i<2; i++)
-    for ( itElem = elements[i]->begin(); itElem != elements[i]->end(); itElem++ )
+  else
+  {
+    for ( const SMDS_MeshElement* elem : theElems )
     {
-      const SMDS_MeshElement* elem = *itElem;
       if ( !elem )
         continue;
-
-      // loop on elem nodes
-      double coord[3];
-      SMDS_ElemIteratorPtr itN = elem->nodesIterator();
-      while ( itN->more() )
+      for ( SMDS_NodeIteratorPtr itN = elem->nodeIterator(); itN->more(); )
       {
-        const SMDS_MeshNode* node = cast2Node( itN->next() );
-        // check if a node has been already transformed
-        pair<TNodeNodeMap::iterator,bool> n2n_isnew =
-          nodeMap.insert( make_pair ( node, node ));
-        if ( !n2n_isnew.second )
-          continue;
-
-        node->GetXYZ( coord );
-        theTrsf.Transforms( coord[0], coord[1], coord[2] );
-        if ( theTargetMesh ) {
-          const SMDS_MeshNode * newNode = aTgtMesh->AddNode( coord[0], coord[1], coord[2] );
-          n2n_isnew.first->second = newNode;
-          myLastCreatedNodes.push_back(newNode);
-          srcNodes.push_back( node );
-        }
-        else if ( theCopy ) {
-          const SMDS_MeshNode * newNode = aMesh->AddNode( coord[0], coord[1], coord[2] );
-          n2n_isnew.first->second = newNode;
-          myLastCreatedNodes.push_back(newNode);
-          srcNodes.push_back( node );
-        }
-        else {
-          aMesh->MoveNode( node, coord[0], coord[1], coord[2] );
-          // node position on shape becomes invalid
-          const_cast< SMDS_MeshNode* > ( node )->SetPosition
-            ( SMDS_SpacePosition::originSpacePosition() );
-        }
-
-        // keep inverse elements
-        if ( !theCopy && !theTargetMesh && needReverse ) {
-          SMDS_ElemIteratorPtr invElemIt = node->GetInverseElementIterator();
-          while ( invElemIt->more() ) {
-            const SMDS_MeshElement* iel = invElemIt->next();
-            inverseElemSet.insert( iel );
-          }
+        const SMDS_MeshNode*  node = itN->next();
+        const SMDS_MeshNode*& node2 = mappedNode( node );
+        if ( !node2 )
+        {
+          node2 = node;
+          trsfNodes.push_back( node );
         }
       }
-    } // loop on elems in { &orphanNode, &theElems };
+    }
+  }
+
+  // transform coordinates
+  std::vector< double > xyz( 3 * trsfNodes.size() );
+  SMDS_ParallelFor( trsfNodes.size(), [&]( size_t i )
+                    {
+                      double* coord = & xyz[ 3 * i ];
+                      trsfNodes[ i ]->GetXYZ( coord );
+                      theTrsf.Transforms( coord[0], coord[1], coord[2] );
+                    });
+
+  if ( theCopy || theTargetMesh )
+  {
+    // make new nodes
+    SMESHDS_Mesh* mesh = theTargetMesh ? aTgtMesh : aMesh;
+    myLastCreatedNodes.reserve( trsfNodes.size() );
+    srcNodes.reserve( trsfNodes.size() );
+    for ( size_t i = 0; i < trsfNodes.size(); ++i )
+    {
+      const SMDS_MeshNode * newNode = mesh->AddNode( xyz[ 3*i ], xyz[ 3*i+1 ], xyz[ 3*i+2 ]);
+      mappedNode( trsfNodes[ i ]) = newNode;
+      myLastCreatedNodes.push_back( newNode );
+      srcNodes.push_back( trsfNodes[ i ]);
+    }
+  }
+  else
+  {
+    // move nodes
+    aMesh->MoveNodes( trsfNodes, xyz );
 
-  // either create new elements or reverse mirrored ones
-  if ( !theCopy && !needReverse && !theTargetMesh )
-    return PGroupIDs();
+    for ( const SMDS_MeshNode* node : trsfNodes )
+    {
+      // node position on shape becomes invalid
+      const_cast< SMDS_MeshNode* > ( node )->SetPosition
+        ( SMDS_SpacePosition::originSpacePosition() );
+    }
 
-  theElems.insert( inverseElemSet.begin(),inverseElemSet.end() );
+    if ( !needReverse )
+      return PGroupIDs();
+
+    // elements sharing moved nodes; those of them which have all
+    // nodes mirrored but are not in theElems are to be reversed
+    if ( !isWholeMesh )
+    {
+      for ( const SMDS_MeshNode* node : trsfNodes )
+        for ( SMDS_ElemIteratorPtr invElemIt = node->GetInverseElementIterator(); invElemIt->more(); )
+          theElems.insert( invElemIt->next() );
+    }
+  }
+
+  if ( !isWholeMesh )
+    elements.assign( theElems.begin(), theElems.end() );
 
   // Replicate or reverse elements
 
   std::vector<int> iForw;
   vector<const SMDS_MeshNode*> nodes;
-  for ( itElem = theElems.begin(); itElem != theElems.end(); itElem++ )
+  for ( const SMDS_MeshElement* elem : elements )
   {
-    const SMDS_MeshElement* elem = *itElem;
     if ( !elem ) continue;
 
     SMDSAbs_GeometryType geomType = elem->GetGeomType();
@@ -6851,12 +7006,11 @@ SMESH_MeshEditor::Transform (TIDSortedElemSet & theElems,
         int nbFaceNodes = aPolyedre->NbFaceNodes(iface);
         for (int inode = 1; inode <= nbFaceNodes && allTransformed; inode++)
         {
-          const SMDS_MeshNode* node = aPolyedre->GetFaceNode(iface, inode);
-          TNodeNodeMap::iterator nodeMapIt = nodeMap.find(node);
-          if ( nodeMapIt == nodeMap.end() )
+          const SMDS_MeshNode* node = mappedNode( aPolyedre->GetFaceNode(iface, inode));
+          if ( !node )
             allTransformed = false; // not all nodes transformed
           else
-            nodes.push_back((*nodeMapIt).second);
+            nodes.push_back( node );
         }
         if ( needReverse && allTransformed )
           std::reverse( nodes.end() - nbFaceNodes, nodes.end() );
@@ -6872,13 +7026,12 @@ SMESH_MeshEditor::Transform (TIDSortedElemSet & theElems,
 
       // find transformed nodes
       size_t iNode = 0;
-      SMDS_ElemIteratorPtr itN = elem->nodesIterator();
+      SMDS_NodeIteratorPtr itN = elem->nodeIterator();
       while ( itN->more() ) {
-        const SMDS_MeshNode* node = static_cast<const SMDS_MeshNode*>( itN->next() );
-        TNodeNodeMap::iterator nodeMapIt = nodeMap.find( node );
-        if ( nodeMapIt == nodeMap.end() )
+        const SMDS_MeshNode* node = mappedNode( itN->next() );
+        if ( !node )
           break; // not all nodes transformed
-        nodes[ i [ iNode++ ]] = (*nodeMapIt).second;
+        nodes[ i [ iNode++ ]] = node;
       }
       if ( iNode != nbNodes )
         continue; // not all nodes transformed
@@ -9213,6 +9366,129 @@ namespace
       nbNodeInFaces.push_back( vTool.NbFaceNodes( iF ));
     }
   }
+
+  //================================================================================
+  /*!
+   * \brief Create medium nodes of links of linear volumes having a node inside a
+   *        SOLID (or in a mesh without geometry) and pass them to the helper.
+   *
+   * Such medium nodes are placed at the link middle (as SMESH_MesherHelper does),
+   * so they don't require projection to geometry. Unique links are found by a
+   * parallel sort of node pairs by node IDs, so that medium nodes are created in
+   * a reproducible order, and node coordinates are computed in parallel;
+   * then the helper finds medium nodes in a sorted vector instead of creating them
+   * one by one in its map.
+   */
+  //================================================================================
+
+  void makeMediumNodesInVolumes( SMESHDS_Mesh* meshDS, SMESH_MesherHelper& helper )
+  {
+    const SMDS_MeshInfo& info = meshDS->GetMeshInfo();
+    if ( info.NbVolumes() == 0 ||
+         info.NbEdges  ( ORDER_QUADRATIC ) +
+         info.NbFaces  ( ORDER_QUADRATIC ) +
+         info.NbVolumes( ORDER_QUADRATIC ) > 0 ) // existing medium nodes are used by helper
+      return;
+
+    // links of linear volumes in SMDS order of nodes, as made quadratic by helper
+    static const int tetraLinks[] = { 0,1, 1,2, 2,0, 0,3, 1,3, 2,3 };
+    static const int pyramLinks[] = { 0,1, 1,2, 2,3, 3,0, 0,4, 1,4, 2,4, 3,4 };
+    static const int pentaLinks[] = { 0,1, 1,2, 2,0, 3,4, 4,5, 5,3, 0,3, 1,4, 2,5 };
+    static const int hexaLinks [] = { 0,1, 1,2, 2,3, 3,0, 4,5, 5,6, 6,7, 7,4, 0,4, 1,5, 2,6, 3,7 };
+    auto getLinks = []( const SMDS_MeshElement* vol, int& nbLinks ) -> const int*
+    {
+      switch ( vol->GetEntityType() ) {
+      case SMDSEntity_Tetra:   nbLinks = 6;  return tetraLinks;
+      case SMDSEntity_Pyramid: nbLinks = 8;  return pyramLinks;
+      case SMDSEntity_Penta:   nbLinks = 9;  return pentaLinks;
+      case SMDSEntity_Hexa:    nbLinks = 12; return hexaLinks;
+      default:                 nbLinks = 0;  return 0;
+      }
+    };
+
+    // a node is inside a SOLID if it is not on VERTEX, EDGE or FACE
+    std::vector< char > isSolidID( meshDS->MaxShapeIndex() + 1, true );
+    for ( size_t shapeID = 1; shapeID < isSolidID.size(); ++shapeID )
+    {
+      const TopoDS_Shape& s = meshDS->IndexToShape( (int) shapeID );
+      isSolidID[ shapeID ] = ( s.IsNull() || s.ShapeType() < TopAbs_FACE );
+    }
+    auto isInSolid = [&]( const SMDS_MeshNode* n )
+    {
+      const int shapeID = n->GetShapeID();
+      return ( shapeID >= (int) isSolidID.size() || isSolidID[ shapeID ]);
+    };
+
+    std::vector< const SMDS_MeshElement* > volumes;
+    std::vector< size_t >                  linkOffset( 1, 0 );
+    volumes.reserve( info.NbVolumes() );
+    linkOffset.reserve( info.NbVolumes() + 1 );
+    for ( SMDS_VolumeIteratorPtr vIt = meshDS->volumesIterator(); vIt->more(); )
+    {
+      const SMDS_MeshElement* vol = vIt->next();
+      int nbLinks;
+      getLinks( vol, nbLinks );
+      if ( nbLinks == 0 )
+        continue;
+      volumes.push_back( vol );
+      linkOffset.push_back( linkOffset.back() + nbLinks );
+    }
+
+    // collect and sort links as SMESH_TLink does, i.e. the node with greater ID first
+    std::vector< NLink > nodePairs( linkOffset.back(), NLink( nullptr, nullptr ));
+    SMDS_ParallelFor( volumes.size(), [&]( size_t iV )
+    {
+      int nbLinks;
+      const int* iNodes = getLinks( volumes[ iV ], nbLinks );
+      NLink*       link = & nodePairs[ linkOffset[ iV ]];
+      for ( int i = 0; i < nbLinks; ++i, ++link )
+      {
+        const SMDS_MeshNode* n1 = volumes[ iV ]->GetNode( iNodes[ 2 * i ]);
+        const SMDS_MeshNode* n2 = volumes[ iV ]->GetNode( iNodes[ 2 * i + 1 ]);
+        if ( !isInSolid( n1 ) && !isInSolid( n2 ))
+          continue; // medium node may need projection to geometry
+        if ( n1->GetID() < n2->GetID() )
+          std::swap( n1, n2 );
+        *link = NLink( n1, n2 );
+      }
+    });
+    std::vector< size_t >().swap( linkOffset );
+    nodePairs.erase( std::remove( nodePairs.begin(), nodePairs.end(), NLink( nullptr, nullptr )),
+                     nodePairs.end() ); // skipped links
+    if ( nodePairs.empty() )
+      return;
+
+    // sort by node IDs, not addresses, for medium nodes to get same IDs at each run
+#ifdef WITH_TBB
+    tbb::parallel_sort( nodePairs.begin(), nodePairs.end(), SMESH_TLink::IDLess );
+#else
+    std::sort( nodePairs.begin(), nodePairs.end(), SMESH_TLink::IDLess );
+#endif
+    nodePairs.erase( std::unique( nodePairs.begin(), nodePairs.end() ), nodePairs.end() );
+
+    // compute medium nodes in parallel and create them
+
+    std::vector< gp_XYZ > middles( nodePairs.size() );
+    SMDS_ParallelFor( nodePairs.size(), [&]( size_t i )
+    {
+      middles[ i ] = 0.5 * ( SMESH_NodeXYZ( nodePairs[ i ].first ) +
+                             SMESH_NodeXYZ( nodePairs[ i ].second ));
+    });
+
+    std::vector< std::pair< SMESH_TLink, const SMDS_MeshNode* > > linkNodes;
+    linkNodes.reserve( nodePairs.size() );
+    for ( size_t i = 0; i < nodePairs.size(); ++i )
+    {
+      const SMDS_MeshNode* n1 = nodePairs[ i ].first;
+      const SMDS_MeshNode* n2 = nodePairs[ i ].second;
+      SMDS_MeshNode*      n12 = meshDS->AddNode( middles[i].X(), middles[i].Y(), middles[i].Z() );
+      const int       shapeID = isInSolid( n1 ) ? n1->GetShapeID() : n2->GetShapeID();
+      if ( shapeID > 0 )
+        meshDS->SetNodeInVolume( n12, shapeID );
+      linkNodes.push_back( std::make_pair( SMESH_TLink( nodePairs[ i ]), n12 ));
+    }
+    helper.SetSortedTLinkNodes( linkNodes );
+  }
 }
 
 //=======================================================================
@@ -9374,6 +9650,9 @@ void SMESH_MeshEditor::ConvertToQuadratic(const bool theForce3d, const bool theT
   aHelper.SetElementsOnShape(true);
   aHelper.ToFixNodeParameters( true );
 
+  // make medium nodes inside SOLIDs at once
+  makeMediumNodesInVolumes( meshDS, aHelper );
+
   // convert elements assigned to sub-meshes
   smIdType nbCheckedElems = 0;
   if ( myMesh->HasShapeToMesh() )
@@ -12894,6 +13173,119 @@ void SMESH_MeshEditor::CreateHoleSkin(double                          radius,
 }
 
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Finds facets of volumes shared by two or more volumes.
+   *        Keys of all facets (sorted IDs of corner nodes) are computed and sorted
+   *        in parallel; a facet whose key is met more than once is not free.
+   *        Other facets, including facets with more than 4 corners, are to be
+   *        checked by SMDS_VolumeTool::IsFreeFace()
+   */
+  //================================================================================
+
+  struct TSharedFacetFinder
+  {
+    std::vector< const SMDS_MeshElement* > _volumes;
+    std::vector< size_t >                  _facetOffset; // index of the first facet of a volume
+    std::vector< char >                    _isShared;    // per facet
+
+    struct TFacetKey
+    {
+      smIdType _nodes[4]; // sorted IDs of corner nodes
+      size_t   _iFacet;
+
+      bool operator<( const TFacetKey& o ) const
+      {
+        return std::lexicographical_compare( _nodes, _nodes + 4, o._nodes, o._nodes + 4 );
+      }
+      bool operator==( const TFacetKey& o ) const
+      {
+        return std::equal( _nodes, _nodes + 4, o._nodes );
+      }
+    };
+
+    size_t NbVolumes() const { return _volumes.size(); }
+
+    bool IsShared( size_t iVol, int iFacet ) const
+    {
+      return ( iVol < _volumes.size() &&
+               _facetOffset[ iVol ] + iFacet < _facetOffset[ iVol + 1 ] &&
+               _isShared[ _facetOffset[ iVol ] + iFacet ]);
+    }
+
+    //! Return type of a volume whose facets are taken from the tables of SMDS_VolumeTool
+    static SMDS_VolumeTool::VolumeType volumeType( const SMDS_MeshElement* volume )
+    {
+      if ( volume->GetType() != SMDSAbs_Volume || volume->IsPoly() )
+        return SMDS_VolumeTool::UNKNOWN;
+      return SMDS_VolumeTool::GetType( volume->NbNodes() );
+    }
+
+    // Keys are made of IDs of corner nodes of facets given by the static tables of
+    // SMDS_VolumeTool, i.e. without SMDS_VolumeTool::Set() that is not thread safe.
+    // Orientation of facets does not matter, only facet indices do, which are
+    // same in tables of either orientation. Polyhedra get no facets here.
+    void Init( SMDS_ElemIteratorPtr volIt )
+    {
+      while ( volIt->more() )
+        _volumes.push_back( volIt->next() );
+
+      // count facets
+      _facetOffset.resize( _volumes.size() + 1, 0 );
+      for ( size_t iV = 0; iV < _volumes.size(); ++iV )
+        _facetOffset[ iV + 1 ] = ( _facetOffset[ iV ] +
+                                   SMDS_VolumeTool::NbFaces( volumeType( _volumes[ iV ])));
+
+      // make facet keys
+      std::vector< TFacetKey > keys( _facetOffset.back() );
+      SMDS_ParallelForBlocks( _volumes.size(), [&]( size_t iBeg, size_t iEnd )
+                              {
+                                for ( size_t iV = iBeg; iV < iEnd; ++iV )
+                                {
+                                  const SMDS_MeshElement*          vol = _volumes[ iV ];
+                                  const SMDS_VolumeTool::VolumeType type = volumeType( vol );
+                                  const int di = vol->IsQuadratic() ? 2 : 1;
+                                  for ( int iF = 0, nbF = SMDS_VolumeTool::NbFaces( type ); iF < nbF; ++iF )
+                                  {
+                                    TFacetKey& key = keys[ _facetOffset[ iV ] + iF ];
+                                    key._iFacet = _facetOffset[ iV ] + iF;
+                                    const int nbN = SMDS_VolumeTool::NbFaceNodes( type, iF ) / di;
+                                    if ( nbN < 3 || nbN > 4 ) // unique key not matching any other
+                                    {
+                                      key._nodes[0] = key._nodes[1] = 0;
+                                      key._nodes[2] = -1;
+                                      key._nodes[3] = (smIdType) key._iFacet;
+                                      continue;
+                                    }
+                                    const int* ind = SMDS_VolumeTool::GetFaceNodesIndices( type, iF,
+                                                                                           /*external=*/true );
+                                    key._nodes[0] = 0; // for a triangle
+                                    for ( int i = 0; i < nbN; ++i )
+                                      key._nodes[ 4 - nbN + i ] = vol->GetNode( ind[ i * di ])->GetID();
+                                    std::sort( key._nodes, key._nodes + 4 );
+                                  }
+                                }
+                              });
+#ifdef WITH_TBB
+      tbb::parallel_sort( keys.begin(), keys.end() );
+#else
+      std::sort( keys.begin(), keys.end() );
+#endif
+
+      // mark facets with equal keys
+      _isShared.resize( keys.size(), false );
+      SMDS_ParallelFor( keys.size(), [&]( size_t i )
+                        {
+                          _isShared[ keys[ i ]._iFacet ] =
+                            (( i > 0               && keys[ i - 1 ] == keys[ i ] ) ||
+                             ( i + 1 < keys.size() && keys[ i + 1 ] == keys[ i ] ));
+                        });
+    }
+  };
+}
+
 //================================================================================
 /*!
  * \brief Generates skin mesh (containing 2D cells) from 3D mesh
@@ -12909,19 +13301,22 @@ bool SMESH_MeshEditor::Make2DMeshFrom3D()
   if (!aMesh)
     return false;
 
+  // find facets shared by volumes in bulk
+  TSharedFacetFinder facetFinder;
+  facetFinder.Init( aMesh->elementsIterator( SMDSAbs_Volume ));
+
   ElemFeatures faceType( SMDSAbs_Face );
   int nbFree = 0, nbExisted = 0, nbCreated = 0;
-  SMDS_VolumeIteratorPtr vIt = aMesh->volumesIterator();
-  while(vIt->more())
+  for ( size_t iVol = 0; iVol < facetFinder.NbVolumes(); ++iVol )
   {
-    const SMDS_MeshVolume* volume = vIt->next();
+    const SMDS_MeshElement* volume = facetFinder._volumes[ iVol ];
     SMDS_VolumeTool vTool( volume, /*ignoreCentralNodes=*/false );
     vTool.SetExternalNormal();
     const int iQuad = volume->IsQuadratic();
     faceType.SetQuad( iQuad );
     for ( int iface = 0, n = vTool.NbFaces(); iface < n; iface++ )
     {
-      if (!vTool.IsFreeFace(iface))
+      if ( facetFinder.IsShared( iVol, iface ) || !vTool.IsFreeFace( iface ))
         continue;
       nbFree++;
       vector<const SMDS_MeshNode *> nodes;
@@ -13027,7 +13422,15 @@ int SMESH_MeshEditor::MakeBoundaryMesh(const TIDSortedElemSet& elements,
   if (elements.empty()) eIt = aMesh->elementsIterator(elemType);
   else                  eIt = SMESHUtils::elemSetIterator( elements );
 
-  while ( eIt->more() )
+  // on the skin of all volumes, find facets shared by volumes in bulk
+  TSharedFacetFinder facetFinder;
+  if ( elemType == SMDSAbs_Volume && elements.empty() && !aroundElements && !toCreateAllElements )
+  {
+    facetFinder.Init( eIt );
+    eIt = SMESHUtils::elemSetIterator( facetFinder._volumes );
+  }
+
+  for ( size_t iElem = 0; eIt->more(); ++iElem )
   {
     const SMDS_MeshElement* elem = eIt->next();
     const int              iQuad = elem->IsQuadratic();
@@ -13044,9 +13447,10 @@ int SMESH_MeshEditor::MakeBoundaryMesh(const TIDSortedElemSet& elements,
       const SMDS_MeshElement* otherVol = 0;
       for ( int iface = 0, n = vTool.NbFaces(); iface < n; iface++ )
       {
-        if ( !toCreateAllElements && 
-              !vTool.IsFreeFace(iface, &otherVol) &&
-                ( !aroundElements || elements.count( otherVol )))
+        if ( !toCreateAllElements &&
+             ( facetFinder.IsShared( iElem, iface ) ||
+               ( !vTool.IsFreeFace(iface, &otherVol) &&
+                 ( !aroundElements || elements.count( otherVol )))))
           continue;
         freeFacets.push_back( iface );
       }
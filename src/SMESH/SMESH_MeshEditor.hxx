@@ -304,8 +304,26 @@ public:
     std::list<const SMDS_MeshElement*>, TElemSort >                        TTElemOfElemListMap;
   typedef std::map<const SMDS_MeshNode*, std::list<const SMDS_MeshNode*> > TNodeOfNodeListMap;
   typedef TNodeOfNodeListMap::iterator                                     TNodeOfNodeListMapItr;
-  typedef std::vector<TNodeOfNodeListMapItr>                               TVecOfNnlmiMap;
-  typedef std::map<const SMDS_MeshElement*, TVecOfNnlmiMap, TElemSort >    TElemOfVecOfNnlmiMap;
+  typedef std::map<const SMDS_MeshElement*, std::vector<int>, TElemSort >  TElemOfColumnsMap;
+
+  /*!
+   * \brief Nodes generated by sweeping, a column of new nodes per source node.
+   *        New nodes of all columns are stored in one array
+   */
+  struct TNodeColumns
+  {
+    std::vector< const SMDS_MeshNode* > mySrcNodes; // source node of each column
+    std::vector< size_t >               myBegin;    // index in myNodes of the first node of each column
+    std::vector< int >                  mySize;     // number of nodes in each column
+    std::vector< const SMDS_MeshNode* > myNodes;    // new nodes of all columns
+
+    size_t                      NbColumns()         const { return mySrcNodes.size(); }
+    const SMDS_MeshNode*        SrcNode( int iCol ) const { return mySrcNodes[ iCol ]; }
+    int                         Size   ( int iCol ) const { return mySize[ iCol ]; }
+    const SMDS_MeshNode* const* Begin  ( int iCol ) const { return myNodes.data() + myBegin[ iCol ]; }
+    const SMDS_MeshNode*        Front  ( int iCol ) const { return myNodes[ myBegin[ iCol ]]; }
+    const SMDS_MeshNode*        Back   ( int iCol ) const { return myNodes[ myBegin[ iCol ] + mySize[ iCol ] - 1 ]; }
+  };
   typedef std::unique_ptr< std::list< int > >                              PGroupIDs;
 
   PGroupIDs RotationSweep (TIDSortedElemSet   theElements[2],
@@ -398,6 +416,15 @@ public:
     {
       return (this->*myMakeNodesFun)( mesh, srcNode, newNodes, makeMediumNodes );
     }
+    // returns true if nodes are made along a direction, so that their coordinates
+    // can be computed beforehand by ComputeNodeCoords()
+    bool IsMadeByDir() const { return myMakeNodesFun == & ExtrusParam::makeNodesByDir; }
+
+    // computes coordinates of nodes made along a direction from a point;
+    // returns number of points stored in \a newPoints. It is thread safe
+    int ComputeNodeCoords( const gp_XYZ& srcPoint,
+                           const bool    makeMediumNodes,
+                           gp_XYZ*       newPoints ) const;
   private:
 
     gp_Dir                          myDir;   // direction of extrusion
@@ -508,7 +535,8 @@ public:
                        const bool         theCopy,
                        const bool         theMakeGroups,
                        SMESH_Mesh*        theTargetMesh=0);
-  // Move or copy theElements applying theTrsf to their nodes
+  // Move or copy theElements applying theTrsf to their nodes.
+  // Copies of nodes of the whole mesh are created in the order of node IDs
 
   PGroupIDs Offset( TIDSortedElemSet & theElements,
                     const double       theValue,
@@ -796,16 +824,18 @@ public:
   /*!
    * \brief Create elements by sweeping an element
    * \param elem - element to sweep
-   * \param newNodesItVec - nodes generated from each node of the element
+   * \param columns - nodes generated from source nodes
+   * \param elemColumns - indices of columns of nodes of the element
    * \param newElems - generated elements
    * \param nbSteps - number of sweeping steps
    * \param srcElements - to append elem for each generated element
    */
-  void sweepElement(const SMDS_MeshElement*                    elem,
-                    const std::vector<TNodeOfNodeListMapItr> & newNodesItVec,
-                    std::list<const SMDS_MeshElement*>&        newElems,
-                    const size_t                               nbSteps,
-                    SMESH_SequenceOfElemPtr&                   srcElements);
+  void sweepElement(const SMDS_MeshElement*             elem,
+                    const TNodeColumns&                 columns,
+                    const std::vector<int>&             elemColumns,
+                    std::list<const SMDS_MeshElement*>& newElems,
+                    const size_t                        nbSteps,
+                    SMESH_SequenceOfElemPtr&            srcElements);
 
   /*!
    * \brief Computes new connectivity of an element after merging nodes
@@ -823,16 +853,16 @@ public:
                    const bool                   avoidMakingHoles );
   /*!
    * \brief Create 1D and 2D elements around swept elements
-   * \param mapNewNodes - source nodes and ones generated from them
+   * \param columns - source nodes and ones generated from them
    * \param newElemsMap - source elements and ones generated from them
-   * \param elemNewNodesMap - nodes generated from each node of each element
+   * \param elemColumnsMap - indices of columns of nodes of each element
    * \param elemSet - all swept elements
    * \param nbSteps - number of sweeping steps
    * \param srcElements - to append elem for each generated element
    */
-  void makeWalls (TNodeOfNodeListMap &     mapNewNodes,
+  void makeWalls (const TNodeColumns&      columns,
                   TTElemOfElemListMap &    newElemsMap,
-                  TElemOfVecOfNnlmiMap &   elemNewNodesMap,
+                  TElemOfColumnsMap &      elemColumnsMap,
                   TIDSortedElemSet&        elemSet,
                   const int                nbSteps,
                   SMESH_SequenceOfElemPtr& srcElements);
@@ -67,6 +67,7 @@
 
 #include <utilities.h>
 
+#include <algorithm>
 #include <limits>
 
 using namespace std;
@@ -1693,6 +1694,15 @@ const SMDS_MeshNode* SMESH_MesherHelper::GetMediumNode(const SMDS_MeshNode* n1,
   // Find existing node
 
   SMESH_TLink link(n1,n2);
+  if ( !mySortedTLinkNodes.empty() )
+  {
+    auto itSL = std::lower_bound( mySortedTLinkNodes.begin(), mySortedTLinkNodes.end(), link,
+                                  []( const std::pair< SMESH_TLink, const SMDS_MeshNode* >& ln,
+                                      const SMESH_TLink&                                    l )
+                                  { return SMESH_TLink::IDLess( ln.first, l ); });
+    if ( itSL != mySortedTLinkNodes.end() && itSL->first == link )
+      return itSL->second;
+  }
   ItTLinkNode itLN = myTLinkNodeMap.find( link );
   if ( itLN != myTLinkNodeMap.end() ) {
     return (*itLN).second;
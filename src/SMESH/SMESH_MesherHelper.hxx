@@ -723,6 +723,14 @@ public:
    */
   void AddTLinkNodeMap(const TLinkNodeMap& aMap)
     { myTLinkNodeMap.insert(aMap.begin(), aMap.end()); }
+  /*!
+   * \brief Set medium nodes of many links at once. The links must be sorted by
+   *        SMESH_TLink::IDLess() and unique; GetMediumNode() looks for a link among
+   *        them before myTLinkNodeMap.
+   *        The vector is swapped with the internal one.
+   */
+  void SetSortedTLinkNodes(std::vector< std::pair< SMESH_TLink, const SMDS_MeshNode* > >& links)
+    { mySortedTLinkNodes.swap( links ); }
 
   bool AddTLinks(const SMDS_MeshEdge*   edge);
   bool AddTLinks(const SMDS_MeshFace*   face);
@@ -790,6 +798,7 @@ public:
 
   // maps used during creation of quadratic elements
   TLinkNodeMap                              myTLinkNodeMap;       // medium nodes on links
+  std::vector< std::pair< SMESH_TLink, const SMDS_MeshNode* > > mySortedTLinkNodes; // bulk medium nodes
   std::map< TBiQuad, const SMDS_MeshNode* > myMapWithCentralNode; // central nodes of faces
 
   std::set< int > myDegenShapeIds;
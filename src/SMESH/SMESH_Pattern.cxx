@@ -27,6 +27,7 @@
 #include "SMESH_Pattern.hxx"
 
 #include "SMDS_EdgePosition.hxx"
+#include "SMDS_ElementRange.hxx"
 #include "SMDS_FacePosition.hxx"
 #include "SMDS_MeshElement.hxx"
 #include "SMDS_MeshFace.hxx"
@@ -2978,6 +2979,75 @@ inline static bool isDefined(const gp_XYZ& theXYZ)
   return theXYZ.X() < 1.e100;
 }
 
+//=======================================================================
+//function : copyPatternForWorker
+//purpose  : Copy the loaded pattern to apply it to mesh elements in a separate thread
+//=======================================================================
+
+void SMESH_Pattern::copyPatternForWorker(const SMESH_Pattern& thePattern)
+{
+  myIs2D                  = thePattern.myIs2D;
+  myPoints                = thePattern.myPoints;
+  myKeyPointIDs           = thePattern.myKeyPointIDs;
+  myElemPointIDs          = thePattern.myElemPointIDs;
+  myIsBoundaryPointsFound = thePattern.myIsBoundaryPointsFound;
+  myNbKeyPntInBoundary    = thePattern.myNbKeyPntInBoundary;
+  myIsComputed            = false;
+
+  // points on shapes must point to own myPoints
+  myShapeIDToPointsMap.clear();
+  map< int, list< TPoint* > >::const_iterator idPointIt = thePattern.myShapeIDToPointsMap.begin();
+  for ( ; idPointIt != thePattern.myShapeIDToPointsMap.end(); ++idPointIt )
+  {
+    list< TPoint* > & points = myShapeIDToPointsMap[ idPointIt->first ];
+    list< TPoint* >::const_iterator pIt = idPointIt->second.begin();
+    for ( ; pIt != idPointIt->second.end(); ++pIt )
+      points.push_back( & myPoints[ *pIt - & thePattern.myPoints[0] ]);
+  }
+}
+
+//=======================================================================
+//function : mapOntoElements
+//purpose  : Map the pattern onto mesh elements in parallel. Each thread
+//           applies its own copy of the pattern to a block of elements
+//=======================================================================
+
+void SMESH_Pattern::mapOntoElements(const vector< const SMDS_MeshElement* >& theElements,
+                                    const size_t                             theNbOrderedNodes,
+                                    const TApplyFun&                         theApply,
+                                    TMappedPoints&                           theResult) const
+{
+  const size_t nbElems = theElements.size();
+  theResult.myNbPoints       = myPoints.size();
+  theResult.myNbOrderedNodes = theNbOrderedNodes;
+  theResult.myXYZ.resize( nbElems * theResult.myNbPoints );
+  theResult.myOrderedNodes.resize( nbElems * theNbOrderedNodes, 0 );
+  theResult.myIsOK.resize( nbElems, false );
+  theResult.myErrors.resize( nbElems, ERR_OK );
+
+  SMDS_ParallelForBlocks( nbElems, [&]( size_t iBeg, size_t iEnd )
+  {
+    SMESH_Pattern worker;
+    worker.copyPatternForWorker( *this );
+
+    for ( size_t iE = iBeg; iE < iEnd; ++iE )
+    {
+      theResult.myIsOK  [ iE ] = theApply( worker, theElements[ iE ]);
+      theResult.myErrors[ iE ] = worker.GetErrorCode();
+      if ( !theResult.myIsOK[ iE ])
+        continue;
+
+      gp_XYZ* xyz = & theResult.myXYZ[ iE * theResult.myNbPoints ];
+      for ( size_t iP = 0; iP < worker.myPoints.size(); ++iP )
+        xyz[ iP ] = worker.myPoints[ iP ].myXYZ.XYZ();
+
+      const size_t nbNodes = std::min( theNbOrderedNodes, worker.myOrderedNodes.size() );
+      std::copy( worker.myOrderedNodes.begin(), worker.myOrderedNodes.begin() + nbNodes,
+                 theResult.myOrderedNodes.begin() + iE * theNbOrderedNodes );
+    }
+  });
+}
+
 //=======================================================================
 //function : Apply
 //purpose  : Compute nodes coordinates applying
@@ -3019,33 +3089,28 @@ bool SMESH_Pattern::Apply (SMESH_Mesh*                     theMesh,
 
   int ind1 = 0; // lowest point index for a face
 
-  // meshed geometry
-  TopoDS_Shape shape;
-//   int          shapeID = 0;
-//   SMESH_MeshEditor editor( theMesh );
-
-  // apply to each face in theFaces set
-  set<const SMDS_MeshFace*>::iterator face = theFaces.begin();
-  for ( ; face != theFaces.end(); ++face )
+  // apply to each face in theFaces set, in parallel
+  vector< const SMDS_MeshElement* > faces( theFaces.begin(), theFaces.end() );
+  TMappedPoints mapped;
+  mapOntoElements( faces, myNbKeyPntInBoundary.front(),
+                   [&]( SMESH_Pattern& pattern, const SMDS_MeshElement* face )
+                   {
+                     return pattern.Apply( static_cast< const SMDS_MeshFace* >( face ),
+                                           theNodeIndexOnKeyPoint1, theReverse );
+                   },
+                   mapped );
+
+  // store computed points
+  for ( size_t iF = 0; iF < faces.size(); ++iF )
   {
-//     int curShapeId = editor.FindShape( *face );
-//     if ( curShapeId != shapeID ) {
-//       if ( curShapeId )
-//         shape = theMesh->GetMeshDS()->IndexToShape( curShapeId );
-//       else
-//         shape.Nullify();
-//       shapeID = curShapeId;
-//     }
-    bool ok;
-    if ( shape.IsNull() )
-      ok = Apply( *face, theNodeIndexOnKeyPoint1, theReverse );
-    else
-      ok = Apply( theMesh, *face, shape, theNodeIndexOnKeyPoint1, theReverse );
-    if ( !ok ) {
-      MESSAGE( "Failed on " << *face );
+    const SMDS_MeshElement* face = faces[ iF ];
+    myErrorCode = mapped.myErrors[ iF ];
+    if ( !mapped.myIsOK[ iF ] ) {
+      MESSAGE( "Failed on " << face );
       continue;
     }
-    myElements.push_back( *face );
+    myIsComputed = true;
+    myElements.push_back( face );
 
     // store computed points belonging to elements
     list< TElemDef >::iterator ll = myElemPointIDs.begin();
@@ -3057,18 +3122,18 @@ bool SMESH_Pattern::Apply (SMESH_Mesh*                     theMesh,
       for ( TElemDef::iterator id = pIds.begin(); id != pIds.end(); id++ ) {
         int pIndex = *id + ind1;
         xyzIds.push_back( pIndex );
-        myXYZ[ pIndex ] = myPoints[ *id ].myXYZ.XYZ();
+        myXYZ[ pIndex ] = mapped.XYZ( iF, *id );
         myReverseConnectivity[ pIndex ].push_back( & xyzIds );
       }
     }
     // put points on links to myIdsOnBoundary,
     // they will be used to sew new elements on adjacent refined elements
-    int nbNodes = (*face)->NbCornerNodes(), eID = nbNodes + 1;
+    int nbNodes = face->NbCornerNodes(), eID = nbNodes + 1;
     for ( int i = 0; i < nbNodes; i++ )
     {
       list< TPoint* > & linkPoints = getShapePoints( eID++ );
-      const SMDS_MeshNode* n1 = myOrderedNodes[ i ];
-      const SMDS_MeshNode* n2 = myOrderedNodes[( i+1 ) % nbNodes ];
+      const SMDS_MeshNode* n1 = mapped.Node( iF, i );
+      const SMDS_MeshNode* n2 = mapped.Node( iF, ( i+1 ) % nbNodes );
       // make a link and a node set
       TNodeSet linkSet, node1Set;
       linkSet.insert( n1 );
@@ -3142,15 +3207,28 @@ bool SMESH_Pattern::Apply (std::set<const SMDS_MeshVolume*> & theVolumes,
 
   int ind1 = 0; // lowest point index for an element
 
-  // apply to each element in theVolumes set
-  set<const SMDS_MeshVolume*>::iterator vol = theVolumes.begin();
-  for ( ; vol != theVolumes.end(); ++vol )
+  // apply to each element in theVolumes set, in parallel
+  vector< const SMDS_MeshElement* > volumes( theVolumes.begin(), theVolumes.end() );
+  TMappedPoints mapped;
+  mapOntoElements( volumes, SMESH_Block::NbVertices(),
+                   [&]( SMESH_Pattern& pattern, const SMDS_MeshElement* vol )
+                   {
+                     return pattern.Apply( static_cast< const SMDS_MeshVolume* >( vol ),
+                                           theNode000Index, theNode001Index );
+                   },
+                   mapped );
+
+  // store computed points
+  for ( size_t iV = 0; iV < volumes.size(); ++iV )
   {
-    if ( !Apply( *vol, theNode000Index, theNode001Index )) {
-      MESSAGE( "Failed on " << *vol );
+    const SMDS_MeshElement* vol = volumes[ iV ];
+    myErrorCode = mapped.myErrors[ iV ];
+    if ( !mapped.myIsOK[ iV ] ) {
+      MESSAGE( "Failed on " << vol );
       continue;
     }
-    myElements.push_back( *vol );
+    myIsComputed = true;
+    myElements.push_back( vol );
 
     // store computed points belonging to elements
     list< TElemDef >::iterator ll = myElemPointIDs.begin();
@@ -3162,7 +3240,7 @@ bool SMESH_Pattern::Apply (std::set<const SMDS_MeshVolume*> & theVolumes,
       for ( TElemDef::iterator id = pIds.begin(); id != pIds.end(); id++ ) {
         int pIndex = *id + ind1;
         xyzIds.push_back( pIndex );
-        myXYZ[ pIndex ] = myPoints[ *id ].myXYZ.XYZ();
+        myXYZ[ pIndex ] = mapped.XYZ( iV, *id );
         myReverseConnectivity[ pIndex ].push_back( & xyzIds );
       }
     }
@@ -3174,22 +3252,22 @@ bool SMESH_Pattern::Apply (std::set<const SMDS_MeshVolume*> & theVolumes,
       TNodeSet subNodes;
       vector< int > subIDs;
       if ( SMESH_Block::IsVertexID( Id )) {
-        subNodes.insert( myOrderedNodes[ Id - 1 ]);
+        subNodes.insert( mapped.Node( iV, Id - 1 ));
       }
       else if ( SMESH_Block::IsEdgeID( Id )) {
         SMESH_Block::GetEdgeVertexIDs( Id, subIDs );
-        subNodes.insert( myOrderedNodes[ subIDs.front() - 1 ]);
-        subNodes.insert( myOrderedNodes[ subIDs.back() - 1 ]);
+        subNodes.insert( mapped.Node( iV, subIDs.front() - 1 ));
+        subNodes.insert( mapped.Node( iV, subIDs.back() - 1 ));
       }
       else {
         SMESH_Block::GetFaceEdgesIDs( Id, subIDs );
         int e1 = subIDs[ 0 ], e2 = subIDs[ 1 ];
         SMESH_Block::GetEdgeVertexIDs( e1, subIDs );
-        subNodes.insert( myOrderedNodes[ subIDs.front() - 1 ]);
-        subNodes.insert( myOrderedNodes[ subIDs.back() - 1 ]);
+        subNodes.insert( mapped.Node( iV, subIDs.front() - 1 ));
+        subNodes.insert( mapped.Node( iV, subIDs.back() - 1 ));
         SMESH_Block::GetEdgeVertexIDs( e2, subIDs );
-        subNodes.insert( myOrderedNodes[ subIDs.front() - 1 ]);
-        subNodes.insert( myOrderedNodes[ subIDs.back() - 1 ]);
+        subNodes.insert( mapped.Node( iV, subIDs.front() - 1 ));
+        subNodes.insert( mapped.Node( iV, subIDs.back() - 1 ));
       }
       // add points
       list< TPoint* > & points = getShapePoints( Id );
@@ -3200,7 +3278,7 @@ bool SMESH_Pattern::Apply (std::set<const SMDS_MeshVolume*> & theVolumes,
       for ( ; p != points.end(); p++ )
         indList.push_back( pointIndex[ *p ] + ind1 );
       if ( subNodes.size() == 1 ) // vertex case
-        myXYZIdToNodeMap[ indList.back() ] = myOrderedNodes[ Id - 1 ];
+        myXYZIdToNodeMap[ indList.back() ] = mapped.Node( iV, Id - 1 );
     }
     ind1 += myPoints.size();
   }
@@ -29,6 +29,7 @@
 
 #include "SMESH_SMESH.hxx"
 
+#include <functional>
 #include <vector>
 #include <list>
 #include <map>
@@ -351,6 +352,31 @@ private:
                                                   const TopoDS_Shape& theShape);
   // return submesh containing elements bound to theShape in theMesh
 
+  void copyPatternForWorker(const SMESH_Pattern& thePattern);
+  // copy the loaded pattern to apply it to mesh elements in a separate thread
+
+  struct TMappedPoints // points of the pattern mapped onto mesh elements
+  {
+    size_t                              myNbPoints, myNbOrderedNodes; // per element
+    std::vector< gp_XYZ >               myXYZ;
+    std::vector< const SMDS_MeshNode* > myOrderedNodes;
+    std::vector< char >                 myIsOK;
+    std::vector< ErrorCode >            myErrors;
+
+    const gp_XYZ&        XYZ ( size_t iElem, int iPoint ) const
+    { return myXYZ[ iElem * myNbPoints + iPoint ]; }
+    const SMDS_MeshNode* Node( size_t iElem, int iNode ) const
+    { return myOrderedNodes[ iElem * myNbOrderedNodes + iNode ]; }
+  };
+
+  typedef std::function< bool( SMESH_Pattern&, const SMDS_MeshElement* ) > TApplyFun;
+
+  void mapOntoElements(const std::vector< const SMDS_MeshElement* >& theElements,
+                       const size_t                                  theNbOrderedNodes,
+                       const TApplyFun&                              theApply,
+                       TMappedPoints&                                theResult) const;
+  // map the pattern onto mesh elements in parallel
+
  private:
   // fields
 
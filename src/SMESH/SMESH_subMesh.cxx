@@ -1507,7 +1507,14 @@ bool SMESH_subMesh::ComputeStateEngine(compute_event event)
       {
         algo = GetAlgo();
         ASSERT(algo);
-        ret = algo->CheckHypothesis((*_father), _subShape, hyp_status);
+        {
+          SMESH_ComputeProfiler::Scope checkScope( &gen->GetComputeProfiler(),
+                                                   SMESH_ComputeProfiler::CHECK_HYPOTHESIS,
+                                                   algo->GetName(), _father->GetId(),
+                                                   _Id, _subShape.ShapeType() );
+          ret = algo->CheckHypothesis((*_father), _subShape, hyp_status);
+          checkScope.SetResult( ret );
+        }
         if (!ret)
         {
           MESSAGE("***** verify compute state *****");
@@ -1559,6 +1566,10 @@ bool SMESH_subMesh::ComputeStateEngine(compute_event event)
         ret = false;
         _computeState = FAILED_TO_COMPUTE;
         _computeError = SMESH_ComputeError::New(COMPERR_OK,"",algo);
+        SMESH_ComputeProfiler::Scope computeScope( &gen->GetComputeProfiler(),
+                                                   SMESH_ComputeProfiler::COMPUTE,
+                                                   algo->GetName(), _father->GetId(),
+                                                   _Id, _subShape.ShapeType() );
         try {
           OCC_CATCH_SIGNALS;
 
@@ -1646,6 +1657,17 @@ bool SMESH_subMesh::ComputeStateEngine(compute_event event)
                    !algo->isDegenerated( TopoDS::Edge( subS.Current() ))))
               ret = false;
         }
+        if ( gen->GetComputeProfiler().IsEnabled() )
+        {
+          smIdType nbNodes = 0, nbElems = 0;
+          for ( subS.ReInit(); subS.More(); subS.Next() )
+            if ( SMESHDS_SubMesh* smDS = _father->GetMeshDS()->MeshElements( subS.Current() ))
+            {
+              nbNodes += smDS->NbNodes();
+              nbElems += smDS->NbElements();
+            }
+          computeScope.SetResult( ret, nbNodes, nbElems );
+        }
 #ifdef PRINT_WHO_COMPUTE_WHAT
         for (subS.ReInit(); subS.More(); subS.Next())
         {
@@ -1973,7 +1995,12 @@ bool SMESH_subMesh::Evaluate(MapShapeNbElems& aResMap)
     }
     else
     {
+      SMESH_ComputeProfiler::Scope evalScope( &_father->GetGen()->GetComputeProfiler(),
+                                              SMESH_ComputeProfiler::EVALUATE,
+                                              algo->GetName(), _father->GetId(),
+                                              _Id, _subShape.ShapeType() );
       ret = algo->Evaluate((*_father), _subShape, aResMap);
+      evalScope.SetResult( ret );
     }
     aResMap.insert( make_pair( this,vector<smIdType>(0)));
   }
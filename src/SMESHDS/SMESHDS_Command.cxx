@@ -480,6 +480,18 @@ const list < double >&SMESHDS_Command::GetCoords()
         return myReals;
 }
 
+//=======================================================================
+//function : GetMemorySize
+//purpose  : Return bytes allocated for the command; a node of std::list
+//           holds 2 pointers besides a value
+//=======================================================================
+size_t SMESHDS_Command::GetMemorySize() const
+{
+        return ( sizeof( SMESHDS_Command ) +
+                 myIntegers.size() * ( sizeof( smIdType ) + 2 * sizeof( void* )) +
+                 myReals.size()    * ( sizeof( double )   + 2 * sizeof( void* )));
+}
+
 
 //********************************************************************
 //*****             Methods for quadratic elements              ******
@@ -115,6 +115,7 @@ class SMESHDS_EXPORT SMESHDS_Command
         smIdType GetNumber();
         const std::list<smIdType> & GetIndexes();
         const std::list<double> & GetCoords();
+        size_t GetMemorySize() const;
          ~SMESHDS_Command();
   private:
         SMESHDS_CommandType myType;
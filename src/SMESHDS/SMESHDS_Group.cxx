@@ -166,6 +166,17 @@ int SMESHDS_Group::GetTic() const
   return myGroup.Tic();
 }
 
+//================================================================================
+/*!
+ * \brief Return bytes allocated for the group
+ */
+//================================================================================
+
+size_t SMESHDS_Group::GetMemorySize() const
+{
+  return SMESHDS_GroupBase::GetMemorySize() + myGroup.GetMemorySize();
+}
+
 //=======================================================================
 //function : SetType
 //purpose  : 
@@ -68,6 +68,8 @@ class SMESHDS_EXPORT SMESHDS_Group : public SMESHDS_GroupBase
 
   SMDS_MeshGroup& SMDSGroup() { return myGroup; }
 
+  virtual size_t GetMemorySize() const;
+
  private:
 
   SMDS_MeshGroup myGroup;
@@ -117,6 +117,16 @@ smIdType SMESHDS_GroupBase::Extent() const
   return nb;
 }
 
+//=======================================================================
+//function : GetMemorySize
+//purpose  : Return bytes allocated for the group
+//=======================================================================
+
+size_t SMESHDS_GroupBase::GetMemorySize() const
+{
+  return sizeof( SMESHDS_GroupBase ) + myStoreName.capacity();
+}
+
 //=======================================================================
 //function : IsEmpty
 //purpose  : 
@@ -73,6 +73,8 @@ class SMESHDS_EXPORT SMESHDS_GroupBase
 
   virtual int GetTic() const = 0;
 
+  virtual size_t GetMemorySize() const; // bytes allocated for the group
+
   virtual ~SMESHDS_GroupBase() {}
 
   void SetColor (const Quantity_Color& theColor)
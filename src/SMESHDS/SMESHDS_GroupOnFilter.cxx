@@ -29,6 +29,7 @@
 #include "ObjectPool.hxx"
 #include "SMESHDS_Mesh.hxx"
 
+#include <algorithm>
 #include <numeric>
 #include <limits>
 
@@ -38,6 +39,17 @@ using namespace std;
 
 //#undef WITH_TBB
 
+namespace
+{
+  // min nb of changed elements to update a group from scratch
+  const size_t theMinNbChangesToUpdateAll = 1000;
+
+  bool lessByID( const SMDS_MeshElement* e1, const SMDS_MeshElement* e2 )
+  {
+    return e1->GetID() < e2->GetID();
+  }
+}
+
 //=============================================================================
 /*!
  * Creates a group based on thePredicate
@@ -50,10 +62,12 @@ SMESHDS_GroupOnFilter::SMESHDS_GroupOnFilter (const int                 theID,
                                               const SMESH_PredicatePtr& thePredicate)
   : SMESHDS_GroupBase( theID, theMesh, theType ),
     SMDS_ElementHolder( theMesh ),
+    myLocality( SMESH::Controls::Functor::MESH ),
     myMeshInfo( SMDSEntity_Last, 0 ),
     myMeshModifTime( 0 ),
     myPredicateTic( 0 ),
-    myNbElemToSkip( 0 )
+    myNbElemToSkip( 0 ),
+    myChangesOverflow( true )
 {
   SetPredicate( thePredicate );
 }
@@ -67,10 +81,14 @@ SMESHDS_GroupOnFilter::SMESHDS_GroupOnFilter (const int                 theID,
 void SMESHDS_GroupOnFilter::SetPredicate( const SMESH_PredicatePtr& thePredicate )
 {
   myPredicate = thePredicate;
+  myLocality  = myPredicate ? myPredicate->GetLocality() : SMESH::Controls::Functor::MESH;
   ++myPredicateTic;
   setChanged();
   if ( myPredicate )
     myPredicate->SetMesh( GetMesh() );
+
+  // to update incrementally, collect changes of elements
+  trackChanges( myLocality != SMESH::Controls::Functor::MESH );
 }
 
 //================================================================================
@@ -85,6 +103,20 @@ smIdType SMESHDS_GroupOnFilter::Extent() const
   return std::accumulate( myMeshInfo.begin(), myMeshInfo.end(), 0 );
 }
 
+//================================================================================
+/*!
+ * \brief Return bytes allocated for the group including cached elements
+ */
+//================================================================================
+
+size_t SMESHDS_GroupOnFilter::GetMemorySize() const
+{
+  return ( SMESHDS_GroupBase::GetMemorySize() +
+           ( myMeshInfo.capacity() + myChangedNodes.capacity() +
+             myChangedCells.capacity() + myTouchedNodes.capacity() ) * sizeof( smIdType ) +
+           myElements.capacity() * sizeof( const SMDS_MeshElement* ));
+}
+
 //================================================================================
 /*!
  * \brief Checks emptyness
@@ -93,7 +125,7 @@ smIdType SMESHDS_GroupOnFilter::Extent() const
 
 bool SMESHDS_GroupOnFilter::IsEmpty()
 {
-  if ( IsUpToDate() )
+  if ( IsUpToDate() || updateIncrementally() )
   {
     return ( Extent() == 0 );
   }
@@ -250,13 +282,18 @@ SMDS_ElemIteratorPtr SMESHDS_GroupOnFilter::GetElements() const
   size_t nbToFind = std::numeric_limits<size_t>::max();
   size_t totalNb  = GetMesh()->GetMeshInfo().NbElements( GetType() );
 
+  SMESHDS_GroupOnFilter* me = const_cast<SMESHDS_GroupOnFilter*>( this );
+
   SMDS_ElemIteratorPtr elemIt; // iterator on all elements to initialize TIterator
   if ( myPredicate )
   {
     myPredicate->SetMesh( GetMesh() ); // hope myPredicate updates self here if necessary
 
-    if ( !IsUpToDate() )
+    if ( !IsUpToDate() && !updateIncrementally() )
+    {
+      me->setChanged(); // not to add found elements to old ones
       updateParallel();
+    }
 
     elemIt = GetMesh()->elementsIterator( GetType() );
     if ( IsUpToDate() )
@@ -277,7 +314,6 @@ SMDS_ElemIteratorPtr SMESHDS_GroupOnFilter::GetElements() const
   }
 
   // the iterator fills myElements if all elements are checked
-  SMESHDS_GroupOnFilter* me = const_cast<SMESHDS_GroupOnFilter*>( this );
   return SMDS_ElemIteratorPtr
     ( new TIterator( myPredicate, elemIt, nbToFind, totalNb, me->myElements, me->myElementsOK ));
 }
@@ -305,7 +341,7 @@ int SMESHDS_GroupOnFilter::getElementIds( void* ids, size_t idSize ) const
 {
   SMESHDS_GroupOnFilter* me = const_cast<SMESHDS_GroupOnFilter*>( this );
 
-  if ( !IsUpToDate() )
+  if ( !IsUpToDate() && !updateIncrementally() )
     me->setChanged();
     
   char* curID = (char*) ids;
@@ -370,7 +406,7 @@ bool SMESHDS_GroupOnFilter::IsUpToDate() const
 void SMESHDS_GroupOnFilter::update() const
 {
   SMESHDS_GroupOnFilter* me = const_cast<SMESHDS_GroupOnFilter*>( this );
-  if ( !IsUpToDate() )
+  if ( !IsUpToDate() && !updateIncrementally() )
   {
     me->setChanged();
     if ( !updateParallel() )
@@ -388,6 +424,92 @@ void SMESHDS_GroupOnFilter::update() const
   }
 }
 
+//================================================================================
+/*!
+ * \brief Updates myElements by re-checking elements changed since the last update
+ *        and, if the predicate depends on neighbors, elements sharing nodes with them
+ *  \retval bool - false if the group must be updated from scratch
+ */
+//================================================================================
+
+bool SMESHDS_GroupOnFilter::updateIncrementally() const
+{
+  if ( !myPredicate || !myElementsOK || myChangesOverflow )
+    return false;
+
+  SMESHDS_GroupOnFilter* me = const_cast<SMESHDS_GroupOnFilter*>( this );
+  const SMDS_Mesh*     mesh = GetMesh();
+  const SMDSAbs_ElementType type = GetType();
+
+  myPredicate->SetMesh( mesh );
+
+  // find IDs of elements to re-check
+
+  std::vector< smIdType > nodeIDs( myChangedNodes ), elemIDs;
+  if ( myLocality == SMESH::Controls::Functor::NEIGHBORS )
+  {
+    nodeIDs.insert( nodeIDs.end(), myTouchedNodes.begin(), myTouchedNodes.end() );
+    for ( size_t i = 0; i < myChangedCells.size(); ++i )
+      if ( const SMDS_MeshElement* cell = mesh->FindElement( myChangedCells[ i ]))
+        for ( SMDS_NodeIteratorPtr nIt = cell->nodeIterator(); nIt->more(); )
+          nodeIDs.push_back( nIt->next()->GetID() );
+  }
+  std::sort( nodeIDs.begin(), nodeIDs.end() );
+  nodeIDs.erase( std::unique( nodeIDs.begin(), nodeIDs.end() ), nodeIDs.end() );
+
+  if ( type == SMDSAbs_Node )
+  {
+    elemIDs.swap( nodeIDs );
+  }
+  else
+  {
+    elemIDs = myChangedCells;
+    for ( size_t i = 0; i < nodeIDs.size(); ++i )
+      if ( const SMDS_MeshNode* node = mesh->FindNode( nodeIDs[ i ]))
+        for ( SMDS_ElemIteratorPtr eIt = node->GetInverseElementIterator( type ); eIt->more(); )
+          elemIDs.push_back( eIt->next()->GetID() );
+    std::sort( elemIDs.begin(), elemIDs.end() );
+    elemIDs.erase( std::unique( elemIDs.begin(), elemIDs.end() ), elemIDs.end() );
+  }
+
+  // remove elements to re-check and removed ones
+
+  size_t nbKept = 0;
+  for ( size_t i = 0; i < myElements.size(); ++i )
+  {
+    const SMDS_MeshElement* e = myElements[ i ];
+    const smIdType         id = e->GetID();
+    if ( id > 0 && !std::binary_search( elemIDs.begin(), elemIDs.end(), id ))
+      me->myElements[ nbKept++ ] = e;
+  }
+  me->myElements.resize( nbKept );
+
+  // add satisfying elements keeping order by ID
+
+  for ( size_t i = 0; i < elemIDs.size(); ++i )
+  {
+    const SMDS_MeshElement* e;
+    if ( type == SMDSAbs_Node ) e = mesh->FindNode   ( elemIDs[ i ]);
+    else                        e = mesh->FindElement( elemIDs[ i ]);
+    if ( e && e->GetType() == type && myPredicate->IsSatisfy( elemIDs[ i ]))
+      me->myElements.push_back( e );
+  }
+  std::inplace_merge( me->myElements.begin(), me->myElements.begin() + nbKept,
+                      me->myElements.end(), lessByID );
+
+  me->myMeshInfo.assign( SMDSEntity_Last, 0 );
+  for ( size_t i = 0; i < myElements.size(); ++i )
+    ++me->myMeshInfo[ myElements[ i ]->GetEntityType() ];
+  me->myNbElemToSkip = 0;
+
+  me->myChangedNodes.clear();
+  me->myChangedCells.clear();
+  me->myTouchedNodes.clear();
+  me->setChanged( false );
+
+  return true;
+}
+
 //================================================================================
 /*!
  * \brief Updates myElements in parallel
@@ -523,6 +645,12 @@ void SMESHDS_GroupOnFilter::setChanged(bool changed)
     myElementsOK = false;
     myNbElemToSkip = 0;
     myMeshInfo.assign( SMDSEntity_Last, 0 );
+
+    // changes before the update are not needed
+    myChangedNodes.clear();
+    myChangedCells.clear();
+    myTouchedNodes.clear();
+    myChangesOverflow = ( myLocality == SMESH::Controls::Functor::MESH );
   }
 }
 
@@ -583,3 +711,86 @@ void SMESHDS_GroupOnFilter::add( const SMDS_MeshElement* element )
 {
   myElements.push_back( element );
 }
+
+//================================================================================
+/*!
+ * \brief Restore order of myElements by ID after mesh compacting
+ */
+//================================================================================
+
+void SMESHDS_GroupOnFilter::compact()
+{
+  std::sort( myElements.begin(), myElements.end(), lessByID );
+
+  // IDs of changed elements are not valid any more
+  if ( !myChangedNodes.empty() || !myChangedCells.empty() )
+  {
+    clearVector( myChangedNodes );
+    clearVector( myChangedCells );
+    clearVector( myTouchedNodes );
+    myChangesOverflow = true;
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Stop collecting changes before mesh clearing
+ */
+//================================================================================
+
+void SMESHDS_GroupOnFilter::clear()
+{
+  clearVector( myChangedNodes );
+  clearVector( myChangedCells );
+  clearVector( myTouchedNodes );
+  myChangesOverflow = true;
+}
+
+//================================================================================
+/*!
+ * \brief Remember IDs of a changed element to re-check at update.
+ *        Stop collecting if there are too many changes.
+ */
+//================================================================================
+
+void SMESHDS_GroupOnFilter::elementChanged( const SMDS_MeshElement* element, TChange change )
+{
+  if ( myChangesOverflow || !myElementsOK )
+    return; // the group will be updated from scratch
+
+  // cells are needed for a group of nodes if nodes of cells matter
+  const bool withNeighbors = ( myLocality == SMESH::Controls::Functor::NEIGHBORS );
+  const bool toStoreCells  = ( GetType() != SMDSAbs_Node || withNeighbors );
+
+  switch ( change )
+  {
+  case NODE_ADDED:
+    myChangedNodes.push_back( element->GetID() );
+    break;
+  case CELL_ADDED:
+    if ( toStoreCells )
+      myChangedCells.push_back( element->GetID() );
+    break;
+  case ELEM_REMOVED:
+  case ELEM_MODIFIED:
+    if ( element->GetType() == SMDSAbs_Node )
+    {
+      myChangedNodes.push_back( element->GetID() );
+    }
+    else if ( toStoreCells )
+    {
+      myChangedCells.push_back( element->GetID() );
+      if ( withNeighbors ) // old nodes
+        for ( SMDS_NodeIteratorPtr nIt = element->nodeIterator(); nIt->more(); )
+          myTouchedNodes.push_back( nIt->next()->GetID() );
+    }
+    break;
+  }
+
+  const size_t nbChanges = myChangedNodes.size() + myChangedCells.size() + myTouchedNodes.size();
+  if ( nbChanges > theMinNbChangesToUpdateAll &&
+       nbChanges > (size_t) GetMesh()->GetMeshInfo().NbElements( GetType() ) / 10 )
+  {
+    clear(); // it's faster to update from scratch
+  }
+}
@@ -58,6 +58,8 @@ class SMESHDS_EXPORT SMESHDS_GroupOnFilter: public SMESHDS_GroupBase, SMDS_Eleme
 
   virtual smIdType  Extent() const;
 
+  virtual size_t GetMemorySize() const;
+
   virtual bool IsEmpty();
 
   virtual bool Contains (const smIdType theID);
@@ -75,12 +77,15 @@ class SMESHDS_EXPORT SMESHDS_GroupOnFilter: public SMESHDS_GroupBase, SMDS_Eleme
   virtual SMDS_ElemIteratorPtr getElements();
   virtual void tmpClear();
   virtual void add( const SMDS_MeshElement* element );
-  virtual void compact() {};
+  virtual void compact();
+  virtual void clear();
+  virtual void elementChanged( const SMDS_MeshElement* element, TChange change );
 
  private:
 
   void update() const;
   bool updateParallel() const;
+  bool updateIncrementally() const;
   void setChanged(bool changed=true);
   const SMDS_MeshElement* setNbElemToSkip( SMDS_ElemIteratorPtr& elIt );
   int getElementIds( void* ids, size_t idSize ) const;
@@ -90,14 +95,21 @@ class SMESHDS_EXPORT SMESHDS_GroupOnFilter: public SMESHDS_GroupBase, SMDS_Eleme
   //    to skip before the first OK element. As well remember total nb of OK
   //    elements (myMeshInfo) to stop iteration as all OK elements are found.
   // 2) The case of enough free memory. Remember all OK elements (myElements).
+  //    Then, if the predicate is local, collect IDs of elements changed since
+  //    the update, to re-check only them and their neighbors at the next update.
 
   SMESH_PredicatePtr                    myPredicate;
+  SMESH::Controls::Functor::Locality    myLocality;
   std::vector< smIdType >               myMeshInfo;
   std::vector< const SMDS_MeshElement*> myElements;
   bool                                  myElementsOK;
   size_t                                myMeshModifTime; // when myMeshInfo was updated
   int                                   myPredicateTic;
   size_t                                myNbElemToSkip;
+  std::vector< smIdType >               myChangedNodes; // added, removed and moved nodes
+  std::vector< smIdType >               myChangedCells; // added, removed and modified cells
+  std::vector< smIdType >               myTouchedNodes; // nodes of removed and modified cells
+  bool                                  myChangesOverflow; // too many changes to collect
 };
 
 #endif
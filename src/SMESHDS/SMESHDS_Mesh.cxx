@@ -215,6 +215,19 @@ void SMESHDS_Mesh::MoveNode(const SMDS_MeshNode *n, double x, double y, double z
   myScript->MoveNode(n->GetID(), x, y, z);
 }
 
+//=======================================================================
+//function : MoveNodes
+//purpose  : Move several nodes at once
+//=======================================================================
+
+void SMESHDS_Mesh::MoveNodes(const std::vector<const SMDS_MeshNode*>& nodes,
+                             const std::vector<double>&               xyz)
+{
+  SMDS_Mesh::MoveNodes( nodes, xyz );
+  for ( size_t i = 0; i < nodes.size(); ++i )
+    myScript->MoveNode( nodes[i]->GetID(), xyz[ 3 * i ], xyz[ 3 * i + 1 ], xyz[ 3 * i + 2 ]);
+}
+
 //=======================================================================
 //function : ChangeElementNodes
 //purpose  : Changed nodes of an element provided that nb of nodes does not change
@@ -898,24 +911,28 @@ void SMESHDS_Mesh::RemoveNode(const SMDS_MeshNode * n)
 
   myScript->RemoveNode(n->GetID());
 
+  std::vector<const SMDS_MeshElement *> removedElems;
+  std::vector<const SMDS_MeshElement *> removedNodes;
+
   // remove inverse elements from the sub-meshes
   for ( SMDS_ElemIteratorPtr eIt = n->GetInverseElementIterator(); eIt->more() ; )
   {
     const SMDS_MeshElement* e = eIt->next();
     if ( SMESHDS_SubMesh * sm = MeshElements( e->getshapeId() ))
       sm->RemoveElement( e );
+    removedElems.push_back( e );
   }
   if ( SMESHDS_SubMesh * sm = MeshElements( n->getshapeId() ))
     sm->RemoveNode( n );
 
-
-  std::vector<const SMDS_MeshElement *> removedElems;
-  std::vector<const SMDS_MeshElement *> removedNodes;
-
-  SMDS_Mesh::RemoveElement( n, removedElems, removedNodes, true );
-
+  // remove from groups before removal from the mesh as groups store IDs of elements
+  removedNodes.push_back( n );
   removeFromContainers( this, myGroups, removedElems );
   removeFromContainers( this, myGroups, removedNodes );
+  removedElems.clear();
+  removedNodes.clear();
+
+  SMDS_Mesh::RemoveElement( n, removedElems, removedNodes, true );
 }
 
 //=======================================================================
@@ -2264,6 +2281,31 @@ void SMESHDS_Mesh::CompactMesh()
   this->myScript->SetModified(true); // notify GUI client for buildPrs when update
 }
 
+//================================================================================
+/*!
+ * \brief Return memory used by the mesh split by data structure and by entity type
+ */
+//================================================================================
+
+void SMESHDS_Mesh::GetMemoryUsage( SMDS_MemoryUsage& usage, bool sampling ) const
+{
+  SMDS_Mesh::GetMemoryUsage( usage, sampling );
+
+  size_t subMeshesSize = 0;
+  for ( SMESHDS_SubMeshIteratorPtr smIt = SubMeshes(); smIt->more(); )
+    subMeshesSize += smIt->next()->GetMemorySize();
+  usage.Add( "sub-meshes", subMeshesSize );
+
+  size_t groupsSize = 0;
+  for ( const SMESHDS_GroupBase* group : myGroups )
+    groupsSize += group->GetMemorySize();
+  usage.Add( "groups", groupsSize );
+
+  bool isSampled = false;
+  usage.Add( "command log", myScript->GetMemorySize( sampling, &isSampled ));
+  usage.SetSampled( isSampled );
+}
+
 void SMESHDS_Mesh::CleanDownWardConnectivity()
 {
   myGrid->CleanDownwardConnectivity();
@@ -2282,6 +2324,22 @@ void SMESHDS_Mesh::BuildDownWardConnectivity(bool withEdges)
  */
 bool SMESHDS_Mesh::ModifyCellNodes(vtkIdType vtkVolId, std::map<int,int> localClonedNodeIds)
 {
+  if ( !myChangeTrackers.empty() )
+  {
+    // notify of the cell and of its old and new nodes
+    if ( const SMDS_MeshElement* cell = FindElementVtk( vtkVolId ))
+      notifyChangeTrackers( cell, SMDS_ElementHolder::ELEM_MODIFIED );
+    std::map<int,int>::iterator old2new = localClonedNodeIds.begin();
+    for ( ; old2new != localClonedNodeIds.end(); ++old2new )
+    {
+      if ( const SMDS_MeshNode* oldNode = FindNodeVtk( old2new->first ))
+        notifyChangeTrackers( oldNode, SMDS_ElementHolder::ELEM_MODIFIED );
+      if ( const SMDS_MeshNode* newNode = FindNodeVtk( old2new->second ))
+        notifyChangeTrackers( newNode, SMDS_ElementHolder::ELEM_MODIFIED );
+    }
+  }
+  setMyModified();
+
   myGrid->ModifyCellNodes(vtkVolId, localClonedNodeIds);
   return true;
 }
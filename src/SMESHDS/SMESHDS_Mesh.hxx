@@ -610,6 +610,9 @@ class SMESHDS_EXPORT SMESHDS_Mesh : public SMDS_Mesh
      const std::vector<int>&                  quantities);
 
   virtual void MoveNode(const SMDS_MeshNode *, double x, double y, double z);
+  virtual void MoveNodes(const std::vector<const SMDS_MeshNode*>& nodes,
+                         const std::vector<double>&               xyz);
+  using SMDS_Mesh::MoveNodes;
   virtual void RemoveNode(const SMDS_MeshNode *);
   void RemoveElement(const SMDS_MeshElement *);
 
@@ -678,6 +681,7 @@ class SMESHDS_EXPORT SMESHDS_Mesh : public SMDS_Mesh
   bool IsGroupOfSubShapes (const TopoDS_Shape& aSubShape) const;
 
   virtual void CompactMesh();
+  virtual void GetMemoryUsage( SMDS_MemoryUsage& usage, bool sampling=false ) const;
   void CleanDownWardConnectivity();
   void BuildDownWardConnectivity(bool withEdges);
 
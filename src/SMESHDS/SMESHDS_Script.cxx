@@ -416,6 +416,32 @@ const list<SMESHDS_Command*>& SMESHDS_Script::GetCommands()
   return myCommands;
 }
 
+//=======================================================================
+//function : GetMemorySize
+//purpose  : Return bytes allocated for commands. If sampling, sizes of
+//           at most 100 last commands are extrapolated to all commands
+//=======================================================================
+size_t SMESHDS_Script::GetMemorySize(bool sampling, bool* isSampled) const
+{
+  const size_t nbSamples  = 100;
+  size_t       size       = 0;
+  size_t       nbVisited  = 0;
+  list<SMESHDS_Command*>::const_reverse_iterator cmd = myCommands.rbegin();
+  for ( ; cmd != myCommands.rend(); ++cmd, ++nbVisited )
+  {
+    if ( sampling && nbVisited == nbSamples )
+      break;
+    size += (*cmd)->GetMemorySize() + 3 * sizeof( void* ); // command and list node
+  }
+  if ( nbVisited > 0 && nbVisited < myCommands.size() )
+    size = size_t( double( size ) / double( nbVisited ) * double( myCommands.size() ));
+
+  if ( isSampled )
+    *isSampled = ( nbVisited < myCommands.size() );
+
+  return size;
+}
+
 
 //********************************************************************
 //*****             Methods for quadratic elements              ******
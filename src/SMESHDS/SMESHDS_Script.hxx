@@ -122,6 +122,7 @@ class SMESHDS_EXPORT SMESHDS_Script
         void ClearMesh();
         void Clear();
         const std::list<SMESHDS_Command*> & GetCommands();
+        size_t GetMemorySize(bool sampling=false, bool* isSampled=0) const;
 
   private:
         SMESHDS_Command* getCommand(const SMESHDS_CommandType aType);
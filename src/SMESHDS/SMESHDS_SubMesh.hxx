@@ -74,6 +74,10 @@ class SMESHDS_EXPORT SMESHDS_SubMesh : public SMDS_ElementHolder
   virtual bool Contains(const SMDS_MeshElement * ME) const;      // check if elem or node is in
   virtual bool IsQuadratic() const;
 
+  // bytes allocated for the sub-mesh; elements are stored by the mesh
+  size_t GetMemorySize() const
+  { return sizeof( *this ) + mySubMeshes.capacity() * sizeof( TSubMeshSet::value_type ); }
+
   // clear the contents
   virtual void Clear();
 
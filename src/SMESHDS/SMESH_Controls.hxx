@@ -56,6 +56,15 @@ namespace SMESH {
       virtual ~Functor(){}
       virtual void SetMesh( const SMDS_Mesh* theMesh ) = 0;
       virtual SMDSAbs_ElementType GetType() const = 0;
+
+      // what a value for an element depends on
+      enum Locality {
+        ELEMENT,   // the element and its nodes
+        NEIGHBORS, // also elements sharing nodes with the element
+        MESH       // the whole mesh
+      };
+      // allows SMESHDS_GroupOnFilter to re-check modified elements only
+      virtual Locality GetLocality() const { return MESH; }
     };
     typedef boost::shared_ptr<Functor> FunctorPtr;
 
@@ -30,6 +30,7 @@
 #include "SMDS_MeshVolume.hxx"
 #include "SMDS_VolumeTool.hxx"
 #include "SMESH_MeshAlgos.hxx"
+#include "SMESH_TypeDefs.hxx"
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Curve2d.hxx>
@@ -1604,8 +1605,6 @@ void SMESH_Block::init()
 //purpose  : prepare to work with theVolume
 //=======================================================================
 
-#define gpXYZ(n) gp_XYZ(n->X(),n->Y(),n->Z())
-
 bool SMESH_Block::LoadMeshBlock(const SMDS_MeshVolume*        theVolume,
                                 const int                     theNode000Index,
                                 const int                     theNode001Index,
@@ -1685,14 +1684,14 @@ bool SMESH_Block::LoadMeshBlock(const SMDS_MeshVolume*        theVolume,
   V111 = vFxy1[2];
 
   // set points coordinates
-  myPnt[ ID_V000 - 1 ] = gpXYZ( nn[ V000 ] );
-  myPnt[ ID_V100 - 1 ] = gpXYZ( nn[ V100 ] );
-  myPnt[ ID_V010 - 1 ] = gpXYZ( nn[ V010 ] );
-  myPnt[ ID_V110 - 1 ] = gpXYZ( nn[ V110 ] );
-  myPnt[ ID_V001 - 1 ] = gpXYZ( nn[ V001 ] );
-  myPnt[ ID_V101 - 1 ] = gpXYZ( nn[ V101 ] );
-  myPnt[ ID_V011 - 1 ] = gpXYZ( nn[ V011 ] );
-  myPnt[ ID_V111 - 1 ] = gpXYZ( nn[ V111 ] );
+  myPnt[ ID_V000 - 1 ] = SMESH_TNodeXYZ( nn[ V000 ] );
+  myPnt[ ID_V100 - 1 ] = SMESH_TNodeXYZ( nn[ V100 ] );
+  myPnt[ ID_V010 - 1 ] = SMESH_TNodeXYZ( nn[ V010 ] );
+  myPnt[ ID_V110 - 1 ] = SMESH_TNodeXYZ( nn[ V110 ] );
+  myPnt[ ID_V001 - 1 ] = SMESH_TNodeXYZ( nn[ V001 ] );
+  myPnt[ ID_V101 - 1 ] = SMESH_TNodeXYZ( nn[ V101 ] );
+  myPnt[ ID_V011 - 1 ] = SMESH_TNodeXYZ( nn[ V011 ] );
+  myPnt[ ID_V111 - 1 ] = SMESH_TNodeXYZ( nn[ V111 ] );
 
   // fill theOrderedNodes
   theOrderedNodes.resize( 8 );
@@ -40,12 +40,15 @@
  *  \param [in] boundaryNodes - vector of nodes of a wire
  *  \param [in] face - the face
  *  \param [in] faceID - the face ID
+ *  \param [in] useBRepMesh - if true, triangulate by BRepMesh_Delaun
+ *         instead of SMESH_Delaunay2D
  */
 //================================================================================
 
 SMESH_Delaunay::SMESH_Delaunay(const std::vector< const UVPtStructVec* > & boundaryNodes,
                                const TopoDS_Face&                          face,
-                               const int                                   faceID)
+                               const int                                   faceID,
+                               const bool                                  useBRepMesh)
   : _face( face ), _faceID( faceID ), _scale( 1., 1. )
 {
   // compute _scale
@@ -85,12 +88,7 @@ SMESH_Delaunay::SMESH_Delaunay(const std::vector< const UVPtStructVec* > & bound
   _bndNodes.resize( nbP );
 
   // fill boundary points
-#if OCC_VERSION_LARGE <= 0x07030000
-  BRepMesh::Array1OfVertexOfDelaun bndVert( 1, 1 + nbP );
-#else
-  IMeshData::Array1OfVertexOfDelaun bndVert( 1, 1 + nbP );
-#endif
-  BRepMesh_Vertex v( 0, 0, BRepMesh_Frontier );
+  std::vector< gp_XY > bndUV( nbP );
   for ( size_t iW = 0; iW < boundaryNodes.size(); ++iW )
   {
     const UVPtStructVec& bndPnt = *boundaryNodes[iW];
@@ -102,12 +100,27 @@ SMESH_Delaunay::SMESH_Delaunay(const std::vector< const UVPtStructVec* > & bound
       _bndNodes[ iP-1 ] = bndPnt[i].node;
       bndPnt[i].node->setIsMarked( true );
 
-      v.ChangeCoord() = bndPnt[i].UV().Multiplied( _scale );
-      bndVert( iP )   = v;
+      bndUV[ iP-1 ] = bndPnt[i].UV().Multiplied( _scale );
     }
   }
 
   // triangulate the srcFace in 2D
+  if ( !useBRepMesh )
+  {
+    _flatDS.reset( new SMESH_Delaunay2D( bndUV ));
+    return;
+  }
+#if OCC_VERSION_LARGE <= 0x07030000
+  BRepMesh::Array1OfVertexOfDelaun bndVert( 1, 1 + nbP );
+#else
+  IMeshData::Array1OfVertexOfDelaun bndVert( 1, 1 + nbP );
+#endif
+  BRepMesh_Vertex v( 0, 0, BRepMesh_Frontier );
+  for ( iP = 1; iP <= nbP; ++iP )
+  {
+    v.ChangeCoord() = bndUV[ iP-1 ];
+    bndVert( iP )   = v;
+  }
   BRepMesh_Delaun Delaunay( bndVert );
   _triaDS = Delaunay.Result();
 }
@@ -141,8 +154,8 @@ const SMDS_MeshNode* SMESH_Delaunay::NextNode( double bc[3], int triaNodes[3] )
   {
     while ( !_noTriQueue.empty() )
     {
-      const SMDS_MeshNode*     node = _noTriQueue.front().first;
-      const BRepMesh_Triangle* tria = _noTriQueue.front().second;
+      const SMDS_MeshNode* node = _noTriQueue.front().first;
+      int                  tria = _noTriQueue.front().second;
       _noTriQueue.pop_front();
       if ( node->isMarked() )
         continue;
@@ -152,7 +165,7 @@ const SMDS_MeshNode* SMESH_Delaunay::NextNode( double bc[3], int triaNodes[3] )
       // find a Delaunay triangle containing the src node
       gp_XY uv = getNodeUV( _face, node );
       tria = FindTriangle( uv, tria, bc, triaNodes );
-      if ( tria )
+      if ( tria >= 0 )
       {
         addCloseNodes( node, tria, _faceID, _noTriQueue );
         return node;
@@ -160,7 +173,8 @@ const SMDS_MeshNode* SMESH_Delaunay::NextNode( double bc[3], int triaNodes[3] )
     }
     for ( ; _iBndNode < _bndNodes.size() &&  _noTriQueue.empty();  ++_iBndNode )
     {
-      if ( const BRepMesh_Triangle* tria = GetTriangleNear( _iBndNode ))
+      int tria = GetTriangleNear( _iBndNode );
+      if ( tria >= 0 )
         addCloseNodes( _bndNodes[ _iBndNode ], tria, _faceID, _noTriQueue );
     }
     if ( _noTriQueue.empty() )
@@ -176,13 +190,91 @@ const SMDS_MeshNode* SMESH_Delaunay::NextNode( double bc[3], int triaNodes[3] )
 /*!
  * \brief Find a Delaunay triangle containing a given 2D point and return
  *        barycentric coordinates within the found triangle
+ *  \param [in] UV - the point
+ *  \param [in] tria - a triangle to start search from
+ *  \param [out] bc - barycentric coordinates of the point
+ *  \param [out] triaNodes - indices of nodes of the found triangle
+ *  \return int - the found triangle; -1 if not found
  */
 //================================================================================
 
-const BRepMesh_Triangle* SMESH_Delaunay::FindTriangle( const gp_XY&             UV,
-                                                       const BRepMesh_Triangle* tria,
-                                                       double                   bc[3],
-                                                       int                      triaNodes[3] )
+int SMESH_Delaunay::FindTriangle( const gp_XY& UV,
+                                  int          tria,
+                                  double       bc[3],
+                                  int          triaNodes[3] )
+{
+  if ( !_flatDS )
+    return findTriangleBRepMesh( UV, tria, bc, triaNodes );
+
+  tria = _flatDS->FindTriangle( UV.Multiplied( _scale ), tria, bc );
+  if ( tria >= 0 )
+  {
+    const int* nodes = _flatDS->GetTriaNodes( tria );
+    triaNodes[0] = nodes[0];
+    triaNodes[1] = nodes[1];
+    triaNodes[2] = nodes[2];
+  }
+  return tria;
+}
+
+//================================================================================
+/*!
+ * \brief Find Delaunay triangles containing given 2D points
+ *  \param [in] uvs - the points
+ *  \param [out] trias - found triangles; -1 for points out of the triangulation
+ *  \param [out] bc - 3 barycentric coordinates per point
+ *  \param [out] triaNodes - 3 indices of triangle nodes per point
+ */
+//================================================================================
+
+void SMESH_Delaunay::FindTriangles( const std::vector< gp_XY >& uvs,
+                                    std::vector< int >&         trias,
+                                    std::vector< double >&      bc,
+                                    std::vector< int >&         triaNodes )
+{
+  trias.resize( uvs.size() );
+  bc.resize( 3 * uvs.size() );
+  triaNodes.resize( 3 * uvs.size() );
+
+  if ( _flatDS )
+  {
+    std::vector< gp_XY > scaledUV( uvs.size() );
+    for ( size_t i = 0; i < uvs.size(); ++i )
+      scaledUV[i] = uvs[i].Multiplied( _scale );
+
+    _flatDS->FindTriangles( scaledUV, trias, bc );
+
+    for ( size_t i = 0; i < uvs.size(); ++i )
+      if ( trias[i] >= 0 )
+      {
+        const int* nodes = _flatDS->GetTriaNodes( trias[i] );
+        triaNodes[ 3 * i     ] = nodes[0];
+        triaNodes[ 3 * i + 1 ] = nodes[1];
+        triaNodes[ 3 * i + 2 ] = nodes[2];
+      }
+  }
+  else
+  {
+    int tria = GetTriangleNear( 0 );
+    for ( size_t i = 0; i < uvs.size(); ++i )
+    {
+      trias[i] = findTriangleBRepMesh( uvs[i], tria, & bc[ 3 * i ], & triaNodes[ 3 * i ]);
+      if ( trias[i] >= 0 )
+        tria = trias[i];
+    }
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Find a triangle of BRepMesh data structure containing a given 2D point
+ */
+//================================================================================
+
+int SMESH_Delaunay::findTriangleBRepMesh( const gp_XY& UV,
+                                          int          iTria,
+                                          double       bc[3],
+                                          int          triaNodes[3] )
 {
   int   nodeIDs[3];
   gp_XY nodeUVs[3];
@@ -193,12 +285,13 @@ const BRepMesh_Triangle* SMESH_Delaunay::FindTriangle( const gp_XY&
 
   // prevent infinite loop in case of numerical instability
   // test case NRT_GRIDS_GEOM_BUGS_15_R7
-  const BRepMesh_Triangle* tria1 = 0;
-  const BRepMesh_Triangle* tria2 = tria;
+  int tria1 = 0;
+  int tria2 = iTria;
 
-  while ( tria )
+  while ( iTria > 0 )
   {
     // check if the uv is in tria
+    const BRepMesh_Triangle* tria = & _triaDS->GetElement( iTria );
 
     _triaDS->ElementNodes( *tria, nodeIDs );
     nodeUVs[0] = _triaDS->GetNode( nodeIDs[0] ).Coord();
@@ -209,25 +302,25 @@ const BRepMesh_Triangle* SMESH_Delaunay::FindTriangle( const gp_XY&
                                            nodeUVs[0], nodeUVs[1], nodeUVs[2],
                                            bc[0], bc[1] );
     if ( (bc[0] >= 0 && bc[1] >= 0 && bc[0] + bc[1] <= 1) ||
-         (tria == tria1 &&
+         (iTria == tria1 &&
           bc[0] >= -1e-14 && bc[1] >= -1e-14 && bc[0] + bc[1] <= 1 + 1e-14) )
     {
       if ( _triaDS->GetNode( nodeIDs[0] ).Movability() != BRepMesh_Frontier ||
            _triaDS->GetNode( nodeIDs[1] ).Movability() != BRepMesh_Frontier ||
            _triaDS->GetNode( nodeIDs[2] ).Movability() != BRepMesh_Frontier )
       {
-        return 0;
+        return -1;
       }
       bc[2] = 1 - bc[0] - bc[1];
       triaNodes[0] = nodeIDs[0] - 1;
       triaNodes[1] = nodeIDs[1] - 1;
       triaNodes[2] = nodeIDs[2] - 1;
-      return tria;
+      return iTria;
     }
 
-    if (tria == tria1) return 0;
+    if (iTria == tria1) return -1;
     tria1 = tria2;
-    tria2 = tria;
+    tria2 = iTria;
 
     // look for a neighbor triangle, which is adjacent to a link intersected
     // by a segment( triangle center -> uv )
@@ -237,8 +330,8 @@ const BRepMesh_Triangle* SMESH_Delaunay::FindTriangle( const gp_XY&
 
     tria->Edges( linkIDs, ori );
 
-    const BRepMesh_Triangle* prevTria = tria;
-    tria = 0;
+    const int prevTria = iTria;
+    iTria = 0;
 
     for ( int i = 0; i < 3; ++i )
     {
@@ -260,29 +353,35 @@ const BRepMesh_Triangle* SMESH_Delaunay::FindTriangle( const gp_XY&
       double uSeg = ( uv1 - gc ) ^ lin / crossSegLin;
       if ( 0. <= uSeg && uSeg <= 1. )
       {
-        tria = & _triaDS->GetElement( triIDs.Index( 1 ));
-        if ( tria == prevTria )
-          tria = & _triaDS->GetElement( triIDs.Index( 2 ));
-        if ( tria->Movability() != BRepMesh_Deleted )
+        iTria = triIDs.Index( 1 );
+        if ( iTria == prevTria )
+          iTria = triIDs.Index( 2 );
+        if ( _triaDS->GetElement( iTria ).Movability() != BRepMesh_Deleted )
           break;
       }
     }
   }
-  return tria;
+  return -1;
 }
 
 //================================================================================
 /*!
  * \brief Return a triangle sharing a given boundary node
  *  \param [in] iBndNode - index of the boundary node
- *  \return const BRepMesh_Triangle* - a found triangle
+ *  \return int - a found triangle; -1 if not found
  */
 //================================================================================
 
-const BRepMesh_Triangle* SMESH_Delaunay::GetTriangleNear( int iBndNode )
+int SMESH_Delaunay::GetTriangleNear( int iBndNode )
 {
+  if ( _flatDS )
+  {
+    if ( iBndNode < 0 || iBndNode >= _flatDS->NbNodes() )
+      return -1;
+    return _flatDS->GetTriangleNear( iBndNode );
+  }
   if ( iBndNode >= _triaDS->NbNodes() )
-    return 0;
+    return -1;
   int nodeIDs[3];
   int nbBndNodes = _bndNodes.size();
 #if OCC_VERSION_LARGE <= 0x07030000
@@ -303,7 +402,7 @@ const BRepMesh_Triangle* SMESH_Delaunay::GetTriangleNear( int iBndNode )
         if ( nodeIDs[0]-1 < nbBndNodes &&
              nodeIDs[1]-1 < nbBndNodes &&
              nodeIDs[2]-1 < nbBndNodes )
-          return &tria;
+          return triaIds.Index(1);
       }
     }
     if ( triaIds.Extent() > 1 )
@@ -315,11 +414,11 @@ const BRepMesh_Triangle* SMESH_Delaunay::GetTriangleNear( int iBndNode )
         if ( nodeIDs[0]-1 < nbBndNodes &&
              nodeIDs[1]-1 < nbBndNodes &&
              nodeIDs[2]-1 < nbBndNodes )
-          return &tria;
+          return triaIds.Index(2);
       }
     }
   }
-  return 0;
+  return -1;
 }
 
 //================================================================================
@@ -330,6 +429,8 @@ const BRepMesh_Triangle* SMESH_Delaunay::GetTriangleNear( int iBndNode )
 
 gp_XY SMESH_Delaunay::GetBndUV(const int iNode) const
 {
+  if ( _flatDS )
+    return _flatDS->GetNode( iNode );
   return _triaDS->GetNode( iNode+1 ).Coord();
 }
 
@@ -339,10 +440,10 @@ gp_XY SMESH_Delaunay::GetBndUV(const int iNode) const
  */
 //================================================================================
 
-void SMESH_Delaunay::addCloseNodes( const SMDS_MeshNode*     node,
-                                    const BRepMesh_Triangle* tria,
-                                    const int                faceID,
-                                    TNodeTriaList &          _noTriQueue )
+void SMESH_Delaunay::addCloseNodes( const SMDS_MeshNode* node,
+                                    const int            tria,
+                                    const int            faceID,
+                                    TNodeTriaList &      _noTriQueue )
 {
   // find in-FACE nodes
   SMDS_ElemIteratorPtr elems = node->GetInverseElementIterator(SMDSAbs_Face);
@@ -377,36 +478,53 @@ void SMESH_Delaunay::ToPython() const
   text << "mesh=smesh.Mesh()\n";
   const char* endl = "\n";
 
-  for ( int i = 0; i < _triaDS->NbNodes(); ++i )
+  if ( _flatDS )
   {
-    const BRepMesh_Vertex& v = _triaDS->GetNode( i+1 );
-    text << "mesh.AddNode( " << v.Coord().X() << ", " << v.Coord().Y() << ", 0 )" << endl;
+    for ( int i = 0; i < _flatDS->NbNodes(); ++i )
+    {
+      const gp_XY& uv = _flatDS->GetNode( i );
+      text << "mesh.AddNode( " << uv.X() << ", " << uv.Y() << ", 0 )" << endl;
+    }
+    text << "# nb elements = " << _flatDS->NbTriangles() << endl;
+    for ( int i = 0; i < _flatDS->NbTriangles(); ++i )
+    {
+      const int* n = _flatDS->GetTriaNodes( i );
+      text << "mesh.AddFace([ " << n[0]+1 << ", " << n[1]+1 << ", " << n[2]+1 << " ])" << endl;
+    }
   }
-
-  int nodeIDs[3];
-  const char* dofName[] = { "Free",
-                            "InVolume",
-                            "OnSurface",
-                            "OnCurve",
-                            "Fixed",
-                            "Frontier",
-                            "Deleted" };
-  text << "# nb elements = " << _triaDS->NbElements() << endl;
-  std::vector< int > deletedElems;
-  for ( int i = 0; i < _triaDS->NbElements(); ++i )
+  else
   {
-    const BRepMesh_Triangle& t = _triaDS->GetElement( i+1 );
-    if ( t.Movability() == BRepMesh_Deleted )
-      deletedElems.push_back( i+1 );
-    //   continue;
-    _triaDS->ElementNodes( t, nodeIDs );
-    text << "mesh.AddFace([ " << nodeIDs[0] << ", " << nodeIDs[1] << ", " << nodeIDs[2] << " ]) # "
-         <<  dofName[ t.Movability() ] << endl;
+    for ( int i = 0; i < _triaDS->NbNodes(); ++i )
+    {
+      const BRepMesh_Vertex& v = _triaDS->GetNode( i+1 );
+      text << "mesh.AddNode( " << v.Coord().X() << ", " << v.Coord().Y() << ", 0 )" << endl;
+    }
+
+    int nodeIDs[3];
+    const char* dofName[] = { "Free",
+                              "InVolume",
+                              "OnSurface",
+                              "OnCurve",
+                              "Fixed",
+                              "Frontier",
+                              "Deleted" };
+    text << "# nb elements = " << _triaDS->NbElements() << endl;
+    std::vector< int > deletedElems;
+    for ( int i = 0; i < _triaDS->NbElements(); ++i )
+    {
+      const BRepMesh_Triangle& t = _triaDS->GetElement( i+1 );
+      if ( t.Movability() == BRepMesh_Deleted )
+        deletedElems.push_back( i+1 );
+      //   continue;
+      _triaDS->ElementNodes( t, nodeIDs );
+      text << "mesh.AddFace([ " << nodeIDs[0] << ", " << nodeIDs[1] << ", " << nodeIDs[2] << " ]) # "
+           <<  dofName[ t.Movability() ] << endl;
+    }
+    text << "mesh.MakeGroupByIds( 'deleted elements', SMESH.FACE, [";
+    for ( int id : deletedElems )
+      text << id << ",";
+    text << "])" << endl;
   }
-  text << "mesh.MakeGroupByIds( 'deleted elements', SMESH.FACE, [";
-  for ( int id : deletedElems )
-    text << id << ",";
-  text << "])" << endl;
 
   const char* fileName = "/tmp/Delaunay.py";
   SMESH_File file( fileName, false );
@@ -28,10 +28,13 @@
 #define __SMESH_Delaunay_HXX__
 
 #include "SMESH_TypeDefs.hxx"
+#include "SMESH_Delaunay2D.hxx"
 
 #include <TopoDS_Face.hxx>
 #include <BRepMesh_DataStructureOfDelaun.hxx>
 
+#include <memory>
+
 /*!
  * \brief Create a Delaunay triangulation of nodes on a face boundary
  *        and provide exploration of nodes shared by elements lying on
@@ -40,6 +43,10 @@
  *        Only non-marked nodes are visited. Boundary nodes given at the construction
  *        are not returned.
  *
+ *        Triangles are identified by indices. The triangulation is stored either
+ *        in BRepMesh data structure (default) or, if a caller opts in, in flat arrays
+ *        of SMESH_Delaunay2D which allow locating many points in parallel.
+ *
  *        For usage, this class needs to be subclassed to implement getNodeUV();
  */
 class SMESHUtils_EXPORT SMESH_Delaunay
@@ -49,7 +56,8 @@ class SMESHUtils_EXPORT SMESH_Delaunay
   // construct a Delaunay triangulation of given boundary nodes
   SMESH_Delaunay(const std::vector< const UVPtStructVec* > & boundaryNodes,
                  const TopoDS_Face&                          face,
-                 const int                                   faceID);
+                 const int                                   faceID,
+                 const bool                                  useBRepMesh = true);
 
   virtual ~SMESH_Delaunay() {}
 
@@ -66,13 +74,21 @@ class SMESHUtils_EXPORT SMESH_Delaunay
 
   // find a triangle containing an UV, starting from a given triangle;
   // return barycentric coordinates of the UV and the found triangle (indices are zero based).
-  const BRepMesh_Triangle* FindTriangle( const gp_XY&             uv,
-                                         const BRepMesh_Triangle* bmTria,
-                                         double                   bc[3],
-                                         int                      triaNodes[3]);
+  // Return -1 if no triangle found
+  int FindTriangle( const gp_XY& uv,
+                    int          tria,
+                    double       bc[3],
+                    int          triaNodes[3]);
+
+  // find triangles containing many UVs; return 3 barycentric coordinates
+  // and 3 node indices per UV; -1 in trias for UVs out of the triangulation
+  void FindTriangles( const std::vector< gp_XY >& uvs,
+                      std::vector< int >&         trias,
+                      std::vector< double >&      bc,
+                      std::vector< int >&         triaNodes);
 
   // return any Delaunay triangle neighboring a given boundary node (zero based)
-  const BRepMesh_Triangle* GetTriangleNear( int iBndNode );
+  int GetTriangleNear( int iBndNode );
 
   // return source boundary nodes
   const std::vector< const SMDS_MeshNode* >& GetBndNodes() const { return _bndNodes; }
@@ -86,28 +102,32 @@ class SMESHUtils_EXPORT SMESH_Delaunay
 
   void ToPython() const;
 
+  // return BRepMesh data structure, it is null if useBRepMesh == false
   Handle(BRepMesh_DataStructureOfDelaun) GetDS() { return _triaDS; }
 
  protected:
 
   // container of a node and a triangle serving as a start while searching a
   // triangle including the node UV
-  typedef std::list< std::pair< const SMDS_MeshNode*, const BRepMesh_Triangle* > > TNodeTriaList;
+  typedef std::list< std::pair< const SMDS_MeshNode*, int > > TNodeTriaList;
 
   // return UV of a node on the face
   virtual gp_XY getNodeUV( const TopoDS_Face& face, const SMDS_MeshNode* node ) const = 0;
 
   // add non-marked nodes surrounding a given one to a queue
-  static void addCloseNodes( const SMDS_MeshNode*     node,
-                             const BRepMesh_Triangle* bmTria,
-                             const int                faceID,
-                             TNodeTriaList &          noTriQueue );
+  static void addCloseNodes( const SMDS_MeshNode* node,
+                             const int            tria,
+                             const int            faceID,
+                             TNodeTriaList &      noTriQueue );
+
+  int findTriangleBRepMesh( const gp_XY& uv, int tria, double bc[3], int triaNodes[3] );
 
   const TopoDS_Face&                     _face;
   int                                    _faceID;
   std::vector< const SMDS_MeshNode* >    _bndNodes;
   gp_XY                                  _scale;
   Handle(BRepMesh_DataStructureOfDelaun) _triaDS;
+  std::unique_ptr< SMESH_Delaunay2D >    _flatDS;
   size_t                                 _nbNodesToVisit, _nbVisitedNodes, _iBndNode;
   TNodeTriaList                          _noTriQueue;
 
@@ -0,0 +1,714 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_Delaunay2D.cxx
+// Module    : SMESH
+//
+#include "SMESH_Delaunay2D.hxx"
+
+#include <SMDS_ElementRange.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  inline int next( int i ) { return i == 2 ? 0 : i + 1; }
+  inline int prev( int i ) { return i == 0 ? 2 : i - 1; }
+
+  // directions from the center of points to the nodes of the super triangle
+  const gp_XY theSuperDir[3] = { gp_XY( -1, -1 ), gp_XY( 1, -1 ), gp_XY( 0, 1 ) };
+}
+
+//================================================================================
+/*!
+ * \brief Triangulate given points by incremental insertion with edge flipping
+ */
+//================================================================================
+
+SMESH_Delaunay2D::SMESH_Delaunay2D( const std::vector< gp_XY >& points )
+  : _xy( points ), _tol2( 0 ), _firstSuperNode( (int) points.size() )
+{
+  _gridSize[0] = _gridSize[1] = 0;
+
+  const int nbPoints = (int) points.size();
+  if ( nbPoints < 3 )
+  {
+    _nodeTria.resize( nbPoints, -1 );
+    return;
+  }
+
+  // bounding box
+
+  gp_XY minXY = points[0], maxXY = points[0];
+  for ( const gp_XY& p : points )
+  {
+    minXY.SetCoord( std::min( minXY.X(), p.X() ), std::min( minXY.Y(), p.Y() ));
+    maxXY.SetCoord( std::max( maxXY.X(), p.X() ), std::max( maxXY.Y(), p.Y() ));
+  }
+  gp_XY  boxSize = maxXY - minXY;
+  double size    = std::max( boxSize.X(), boxSize.Y() );
+  if ( size <= 0 )
+    size = 1.;
+  _tol2 = 1e-20 * size * size;
+
+  // super triangle including all points; predicates treat its nodes as infinitely far
+
+  const double k = 100. * size;
+  _superCenter = 0.5 * ( minXY + maxXY );
+  for ( const gp_XY& dir : theSuperDir )
+    _xy.push_back( _superCenter + k * dir );
+
+  _triaNodes.reserve( 6 * nbPoints + 3 );
+  _triaAdj.reserve  ( 6 * nbPoints + 3 );
+  _triaNodes = { nbPoints, nbPoints + 1, nbPoints + 2 };
+  _triaAdj   = { -1, -1, -1 };
+  _nodeTria.resize( nbPoints + 3, 0 );
+  std::fill( _nodeTria.begin(), _nodeTria.begin() + nbPoints, -1 );
+
+  // sort points along a serpentine through cells of a grid to make walks short
+
+  const int nbCells = std::max( 1, (int) std::sqrt( nbPoints / 4. ));
+  const gp_XY cellSize( std::max( boxSize.X(), size * 1e-6 ) / nbCells,
+                        std::max( boxSize.Y(), size * 1e-6 ) / nbCells );
+  std::vector< std::pair< int, int > > cellOfPoint( nbPoints );
+  for ( int i = 0; i < nbPoints; ++i )
+  {
+    int iX = std::min( nbCells - 1, int(( points[i].X() - minXY.X() ) / cellSize.X() ));
+    int iY = std::min( nbCells - 1, int(( points[i].Y() - minXY.Y() ) / cellSize.Y() ));
+    if ( iY % 2 )
+      iX = nbCells - 1 - iX;
+    cellOfPoint[i] = std::make_pair( iY * nbCells + iX, i );
+  }
+  std::sort( cellOfPoint.begin(), cellOfPoint.end() );
+
+  // insert points
+
+  std::vector< int > coincidentNodes( nbPoints, -1 );
+  int lastTria = 0;
+  for ( int i = 0; i < nbPoints; ++i )
+  {
+    int iNode = cellOfPoint[i].second;
+    insert( iNode, lastTria, coincidentNodes[ iNode ]);
+  }
+
+  removeSuperTriangles();
+
+  for ( int i = 0; i < nbPoints; ++i )
+    if ( coincidentNodes[i] >= 0 )
+      _nodeTria[i] = _nodeTria[ coincidentNodes[i] ];
+
+  makeSeedGrid();
+}
+
+//================================================================================
+/*!
+ * \brief Return a doubled signed area of a triangle (n1,n2,p);
+ *        it is positive if p is on the left of n1->n2.
+ *
+ * Nodes of the super triangle are treated as if they were infinitely far in
+ * theSuperDir, else the super triangle, however large, cuts off thin triangles
+ * along the convex hull of almost collinear points. Then only the sign of the
+ * result is meaningful.
+ */
+//================================================================================
+
+double SMESH_Delaunay2D::orient( int n1, int n2, const gp_XY& p ) const
+{
+  const bool isSuper1 = ( n1 >= _firstSuperNode ), isSuper2 = ( n2 >= _firstSuperNode );
+  if ( !isSuper1 && !isSuper2 )
+    return ( _xy[ n2 ] - _xy[ n1 ]) ^ ( p - _xy[ n1 ]);
+
+  if ( isSuper1 && isSuper2 ) // p is inside the super triangle
+    return ( n2 - _firstSuperNode == next( n1 - _firstSuperNode )) ? 1. : -1.;
+
+  // rotate (n1,n2,p) to (a,b,S)
+  if ( isSuper1 )
+    return orientToSuper( _xy[ n2 ], p, n1 );
+  return orientToSuper( p, _xy[ n1 ], n2 );
+}
+
+//================================================================================
+/*!
+ * \brief Return orientation of a triangle (n1,n2,n3) any node of which can be
+ *        a node of the super triangle
+ */
+//================================================================================
+
+double SMESH_Delaunay2D::orient( int n1, int n2, int n3 ) const
+{
+  if ( n3 < _firstSuperNode ) return orient( n1, n2, _xy[ n3 ]);
+  if ( n1 < _firstSuperNode ) return orient( n2, n3, _xy[ n1 ]);
+  if ( n2 < _firstSuperNode ) return orient( n3, n1, _xy[ n2 ]);
+  return ( n2 - _firstSuperNode == next( n1 - _firstSuperNode )) ? 1. : -1.;
+}
+
+//================================================================================
+/*!
+ * \brief Return orientation of a triangle (a,b,S) where S is a node of the super
+ *        triangle lying infinitely far from the center of points
+ */
+//================================================================================
+
+double SMESH_Delaunay2D::orientToSuper( const gp_XY& a, const gp_XY& b, int superNode ) const
+{
+  const gp_XY ab = b - a;
+  const double o = ab ^ theSuperDir[ superNode - _firstSuperNode ];
+  if ( o != 0 )
+    return o;
+  // a->b is parallel to the direction to S; S is shifted from a by the center of points
+  return ab ^ ( _superCenter - a );
+}
+
+//================================================================================
+/*!
+ * \brief Check if a node is inside a circumcircle of a triangle.
+ *
+ * Nodes of the super triangle are treated as infinitely far. As a node goes to
+ * infinity, a circle passing through it turns into a half-plane. The triangle
+ * always includes a real node, as it shares the node being inserted.
+ */
+//================================================================================
+
+bool SMESH_Delaunay2D::isInCircle( int iTria, int iNode ) const
+{
+  const int* n = GetTriaNodes( iTria );
+  int iSuper = -1;
+  for ( int i = 0; i < 3; ++i )
+    if ( n[i] >= _firstSuperNode )
+    {
+      if ( iSuper >= 0 ) // two super nodes
+        return true;
+      iSuper = i;
+    }
+
+  if ( iSuper >= 0 )
+  {
+    // a triangle (a,b,S): the circle turns into a half-plane on the left of a->b
+    const int    a = n[ next( iSuper )], b = n[ prev( iSuper )];
+    const double o = orient( a, b, iNode );
+    if ( o != 0 || iNode >= _firstSuperNode )
+      return o > 0;
+    // the node is on the line (a,b); it is inside the circle if it is between a and b
+    const gp_XY& p = _xy[ iNode ];
+    return (( p - _xy[ a ]) * ( _xy[ b ] - _xy[ a ]) > 0 &&
+            ( p - _xy[ b ]) * ( _xy[ a ] - _xy[ b ]) > 0 );
+  }
+
+  if ( iNode >= _firstSuperNode ) // an infinitely far node is out of any finite circle
+    return false;
+
+  const gp_XY& p = _xy[ iNode ];
+  const gp_XY  a = _xy[ n[0] ] - p;
+  const gp_XY  b = _xy[ n[1] ] - p;
+  const gp_XY  c = _xy[ n[2] ] - p;
+  double det = ( a.SquareModulus() * ( b ^ c ) +
+                 b.SquareModulus() * ( c ^ a ) +
+                 c.SquareModulus() * ( a ^ b ));
+  return det > 0;
+}
+
+//================================================================================
+/*!
+ * \brief Walk from a given triangle towards a point
+ *  \param [in] p - the point
+ *  \param [in] startTria - a triangle to start from
+ *  \param [out] isOut - true if the point is outside the triangulation
+ *  \return int - a triangle containing the point or the last triangle of the walk
+ */
+//================================================================================
+
+int SMESH_Delaunay2D::walk( const gp_XY& p, int startTria, bool& isOut ) const
+{
+  isOut = false;
+  const int nbTrias = NbTriangles();
+  if ( startTria < 0 || startTria >= nbTrias )
+    return -1;
+
+  int iTria = startTria, prevTria = -1;
+  for ( int nbSteps = 0; nbSteps <= nbTrias; ++nbSteps )
+  {
+    const int* n = GetTriaNodes( iTria );
+    int  nextTria = -1;
+    bool isOutOfHull = false;
+    for ( int k = 0; k < 3 && nextTria < 0; ++k )
+    {
+      int i = ( k + nbSteps ) % 3; // vary the first edge to avoid cycling
+      int adjTria = GetNeighbor( iTria, i );
+      if ( adjTria >= 0 && adjTria == prevTria )
+        continue;
+      if ( orient( n[ next( i )], n[ prev( i )], p ) < 0 )
+      {
+        if ( adjTria < 0 )
+          isOutOfHull = true;
+        else
+          nextTria = adjTria;
+      }
+    }
+    if ( nextTria < 0 )
+    {
+      isOut = isOutOfHull;
+      return iTria;
+    }
+    prevTria = iTria;
+    iTria    = nextTria;
+  }
+
+  // walk failed due to numerical instability; check all triangles
+  for ( iTria = 0; iTria < nbTrias; ++iTria )
+  {
+    const int* n = GetTriaNodes( iTria );
+    if ( orient( n[0], n[1], p ) >= 0 &&
+         orient( n[1], n[2], p ) >= 0 &&
+         orient( n[2], n[0], p ) >= 0 )
+      return iTria;
+  }
+  isOut = true;
+  return -1;
+}
+
+//================================================================================
+/*!
+ * \brief Insert a point into the triangulation
+ *  \param [in] iNode - index of the point
+ *  \param [inout] lastTria - a triangle to start search from; returns a triangle
+ *         sharing the inserted node
+ *  \param [out] coincidentNode - a node coincident with the point
+ *  \return bool - false if the point is not inserted
+ */
+//================================================================================
+
+bool SMESH_Delaunay2D::insert( int iNode, int& lastTria, int& coincidentNode )
+{
+  const gp_XY& p = _xy[ iNode ];
+
+  bool isOut;
+  int iTria = walk( p, lastTria, isOut );
+  if ( iTria < 0 || isOut )
+    return false;
+
+  const int n[3] = { _triaNodes[ 3 * iTria ],
+                     _triaNodes[ 3 * iTria + 1 ],
+                     _triaNodes[ 3 * iTria + 2 ] };
+  int nbOnEdge = 0, iEdge = -1, sumEdges = 0;
+  for ( int i = 0; i < 3; ++i )
+  {
+    if (( _xy[ n[i] ] - p ).SquareModulus() <= _tol2 )
+    {
+      coincidentNode = n[i];
+      return false;
+    }
+    if ( orient( n[ next( i )], n[ prev( i )], p ) == 0 )
+    {
+      ++nbOnEdge;
+      iEdge = i;
+      sumEdges += i;
+    }
+  }
+  if ( nbOnEdge > 1 ) // on two edges, i.e. at their common node
+  {
+    coincidentNode = n[ 3 - sumEdges ];
+    return false;
+  }
+
+  const int t0 = iTria;
+  if ( nbOnEdge == 0 )
+  {
+    // split the triangle (a,b,c) into (a,b,p), (b,c,p), (c,a,p)
+
+    const int adj[3] = { _triaAdj[ 3 * t0 ], _triaAdj[ 3 * t0 + 1 ], _triaAdj[ 3 * t0 + 2 ] };
+    const int t1 = NbTriangles(), t2 = t1 + 1;
+    const int a = n[0], b = n[1], c = n[2];
+
+    _triaNodes[ 3 * t0 + 2 ] = iNode;
+    _triaAdj  [ 3 * t0     ] = t1;
+    _triaAdj  [ 3 * t0 + 1 ] = t2;
+    _triaAdj  [ 3 * t0 + 2 ] = adj[2];
+
+    _triaNodes.insert( _triaNodes.end(), { b, c, iNode, c, a, iNode });
+    _triaAdj.insert  ( _triaAdj.end(),   { t2, t0, adj[0], t0, t1, adj[1] });
+
+    setAdjacent( adj[0], t0, t1 );
+    setAdjacent( adj[1], t0, t2 );
+
+    _nodeTria[ c ] = t1;
+
+    _flipStack.push_back( std::make_pair( t0, 2 ));
+    _flipStack.push_back( std::make_pair( t1, 2 ));
+    _flipStack.push_back( std::make_pair( t2, 2 ));
+  }
+  else
+  {
+    // the point is on an edge (b,c) shared by (a,b,c) and (d,c,b);
+    // split them into (a,b,p), (a,p,c), (d,c,p), (d,p,b)
+
+    const int a = n[ iEdge ], b = n[ next( iEdge )], c = n[ prev( iEdge )];
+    const int adjCA = GetNeighbor( t0, next( iEdge ));
+    const int adjAB = GetNeighbor( t0, prev( iEdge ));
+    const int o0    = GetNeighbor( t0, iEdge );
+    const int t1    = NbTriangles();
+    const int o1    = ( o0 < 0 ) ? -1 : t1 + 1;
+
+    _triaNodes[ 3 * t0     ] = a;
+    _triaNodes[ 3 * t0 + 1 ] = b;
+    _triaNodes[ 3 * t0 + 2 ] = iNode;
+    _triaAdj  [ 3 * t0     ] = o1;
+    _triaAdj  [ 3 * t0 + 1 ] = t1;
+    _triaAdj  [ 3 * t0 + 2 ] = adjAB;
+
+    _triaNodes.insert( _triaNodes.end(), { a, iNode, c });
+    _triaAdj.insert  ( _triaAdj.end(),   { o0, adjCA, t0 });
+    setAdjacent( adjCA, t0, t1 );
+
+    _nodeTria[ a ] = _nodeTria[ b ] = t0;
+    _nodeTria[ c ] = t1;
+    _flipStack.push_back( std::make_pair( t0, 2 ));
+    _flipStack.push_back( std::make_pair( t1, 1 ));
+
+    if ( o0 >= 0 )
+    {
+      int j = 0;
+      while ( GetNeighbor( o0, j ) != t0 ) ++j;
+      const int d     = _triaNodes[ 3 * o0 + j ];
+      const int adjBD = GetNeighbor( o0, next( j ));
+      const int adjDC = GetNeighbor( o0, prev( j ));
+
+      _triaNodes[ 3 * o0     ] = d;
+      _triaNodes[ 3 * o0 + 1 ] = c;
+      _triaNodes[ 3 * o0 + 2 ] = iNode;
+      _triaAdj  [ 3 * o0     ] = t1;
+      _triaAdj  [ 3 * o0 + 1 ] = o1;
+      _triaAdj  [ 3 * o0 + 2 ] = adjDC;
+
+      _triaNodes.insert( _triaNodes.end(), { d, iNode, b });
+      _triaAdj.insert  ( _triaAdj.end(),   { t0, adjBD, o0 });
+      setAdjacent( adjBD, o0, o1 );
+
+      _nodeTria[ d ] = o0;
+      _flipStack.push_back( std::make_pair( o0, 2 ));
+      _flipStack.push_back( std::make_pair( o1, 1 ));
+    }
+  }
+  _nodeTria[ iNode ] = t0;
+  lastTria = t0;
+
+  legalize( iNode );
+
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief Flip edges opposite to a new node while they are not Delaunay
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::legalize( int iNode )
+{
+  while ( !_flipStack.empty() )
+  {
+    int iTria = _flipStack.back().first;
+    int i     = _flipStack.back().second;
+    _flipStack.pop_back();
+
+    if ( _triaNodes[ 3 * iTria + i ] != iNode )
+      continue;
+    int adjTria = GetNeighbor( iTria, i );
+    if ( adjTria < 0 )
+      continue;
+    int j = 0;
+    while ( GetNeighbor( adjTria, j ) != iTria ) ++j;
+    const int d = _triaNodes[ 3 * adjTria + j ];
+    if ( !isInCircle( iTria, d ))
+      continue;
+
+    // check that the quadrangle is convex
+    const int q = _triaNodes[ 3 * iTria + next( i )];
+    const int r = _triaNodes[ 3 * iTria + prev( i )];
+    if ( orient( q, iNode, d ) >= 0 || orient( r, iNode, d ) <= 0 )
+      continue;
+
+    flip( iTria, i );
+
+    _flipStack.push_back( std::make_pair( iTria,   0 ));
+    _flipStack.push_back( std::make_pair( adjTria, 0 ));
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Flip an edge opposite to i-th node of a triangle.
+ *        Triangles (p,q,r) and (d,r,q) become (p,q,d) and (p,d,r)
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::flip( int t, int i )
+{
+  const int o = GetNeighbor( t, i );
+  int j = 0;
+  while ( GetNeighbor( o, j ) != t ) ++j;
+
+  const int p = _triaNodes[ 3 * t + i ];
+  const int q = _triaNodes[ 3 * t + next( i )];
+  const int r = _triaNodes[ 3 * t + prev( i )];
+  const int d = _triaNodes[ 3 * o + j ];
+  const int adjRP = GetNeighbor( t, next( i ));
+  const int adjPQ = GetNeighbor( t, prev( i ));
+  const int adjQD = GetNeighbor( o, next( j ));
+  const int adjDR = GetNeighbor( o, prev( j ));
+
+  _triaNodes[ 3 * t     ] = p;
+  _triaNodes[ 3 * t + 1 ] = q;
+  _triaNodes[ 3 * t + 2 ] = d;
+  _triaAdj  [ 3 * t     ] = adjQD;
+  _triaAdj  [ 3 * t + 1 ] = o;
+  _triaAdj  [ 3 * t + 2 ] = adjPQ;
+
+  _triaNodes[ 3 * o     ] = p;
+  _triaNodes[ 3 * o + 1 ] = d;
+  _triaNodes[ 3 * o + 2 ] = r;
+  _triaAdj  [ 3 * o     ] = adjDR;
+  _triaAdj  [ 3 * o + 1 ] = adjRP;
+  _triaAdj  [ 3 * o + 2 ] = t;
+
+  setAdjacent( adjQD, o, t );
+  setAdjacent( adjRP, t, o );
+
+  _nodeTria[ p ] = _nodeTria[ q ] = _nodeTria[ d ] = t;
+  _nodeTria[ r ] = o;
+}
+
+//================================================================================
+/*!
+ * \brief Replace a neighbor of a triangle
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::setAdjacent( int iTria, int oldAdj, int newAdj )
+{
+  if ( iTria < 0 )
+    return;
+  for ( int i = 0; i < 3; ++i )
+    if ( _triaAdj[ 3 * iTria + i ] == oldAdj )
+    {
+      _triaAdj[ 3 * iTria + i ] = newAdj;
+      break;
+    }
+}
+
+//================================================================================
+/*!
+ * \brief Remove triangles sharing nodes of the super triangle
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::removeSuperTriangles()
+{
+  const int nbPoints = (int) _xy.size() - 3;
+
+  std::vector< int > newIndex( NbTriangles(), -1 );
+  int nbTrias = 0;
+  for ( int iT = 0; iT < NbTriangles(); ++iT )
+  {
+    const int* n = GetTriaNodes( iT );
+    if ( n[0] < nbPoints && n[1] < nbPoints && n[2] < nbPoints )
+      newIndex[ iT ] = nbTrias++;
+  }
+
+  std::vector< int > triaNodes( 3 * nbTrias ), triaAdj( 3 * nbTrias );
+  _nodeTria.assign( nbPoints, -1 );
+  for ( int iT = 0; iT < NbTriangles(); ++iT )
+  {
+    const int newT = newIndex[ iT ];
+    if ( newT < 0 )
+      continue;
+    for ( int i = 0; i < 3; ++i )
+    {
+      const int adj = _triaAdj[ 3 * iT + i ];
+      triaNodes[ 3 * newT + i ] = _triaNodes[ 3 * iT + i ];
+      triaAdj  [ 3 * newT + i ] = adj < 0 ? -1 : newIndex[ adj ];
+      _nodeTria[ _triaNodes[ 3 * iT + i ]] = newT;
+    }
+  }
+  _triaNodes.swap( triaNodes );
+  _triaAdj.swap( triaAdj );
+  _xy.resize( nbPoints );
+
+  std::vector< std::pair< int, int > >().swap( _flipStack );
+}
+
+//================================================================================
+/*!
+ * \brief Fill a regular grid with triangles to start a walk from
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::makeSeedGrid()
+{
+  const int nbTrias = NbTriangles();
+  if ( nbTrias == 0 )
+    return;
+
+  gp_XY minXY = _xy[0], maxXY = _xy[0];
+  for ( const gp_XY& p : _xy )
+  {
+    minXY.SetCoord( std::min( minXY.X(), p.X() ), std::min( minXY.Y(), p.Y() ));
+    maxXY.SetCoord( std::max( maxXY.X(), p.X() ), std::max( maxXY.Y(), p.Y() ));
+  }
+  const gp_XY  boxSize = maxXY - minXY;
+  const double size    = std::max( boxSize.X(), boxSize.Y() );
+
+  const int nbCells = std::max( 1, (int) std::sqrt( nbTrias / 2. ));
+  _gridSize[0] = _gridSize[1] = nbCells;
+  _gridMin = minXY;
+  _gridCellSize.SetCoord( std::max( boxSize.X(), size * 1e-6 ) / nbCells,
+                          std::max( boxSize.Y(), size * 1e-6 ) / nbCells );
+  _gridTrias.assign( nbCells * nbCells, -1 );
+
+  for ( int iT = 0; iT < nbTrias; ++iT )
+  {
+    const int* n = GetTriaNodes( iT );
+    gp_XY center = ( _xy[ n[0] ] + _xy[ n[1] ] + _xy[ n[2] ]) / 3.;
+    _gridTrias[ gridCell( center )] = iT;
+  }
+
+  // fill empty cells by triangles of neighbor cells
+  int iT = -1;
+  for ( int& t : _gridTrias )
+    if ( t < 0 ) t  = iT;
+    else         iT = t;
+  iT = -1;
+  for ( auto t = _gridTrias.rbegin(); t != _gridTrias.rend(); ++t )
+    if ( *t < 0 ) *t = iT;
+    else          iT = *t;
+}
+
+//================================================================================
+/*!
+ * \brief Return an index of a grid cell including a point
+ */
+//================================================================================
+
+int SMESH_Delaunay2D::gridCell( const gp_XY& p ) const
+{
+  const gp_XY xy = p - _gridMin;
+  int iX = (int) std::floor( xy.X() / _gridCellSize.X() );
+  int iY = (int) std::floor( xy.Y() / _gridCellSize.Y() );
+  iX = std::max( 0, std::min( _gridSize[0] - 1, iX ));
+  iY = std::max( 0, std::min( _gridSize[1] - 1, iY ));
+  return iY * _gridSize[0] + iX;
+}
+
+//================================================================================
+/*!
+ * \brief Compute barycentric coordinates of a point within a triangle
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::getBaryCoords( int iTria, const gp_XY& p, double bc[3] ) const
+{
+  const int* n = GetTriaNodes( iTria );
+  const double area = orient( n[0], n[1], _xy[ n[2] ]);
+  bc[0] = orient( n[1], n[2], p ) / area;
+  bc[1] = orient( n[2], n[0], p ) / area;
+  bc[2] = 1. - bc[0] - bc[1];
+}
+
+//================================================================================
+/*!
+ * \brief Find a triangle containing a point
+ *  \param [in] point - the point
+ *  \param [in] startTria - a triangle to start search from; if it is negative,
+ *         start from a triangle close to the point
+ *  \param [out] bc - barycentric coordinates of the point within the found triangle;
+ *         they are not negative, a point lying out of the triangle within a tolerance
+ *         is moved to its boundary
+ *  \return int - index of the found triangle, -1 if the point is outside
+ */
+//================================================================================
+
+int SMESH_Delaunay2D::FindTriangle( const gp_XY& point, int startTria, double bc[3] ) const
+{
+  if ( NbTriangles() == 0 )
+    return -1;
+  if ( startTria < 0 || startTria >= NbTriangles() )
+    startTria = _gridTrias[ gridCell( point )];
+
+  bool isOut;
+  int iTria = walk( point, startTria, isOut );
+  if ( iTria < 0 )
+    return -1;
+
+  getBaryCoords( iTria, point, bc );
+
+  const double tol = 1e-9;
+  if ( std::min( bc[0], std::min( bc[1], bc[2] )) < -tol )
+  {
+    if ( isOut )
+      return -1;
+    // the walk stopped at a wrong triangle due to rounding errors
+    iTria = -1;
+    double maxMinBC = -tol;
+    double triaBC[3];
+    for ( int iT = 0; iT < NbTriangles(); ++iT )
+    {
+      getBaryCoords( iT, point, triaBC );
+      const double minBC = std::min( triaBC[0], std::min( triaBC[1], triaBC[2] ));
+      if ( minBC >= maxMinBC )
+      {
+        maxMinBC = minBC;
+        iTria    = iT;
+        std::copy( triaBC, triaBC + 3, bc );
+      }
+    }
+    if ( iTria < 0 )
+      return -1;
+  }
+
+  // snap a point lying on the boundary of the triangle within the tolerance
+  for ( int i = 0; i < 3; ++i )
+    bc[i] = std::max( 0., bc[i] );
+  const double sumBC = bc[0] + bc[1] + bc[2];
+  for ( int i = 0; i < 3; ++i )
+    bc[i] /= sumBC;
+
+  return iTria;
+}
+
+//================================================================================
+/*!
+ * \brief Find triangles containing given points
+ *  \param [in] points - the points
+ *  \param [out] trias - indices of found triangles, -1 for points outside
+ *  \param [out] bc - 3 barycentric coordinates per point
+ */
+//================================================================================
+
+void SMESH_Delaunay2D::FindTriangles( const std::vector< gp_XY >& points,
+                                      std::vector< int >&         trias,
+                                      std::vector< double >&      bc ) const
+{
+  trias.resize( points.size() );
+  bc.resize( 3 * points.size() );
+
+  SMDS_ParallelForBlocks( points.size(), [&]( size_t begin, size_t end )
+  {
+    for ( size_t i = begin; i < end; ++i )
+      trias[i] = FindTriangle( points[i], -1, & bc[ 3 * i ]);
+  });
+}
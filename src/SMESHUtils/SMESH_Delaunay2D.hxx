@@ -0,0 +1,108 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_Delaunay2D.hxx
+// Module    : SMESH
+//
+#ifndef __SMESH_Delaunay2D_HXX__
+#define __SMESH_Delaunay2D_HXX__
+
+#include "SMESH_Utils.hxx"
+
+#include <gp_XY.hxx>
+
+#include <vector>
+
+/*!
+ * \brief Delaunay triangulation of 2D points stored in flat arrays.
+ *
+ *        Triangles are stored as triples of node indices (counterclockwise) and
+ *        triples of indices of adjacent triangles; i-th neighbor of a triangle
+ *        lies opposite to its i-th node. The triangulation covers the convex hull
+ *        of the points. A point is located by a walk started from a triangle
+ *        found in a regular grid of seed triangles.
+ *
+ *        Location does not modify the triangulation, so it is thread safe.
+ */
+class SMESHUtils_EXPORT SMESH_Delaunay2D
+{
+ public:
+
+  // triangulate given points
+  SMESH_Delaunay2D( const std::vector< gp_XY >& points );
+
+  // return nb of points given at construction
+  int NbNodes() const { return (int) _nodeTria.size(); }
+
+  // return nb of triangles
+  int NbTriangles() const { return (int) _triaNodes.size() / 3; }
+
+  // return coordinates of a point
+  const gp_XY& GetNode( int iNode ) const { return _xy[ iNode ]; }
+
+  // return three node indices of a triangle
+  const int* GetTriaNodes( int iTria ) const { return & _triaNodes[ 3 * iTria ]; }
+
+  // return a triangle adjacent to a given one opposite to its i-th node; -1 if none
+  int GetNeighbor( int iTria, int i ) const { return _triaAdj[ 3 * iTria + i ]; }
+
+  // return any triangle sharing a given node; -1 if none
+  int GetTriangleNear( int iNode ) const { return _nodeTria[ iNode ]; }
+
+  // find a triangle containing a point, starting from a given triangle or from
+  // a seed triangle if startTria < 0; return -1 if the point is outside.
+  // Returned barycentric coordinates are not negative
+  int FindTriangle( const gp_XY& point, int startTria, double bc[3] ) const;
+
+  // find triangles containing many points, in parallel
+  void FindTriangles( const std::vector< gp_XY >& points,
+                      std::vector< int >&         trias,
+                      std::vector< double >&      bc ) const;
+
+ private:
+
+  double orient( int n1, int n2, const gp_XY& p ) const;
+  double orient( int n1, int n2, int n3 ) const;
+  double orientToSuper( const gp_XY& a, const gp_XY& b, int superNode ) const;
+  bool   isInCircle( int iTria, int iNode ) const;
+  int    walk( const gp_XY& p, int startTria, bool& isOut ) const;
+  bool   insert( int iNode, int& lastTria, int& coincidentNode );
+  void   flip( int iTria, int i );
+  void   legalize( int iNode );
+  void   setAdjacent( int iTria, int oldAdj, int newAdj );
+  void   removeSuperTriangles();
+  void   makeSeedGrid();
+  int    gridCell( const gp_XY& p ) const;
+  void   getBaryCoords( int iTria, const gp_XY& p, double bc[3] ) const;
+
+  std::vector< gp_XY > _xy;        // points + 3 nodes of a super triangle
+  std::vector< int >   _triaNodes; // 3 node indices per triangle
+  std::vector< int >   _triaAdj;   // 3 adjacent triangles per triangle
+  std::vector< int >   _nodeTria;  // a triangle per node
+  std::vector< std::pair< int, int > > _flipStack; // (triangle, index of an edge to check)
+  double               _tol2;      // squared distance between coincident points
+  int                  _firstSuperNode; // index of the first node of the super triangle
+  gp_XY                _superCenter;    // super nodes are infinitely far from it
+
+  // grid of seed triangles
+  gp_XY                _gridMin, _gridCellSize;
+  int                  _gridSize[2];
+  std::vector< int >   _gridTrias;
+};
+
+#endif
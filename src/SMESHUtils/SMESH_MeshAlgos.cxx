@@ -71,9 +71,8 @@ struct SMESH_NodeSearcherImpl: public SMESH_NodeSearcher
 
     TIDSortedNodeSet nodes;
     if ( theMesh ) {
-      SMDS_NodeIteratorPtr nIt = theMesh->nodesIterator();
-      while ( nIt->more() )
-        nodes.insert( nodes.end(), nIt->next() );
+      for ( const SMDS_MeshNode* node : theMesh->nodesRange() )
+        nodes.insert( nodes.end(), node );
     }
     else if ( theElemIt )
     {
@@ -1277,13 +1276,13 @@ gp_XYZ SMESH_ElementSearcherImpl::Project(const gp_Pnt&            point,
                                           SMDSAbs_ElementType      type,
                                           const SMDS_MeshElement** closestElem)
 {
-  _elementType = type;
-  if ( _mesh->GetMeshInfo().NbElements( _elementType ) == 0 )
+  // _elementType is not changed for concurrent calls to be possible
+  if ( _mesh->GetMeshInfo().NbElements( type ) == 0 )
     throw SALOME_Exception( LOCALIZED( "No elements of given type in the mesh" ));
 
-  ElementBndBoxTree*& ebbTree = _ebbTree[ _elementType ];
+  ElementBndBoxTree*& ebbTree = _ebbTree[ type ];
   if ( !ebbTree )
-    ebbTree = new ElementBndBoxTree( *_mesh, _elementType, _meshPartIt );
+    ebbTree = new ElementBndBoxTree( *_mesh, type, _meshPartIt );
 
   gp_XYZ p = point.XYZ();
   ElementBndBoxTree* ebbLeaf = ebbTree->getLeafAtPoint( p );
@@ -113,7 +113,9 @@ struct SMESHUtils_EXPORT SMESH_ElementSearcher
 
   /*!
    * \brief Return a projection of a given point to a 2D mesh.
-   *        Optionally return the closest face
+   *        Optionally return the closest face.
+   *        Concurrent calls are safe once a tree of elements of \a type is built
+   *        by a first call.
    */
   virtual gp_XYZ Project(const gp_Pnt&            point,
                          SMDSAbs_ElementType      type,
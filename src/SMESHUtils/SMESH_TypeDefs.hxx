@@ -158,6 +158,15 @@ struct SMESH_TLink: public NLink
   const SMDS_MeshNode* node1() const { return first; }
   const SMDS_MeshNode* node2() const { return second; }
 
+  // compare links by IDs of nodes; unlike operator<, the order does not depend on
+  // location of nodes in memory
+  static bool IDLess( const NLink& l1, const NLink& l2 )
+  {
+    if ( l1.first->GetID() != l2.first->GetID() )
+      return l1.first->GetID() < l2.first->GetID();
+    return l1.second->GetID() < l2.second->GetID();
+  }
+
   // methods for usage of SMESH_TLink as a hasher in NCollection maps
   //static int HashCode(const SMESH_TLink& link, int aLimit)
   //{
@@ -3097,6 +3097,50 @@ SMESH::smIdType_array* SMESH_Gen_i::Evaluate(SMESH::SMESH_Mesh_ptr theMesh,
   return nbels._retn();
 }
 
+//=============================================================================
+/*!
+ *  SMESH_Gen_i::SetComputeProfiling
+ *
+ *  Switch on/off recording of timing of computation stages
+ */
+//=============================================================================
+
+void SMESH_Gen_i::SetComputeProfiling( CORBA::Boolean theToProfile )
+{
+  myGen.GetComputeProfiler().SetEnabled( theToProfile );
+}
+
+//=============================================================================
+/*!
+ *  SMESH_Gen_i::IsComputeProfiling
+ *
+ *  Check if timing of computation stages is recorded
+ */
+//=============================================================================
+
+CORBA::Boolean SMESH_Gen_i::IsComputeProfiling()
+{
+  return myGen.GetComputeProfiler().IsEnabled();
+}
+
+//=============================================================================
+/*!
+ *  SMESH_Gen_i::GetComputeProfile
+ *
+ *  Return recorded timing of computation stages in JSON format
+ */
+//=============================================================================
+
+char* SMESH_Gen_i::GetComputeProfile( CORBA::Boolean theToClear )
+{
+  std::ostringstream json;
+  myGen.GetComputeProfiler().WriteJSON( json );
+  if ( theToClear )
+    myGen.GetComputeProfiler().Clear();
+
+  return CORBA::string_dup( json.str().c_str() );
+}
+
 //================================================================================
 /*!
  * \brief Return geometrical object the given element is built on
@@ -335,6 +335,13 @@ public:
   SMESH::smIdType_array* Evaluate(SMESH::SMESH_Mesh_ptr theMesh,
                               GEOM::GEOM_Object_ptr theShapeObject);
 
+  // Switch on/off recording of timing of computation stages
+  void SetComputeProfiling( CORBA::Boolean theToProfile );
+  // Returns true if timing of computation stages is recorded
+  CORBA::Boolean IsComputeProfiling();
+  // Returns recorded timing of computation stages in JSON format
+  char* GetComputeProfile( CORBA::Boolean theToClear );
+
   // Returns true if mesh contains enough data to be computed
   CORBA::Boolean IsReadyToCompute( SMESH::SMESH_Mesh_ptr theMesh,
                                    GEOM::GEOM_Object_ptr theShapeObject );
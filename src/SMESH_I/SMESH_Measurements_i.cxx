@@ -25,16 +25,25 @@
 #include "SMESH_Measurements_i.hxx"
 
 #include "SMDS_ElemIterator.hxx"
+#include "SMDS_ElementRange.hxx"
 #include "SMDS_Mesh.hxx"
 #include "SMDS_MeshElement.hxx"
 #include "SMDS_MeshNode.hxx"
+#include "SMDS_VolumeTool.hxx"
 #include "SMESHDS_Mesh.hxx"
 #include "SMESH_Filter_i.hxx"
 #include "SMESH_Gen_i.hxx"
 #include "SMESH_MeshAlgos.hxx"
 #include "SMESH_PythonDump.hxx"
 
+#include <Bnd_B3d.hxx>
+#include <Precision.hxx>
+
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
 
 //using namespace SMESH;
 
@@ -179,6 +188,506 @@ static double getNumericalValue(SMESH::SMESH_IDSource_ptr            theSource,
   return value;
 }
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief An entity distance is measured to and from: its nodes and
+   *        a searcher of its nodes or elements
+   */
+  //================================================================================
+
+  struct TDistanceSource
+  {
+    bool                                     _isNode;
+    bool                                     _hasVolumes;
+    std::vector< const SMDS_MeshElement* >   _elems;
+    std::vector< const SMDS_MeshElement* >   _nodes;
+    std::unique_ptr< SMESH_NodeSearcher >    _nodeSearcher;
+    std::unique_ptr< SMESH_ElementSearcher > _elemSearcher;
+
+    bool Init( SMESH::SMESH_IDSource_ptr theSource )
+    {
+      SMESHDS_Mesh* mesh = getMesh( theSource );
+      if ( !mesh )
+        return false;
+      SMESH::array_of_ElementType_var types = theSource->GetTypes();
+      _isNode = isNodeType( types );
+      _hasVolumes = false;
+
+      SMDS_ElemIteratorPtr elemIt =
+        SMESH_Mesh_i::GetElements( theSource, _isNode ? SMESH::NODE : SMESH::ALL );
+      if ( !elemIt )
+        return false;
+      while ( elemIt->more() )
+      {
+        _elems.push_back( elemIt->next() );
+        _hasVolumes |= ( _elems.back()->GetType() == SMDSAbs_Volume );
+      }
+      if ( _elems.empty() )
+        return false;
+
+      if ( _isNode )
+      {
+        _nodes = _elems;
+        _nodeSearcher.reset( SMESH_MeshAlgos::GetNodeSearcher( SMESHUtils::elemSetIterator( _nodes )));
+      }
+      else
+      {
+        for ( const SMDS_MeshElement* elem : _elems )
+          _nodes.insert( _nodes.end(), elem->begin_nodes(), elem->end_nodes() );
+        std::sort( _nodes.begin(), _nodes.end() );
+        _nodes.erase( std::unique( _nodes.begin(), _nodes.end() ), _nodes.end() );
+
+        _elemSearcher.reset( SMESH_MeshAlgos::GetElementSearcher( *mesh,
+                                                                  SMESHUtils::elemSetIterator( _elems )));
+        // build a tree of elements before projecting in parallel
+        const SMDS_MeshElement* closestElem = 0;
+        _elemSearcher->Project( SMESH_NodeXYZ( _nodes[0] ), SMDSAbs_All, &closestElem );
+      }
+      return true;
+    }
+
+    // return distance from a point to the entity; thread safe after Init() which
+    // builds a tree of elements
+    double Distance( const gp_Pnt& point, const SMDS_MeshElement*& closest, gp_XYZ& closestPnt ) const
+    {
+      closest = 0;
+      if ( _nodeSearcher )
+      {
+        closest    = _nodeSearcher->FindClosestTo( point );
+        closestPnt = SMESH_NodeXYZ( closest );
+      }
+      else
+      {
+        closestPnt = _elemSearcher->Project( point, SMDSAbs_All, &closest );
+      }
+      return closest ? point.Distance( closestPnt ) : Precision::Infinite();
+    }
+  };
+
+  //================================================================================
+  /*!
+   * \brief Distance from a node to an entity
+   */
+  //================================================================================
+
+  struct TNodeDistance
+  {
+    double                  _dist;
+    const SMDS_MeshElement* _closest;
+    gp_XYZ                  _closestPnt;
+  };
+
+  //================================================================================
+  /*!
+   * \brief Compute distances from all nodes of one entity to another one.
+   *        Distances to volumes are computed sequentially as SMDS_VolumeTool used
+   *        to measure them is not meant for concurrent use.
+   */
+  //================================================================================
+
+  void computeDistances( const TDistanceSource&        from,
+                         const TDistanceSource&        to,
+                         std::vector< TNodeDistance >& distances )
+  {
+    distances.resize( from._nodes.size() );
+    auto computeDistance = [&]( size_t i )
+      {
+        TNodeDistance& d = distances[ i ];
+        d._dist = to.Distance( SMESH_NodeXYZ( from._nodes[ i ]), d._closest, d._closestPnt );
+      };
+    if ( to._hasVolumes )
+      for ( size_t i = 0; i < from._nodes.size(); ++i )
+        computeDistance( i );
+    else
+      SMDS_ParallelFor( from._nodes.size(), computeDistance );
+  }
+
+  //================================================================================
+  /*!
+   * \brief Linear segments and triangles an element is made of; medium nodes of
+   *        faces and volumes are ignored as by SMESH_MeshAlgos::GetDistance()
+   */
+  //================================================================================
+
+  struct TElemGeometry
+  {
+    std::vector< gp_XYZ > _segments;  // ends of segments
+    std::vector< gp_XYZ > _triangles; // corners of triangles
+    Bnd_B3d               _box;
+
+    void Init( const SMDS_MeshElement* elem )
+    {
+      switch ( elem->GetType() )
+      {
+      case SMDSAbs_Edge:
+      {
+        SMDS_NodeIteratorPtr nIt = elem->interlacedNodesIterator();
+        SMESH_NodeXYZ prev = nIt->next();
+        while ( nIt->more() )
+        {
+          SMESH_NodeXYZ next = nIt->next();
+          _segments.push_back( prev );
+          _segments.push_back( next );
+          prev = next;
+        }
+        break;
+      }
+      case SMDSAbs_Face:
+      {
+        const int nbCorners = elem->NbCornerNodes();
+        for ( int i = 0; i < nbCorners; ++i )
+        {
+          _segments.push_back( SMESH_NodeXYZ( elem->GetNode( i )));
+          _segments.push_back( SMESH_NodeXYZ( elem->GetNode(( i + 1 ) % nbCorners )));
+        }
+        if ( elem->GetEntityType() == SMDSEntity_Polygon )
+        {
+          std::vector< const SMDS_MeshNode* > nodes;
+          int nbTria = SMESH_MeshAlgos::Triangulate().GetTriangles( elem, nodes );
+          for ( int i = 0; i < 3 * nbTria; ++i )
+            _triangles.push_back( SMESH_NodeXYZ( nodes[ i ]));
+        }
+        else
+        {
+          for ( int i = 2; i < nbCorners; ++i ) // fan of triangles
+          {
+            _triangles.push_back( SMESH_NodeXYZ( elem->GetNode( 0 )));
+            _triangles.push_back( SMESH_NodeXYZ( elem->GetNode( i - 1 )));
+            _triangles.push_back( SMESH_NodeXYZ( elem->GetNode( i )));
+          }
+        }
+        break;
+      }
+      case SMDSAbs_Volume:
+      {
+        SMDS_VolumeTool vTool( elem );
+        const int iQ = elem->IsQuadratic() ? 2 : 1;
+        for ( int iF = 0; iF < vTool.NbFaces(); ++iF )
+        {
+          const SMDS_MeshNode** nodes = vTool.GetFaceNodes( iF );
+          const int         nbCorners = vTool.NbFaceNodes( iF ) / iQ;
+          for ( int i = 0; i < nbCorners; ++i )
+          {
+            _segments.push_back( SMESH_NodeXYZ( nodes[ i * iQ ]));
+            _segments.push_back( SMESH_NodeXYZ( nodes[ ( i + 1 ) % nbCorners * iQ ]));
+          }
+          for ( int i = 2; i < nbCorners; ++i ) // fan of triangles
+          {
+            _triangles.push_back( SMESH_NodeXYZ( nodes[ 0 ]));
+            _triangles.push_back( SMESH_NodeXYZ( nodes[ ( i - 1 ) * iQ ]));
+            _triangles.push_back( SMESH_NodeXYZ( nodes[ i * iQ ]));
+          }
+        }
+        break;
+      }
+      default:; // nodes are measured by computeDistances()
+      }
+      for ( const gp_XYZ& p : _segments )
+        _box.Add( p );
+    }
+  };
+
+  //================================================================================
+  /*!
+   * \brief Return distance between two segments and their closest points
+   */
+  //================================================================================
+
+  double getSegmentDistance( const gp_XYZ& p1, const gp_XYZ& q1,
+                             const gp_XYZ& p2, const gp_XYZ& q2,
+                             gp_XYZ&       c1, gp_XYZ&       c2 )
+  {
+    const gp_XYZ d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+    const double  a = d1.SquareModulus(), e = d2.SquareModulus(), f = d2 * r;
+    const double eps = std::numeric_limits<double>::min();
+    double s = 0, t = 0; // params on segments
+    if ( a > eps && e <= eps )
+    {
+      s = Min( 1., Max( 0., -( d1 * r ) / a ));
+    }
+    else if ( a <= eps && e > eps )
+    {
+      t = Min( 1., Max( 0., f / e ));
+    }
+    else if ( a > eps && e > eps )
+    {
+      const double b = d1 * d2, c = d1 * r, denom = a * e - b * b;
+      if ( denom > eps ) // not parallel
+        s = Min( 1., Max( 0., ( b * f - c * e ) / denom ));
+      t = ( b * s + f ) / e;
+      if ( t < 0. )
+      {
+        t = 0.;
+        s = Min( 1., Max( 0., -c / a ));
+      }
+      else if ( t > 1. )
+      {
+        t = 1.;
+        s = Min( 1., Max( 0., ( b - c ) / a ));
+      }
+    }
+    c1 = p1 + s * d1;
+    c2 = p2 + t * d2;
+    return ( c2 - c1 ).Modulus();
+  }
+
+  //================================================================================
+  /*!
+   * \brief Check if a segment crosses a triangle and return the intersection point.
+   *        A segment parallel to the triangle is not considered.
+   */
+  //================================================================================
+
+  bool isSegmentCrossingTriangle( const gp_XYZ& p,  const gp_XYZ& q,
+                                  const gp_XYZ& t0, const gp_XYZ& t1, const gp_XYZ& t2,
+                                  gp_XYZ&       intersection )
+  {
+    const gp_XYZ dir = q - p, e1 = t1 - t0, e2 = t2 - t0;
+    const gp_XYZ h   = dir ^ e2;
+    const double a   = e1 * h;
+    if ( Abs( a ) <= std::numeric_limits<double>::min() )
+      return false;
+    const gp_XYZ s = p - t0;
+    const double u = ( s * h ) / a;
+    if ( u < 0. || u > 1. )
+      return false;
+    const gp_XYZ sXe1 = s ^ e1;
+    const double    v = ( dir * sXe1 ) / a;
+    if ( v < 0. || u + v > 1. )
+      return false;
+    const double t = ( e2 * sXe1 ) / a;
+    if ( t < 0. || t > 1. )
+      return false;
+    intersection = p + t * dir;
+    return true;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Return distance between two elements except distances from their nodes,
+   *        i.e. distance between links of elements or zero if a link of one element
+   *        crosses another element
+   */
+  //================================================================================
+
+  double getLinkDistance( const TElemGeometry& g1, const TElemGeometry& g2,
+                          gp_XYZ&              p1, gp_XYZ&              p2 )
+  {
+    double minDist = Precision::Infinite();
+    gp_XYZ c1, c2;
+    for ( size_t i1 = 0; i1 < g1._segments.size(); i1 += 2 )
+      for ( size_t i2 = 0; i2 < g2._segments.size(); i2 += 2 )
+      {
+        double d = getSegmentDistance( g1._segments[ i1 ], g1._segments[ i1 + 1 ],
+                                       g2._segments[ i2 ], g2._segments[ i2 + 1 ], c1, c2 );
+        if ( d < minDist )
+        {
+          minDist = d;
+          p1 = c1;
+          p2 = c2;
+        }
+      }
+    const TElemGeometry* segGeom[2] = { &g1, &g2 }, *triaGeom[2] = { &g2, &g1 };
+    for ( int iG = 0; iG < 2 && minDist > 0; ++iG )
+    {
+      const std::vector< gp_XYZ >& segs = segGeom[ iG ]->_segments;
+      const std::vector< gp_XYZ >& tria = triaGeom[ iG ]->_triangles;
+      for ( size_t iS = 0; iS < segs.size() && minDist > 0; iS += 2 )
+        for ( size_t iT = 0; iT < tria.size(); iT += 3 )
+          if ( isSegmentCrossingTriangle( segs[ iS ], segs[ iS + 1 ],
+                                          tria[ iT ], tria[ iT + 1 ], tria[ iT + 2 ], c1 ))
+          {
+            minDist = 0;
+            p1 = p2 = c1;
+            break;
+          }
+    }
+    return minDist;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Fill theMeasure with a distance from a node of one entity to another one.
+   *        As for node-element distance, min* is a vector from source1 to source2
+   *        and max* is a point on source2
+   */
+  //================================================================================
+
+  void setNodeDistance( SMESH::Measure&         theMeasure,
+                        const SMDS_MeshElement* theNode,
+                        const TNodeDistance&    theDistance,
+                        const bool              isNodeOfSource1 )
+  {
+    gp_XYZ p1 = SMESH_NodeXYZ( theNode ), p2 = theDistance._closestPnt;
+    if ( !isNodeOfSource1 )
+      std::swap( p1, p2 );
+
+    theMeasure.value = theDistance._dist;
+    theMeasure.minX  = p2.X() - p1.X();
+    theMeasure.minY  = p2.Y() - p1.Y();
+    theMeasure.minZ  = p2.Z() - p1.Z();
+    theMeasure.maxX  = p2.X();
+    theMeasure.maxY  = p2.Y();
+    theMeasure.maxZ  = p2.Z();
+
+    const bool isClosestNode = ( theDistance._closest->GetType() == SMDSAbs_Node );
+    if ( isNodeOfSource1 )
+    {
+      theMeasure.node1 = theNode->GetID();
+      ( isClosestNode ? theMeasure.node2 : theMeasure.elem2 ) = theDistance._closest->GetID();
+    }
+    else
+    {
+      theMeasure.node2 = theNode->GetID();
+      ( isClosestNode ? theMeasure.node1 : theMeasure.elem1 ) = theDistance._closest->GetID();
+    }
+  }
+
+  //================================================================================
+  /*!
+   * \brief Find a pair of elements of two entities closer than given distance,
+   *        taking into account only links of elements.
+   *        Only pairs of elements whose boxes are within the distance are checked.
+   */
+  //================================================================================
+
+  bool getElemElemDistance( SMESH::Measure&        theMeasure,
+                            const TDistanceSource& source1,
+                            const TDistanceSource& source2,
+                            const double           maxDist )
+  {
+    // segments and triangles of elements; SMDS_VolumeTool used for volumes
+    // is not meant for concurrent use, so this is done sequentially
+    std::vector< TElemGeometry > geom1( source1._elems.size() ), geom2( source2._elems.size() );
+    std::unordered_map< const SMDS_MeshElement*, size_t > elem2Index;
+    for ( size_t i = 0; i < geom1.size(); ++i )
+      geom1[ i ].Init( source1._elems[ i ]);
+    for ( size_t i = 0; i < geom2.size(); ++i )
+    {
+      geom2[ i ].Init( source2._elems[ i ]);
+      elem2Index.insert({ source2._elems[ i ], i });
+    }
+
+    // candidate pairs: elements of source2 whose boxes are within maxDist;
+    // the searcher is not meant for concurrent use
+    std::vector< std::vector< size_t > > candidates( geom1.size() );
+    std::vector< const SMDS_MeshElement* > found;
+    for ( size_t i1 = 0; i1 < geom1.size(); ++i1 )
+    {
+      if ( geom1[ i1 ]._segments.empty() )
+        continue;
+      Bnd_B3d box = geom1[ i1 ]._box;
+      box.Enlarge( maxDist );
+      found.clear();
+      source2._elemSearcher->GetElementsInBox( box, SMDSAbs_All, found );
+      for ( const SMDS_MeshElement* e2 : found )
+      {
+        auto e2i = elem2Index.find( e2 );
+        if ( e2i != elem2Index.end() && !geom2[ e2i->second ]._segments.empty() )
+          candidates[ i1 ].push_back( e2i->second );
+      }
+    }
+
+    // distances between candidate pairs
+    struct TPairDistance
+    {
+      double _dist;
+      size_t _i2;
+      gp_XYZ _p1, _p2;
+    };
+    std::vector< TPairDistance > distances( geom1.size(), { maxDist, 0, gp_XYZ(), gp_XYZ() });
+    SMDS_ParallelFor( geom1.size(), [&]( size_t i1 )
+                      {
+                        TPairDistance& best = distances[ i1 ];
+                        gp_XYZ p1, p2;
+                        for ( size_t i2 : candidates[ i1 ])
+                        {
+                          double d = getLinkDistance( geom1[ i1 ], geom2[ i2 ], p1, p2 );
+                          if ( d < best._dist )
+                            best = { d, i2, p1, p2 };
+                          if ( best._dist == 0 )
+                            break;
+                        }
+                      });
+
+    size_t iBest = geom1.size();
+    for ( size_t i1 = 0; i1 < distances.size(); ++i1 )
+      if ( distances[ i1 ]._dist < ( iBest < geom1.size() ? distances[ iBest ]._dist : maxDist ))
+        iBest = i1;
+    if ( iBest == geom1.size() )
+      return false;
+
+    // as for node distance, min* is a vector from source1 to source2
+    // and max* is a point on source2
+    const TPairDistance& best = distances[ iBest ];
+    initMeasure( theMeasure );
+    theMeasure.value = best._dist;
+    theMeasure.minX  = best._p2.X() - best._p1.X();
+    theMeasure.minY  = best._p2.Y() - best._p1.Y();
+    theMeasure.minZ  = best._p2.Z() - best._p1.Z();
+    theMeasure.maxX  = best._p2.X();
+    theMeasure.maxY  = best._p2.Y();
+    theMeasure.maxZ  = best._p2.Z();
+    theMeasure.elem1 = source1._elems[ iBest ]->GetID();
+    theMeasure.elem2 = source2._elems[ best._i2 ]->GetID();
+    return true;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Compute minimal or Hausdorff distance between two entities.
+   *        Distances from nodes of each entity to another one are computed.
+   *        For the minimal distance between two sets of elements, distances between
+   *        links of elements closer than the found node distance are also computed.
+   *        The Hausdorff distance is sampled at nodes.
+   */
+  //================================================================================
+
+  bool getSetSetDistance( SMESH::Measure&           theMeasure,
+                          SMESH::SMESH_IDSource_ptr theSource1,
+                          SMESH::SMESH_IDSource_ptr theSource2,
+                          const bool                isHausdorff )
+  {
+    TDistanceSource source1, source2;
+    if ( !source1.Init( theSource1 ) || !source2.Init( theSource2 ))
+      return false;
+
+    std::vector< TNodeDistance > distances[2];
+    computeDistances( source1, source2, distances[0] );
+    computeDistances( source2, source1, distances[1] );
+
+    int    iBest[2] = { -1, -1 };
+    double bestDist = isHausdorff ? -1. : Precision::Infinite();
+    for ( int iSrc = 0; iSrc < 2; ++iSrc )
+      for ( size_t i = 0; i < distances[ iSrc ].size(); ++i )
+      {
+        const TNodeDistance& d = distances[ iSrc ][ i ];
+        if ( !d._closest )
+          continue;
+        if ( isHausdorff ? ( d._dist > bestDist ) : ( d._dist < bestDist ))
+        {
+          bestDist = d._dist;
+          iBest[0] = iSrc;
+          iBest[1] = (int) i;
+        }
+      }
+    if ( iBest[0] < 0 )
+      return false;
+
+    const TDistanceSource& from = iBest[0] ? source2 : source1;
+    setNodeDistance( theMeasure, from._nodes[ iBest[1] ], distances[ iBest[0] ][ iBest[1] ],
+                     /*isNodeOfSource1=*/ iBest[0] == 0 );
+
+    // a closer pair of points may lie on links of elements of both entities
+    if ( !isHausdorff && !source1._isNode && !source2._isNode && bestDist > 0 )
+      getElemElemDistance( theMeasure, source1, source2, bestDist );
+
+    return true;
+  }
+}
+
 //=======================================================================
 // name    : MinDistance
 // Purpose : minimal distance between two given entities
@@ -207,24 +716,20 @@ SMESH::Measure SMESH::Measurements_i::MinDistance
 
   SMESH::smIdType_array_var aElementsId1 = theSource1->GetIDs();
   SMESH::smIdType_array_var aElementsId2;
+  if ( !isOrigin ) aElementsId2 = theSource2->GetIDs();
 
   // compute distance between two entities
-  /* NOTE: currently only node-to-node case is implemented
-   * all other cases will be implemented later
-   * below IF should be replaced by complete switch
-   * on mesh entities types
-   */
-  if (isNode1 && isNode2)
+  if (isNode1 && isNode2 && ( isOrigin || ( aElementsId1->length() == 1 &&
+                                            aElementsId2->length() == 1 )))
   {
     // node - node
     const SMESHDS_Mesh* aMesh1 = getMesh( theSource1 );
     const SMESHDS_Mesh* aMesh2 = isOrigin ? 0 : getMesh( theSource2 );
-    if ( !isOrigin ) aElementsId2 = theSource2->GetIDs();
     const SMDS_MeshNode* theNode1 = aMesh1 ? aMesh1->FindNode( aElementsId1[0] ) : 0;
     const SMDS_MeshNode* theNode2 = aMesh2 ? aMesh2->FindNode( aElementsId2[0] ) : 0;
     getNodeNodeDistance( aMeasure, theNode1, theNode2 );
   }
-  if (isNode1 && !isNode2 && aElementsId1->length() == 1 )
+  else if (isNode1 && !isNode2 && aElementsId1->length() == 1 )
   {
     // node - elements
     SMESHDS_Mesh* aMesh1 = getMesh( theSource1 );
@@ -238,14 +743,82 @@ SMESH::Measure SMESH::Measurements_i::MinDistance
       getNodeElemDistance( aMeasure, aNode, aSearcher.get() );
     }
   }
-  else
+  else if ( !isOrigin )
   {
-    // NOT_IMPLEMENTED
+    // nodes and elements - nodes and elements
+    getSetSetDistance( aMeasure, theSource1, theSource2, /*isHausdorff=*/false );
   }
 
   return aMeasure;
 }
 
+//=======================================================================
+// name    : HausdorffDistance
+// Purpose : maximal distance from nodes of one entity to another one
+//=======================================================================
+SMESH::Measure SMESH::Measurements_i::HausdorffDistance
+ (SMESH::SMESH_IDSource_ptr theSource1,
+  SMESH::SMESH_IDSource_ptr theSource2)
+{
+  SMESH::Measure aMeasure;
+  initMeasure(aMeasure);
+
+  if ( CORBA::is_nil( theSource1 ) || CORBA::is_nil( theSource2 ))
+    return aMeasure;
+
+  getSetSetDistance( aMeasure, theSource1, theSource2, /*isHausdorff=*/true );
+
+  return aMeasure;
+}
+
+//=======================================================================
+// name    : DistanceHistogram
+// Purpose : histogram of distances from nodes of theSource1 to theSource2
+//=======================================================================
+SMESH::Histogram* SMESH::Measurements_i::DistanceHistogram
+ (SMESH::SMESH_IDSource_ptr theSource1,
+  SMESH::SMESH_IDSource_ptr theSource2,
+  CORBA::Short              theNbIntervals)
+{
+  SMESH::Histogram_var histogram = new SMESH::Histogram;
+
+  TDistanceSource source1, source2;
+  if ( CORBA::is_nil( theSource1 ) || CORBA::is_nil( theSource2 ) || theNbIntervals < 1 ||
+       !source1.Init( theSource1 ) || !source2.Init( theSource2 ))
+    return histogram._retn();
+
+  std::vector< TNodeDistance > distances;
+  computeDistances( source1, source2, distances );
+
+  double minDist = Precision::Infinite(), maxDist = -1;
+  for ( const TNodeDistance& d : distances )
+    if ( d._closest )
+    {
+      minDist = std::min( minDist, d._dist );
+      maxDist = std::max( maxDist, d._dist );
+    }
+  if ( maxDist < 0 )
+    return histogram._retn();
+
+  const double step = ( maxDist - minDist ) / theNbIntervals;
+  histogram->length( theNbIntervals );
+  for ( int i = 0; i < theNbIntervals; ++i )
+  {
+    SMESH::HistogramRectangle& rect = histogram[i];
+    rect.nbEvents = 0;
+    rect.min = minDist + i * step;
+    rect.max = ( i + 1 == theNbIntervals ) ? maxDist : minDist + ( i + 1 ) * step;
+  }
+  for ( const TNodeDistance& d : distances )
+    if ( d._closest )
+    {
+      int i = step > 0 ? int(( d._dist - minDist ) / step ) : 0;
+      histogram[ std::min( i, theNbIntervals - 1 )].nbEvents++;
+    }
+
+  return histogram._retn();
+}
+
 //=======================================================================
 // name    : enlargeBoundingBox
 // Purpose : 
@@ -53,6 +53,19 @@ namespace SMESH
     SMESH::Measure MinDistance(SMESH::SMESH_IDSource_ptr theSource1,
                                SMESH::SMESH_IDSource_ptr theSource2);
 
+    /*!
+     * Hausdorff distance between two given entities
+     */
+    SMESH::Measure HausdorffDistance(SMESH::SMESH_IDSource_ptr theSource1,
+                                     SMESH::SMESH_IDSource_ptr theSource2);
+
+    /*!
+     * histogram of distances from nodes of theSource1 to theSource2
+     */
+    SMESH::Histogram* DistanceHistogram(SMESH::SMESH_IDSource_ptr theSource1,
+                                        SMESH::SMESH_IDSource_ptr theSource2,
+                                        CORBA::Short              theNbIntervals);
+
     /*!
      * common bounding box of entities
      */
@@ -121,6 +121,7 @@ SMESH_Mesh_i::SMESH_Mesh_i( PortableServer::POA_ptr thePOA,
   _previewEditor = NULL;
   _preMeshInfo   = NULL;
   _mainShapeTick = 0;
+  _nbKeptSubMeshes = 0;
 }
 
 //=============================================================================
@@ -200,6 +201,18 @@ void SMESH_Mesh_i::SetShape( GEOM::GEOM_Object_ptr theShapeObject )
     _mainShapeTick = theShapeObject->GetTick();
 }
 
+//================================================================================
+/*!
+ * \brief Return nb of sub-meshes whose nodes and elements were kept at the last
+ *        update of the mesh after modification or replacement of the shape to mesh
+ */
+//================================================================================
+
+CORBA::Long SMESH_Mesh_i::GetNbKeptSubMeshes()
+{
+  return _nbKeptSubMeshes;
+}
+
 //================================================================================
 /*!
  * \brief Return true if mesh has a shape to build a shape on
@@ -2486,8 +2499,11 @@ void SMESH_Mesh_i::CheckGeomModif( bool theIsBreakLink )
   if ( _preMeshInfo )
     _preMeshInfo->ForgetAllData();
 
+  // keep mesh of sub-shapes not changed by the modification, remove the rest
+  int nbKeptSubMeshes = 0;
   if ( geomChanged || !isShaper )
-    _impl->Clear();
+    nbKeptSubMeshes = _impl->StoreUnchangedSubMeshes( newShape );
+  _nbKeptSubMeshes = 0;
   if ( newShape.IsNull() )
     return;
 
@@ -2583,6 +2599,11 @@ void SMESH_Mesh_i::CheckGeomModif( bool theIsBreakLink )
   _impl->ShapeToMesh( TopoDS_Shape() );
   _impl->ShapeToMesh( newShape );
 
+  // bind kept mesh to new sub-shapes before hypotheses assignment which cleans
+  // sub-meshes to be re-computed by all-dimensional algorithms
+  if ( nbKeptSubMeshes > 0 )
+    _nbKeptSubMeshes = nbKeptSubMeshes = _impl->RestoreUnchangedSubMeshes();
+
   // check if shape topology changes - check new shape types
   bool sameTopology = ( oldNbSubShapes == meshDS->MaxShapeIndex() );
   for ( int shapeID = oldNbSubShapes; shapeID > 0 &&  sameTopology; --shapeID )
@@ -2667,6 +2688,21 @@ void SMESH_Mesh_i::CheckGeomModif( bool theIsBreakLink )
     }
   }
 
+  // update compute state of sub-meshes with the kept mesh
+  if ( nbKeptSubMeshes > 0 )
+    if ( SMESH_subMesh* mainSM = _impl->GetSubMeshContaining( 1 ))
+    {
+      mainSM->ComputeSubMeshStateEngine( SMESH_subMesh::CHECK_COMPUTE_STATE );
+      mainSM->ComputeStateEngine( SMESH_subMesh::CHECK_COMPUTE_STATE );
+
+      int nbReused = 0;
+      SMESH_subMeshIteratorPtr smIt = mainSM->getDependsOnIterator( /*includeSelf=*/true );
+      while ( smIt->more() )
+        nbReused += ( smIt->next()->GetComputeState() == SMESH_subMesh::COMPUTE_OK );
+      MESSAGE( "CheckGeomModif(): mesh of " << nbReused << " sub-shapes reused, "
+               << nbKeptSubMeshes << " sub-meshes kept" );
+    }
+
   {
     // restore groups on geometry
     for ( size_t i = 0; i < groupsData.size(); ++i )
@@ -5027,6 +5063,25 @@ char* SMESH_Mesh_i::Dump()
   return CORBA::string_dup( os.str().c_str() );
 }
 
+//=============================================================================
+/*!
+ * Return memory used by mesh data structures in JSON format
+ */
+//=============================================================================
+
+char* SMESH_Mesh_i::GetMemoryUsage( CORBA::Boolean theSampling )
+{
+  if ( _preMeshInfo )
+    _preMeshInfo->FullLoadFromFile();
+
+  SMDS_MemoryUsage usage;
+  _impl->GetMeshDS()->GetMemoryUsage( usage, theSampling );
+
+  ostringstream json;
+  usage.WriteJSON( json );
+  return CORBA::string_dup( json.str().c_str() );
+}
+
 //=============================================================================
 /*!
  * Method of SMESH_IDSource interface
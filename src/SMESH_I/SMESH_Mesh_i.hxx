@@ -73,6 +73,8 @@ public:
 
   virtual void ReplaceShape(GEOM::GEOM_Object_ptr theNewGeom);
 
+  CORBA::Long GetNbKeptSubMeshes();
+
   CORBA::Boolean IsLoaded();
 
   void Load();
@@ -368,6 +370,8 @@ public:
 
   char* Dump();
 
+  char* GetMemoryUsage( CORBA::Boolean theSampling );
+
   // Create groups of elements preventing computation of a sub-shape
   SMESH::ListOfGroups* MakeGroupsOfBadInputElements( int         theSubShapeID,
                                                      const char* theGroupName);
@@ -718,6 +722,7 @@ private:
   };
   std::list<TGeomGroupData> _geomGroupData;
   int                       _mainShapeTick; // to track modifications of the meshed shape
+  int                       _nbKeptSubMeshes; // kept at the last CheckGeomModif()
 
   /*!
    * Remember GEOM group data
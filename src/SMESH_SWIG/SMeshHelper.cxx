@@ -22,9 +22,16 @@
 #include "SALOME_KernelServices.hxx"
 
 #include <cstring>
+#include <stdexcept>
 
 #include <DriverGMF_Read.hxx>
+#include <SMDS_MeshElement.hxx>
+#include <SMDS_MeshNode.hxx>
+#include <SMESHDS_GroupBase.hxx>
+#include <SMESHDS_Mesh.hxx>
+#include <SMESH_Group.hxx>
 #include <SMESH_MGLicenseKeyGen.hxx>
+#include <SMESH_Mesh.hxx>
 
 std::string GetMGLicenseKeyImpl(const char* gmfFile)
 {
@@ -47,3 +54,121 @@ std::string GetMGLicenseKeyImpl(const char* gmfFile)
   }
   return key;
 }
+
+//================================================================================
+/*!
+ * \brief Load nodes, elements and groups of a mesh
+ */
+//================================================================================
+
+SMeshHelper_MeshData::SMeshHelper_MeshData( long long meshPtr )
+  : _mesh( reinterpret_cast< SMESH_Mesh* >( meshPtr ))
+{
+  const SMESHDS_Mesh* meshDS = _mesh->GetMeshDS();
+
+  const size_t nbNodes = meshDS->NbNodes();
+  _nodeIDs.reserve( nbNodes );
+  _nodeCoords.reserve( 3 * nbNodes );
+  std::vector< smIdType > nodeIndex( meshDS->MaxNodeID() + 1, -1 ); // node ID -> index in _nodeIDs
+
+  double xyz[3];
+  SMDS_NodeIteratorPtr nIt = meshDS->nodesIterator();
+  while ( nIt->more() )
+  {
+    const SMDS_MeshNode* node = nIt->next();
+    node->GetXYZ( xyz );
+    nodeIndex[ node->GetID() ] = _nodeIDs.size();
+    _nodeIDs.push_back( node->GetID() );
+    _nodeCoords.insert( _nodeCoords.end(), xyz, xyz + 3 );
+  }
+
+  // connectivity is read at once, while nodeIndex corresponds to the mesh
+  for ( int entity = 0; entity < SMDSEntity_Last; ++entity )
+    if ( meshDS->GetMeshInfo().NbEntities( SMDSAbs_EntityType( entity )) > 0 )
+      loadEntity( entity, nodeIndex );
+
+  _groupOffsets.push_back( 0 );
+  SMESH_Mesh::GroupIteratorPtr gIt = _mesh->GetGroups();
+  while ( gIt->more() )
+  {
+    SMESH_Group*     group = gIt->next();
+    SMESHDS_GroupBase* gDS = group->GetGroupDS();
+    _groupNames.push_back( group->GetName() );
+    _groupTypes.push_back( gDS->GetType() );
+    for ( SMDS_ElemIteratorPtr eIt = gDS->GetElements(); eIt->more(); )
+      _groupElemIDs.push_back( eIt->next()->GetID() );
+    _groupOffsets.push_back( _groupElemIDs.size() );
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Move all nodes at once. Nodes must be same as at construction
+ */
+//================================================================================
+
+bool SMeshHelper_MeshData::SetNodeCoords( const double* xyz, size_t size )
+{
+  if ( size != _nodeCoords.size() )
+    return false;
+
+  SMESHDS_Mesh* meshDS = _mesh->GetMeshDS();
+  if ( (size_t) meshDS->NbNodes() != _nodeIDs.size() )
+    return false;
+
+  std::vector< const SMDS_MeshNode* > nodes( _nodeIDs.size() );
+  for ( size_t i = 0; i < nodes.size(); ++i )
+    if ( !( nodes[ i ] = meshDS->FindNode( _nodeIDs[ i ])))
+      return false;
+
+  _nodeCoords.assign( xyz, xyz + size );
+  meshDS->MoveNodes( nodes, _nodeCoords );
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief Return connectivity of elements of an entity type
+ */
+//================================================================================
+
+const SMeshHelper_MeshData::TEntityData& SMeshHelper_MeshData::getEntity( int entity ) const
+{
+  static const TEntityData noData = { {}, { 0 }, {} };
+
+  std::map< int, TEntityData >::const_iterator e2d = _entities.find( entity );
+  return ( e2d == _entities.end() ) ? noData : e2d->second;
+}
+
+//================================================================================
+/*!
+ * \brief Read connectivity of elements of an entity type
+ */
+//================================================================================
+
+void SMeshHelper_MeshData::loadEntity( int entity, const std::vector< smIdType >& nodeIndex )
+{
+  const SMESHDS_Mesh* meshDS = _mesh->GetMeshDS();
+  const SMDSAbs_EntityType type = SMDSAbs_EntityType( entity );
+
+  TEntityData& data = _entities[ entity ];
+  const size_t nbElems = meshDS->GetMeshInfo().NbEntities( type );
+  data._elemIDs.reserve( nbElems );
+  data._offsets.reserve( nbElems + 1 );
+  data._offsets.push_back( 0 );
+
+  SMDS_ElemIteratorPtr eIt = meshDS->elementEntityIterator( type );
+  while ( eIt->more() )
+  {
+    const SMDS_MeshElement* elem = eIt->next();
+    data._elemIDs.push_back( elem->GetID() );
+    for ( SMDS_NodeIteratorPtr nIt = elem->nodeIterator(); nIt->more(); )
+    {
+      const smIdType nodeID = nIt->next()->GetID();
+      if ( nodeID < 0 || nodeID >= (smIdType) nodeIndex.size() || nodeIndex[ nodeID ] < 0 )
+        throw std::runtime_error( "SMeshHelper_MeshData: element node not found among mesh nodes" );
+      data._connectivity.push_back( nodeIndex[ nodeID ]);
+    }
+    data._offsets.push_back( data._connectivity.size() );
+  }
+}
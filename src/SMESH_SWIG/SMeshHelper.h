@@ -19,6 +19,71 @@
 
 #pragma once
 
+#include <smIdType.hxx>
+
+#include <map>
 #include <string>
+#include <vector>
+
+class SMESH_Mesh;
 
 std::string GetMGLicenseKeyImpl(const char* gmfFile);
+
+/*!
+ * \brief Mesh data stored in contiguous arrays to be read by numpy without copying.
+ *
+ *        The mesh must live in the same process; it is given by a value
+ *        of SMESH_Mesh.GetMeshPtr(). Nodes of elements are given by indices
+ *        of nodes in NodeCoords() rather than by IDs. All data is read at
+ *        construction, so it does not follow later modifications of the mesh.
+ */
+class SMeshHelper_MeshData
+{
+ public:
+
+  SMeshHelper_MeshData( long long meshPtr );
+
+  size_t NbNodes() const { return _nodeIDs.size(); }
+
+  // node coordinates, 3 per node
+  const double*   NodeCoords() const { return _nodeCoords.data(); }
+  const smIdType* NodeIDs() const { return _nodeIDs.data(); }
+
+  // move all nodes at once; xyz holds 3 * NbNodes() coordinates.
+  // Return false if nodes of the mesh changed since construction
+  bool SetNodeCoords( const double* xyz, size_t size );
+
+  // elements of an entity type (SMDSAbs_EntityType)
+  size_t          NbElements  ( int entity ) const { return getEntity( entity )._elemIDs.size(); }
+  const smIdType* ElemIDs     ( int entity ) const { return getEntity( entity )._elemIDs.data(); }
+  // NbElements() + 1 offsets of element nodes in Connectivity()
+  const smIdType* Offsets     ( int entity ) const { return getEntity( entity )._offsets.data(); }
+  const smIdType* Connectivity( int entity ) const { return getEntity( entity )._connectivity.data(); }
+  size_t ConnectivitySize     ( int entity ) const { return getEntity( entity )._connectivity.size(); }
+
+  // groups; IDs of elements of all groups are stored in one array
+  int             NbGroups() const { return (int) _groupNames.size(); }
+  std::string     GroupName( int i ) const { return _groupNames[ i ]; }
+  int             GroupType( int i ) const { return _groupTypes[ i ]; }
+  // NbGroups() + 1 offsets of group contents in GroupElemIDs()
+  const smIdType* GroupOffsets() const { return _groupOffsets.data(); }
+  const smIdType* GroupElemIDs() const { return _groupElemIDs.data(); }
+  size_t          GroupElemIDsSize() const { return _groupElemIDs.size(); }
+
+ private:
+
+  struct TEntityData
+  {
+    std::vector< smIdType > _elemIDs, _offsets, _connectivity;
+  };
+  const TEntityData& getEntity( int entity ) const;
+  void               loadEntity( int entity, const std::vector< smIdType >& nodeIndex );
+
+  SMESH_Mesh*                   _mesh;
+  std::vector< double >         _nodeCoords;
+  std::vector< smIdType >       _nodeIDs;
+  std::map< int, TEntityData >  _entities;
+  std::vector< std::string >    _groupNames;
+  std::vector< int >            _groupTypes;
+  std::vector< smIdType >       _groupOffsets, _groupElemIDs;
+};
@@ -21,10 +21,34 @@
 
 %include "std_string.i"
 
+%ignore SMeshHelper_MeshData::NodeCoords;
+%ignore SMeshHelper_MeshData::NodeIDs;
+%ignore SMeshHelper_MeshData::SetNodeCoords;
+%ignore SMeshHelper_MeshData::ElemIDs;
+%ignore SMeshHelper_MeshData::Offsets;
+%ignore SMeshHelper_MeshData::Connectivity;
+%ignore SMeshHelper_MeshData::GroupOffsets;
+%ignore SMeshHelper_MeshData::GroupElemIDs;
+
 %{
 #include "SMeshHelper.h"
 %}
 
+%include "exception.i"
+
+// an inconsistent mesh is reported by RuntimeError
+%exception SMeshHelper_MeshData::SMeshHelper_MeshData
+{
+  try
+  {
+    $action
+  }
+  catch ( const std::exception& ex )
+  {
+    SWIG_exception( SWIG_RuntimeError, ex.what() );
+  }
+}
+
 %inline
 {
   std::string GetMGLicenseKey(const char* gmfFile)
@@ -32,3 +56,210 @@
     return GetMGLicenseKeyImpl( gmfFile );
   }
 }
+
+%include "SMeshHelper.h"
+
+// Arrays of SMeshHelper_MeshData are returned as read-only memoryviews
+// referring to data owned by SMeshHelper_MeshData; a memoryview keeps
+// the Python object of SMeshHelper_MeshData alive
+
+%{
+  // An object exporting a read-only buffer of data owned by another Python object
+  struct SMeshHelper_BufferExporter
+  {
+    PyObject_HEAD
+    PyObject*   _owner;
+    const void* _data;
+    Py_ssize_t  _size;
+  };
+
+  static int bufferExporter_getbuffer( PyObject* self, Py_buffer* view, int flags )
+  {
+    SMeshHelper_BufferExporter* exporter = (SMeshHelper_BufferExporter*) self;
+    static char noData;
+    void* data = exporter->_data ? (void*) exporter->_data : (void*) &noData;
+    return PyBuffer_FillInfo( view, self, data, exporter->_size, /*readonly=*/1, flags );
+  }
+
+  static void bufferExporter_dealloc( PyObject* self )
+  {
+    Py_XDECREF( ((SMeshHelper_BufferExporter*) self)->_owner );
+    PyObject_Del( self );
+  }
+
+  static PyTypeObject* bufferExporterType()
+  {
+    static PyBufferProcs bufferProcs = { bufferExporter_getbuffer, 0 };
+    static PyTypeObject  type        = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+    static bool          isReady     = false;
+    if ( !isReady )
+    {
+      type.tp_name      = "SMeshHelper.BufferExporter";
+      type.tp_basicsize = sizeof( SMeshHelper_BufferExporter );
+      type.tp_flags     = Py_TPFLAGS_DEFAULT;
+      type.tp_dealloc   = bufferExporter_dealloc;
+      type.tp_as_buffer = &bufferProcs;
+      if ( PyType_Ready( &type ) < 0 )
+        return 0;
+      isReady = true;
+    }
+    return &type;
+  }
+
+  // Return a memoryview of data owned by owner. PyMemoryView_FromMemory() is not used
+  // as the memoryview would not keep the owner alive
+  static PyObject* makeMemoryView( PyObject* owner, const void* data, size_t size )
+  {
+    PyTypeObject* type = bufferExporterType();
+    if ( !type )
+      return 0;
+    SMeshHelper_BufferExporter* exporter = PyObject_New( SMeshHelper_BufferExporter, type );
+    if ( !exporter )
+      return 0;
+    Py_INCREF( owner );
+    exporter->_owner = owner;
+    exporter->_data  = data;
+    exporter->_size  = (Py_ssize_t) size;
+    PyObject* view = PyMemoryView_FromObject( (PyObject*) exporter );
+    Py_DECREF( exporter ); // the memoryview holds it
+    return view;
+  }
+%}
+
+%extend SMeshHelper_MeshData
+{
+  // owner is the Python object of $self passed by methods defined in %pythoncode below
+  PyObject* _NodeCoordsBuffer( PyObject* owner )
+  {
+    return makeMemoryView( owner, $self->NodeCoords(), 3 * $self->NbNodes() * sizeof( double ));
+  }
+  PyObject* _NodeIDsBuffer( PyObject* owner )
+  {
+    return makeMemoryView( owner, $self->NodeIDs(), $self->NbNodes() * sizeof( smIdType ));
+  }
+  PyObject* _ElemIDsBuffer( PyObject* owner, int entity )
+  {
+    return makeMemoryView( owner, $self->ElemIDs( entity ),
+                           $self->NbElements( entity ) * sizeof( smIdType ));
+  }
+  PyObject* _OffsetsBuffer( PyObject* owner, int entity )
+  {
+    return makeMemoryView( owner, $self->Offsets( entity ),
+                           ( $self->NbElements( entity ) + 1 ) * sizeof( smIdType ));
+  }
+  PyObject* _ConnectivityBuffer( PyObject* owner, int entity )
+  {
+    return makeMemoryView( owner, $self->Connectivity( entity ),
+                           $self->ConnectivitySize( entity ) * sizeof( smIdType ));
+  }
+  PyObject* _GroupOffsetsBuffer( PyObject* owner )
+  {
+    return makeMemoryView( owner, $self->GroupOffsets(),
+                           ( $self->NbGroups() + 1 ) * sizeof( smIdType ));
+  }
+  PyObject* _GroupElemIDsBuffer( PyObject* owner )
+  {
+    return makeMemoryView( owner, $self->GroupElemIDs(),
+                           $self->GroupElemIDsSize() * sizeof( smIdType ));
+  }
+
+  %pythoncode
+  %{
+    def NodeCoordsBuffer(self):
+        return self._NodeCoordsBuffer( self )
+    def NodeIDsBuffer(self):
+        return self._NodeIDsBuffer( self )
+    def ElemIDsBuffer(self, entity):
+        return self._ElemIDsBuffer( self, entity )
+    def OffsetsBuffer(self, entity):
+        return self._OffsetsBuffer( self, entity )
+    def ConnectivityBuffer(self, entity):
+        return self._ConnectivityBuffer( self, entity )
+    def GroupOffsetsBuffer(self):
+        return self._GroupOffsetsBuffer( self )
+    def GroupElemIDsBuffer(self):
+        return self._GroupElemIDsBuffer( self )
+  %}
+
+  // set coordinates of all nodes from an object supporting buffer protocol
+  bool SetNodeCoordsFromBuffer( PyObject* xyz )
+  {
+    Py_buffer view;
+    if ( PyObject_GetBuffer( xyz, &view, PyBUF_C_CONTIGUOUS ) != 0 )
+      return false;
+    bool ok = $self->SetNodeCoords( (const double*) view.buf, view.len / sizeof( double ));
+    PyBuffer_Release( &view );
+    return ok;
+  }
+  static int IdTypeSize()
+  {
+    return sizeof( smIdType );
+  }
+}
+
+%pythoncode
+%{
+def _idDType():
+    import numpy
+    return numpy.dtype( "i%d" % SMeshHelper_MeshData.IdTypeSize() )
+
+def GetMeshData(mesh):
+    """
+    Return SMeshHelper_MeshData of a mesh living in the current process.
+    Arrays returned by the functions below refer to the data of SMeshHelper_MeshData
+    and keep it alive. The data is read at once and does not follow later
+    modifications of the mesh; SetNodeCoordinates() fails if nodes are added or removed
+
+    Parameters:
+        mesh: SMESH.SMESH_Mesh or smeshBuilder.Mesh
+    """
+    if hasattr( mesh, "GetMesh" ): mesh = mesh.GetMesh()
+    return SMeshHelper_MeshData( mesh.GetMeshPtr() )
+
+def GetNodeCoordinates(meshData):
+    """
+    Return numpy arrays (not copied) of node coordinates of shape (nbNodes,3) and of node IDs
+    """
+    import numpy
+    coords = numpy.frombuffer( meshData.NodeCoordsBuffer(), dtype=numpy.float64 ).reshape( -1, 3 )
+    ids    = numpy.frombuffer( meshData.NodeIDsBuffer(), dtype=_idDType() )
+    return coords, ids
+
+def SetNodeCoordinates(meshData, coords):
+    """
+    Move all nodes of a mesh; *coords* is an array of shape (nbNodes,3)
+    """
+    import numpy
+    coords = numpy.ascontiguousarray( coords, dtype=numpy.float64 )
+    return meshData.SetNodeCoordsFromBuffer( coords )
+
+def GetConnectivity(meshData, entity):
+    """
+    Return numpy arrays (not copied) of element IDs, offsets and connectivity
+    of elements of a given SMESH.EntityType. Nodes of i-th element are
+    connectivity[ offsets[i] : offsets[i+1] ], they are indices of node coordinates
+    """
+    import numpy
+    if hasattr( entity, "_v" ): entity = entity._v
+    idType  = _idDType()
+    ids     = numpy.frombuffer( meshData.ElemIDsBuffer( entity ),      dtype=idType )
+    offsets = numpy.frombuffer( meshData.OffsetsBuffer( entity ),      dtype=idType )
+    conn    = numpy.frombuffer( meshData.ConnectivityBuffer( entity ), dtype=idType )
+    return ids, offsets, conn
+
+def GetGroups(meshData):
+    """
+    Return a list of (name, SMESH.ElementType, numpy array (not copied) of element IDs)
+    of all groups; names of groups are not necessarily unique
+    """
+    import numpy, SMESH
+    idType  = _idDType()
+    offsets = numpy.frombuffer( meshData.GroupOffsetsBuffer(), dtype=idType )
+    ids     = numpy.frombuffer( meshData.GroupElemIDsBuffer(), dtype=idType )
+    groups  = []
+    for i in range( meshData.NbGroups() ):
+        groups.append(( meshData.GroupName( i ),
+                        SMESH.ElementType._item( meshData.GroupType( i )),
+                        ids[ offsets[i] : offsets[i+1] ] ))
+    return groups
+%}
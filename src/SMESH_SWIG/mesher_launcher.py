@@ -24,14 +24,18 @@ File to run mesher from command line
 """
 from os import environ, path
 import sys
+import json
+import shlex
 import subprocess as sp
 
-from argparse import ArgumentParser
-
-import pylauncher
+from argparse import ArgumentParser, Namespace
 
 MESHER_HANDLED = ["NETGEN3D","NETGEN2D","NETGEN1D","NETGEN1D2D","NETGEN1D2D","GMSH3D"]
 
+# arguments a job of the worker method may set
+JOB_KEYS = ["mesher", "input_mesh_file", "shape_file", "hypo_file", "elem_orient_file",
+            "new_element_file", "output_mesh_file"]
+
 CMD_TEMPLATE = \
 """{runner} {mesher} {mesh_file} {shape_file} {param_file} {elem_orientation_file} {new_element_file} {output_mesh_file} > {log_file} 2>&1"""
 
@@ -54,6 +58,7 @@ def _exec(cmd):
 def create_launcher():
     """ Initialise pylauncher
     """
+    import pylauncher
     launcher = pylauncher.Launcher_cpp()
     launcher.SetResourcesManager(create_resources_manager())
     return launcher
@@ -61,6 +66,7 @@ def create_launcher():
 def create_resources_manager():
     """ Look for the catalog file and create a resource manager with it """
     # localhost is defined anyway, even if the catalog file does not exist.
+    import pylauncher
     catalog_path = environ.get("USER_CATALOG_RESOURCES_FILE", "")
     if not path.isfile(catalog_path):
         salome_path = environ.get("ROOT_SALOME_INSTALL", "")
@@ -72,23 +78,29 @@ def create_resources_manager():
 
 def create_job_parameters():
     """ Initialsie JobParameters """
+    import pylauncher
     jparam = pylauncher.JobParameters_cpp()
     jparam.resource_required = create_resource_parameters()
     return jparam
 
 def create_resource_parameters():
     """ Init resourceParams """
+    import pylauncher
     return pylauncher.resourceParams()
 
-def get_runner(mesher):
+def get_runner(mesher, runner=None):
     """
     Get path to exe for mesher
 
     Arguments:
     mesher: Name of the mesher (NETGEN2D/NETGEN3D...)
+    runner: Path to an exe to use instead of the mesher one (e.g. a stand-in for tests)
 
     returns (string) Path to the exe
     """
+    if runner:
+        return runner
+
     if sys.platform.startswith('win'):
         ext = ".exe"
     else:
@@ -111,33 +123,40 @@ def get_runner(mesher):
 
 def run_local(args):
     """ Simple Local run """
-    cmd = CMD_TEMPLATE.format(\
-        runner=get_runner(args.mesher),
-        mesher=args.mesher,
-        mesh_file=args.input_mesh_file,
-        shape_file=args.shape_file,
-        param_file=args.hypo_file,
-        elem_orientation_file=args.elem_orient_file,
-        new_element_file=args.new_element_file,
-        log_file=path.join(path.dirname(args.shape_file), "run.log"),
-        output_mesh_file=args.output_mesh_file)
-    sp.check_output(cmd, shell=True, cwd=path.dirname(args.shape_file))
+    if args.mesher not in MESHER_HANDLED:
+        raise Exception("Mesher {mesher} is not handled".format(mesher=args.mesher))
+    # arguments are passed as a list, not through a shell, so that
+    # file names can't inject shell commands
+    cmd = [path.expandvars(get_runner(args.mesher, args.runner)),
+           args.mesher,
+           args.input_mesh_file,
+           args.shape_file,
+           args.hypo_file,
+           str(args.elem_orient_file),
+           args.new_element_file,
+           args.output_mesh_file]
+    if None in cmd:
+        raise Exception("Missing file arguments in {}".format(cmd))
+    log_file = path.join(path.dirname(args.shape_file), "run.log")
+    with open(log_file, "w") as log:
+        sp.check_call(cmd, stdout=log, stderr=sp.STDOUT, cwd=path.dirname(args.shape_file))
 
 def run_pylauncher(args):
     """ Run exe through pylauncher """
     import time
     print("Cluster run")
 
+    # the runner path refers to environment variables expanded by the shell
     cmd = CMD_TEMPLATE.format(\
-        runner=get_runner(args.mesher),
-        mesher=args.mesher,
-        mesh_file="../"+path.basename(args.input_mesh_file),
-        shape_file=path.basename(args.shape_file),
-        param_file=path.basename(args.hypo_file),
-        elem_orientation_file=path.basename(args.elem_orient_file),
-        new_element_file=path.basename(args.new_element_file),
+        runner=get_runner(args.mesher, args.runner),
+        mesher=shlex.quote(args.mesher),
+        mesh_file=shlex.quote("../"+path.basename(args.input_mesh_file)),
+        shape_file=shlex.quote(path.basename(args.shape_file)),
+        param_file=shlex.quote(path.basename(args.hypo_file)),
+        elem_orientation_file=shlex.quote(path.basename(args.elem_orient_file)),
+        new_element_file=shlex.quote(path.basename(args.new_element_file)),
         log_file="run.log",
-        output_mesh_file=path.basename(args.output_mesh_file))
+        output_mesh_file=shlex.quote(path.basename(args.output_mesh_file)))
 
     print("Cmd: ", cmd)
 
@@ -252,17 +271,62 @@ def run_pylauncher(args):
     if del_tmp_folder:
         launcher.clearJobWorkingDir(job_id)
 
+def run_worker(args):
+    """
+    Persistent local run: stay alive and run the mesher for each job read from
+    stdin, which avoids starting a launcher per solid.
+
+    Each job is a line containing a JSON object with string values of keys named
+    as arguments of the script (mesher, input_mesh_file, shape_file, hypo_file,
+    elem_orient_file, new_element_file, output_mesh_file) and an optional "id".
+    Missing keys are taken from the command line, other keys are not accepted.
+    For each job a line is written to stdout:
+    "OK <id>" or "FAILED <id> <error message>".
+    The worker stops at the end of stdin or on a "quit" line.
+
+    SMESH_Gen does not start a worker yet: runners of mesher plugins are started
+    per solid by the plugins themselves.
+    """
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+        if line == "quit":
+            break
+        job_id = ""
+        try:
+            job = json.loads(line)
+            job_id = job.pop("id", "")
+            job_args = Namespace(**vars(args))
+            for key, value in job.items():
+                key = key.replace("-", "_")
+                if key not in JOB_KEYS:
+                    raise Exception("Unknown job key {}".format(key))
+                if not isinstance(value, str):
+                    raise Exception("Value of {} is not a string".format(key))
+                setattr(job_args, key, value)
+            run_local(job_args)
+            print("OK {}".format(job_id), flush=True)
+        except Exception as e:
+            msg = str(e).replace("\n", " ")
+            print("FAILED {} {}".format(job_id, msg), flush=True)
+
 def def_arg():
     """ Define and parse arguments for the script """
     parser = ArgumentParser()
+    # positional arguments are optional in worker mode where they come with jobs
     parser.add_argument("mesher",
+                        nargs="?",
                         choices=MESHER_HANDLED,
                         help="mesher to use from ("+",".join(MESHER_HANDLED)+")")
     parser.add_argument("input_mesh_file",\
+        nargs="?",
         help="MED File containing lower-dimension-elements already meshed")
     parser.add_argument("shape_file",
-                        help="STEP file containing the shape to mesh")
+                        nargs="?",
+                        help="STEP, BREP or binary (.bin) file containing the shape to mesh")
     parser.add_argument("hypo_file",
+                        nargs="?",
                         help="Ascii file containing the list of parameters")
     parser.add_argument("--elem-orient-file",\
         help="binary file containing the list of elements from "\
@@ -283,8 +347,12 @@ def def_arg():
             "Parameters for the run of the mesher")
     run_param.add_argument("--method",
                            default="local",
-                           choices=["local", "cluster"],
-                           help="Running method (default: local)")
+                           choices=["local", "cluster", "worker"],
+                           help="Running method (default: local). "\
+                                "worker: run jobs read from stdin, see run_worker()")
+    run_param.add_argument("--runner",
+                           help="exe to run instead of the mesher runner "\
+                                "(e.g. a stand-in runner for tests)")
 
     run_param.add_argument("--resource",
                            help="resource from SALOME Catalog")
@@ -309,6 +377,9 @@ def def_arg():
 
     args = parser.parse_args()
 
+    if args.method != "worker" and not args.hypo_file:
+        parser.error("mesher, input_mesh_file, shape_file and hypo_file are required")
+
     return args
 
 def main():
@@ -318,6 +389,8 @@ def main():
         run_local(args)
     elif args.method == "cluster":
         run_pylauncher(args)
+    elif args.method == "worker":
+        run_worker(args)
     else:
         raise Exception("Unknown method {}".format(args.method))
 
@@ -686,6 +686,29 @@ class smeshBuilder( SMESH._objref_SMESH_Gen, object ):
         global notebook
         notebook = salome_notebook.NoteBook( theIsEnablePublish )
 
+    def SetComputeProfiling( self, theToProfile ):
+        """
+        Switch on/off recording of timing of computation stages: algorithm compute
+        and evaluation, hypothesis checks, export. Recording can be also switched on
+        by *SMESH_COMPUTE_PROFILE* environment variable.
+        """
+
+        SMESH._objref_SMESH_Gen.SetComputeProfiling(self,theToProfile)
+
+    def GetComputeProfile( self, theToClear=False ):
+        """
+        Return timing of computation stages recorded since :meth:`SetComputeProfiling`
+
+        Parameters:
+                theToClear: if *True*, remove the returned records
+
+        Returns:
+                a dictionary with "records" of stages and "totals" per stage and algorithm
+        """
+
+        import json
+        return json.loads( SMESH._objref_SMESH_Gen.GetComputeProfile(self,theToClear))
+
     def ReloadMeshFromFile(self, theMesh):
         """
         Desc for method,
@@ -1345,6 +1368,8 @@ class smeshBuilder( SMESH._objref_SMESH_Gen, object ):
 
         * If *src2* is None, and *id2* = 0, distance from *src1* / *id1* to the origin is computed.
         * If *src2* is None, and *id2* != 0, it is assumed that both *id1* and *id2* belong to *src1*.
+        * Between two sets of elements, the distance between linear elements is returned,
+          medium nodes of faces and volumes being ignored.
 
         Parameters:
                 src1 (SMESH.SMESH_IDSource): first source object
@@ -1422,6 +1447,75 @@ class smeshBuilder( SMESH._objref_SMESH_Gen, object ):
         result = aMeasurements.MinDistance(src1, src2)
         return result
 
+    def HausdorffDistance(self, src1, src2):
+        """
+        Get Hausdorff distance between two objects, i.e. maximal distance
+        from nodes of one object to another object
+
+        Parameters:
+                src1 (SMESH.SMESH_IDSource): first source object
+                src2 (SMESH.SMESH_IDSource): second source object
+
+        Returns:
+                Hausdorff distance value
+
+        See also:
+                :meth:`GetHausdorffDistance`
+        """
+
+        result = self.GetHausdorffDistance(src1, src2)
+        if result is None:
+            result = 0.0
+        else:
+            result = result.value
+        return result
+
+    def GetHausdorffDistance(self, src1, src2):
+        """
+        Get :class:`SMESH.Measure` structure specifying Hausdorff distance data between two objects.
+        *node1* or *node2* is a node most distant from another object.
+
+        Parameters:
+                src1 (SMESH.SMESH_IDSource): first source object
+                src2 (SMESH.SMESH_IDSource): second source object
+
+        Returns:
+                :class:`SMESH.Measure` structure or None if input data is invalid
+        See also:
+                :meth:`HausdorffDistance`
+        """
+
+        if isinstance(src1, Mesh): src1 = src1.mesh
+        if isinstance(src2, Mesh): src2 = src2.mesh
+        if not hasattr(src1, "_narrow") or not hasattr(src2, "_narrow"): return None
+        src1 = src1._narrow(SMESH.SMESH_IDSource)
+        src2 = src2._narrow(SMESH.SMESH_IDSource)
+        if not src1 or not src2: return None
+        aMeasurements = self.CreateMeasurements()
+        result = aMeasurements.HausdorffDistance(src1, src2)
+        aMeasurements.UnRegister()
+        return result
+
+    def GetDistanceHistogram(self, src1, src2, nbIntervals):
+        """
+        Get histogram of distances from nodes of one object to another object
+
+        Parameters:
+                src1 (SMESH.SMESH_IDSource): object whose nodes distances are measured from
+                src2 (SMESH.SMESH_IDSource): object distances are measured to
+                nbIntervals (int): number of intervals of the histogram
+
+        Returns:
+                list of :class:`SMESH.HistogramRectangle`
+        """
+
+        if isinstance(src1, Mesh): src1 = src1.mesh
+        if isinstance(src2, Mesh): src2 = src2.mesh
+        aMeasurements = self.CreateMeasurements()
+        result = aMeasurements.DistanceHistogram(src1, src2, nbIntervals)
+        aMeasurements.UnRegister()
+        return result
+
     def BoundingBox(self, objects):
         """
         Get bounding box of the specified object(s)
@@ -3361,6 +3455,23 @@ class Mesh(metaclass = MeshMeta):
         if not obj: obj = self.mesh
         return self.smeshpyD.GetMeshInfo(obj)
 
+    def GetMemoryUsage(self, sampling=False):
+        """
+        Get memory used by mesh data structures
+
+        Parameters:
+                sampling: if *True*, sizes of polyhedra and of the command log
+                    are estimated from a few items, which is faster on big meshes
+
+        Returns:
+                a dictionary with "total" bytes, "sampled" flag, bytes per data structure
+                in "components" and bytes per used entity type in "entities", where
+                entity types are named as :class:`SMESH.EntityType`, e.g. "Entity_Hexa"
+        """
+
+        import json
+        return json.loads( self.mesh.GetMemoryUsage( sampling ))
+
     def NbNodes(self):
         """
         Return the number of nodes in the mesh
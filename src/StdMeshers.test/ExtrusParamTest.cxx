@@ -0,0 +1,193 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : ExtrusParamTest.cxx
+//  Module : SMESH
+//  Purpose: Check that SMESH_MeshEditor::ExtrusParam::ComputeNodeCoords() gives nodes of
+//            extrusion along a direction with scale and angle variation at same places as
+//            makeNodesByDir() did by creating nodes step by step and then moving them.
+
+#include "SMESH_MeshEditor.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+// OCC
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+/*!
+  * \brief Return coordinates of nodes made by makeNodesByDir() before it used
+  *        ComputeNodeCoords(): nodes were made by steps and then moved according
+  *        to the scale and the angle of each step
+  *  \param [in] stepScales - scale at each step, may be shorter than the number of steps
+  *  \param [in] stepAngles - accumulated rotation angle at each step
+  */
+std::vector< gp_XYZ > oldNodeCoords( const gp_XYZ&                srcPoint,
+                                     const gp_Vec&                step,
+                                     const int                    nbSteps,
+                                     const std::vector< double >& stepScales,
+                                     const std::vector< double >& stepAngles,
+                                     const gp_XYZ&                baseP,
+                                     const bool                   makeMediumNodes )
+{
+  // scales and angles of medium and corner nodes, as ExtrusParam stores them
+  std::vector< double > scales, angles;
+  for ( size_t i = 0; i < stepScales.size(); ++i )
+  {
+    scales.push_back( 0.5 * ( stepScales[i] + ( i ? stepScales[i-1] : 1. )));
+    scales.push_back( stepScales[i] );
+  }
+  for ( size_t i = 0; i < stepAngles.size(); ++i )
+  {
+    angles.push_back( 0.5 * ( stepAngles[i] + ( i ? stepAngles[i-1] : 0. )));
+    angles.push_back( stepAngles[i] );
+  }
+
+  std::vector< double > steps;
+  for ( int i = 0; i < nbSteps; ++i )
+    if ( makeMediumNodes )
+      steps.insert( steps.end(), 2, step.Magnitude() / 2. );
+    else
+      steps.push_back( step.Magnitude() );
+  const gp_Dir dir( step );
+
+  // make nodes
+  std::vector< gp_XYZ > nodes;
+  gp_XYZ p = srcPoint;
+  for ( double s : steps )
+  {
+    p += dir.XYZ() * s;
+    nodes.push_back( p );
+  }
+
+  // move nodes
+  if ( !scales.empty() || !angles.empty() )
+  {
+    gp_XYZ  center = baseP;
+    gp_Ax1  rotationAxis( gp_Pnt( center ), dir );
+    gp_Trsf rotation;
+    size_t i = !makeMediumNodes;
+    for ( size_t iN = 0; iN < nodes.size(); ++iN, i += 1 + !makeMediumNodes )
+    {
+      center += dir.XYZ() * steps[ iN ];
+
+      gp_XYZ xyz = nodes[ iN ];
+      bool moved = false;
+      if ( i < scales.size() )
+      {
+        xyz = ( scales[i] * ( xyz - center )) + center;
+        moved = true;
+      }
+      if ( !angles.empty() )
+      {
+        rotation.SetRotation( rotationAxis, angles[i] );
+        rotation.Transforms( xyz );
+        moved = true;
+      }
+      if ( !moved )
+        break;
+      nodes[ iN ] = xyz;
+    }
+  }
+  return nodes;
+}
+
+/*!
+  * \brief Compare nodes computed by ComputeNodeCoords() with nodes made by the old algorithm
+  */
+bool testVariation( const std::string&           name,
+                    std::list< double >          scales,
+                    std::list< double >          angles,
+                    const int                    flags,
+                    const std::vector< double >& stepScales,
+                    const std::vector< double >& stepAngles )
+{
+  const gp_XYZ srcPoint( 3, 1, 2 ), baseP( 1, 0, 0 );
+  const gp_Vec step( 0.3, 0.1, 1 );
+  const int    nbSteps = 4;
+
+  SMESH_MeshEditor::ExtrusParam param( step, nbSteps, scales, angles, &baseP, flags );
+
+  for ( bool withMedium : { false, true })
+  {
+    std::vector< gp_XYZ > expected = oldNodeCoords( srcPoint, step, nbSteps,
+                                                    stepScales, stepAngles, baseP, withMedium );
+    std::vector< gp_XYZ > computed( 2 * nbSteps );
+    const int nbNodes = param.ComputeNodeCoords( srcPoint, withMedium, computed.data() );
+
+    if ( nbNodes != (int) expected.size() )
+    {
+      std::cerr << name << ": " << nbNodes << " nodes instead of " << expected.size() << std::endl;
+      return false;
+    }
+    for ( int i = 0; i < nbNodes; ++i )
+      if (( computed[i] - expected[i] ).Modulus() > 1e-9 )
+      {
+        std::cerr << name << ( withMedium ? " with medium nodes" : "" )
+                  << ": node #" << i << " is at a wrong place" << std::endl;
+        return false;
+      }
+  }
+  return true;
+}
+
+/*!
+  * \brief Check extrusion with scales and angles given per step and varying linearly
+  */
+bool testComputeNodeCoords()
+{
+  bool isOK = true;
+
+  isOK = testVariation( "translation", {}, {}, 0, {}, {} ) && isOK;
+
+  isOK = testVariation( "scales", { 0.5, 0.8, 1.2, 2. }, {}, 0,
+                        { 0.5, 0.8, 1.2, 2. }, {} ) && isOK;
+
+  // nodes of steps with no scale are not moved
+  isOK = testVariation( "few scales", { 0.5, 0.8 }, {}, 0,
+                        { 0.5, 0.8 }, {} ) && isOK;
+
+  // angles are accumulated, the last one is kept until the last step
+  isOK = testVariation( "angles", {}, { 0.1, 0.2 }, 0,
+                        {}, { 0.1, 0.3, 0.3, 0.3 } ) && isOK;
+
+  // nodes of steps with no scale are rotated
+  isOK = testVariation( "scales and angles", { 2., 3. }, { 0.1, 0.1, 0.1, 0.1 }, 0,
+                        { 2., 3. }, { 0.1, 0.2, 0.3, 0.4 } ) && isOK;
+
+  isOK = testVariation( "linear variation", { 2. }, { 0.4 },
+                        SMESH_MeshEditor::EXTRUSION_FLAG_SCALE_LINEAR_VARIATION |
+                        SMESH_MeshEditor::EXTRUSION_FLAG_ANGLE_LINEAR_VARIATION,
+                        { 1.25, 1.5, 1.75, 2. }, { 0.1, 0.2, 0.3, 0.4 } ) && isOK;
+
+  return isOK;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testComputeNodeCoords();
+  return isOK ? 0 : 1;
+}
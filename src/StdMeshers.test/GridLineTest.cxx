@@ -0,0 +1,185 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : GridLineTest.cxx
+//  Module : SMESH
+//  Purpose: Check intersection points of GridLine stored in a vector: Grid::SortIntersections()
+//            must order them as a std::multiset did, and GridLine::RemoveExcessIntPoints()
+//            must merge coincident points as it did with the multiset.
+
+#include "StdMeshers_Cartesian_3D_Grid.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+using namespace StdMeshers::Cartesian3D;
+
+/*!
+  * \brief Make an intersection point
+  */
+F_IntersectPoint makePoint( double param, Transition transition, TGeomID faceID )
+{
+  F_IntersectPoint ip;
+  ip._paramOnLine = param;
+  ip._u = ip._v   = 0.;
+  ip._transition  = transition;
+  ip._indexOnLine = 0;
+  ip._faceIDs.push_back( faceID );
+  return ip;
+}
+
+/*!
+  * \brief Remove coincident points from a multiset as GridLine did before
+  *        storing points in a vector
+  */
+std::vector< F_IntersectPoint > removeExcessIntPoints( std::multiset< F_IntersectPoint >& points,
+                                                       const double                       tol )
+{
+  if ( points.size() >= 2 )
+  {
+    std::set< Transition > tranSet;
+    std::multiset< F_IntersectPoint >::iterator ip1, ip2 = points.begin();
+    while ( ip2 != points.end() )
+    {
+      tranSet.clear();
+      ip1 = ip2++;
+      while ( ip2 != points.end() && ip2->_paramOnLine - ip1->_paramOnLine <= tol )
+      {
+        tranSet.insert( ip1->_transition );
+        tranSet.insert( ip2->_transition );
+        ip2->Add( ip1->_faceIDs );
+        points.erase( ip1 );
+        ip1 = ip2++;
+      }
+      if ( tranSet.size() > 1 )
+      {
+        bool isIN  = tranSet.count( Trans_IN );
+        bool isOUT = tranSet.count( Trans_OUT );
+        if ( isIN && isOUT )
+          (*ip1)._transition = Trans_TANGENT;
+        else
+          (*ip1)._transition = isIN ? Trans_IN : Trans_OUT;
+      }
+    }
+  }
+  return std::vector< F_IntersectPoint >( points.begin(), points.end() );
+}
+
+/*!
+  * \brief Check if two sequences of intersection points are same
+  */
+bool isSame( const std::vector< F_IntersectPoint >& points1,
+             const std::vector< F_IntersectPoint >& points2 )
+{
+  if ( points1.size() != points2.size() )
+    return false;
+  for ( size_t i = 0; i < points1.size(); ++i )
+    if ( points1[i]._paramOnLine != points2[i]._paramOnLine ||
+         points1[i]._transition  != points2[i]._transition  ||
+         points1[i]._faceIDs     != points2[i]._faceIDs )
+      return false;
+  return true;
+}
+
+/*!
+  * \brief Sort and merge points on a grid line and compare with the multiset
+  */
+bool testPoints( const std::string& name, const std::vector< F_IntersectPoint >& points )
+{
+  const double tol = 1e-3;
+
+  Grid grid;
+  grid._lines[0].resize( 1 );
+  GridLine& line = grid._lines[0][0];
+  line._intPoints = points;
+
+  std::multiset< F_IntersectPoint > pointSet( points.begin(), points.end() );
+
+  grid.SortIntersections();
+  if ( !isSame( line._intPoints, std::vector< F_IntersectPoint >( pointSet.begin(), pointSet.end() )))
+  {
+    std::cerr << name << ": sorted points differ from std::multiset" << std::endl;
+    return false;
+  }
+
+  line.RemoveExcessIntPoints( tol );
+  std::vector< F_IntersectPoint > expected = removeExcessIntPoints( pointSet, tol );
+  if ( !isSame( line._intPoints, expected ))
+  {
+    std::cerr << name << ": " << line._intPoints.size() << " points kept instead of "
+              << expected.size() << " or they differ" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/*!
+  * \brief Test sets of points with and without coincident ones
+  */
+bool testGridLine()
+{
+  bool isOK = true;
+
+  isOK = testPoints( "empty", {} ) && isOK;
+  isOK = testPoints( "one", { makePoint( 1., Trans_IN, 1 ) }) && isOK;
+
+  isOK = testPoints( "distinct",
+                     { makePoint( 3., Trans_OUT, 2 ), makePoint( 1., Trans_IN, 1 ),
+                       makePoint( 2., Trans_TANGENT, 3 ) }) && isOK;
+
+  // equal parameters keep the order of insertion
+  isOK = testPoints( "equal",
+                     { makePoint( 1., Trans_IN, 1 ), makePoint( 1., Trans_OUT, 2 ),
+                       makePoint( 1., Trans_IN, 3 ), makePoint( 0., Trans_OUT, 4 ) }) && isOK;
+
+  // IN and OUT give TANGENT, IN and TANGENT give IN
+  isOK = testPoints( "in-out",
+                     { makePoint( 5.0005, Trans_OUT, 2 ), makePoint( 5., Trans_IN, 1 ),
+                       makePoint( 7., Trans_TANGENT, 3 ), makePoint( 7.0002, Trans_IN, 4 ) }) && isOK;
+
+  // a chain of points each close to the previous one is merged into the last one
+  std::vector< F_IntersectPoint > chain;
+  for ( int i = 0; i < 10; ++i )
+    chain.push_back( makePoint( 10. + i * 0.0009, i % 2 ? Trans_IN : Trans_TANGENT, i + 1 ));
+  chain.push_back( makePoint( 20., Trans_OUT, 1 ));
+  isOK = testPoints( "chain", chain ) && isOK;
+
+  // many points in pseudo-random order, some coincident
+  std::vector< F_IntersectPoint > many;
+  size_t r = 7;
+  for ( int i = 0; i < 1000; ++i )
+  {
+    r = ( r * 1103515245 + 12345 ) % 2147483648;
+    double param = double( r % 5000 ) * 0.0007;
+    many.push_back( makePoint( param, Transition( r % 3 ), TGeomID( r % 7 + 1 )));
+  }
+  isOK = testPoints( "many", many ) && isOK;
+
+  return isOK;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testGridLine();
+  return isOK ? 0 : 1;
+}
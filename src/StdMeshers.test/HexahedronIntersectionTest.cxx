@@ -0,0 +1,269 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : HexahedronIntersectionTest.cxx
+//  Module : SMESH
+//  Purpose: Check and time intersection of grid lines with faces by FaceGridIntersector.
+//            Intersection of lines culled by the face bounding box and split into tasks
+//            must give the same points as intersection of all grid lines.
+
+#include "StdMeshers_Cartesian_3D_Grid.hxx"
+#include "StdMeshers_CartesianParameters3D.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+// OCC
+#include <BRep_Builder.hxx>
+#include <BRepTools.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeCone.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <tuple>
+
+using namespace StdMeshers::Cartesian3D;
+
+/*!
+  * \brief Mock mesh
+  */
+struct SMESH_Mesh_Test: public SMESH_Mesh
+{
+  SMESH_Mesh_Test() {
+    _isShapeToMesh = (_id = 0);
+    _meshDS  = new SMESHDS_Mesh( _id, true );
+  }
+};
+
+/*!
+  * \brief Mock Hypothesis
+  */
+struct CartesianHypo: public StdMeshers_CartesianParameters3D
+{
+  CartesianHypo() : StdMeshers_CartesianParameters3D(0/*zero hypoId*/, nullptr/*NULL generator*/)
+  {
+  }
+};
+
+/*!
+  * \brief Shape loader
+  */
+void loadBrepShape( std::string shapeName, TopoDS_Shape & shape )
+{
+  BRep_Builder b;
+  BRepTools::Read(shape, shapeName.c_str(), b);
+}
+
+/*!
+  * \brief Intersection point: index of a grid line, parameter on the line, face ID
+  */
+typedef std::tuple< size_t, double, TGeomID > TIntPoint;
+
+/*!
+  * \brief Intersect faces of a shape with grid lines by given intersectors
+  *  \param [out] time - time of intersection, in seconds
+  *  \return sorted intersection points
+  */
+std::vector< TIntPoint > intersect( Grid&                              grid,
+                                    std::vector< FaceGridIntersector >& intersectors,
+                                    double&                            time )
+{
+  auto start = std::chrono::steady_clock::now();
+  for ( size_t i = 0; i < intersectors.size(); ++i )
+    intersectors[i].Intersect();
+  time = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+
+  std::vector< TIntPoint > points;
+  for ( size_t i = 0; i < intersectors.size(); ++i )
+  {
+    for ( auto& line2point : intersectors[i]._intersections )
+    {
+      // index of the line among lines of all directions
+      size_t lineIndex = 0;
+      for ( int iDir = 0; iDir < 3; ++iDir )
+      {
+        std::vector< GridLine >& lines = grid._lines[ iDir ];
+        if ( line2point.first >= & lines[0] && line2point.first < & lines[0] + lines.size() )
+        {
+          lineIndex += line2point.first - & lines[0];
+          break;
+        }
+        lineIndex += lines.size();
+      }
+      points.push_back( TIntPoint( lineIndex,
+                                   line2point.second._paramOnLine,
+                                   intersectors[i]._faceID ));
+    }
+  }
+  std::sort( points.begin(), points.end() );
+  return points;
+}
+
+/*!
+  * \brief Check if two sets of intersection points are same
+  */
+bool isSame( const std::vector< TIntPoint >& points1,
+             const std::vector< TIntPoint >& points2,
+             double                          tol )
+{
+  if ( points1.size() != points2.size() )
+    return false;
+  for ( size_t i = 0; i < points1.size(); ++i )
+    if ( std::get<0>( points1[i] ) != std::get<0>( points2[i] ) ||
+         std::get<2>( points1[i] ) != std::get<2>( points2[i] ) ||
+         std::abs( std::get<1>( points1[i] ) - std::get<1>( points2[i] )) > tol )
+      return false;
+  return true;
+}
+
+/*!
+  * \brief Compare intersections of all grid lines, of culled lines and of lines split into tasks
+  */
+bool testShape( const std::string& name, const TopoDS_Shape& theShape, double gridSpacing )
+{
+  std::unique_ptr<SMESH_Mesh> aMesh( new SMESH_Mesh_Test() );
+  aMesh->ShapeToMesh( theShape );
+  SMESH_MesherHelper helper( *aMesh );
+
+  Grid grid;
+  grid._helper = &helper;
+  grid._toAddEdges = false;
+  grid._toCreateFaces = false;
+  grid._toConsiderInternalFaces = false;
+  grid._toUseThresholdForInternalFaces = false;
+  grid._toUseQuanta = false;
+  grid._sizeThreshold = 4.0;
+
+  // Canonical axes(i,j,k)
+  double axisDirs[9] = {1.,0.,0., 0.,1.,0., 0.,0.,1.};
+  std::vector<std::string> grdSpace = { std::to_string(gridSpacing) };
+  std::vector<double> intPnts;
+
+  std::unique_ptr<CartesianHypo> aHypo ( new CartesianHypo() );
+  aHypo->SetAxisDirs(axisDirs);
+  aHypo->SetGridSpacing(grdSpace, intPnts, 0 );
+  aHypo->SetGridSpacing(grdSpace, intPnts, 1 );
+  aHypo->SetGridSpacing(grdSpace, intPnts, 2 );
+
+  TEdge2faceIDsMap edge2faceIDsMap;
+  grid.GridInitAndInterserctWithShape( theShape, edge2faceIDsMap, aHypo.get(), 1, false );
+
+  std::vector< FaceGridIntersector > allLines, culled, tasks;
+  for ( TopExp_Explorer fExp( theShape, TopAbs_FACE ); fExp.More(); fExp.Next() )
+  {
+    FaceGridIntersector fgi;
+    fgi._face   = TopoDS::Face( fExp.Current() );
+    fgi._faceID = grid.ShapeID( fExp.Current() );
+    fgi._grid   = &grid;
+    fgi.GetFaceBndBox();
+    culled.push_back( fgi );
+
+    // not culled lines: a task per direction including all lines
+    fgi._surfaceInt = 0;
+    for ( int iDir = 0; iDir < 3; ++iDir )
+    {
+      LineIndexer li = grid.GetLineIndexer( iDir );
+      fgi._iDir = iDir;
+      fgi._range1[0] = fgi._range2[0] = 0;
+      fgi._range1[1] = li._size[ li._iVar1 ];
+      fgi._range2[1] = li._size[ li._iVar2 ];
+      allLines.push_back( fgi );
+    }
+  }
+  for ( size_t i = 0; i < culled.size(); ++i )
+  {
+    FaceGridIntersector fgi = culled[i];
+    fgi._surfaceInt = 0;
+    fgi.Split( /*maxNbLines=*/64, tasks );
+  }
+
+  double tAll, tCulled, tTasks;
+  std::vector< TIntPoint > pointsAll    = intersect( grid, allLines, tAll );
+  std::vector< TIntPoint > pointsCulled = intersect( grid, culled,   tCulled );
+  std::vector< TIntPoint > pointsTasks  = intersect( grid, tasks,    tTasks );
+
+  std::cout << name << ": " << pointsAll.size() << " points; all lines " << tAll
+            << " s, culled lines " << tCulled << " s, "
+            << tasks.size() << " tasks " << tTasks << " s" << std::endl;
+
+  if ( pointsAll.empty() ||
+       !isSame( pointsAll, pointsCulled, grid._tol ) ||
+       !isSame( pointsAll, pointsTasks,  grid._tol ))
+  {
+    std::cerr << name << ": intersection points do not match: "
+              << pointsAll.size() << " != " << pointsCulled.size() << " != " << pointsTasks.size()
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/*!
+  * \brief Test some primitive shapes and shapes of HexahedronTest
+  */
+bool testShapes()
+{
+  bool isOK = true;
+
+  gp_Ax2 anAxes (gp::Origin(), gp::DZ());
+
+  BRepPrimAPI_MakeBox aMakeBox (10, 20, 30);
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the box!", aMakeBox.IsDone() );
+  isOK = testShape( "box", aMakeBox.Shape(), 0.1 ) && isOK;
+
+  BRepPrimAPI_MakeCylinder aMakeCyl (anAxes, 20., 30.);
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the cylinder!", aMakeCyl.IsDone() );
+  isOK = testShape( "cylinder", aMakeCyl.Shape(), 0.2 ) && isOK;
+
+  BRepPrimAPI_MakeSphere aMakeSph (anAxes, 30.);
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the sphere!", aMakeSph.IsDone() );
+  isOK = testShape( "sphere", aMakeSph.Shape(), 0.3 ) && isOK;
+
+  BRepPrimAPI_MakeCone aMakeCon (anAxes, 30., 15., 20.);
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the cone!", aMakeCon.IsDone() );
+  isOK = testShape( "cone", aMakeCon.Shape(), 0.3 ) && isOK;
+
+  BRepPrimAPI_MakeTorus aMakeTor (anAxes, 30., 10.);
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the torus!", aMakeTor.IsDone() );
+  isOK = testShape( "torus", aMakeTor.Shape(), 0.3 ) && isOK;
+
+  TopoDS_Shape aShape;
+  loadBrepShape( "data/HexahedronTest/NRTM1.brep", aShape );
+  CPPUNIT_ASSERT_MESSAGE( "Could not load the brep shape!", !aShape.IsNull() );
+  isOK = testShape( "NRTM1", aShape, 0.5 ) && isOK;
+
+  loadBrepShape( "data/HexahedronTest/NRTMJ4.brep", aShape );
+  CPPUNIT_ASSERT_MESSAGE( "Could not load the brep shape!", !aShape.IsNull() );
+  isOK = testShape( "NRTMJ4", aShape, 1.0 ) && isOK;
+
+  return isOK;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testShapes();
+  return isOK ? 0 : 1;
+}
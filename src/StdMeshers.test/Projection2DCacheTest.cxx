@@ -0,0 +1,251 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : Projection2DCacheTest.cxx
+//  Module : SMESH
+//  Purpose: Check that Projection_2D projecting one source FACE onto several target FACEs
+//            within one Compute() shares the source FACE mesh and the auxiliary quadrangle
+//            mesh between targets, and that the result is same as projection of each target
+//            computed alone.
+
+#include "SMESH_Gen.hxx"
+#include "SMESH_Mesh.hxx"
+#include "SMESH_TypeDefs.hxx"
+#include "SMESH_subMesh.hxx"
+#include "SMESHDS_Mesh.hxx"
+#include "SMESHDS_SubMesh.hxx"
+#include "StdMeshers_NumberOfSegments.hxx"
+#include "StdMeshers_ProjectionSource2D.hxx"
+#include "StdMeshers_Projection_2D.hxx"
+#include "StdMeshers_Quadrangle_2D.hxx"
+#include "StdMeshers_Regular_1D.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+// OCC
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace
+{
+  /*!
+   * \brief Projection_2D remembering meshes of the source FACE it keeps between
+   *        projections to target FACEs
+   */
+  struct CacheTracingProjection : public StdMeshers_Projection_2D
+  {
+    std::set< StdMeshers_ProjectionUtils::SourceFaceMeshPtr > _usedSrcFaceMeshes;
+    std::set< boost::shared_ptr< SMESH_Mesh > >              _usedSrcQuadMeshes;
+
+    CacheTracingProjection( int hypId, SMESH_Gen* gen ): StdMeshers_Projection_2D( hypId, gen ) {}
+
+    virtual bool Compute( SMESH_Mesh& theMesh, const TopoDS_Shape& theShape )
+    {
+      bool ok = StdMeshers_Projection_2D::Compute( theMesh, theShape );
+      // keep pointers to see if a new source mesh is loaded for each target
+      for ( auto& key2mesh : _srcFaceMeshes )
+        _usedSrcFaceMeshes.insert( key2mesh.second );
+      for ( auto& key2mesh : _srcQuadMeshes )
+        _usedSrcQuadMeshes.insert( key2mesh.second );
+      return ok;
+    }
+  };
+
+  /*!
+   * \brief Make a planar FACE bounded by a polygon
+   */
+  TopoDS_Face makeFace( const std::vector< gp_Pnt >& corners )
+  {
+    BRepBuilderAPI_MakePolygon polygon;
+    for ( const gp_Pnt& p : corners )
+      polygon.Add( p );
+    polygon.Close();
+    return BRepBuilderAPI_MakeFace( polygon.Wire(), /*OnlyPlane=*/true );
+  }
+
+  /*!
+   * \brief Return a VERTEX of a shape located at a point
+   */
+  TopoDS_Vertex findVertex( const TopoDS_Shape& shape, const gp_Pnt& p )
+  {
+    for ( TopExp_Explorer vExp( shape, TopAbs_VERTEX ); vExp.More(); vExp.Next() )
+      if ( BRep_Tool::Pnt( TopoDS::Vertex( vExp.Current() )).Distance( p ) < 1e-7 )
+        return TopoDS::Vertex( vExp.Current() );
+    return TopoDS_Vertex();
+  }
+
+  /*!
+   * \brief Check if two sub-meshes have same elements at same places
+   */
+  bool isSameMesh( SMESHDS_SubMesh* sm1, SMESHDS_SubMesh* sm2 )
+  {
+    if ( !sm1 || !sm2 || sm1->NbElements() == 0 || sm1->NbElements() != sm2->NbElements() )
+      return false;
+    SMDS_ElemIteratorPtr elemIt1 = sm1->GetElements(), elemIt2 = sm2->GetElements();
+    while ( elemIt1->more() )
+    {
+      const SMDS_MeshElement* e1 = elemIt1->next(), *e2 = elemIt2->next();
+      if ( e1->NbNodes() != e2->NbNodes() )
+        return false;
+      for ( int i = 0; i < e1->NbNodes(); ++i )
+        if (( SMESH_NodeXYZ( e1->GetNode( i )) - SMESH_NodeXYZ( e2->GetNode( i ))).Modulus() > 1e-12 )
+          return false;
+    }
+    return true;
+  }
+}
+
+/*!
+  * \brief Assign hypotheses to a mesh of a compound of the source and target FACEs
+  */
+void setHypotheses( SMESH_Mesh&                                                            mesh,
+                    const TopoDS_Shape&                                                    shape,
+                    const TopoDS_Face&                                                     srcFace,
+                    const std::vector< TopoDS_Face >&                                      tgtFaces,
+                    const std::vector< SMESH_Hypothesis* >&                                hyps,
+                    const std::vector< std::unique_ptr< StdMeshers_ProjectionSource2D > >& sources )
+{
+  mesh.ShapeToMesh( shape );
+  mesh.AddHypothesis( shape,   hyps[0]->GetID() ); // Regular_1D
+  mesh.AddHypothesis( shape,   hyps[1]->GetID() ); // NumberOfSegments
+  mesh.AddHypothesis( srcFace, hyps[2]->GetID() ); // Quadrangle_2D
+  for ( size_t i = 0; i < tgtFaces.size(); ++i )
+  {
+    mesh.AddHypothesis( tgtFaces[i], hyps[3]->GetID() ); // Projection_2D
+    mesh.AddHypothesis( tgtFaces[i], sources[i]->GetID() );
+  }
+}
+
+/*!
+  * \brief Project a square FACE onto its partners, a similar FACE and two trapezoids
+  *        at once and one by one
+  */
+bool testProjectToSeveralFaces()
+{
+  // source and target FACEs; two first corners of a target correspond to
+  // two first corners of the source
+  const std::vector< gp_Pnt > srcCorners = { gp_Pnt( 0, 0, 0 ), gp_Pnt( 1, 0, 0 ),
+                                             gp_Pnt( 1, 1, 0 ), gp_Pnt( 0, 1, 0 ) };
+  const TopoDS_Face srcFace = makeFace( srcCorners );
+
+  std::vector< TopoDS_Face >            tgtFaces;
+  std::vector< std::vector< gp_Pnt > > tgtCorners;
+  for ( double dx : { 2., 4. } ) // partners of srcFace
+  {
+    gp_Trsf trsf;
+    trsf.SetTranslation( gp_Vec( dx, 0, 0 ));
+    tgtFaces.push_back( TopoDS::Face( srcFace.Moved( TopLoc_Location( trsf ))));
+    tgtCorners.push_back({ gp_Pnt( dx, 0, 0 ), gp_Pnt( dx + 1, 0, 0 ) });
+  }
+  tgtCorners.push_back({ gp_Pnt( 0, 2, 0 ), gp_Pnt( 1, 2, 0 ), // similar to srcFace
+                         gp_Pnt( 1, 3, 0 ), gp_Pnt( 0, 3, 0 ) });
+  tgtFaces.push_back( makeFace( tgtCorners.back() ));
+  for ( double dx : { 0., 3. } ) // not similar to srcFace
+  {
+    tgtCorners.push_back({ gp_Pnt( dx, 4, 0 ),     gp_Pnt( dx + 1.5, 4, 0 ),
+                           gp_Pnt( dx + 1, 5, 0 ), gp_Pnt( dx, 5, 0 ) });
+    tgtFaces.push_back( makeFace( tgtCorners.back() ));
+  }
+
+  TopoDS_Compound shape;
+  BRep_Builder builder;
+  builder.MakeCompound( shape );
+  builder.Add( shape, srcFace );
+  for ( const TopoDS_Face& f : tgtFaces )
+    builder.Add( shape, f );
+
+  // hypotheses
+  SMESH_Gen aGen;
+  StdMeshers_Regular_1D       aRegular1D  ( 1, &aGen );
+  StdMeshers_NumberOfSegments aNbSegments ( 2, &aGen );
+  StdMeshers_Quadrangle_2D    aQuadrangle ( 3, &aGen );
+  CacheTracingProjection      aProjection ( 4, &aGen );
+  aNbSegments.SetNumberOfSegments( 10 );
+  std::vector< SMESH_Hypothesis* > aHyps = { &aRegular1D, &aNbSegments, &aQuadrangle, &aProjection };
+
+  std::vector< std::unique_ptr< StdMeshers_ProjectionSource2D > > aSources;
+  for ( size_t i = 0; i < tgtFaces.size(); ++i )
+  {
+    TopoDS_Vertex srcV1 = findVertex( srcFace,     srcCorners[0] );
+    TopoDS_Vertex srcV2 = findVertex( srcFace,     srcCorners[1] );
+    TopoDS_Vertex tgtV1 = findVertex( tgtFaces[i], tgtCorners[i][0] );
+    TopoDS_Vertex tgtV2 = findVertex( tgtFaces[i], tgtCorners[i][1] );
+    CPPUNIT_ASSERT_MESSAGE( "Corner VERTEX not found",
+                            !srcV1.IsNull() && !srcV2.IsNull() && !tgtV1.IsNull() && !tgtV2.IsNull() );
+
+    aSources.emplace_back( new StdMeshers_ProjectionSource2D( 5 + (int) i, &aGen ));
+    aSources.back()->SetSourceFace( srcFace );
+    aSources.back()->SetVertexAssociation( srcV1, srcV2, tgtV1, tgtV2 );
+  }
+
+  // project onto all target FACEs at once
+
+  std::unique_ptr< SMESH_Mesh > aMesh( aGen.CreateMesh( false ));
+  setHypotheses( *aMesh, shape, srcFace, tgtFaces, aHyps, aSources );
+  CPPUNIT_ASSERT_MESSAGE( "Could not compute the mesh!", aGen.Compute( *aMesh, shape, /*flags=*/0 ));
+
+  CPPUNIT_ASSERT_MESSAGE( "Source FACE mesh not shared by targets",
+                          aProjection._usedSrcFaceMeshes.size() == 1 );
+  CPPUNIT_ASSERT_MESSAGE( "Quadrangle mesh of the source FACE not shared by trapezoids",
+                          aProjection._usedSrcQuadMeshes.size() == 1 );
+
+  // project onto each target FACE alone; nothing is kept between projections
+
+  aProjection._usedSrcFaceMeshes.clear();
+  aProjection._usedSrcQuadMeshes.clear();
+
+  std::unique_ptr< SMESH_Mesh > aMeshByFace( aGen.CreateMesh( false ));
+  setHypotheses( *aMeshByFace, shape, srcFace, tgtFaces, aHyps, aSources );
+  for ( const TopoDS_Face& tgtFace : tgtFaces )
+    CPPUNIT_ASSERT_MESSAGE( "Could not compute a target FACE!",
+                            aGen.Compute( *aMeshByFace, tgtFace, /*flags=*/0 ));
+
+  CPPUNIT_ASSERT_MESSAGE( "Mesh kept by projection of one target FACE",
+                          aProjection._usedSrcFaceMeshes.empty() &&
+                          aProjection._usedSrcQuadMeshes.empty() );
+
+  // compare
+
+  for ( const TopoDS_Face& tgtFace : tgtFaces )
+    CPPUNIT_ASSERT_MESSAGE( "Projection differs from projection of one target FACE",
+                            isSameMesh( aMesh      ->GetMeshDS()->MeshElements( tgtFace ),
+                                        aMeshByFace->GetMeshDS()->MeshElements( tgtFace )));
+
+  return true;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testProjectToSeveralFaces();
+  return isOK ? 0 : 1;
+}
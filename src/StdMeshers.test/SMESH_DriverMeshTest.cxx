@@ -0,0 +1,276 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : SMESH_DriverMeshTest.cxx
+//  Module : SMESH
+//  Purpose: Check files exchanged with mesher runners: a shape written to a binary (.bin) file
+//            and the mesh of a solid boundary written by SMESH_DriverMesh::exportSolidBoundary()
+//            must be read back unchanged; a corrupted boundary file must be refused.
+
+#include "SMESH_DriverMesh.hxx"
+#include "SMESH_DriverShape.hxx"
+#include "SMESH_Gen.hxx"
+#include "SMESH_Mesh.hxx"
+#include "SMESH_MeshAlgos.hxx"
+#include "SMESH_TypeDefs.hxx"
+#include "SMESHDS_Mesh.hxx"
+#include "SMDS_Mesh.hxx"
+#include "StdMeshers_NumberOfSegments.hxx"
+#include "StdMeshers_Quadrangle_2D.hxx"
+#include "StdMeshers_Regular_1D.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+// OCC
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/*!
+  * \brief Write a box to a .bin file and read it back
+  */
+bool testBinShape()
+{
+  BRepPrimAPI_MakeBox aMakeBox( gp_Pnt( 1, 2, 3 ), 10, 20, 30 );
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the box!", aMakeBox.IsDone() );
+  TopoDS_Shape aShape = aMakeBox.Shape();
+
+  const std::string aFile = "SMESH_DriverMeshTest_shape.bin";
+  SMESH_DriverShape::exportShape( aFile, aShape );
+  TopoDS_Shape aReadShape;
+  SMESH_DriverShape::importShape( aFile, aReadShape );
+  std::remove( aFile.c_str() );
+
+  CPPUNIT_ASSERT_MESSAGE( "Could not read the .bin shape!", !aReadShape.IsNull() );
+  CPPUNIT_ASSERT( aReadShape.ShapeType() == aShape.ShapeType() );
+
+  TopTools_IndexedMapOfShape aFaces, aReadFaces;
+  TopExp::MapShapes( aShape,     TopAbs_FACE, aFaces );
+  TopExp::MapShapes( aReadShape, TopAbs_FACE, aReadFaces );
+  CPPUNIT_ASSERT_EQUAL( aFaces.Extent(), aReadFaces.Extent() );
+
+  GProp_GProps aProps;
+  BRepGProp::VolumeProperties( aReadShape, aProps );
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( 10. * 20. * 30., aProps.Mass(), 1e-6 );
+  CPPUNIT_ASSERT( aProps.CentreOfMass().IsEqual( gp_Pnt( 6, 12, 18 ), 1e-9 ));
+
+  return true;
+}
+
+/*!
+  * \brief Mesh the boundary of a box, export it and import it into another mesh
+  */
+bool testSolidBoundary()
+{
+  SMESH_Gen aGen;
+  StdMeshers_Regular_1D       aRegular1D  ( 1, &aGen );
+  StdMeshers_NumberOfSegments aNbSegments ( 2, &aGen );
+  StdMeshers_Quadrangle_2D    aQuadrangle ( 3, &aGen );
+  aNbSegments.SetNumberOfSegments( 3 );
+
+  const gp_Pnt aCenter( 5, 10, 15 );
+  BRepPrimAPI_MakeBox aMakeBox( 10, 20, 30 );
+  CPPUNIT_ASSERT_MESSAGE( "Could not create the box!", aMakeBox.IsDone() );
+  TopoDS_Shape aBox = aMakeBox.Shape();
+
+  std::unique_ptr< SMESH_Mesh > aMesh( aGen.CreateMesh( false ));
+  aMesh->ShapeToMesh( aBox );
+  aMesh->AddHypothesis( aBox, aRegular1D.GetID() );
+  aMesh->AddHypothesis( aBox, aNbSegments.GetID() );
+  aMesh->AddHypothesis( aBox, aQuadrangle.GetID() );
+  CPPUNIT_ASSERT_MESSAGE( "Could not compute the mesh!",
+                          aGen.Compute( *aMesh, aBox, SMESH_Gen::COMPACT_MESH, ::MeshDim_2D ));
+
+  SMESHDS_Mesh* aMeshDS = aMesh->GetMeshDS();
+  CPPUNIT_ASSERT_EQUAL( smIdType( 6 * 3 * 3 ), aMeshDS->NbFaces() );
+
+  TopTools_IndexedMapOfShape aSolids;
+  TopExp::MapShapes( aBox, TopAbs_SOLID, aSolids );
+  const std::string aFile = "SMESH_DriverMeshTest_boundary.bin";
+  SMESH_DriverMesh::exportSolidBoundary( aFile, *aMesh, aSolids( 1 ));
+
+  std::unique_ptr< SMESH_Mesh > aReadMesh( aGen.CreateMesh( false ));
+  SMESH_DriverMesh::importSolidBoundary( aFile, *aReadMesh );
+  std::remove( aFile.c_str() );
+
+  // same nodes, same IDs
+  SMESHDS_Mesh* aReadMeshDS = aReadMesh->GetMeshDS();
+  CPPUNIT_ASSERT_EQUAL( aMeshDS->NbNodes(), aReadMeshDS->NbNodes() );
+  CPPUNIT_ASSERT_EQUAL( aMeshDS->NbFaces(), aReadMeshDS->NbFaces() );
+  for ( SMDS_NodeIteratorPtr nIt = aReadMeshDS->nodesIterator(); nIt->more(); )
+  {
+    const SMDS_MeshNode* aReadNode = nIt->next();
+    const SMDS_MeshNode* aNode = aMeshDS->FindNode( aReadNode->GetID() );
+    CPPUNIT_ASSERT_MESSAGE( "Node ID is not kept", aNode );
+    CPPUNIT_ASSERT( SMESH_NodeXYZ( aNode ).IsEqual( SMESH_NodeXYZ( aReadNode ), 0. ));
+  }
+
+  // same faces, same IDs, normals point outside the box
+  for ( SMDS_ElemIteratorPtr fIt = aReadMeshDS->elementsIterator( SMDSAbs_Face ); fIt->more(); )
+  {
+    const SMDS_MeshElement* aReadFace = fIt->next();
+    const SMDS_MeshElement* aFace = aMeshDS->FindElement( aReadFace->GetID() );
+    CPPUNIT_ASSERT_MESSAGE( "Face ID is not kept", aFace && aFace->GetType() == SMDSAbs_Face );
+    CPPUNIT_ASSERT( aFace->GetEntityType() == aReadFace->GetEntityType() );
+
+    std::set< smIdType > aNodeIDs, aReadNodeIDs;
+    for ( int i = 0; i < aFace->NbNodes(); ++i )
+    {
+      aNodeIDs.insert    ( aFace    ->GetNode( i )->GetID() );
+      aReadNodeIDs.insert( aReadFace->GetNode( i )->GetID() );
+    }
+    CPPUNIT_ASSERT_MESSAGE( "Face nodes differ", aNodeIDs == aReadNodeIDs );
+
+    gp_XYZ aNormal;
+    CPPUNIT_ASSERT( SMESH_MeshAlgos::FaceNormal( aReadFace, aNormal ));
+    gp_XYZ aFaceCenter( 0, 0, 0 );
+    for ( int i = 0; i < aReadFace->NbNodes(); ++i )
+      aFaceCenter += SMESH_NodeXYZ( aReadFace->GetNode( i )) / aReadFace->NbNodes();
+    CPPUNIT_ASSERT_MESSAGE( "Face is not oriented outside",
+                            aNormal * ( aFaceCenter - aCenter.XYZ() ) > 0 );
+  }
+
+  aReadMesh.reset();
+  aMesh.reset();
+  return true;
+}
+
+template< typename T > void write( std::ostringstream& data, const T& value )
+{
+  data.write( (const char*) &value, sizeof( T ));
+}
+
+/*!
+  * \brief Contents of a boundary file holding two triangles sharing nodes
+  */
+std::string makeBoundaryData( smIdType nbNodes, smIdType nbFaces, smIdType lastNodeID )
+{
+  std::ostringstream data;
+  data.write( "SMESHBND", 8 );
+  write( data, int( 1 ));
+  write( data, int( sizeof( smIdType )));
+
+  write( data, nbNodes );
+  for ( smIdType id : { 1, 2, 3, 4 } )
+    write( data, id );
+  for ( double coord : { 0., 0., 0.,   1., 0., 0.,   0., 1., 0.,   1., 1., 0. } )
+    write( data, coord );
+
+  write( data, nbFaces );
+  for ( smIdType id : { 5, 6 } )   write( data, id ); // face IDs
+  for ( smIdType nb : { 3, 3 } )   write( data, nb ); // nb of face nodes
+  for ( char flag : { 0, 0 } )     write( data, flag );
+  for ( smIdType id : std::vector< smIdType >{ 1, 2, 3,  2, 4, lastNodeID } )
+    write( data, id );
+
+  return data.str();
+}
+
+/*!
+  * \brief Write a boundary file and return the number of nodes and faces imported from it,
+  *        or -1 if import fails
+  */
+smIdType importBoundaryData( SMESH_Gen& aGen, const std::string& aData, int nbImports = 1 )
+{
+  const std::string aFile = "SMESH_DriverMeshTest_corrupted.bin";
+  {
+    std::ofstream file( aFile, std::ios::binary );
+    file.write( aData.data(), aData.size() );
+  }
+  std::unique_ptr< SMESH_Mesh > aMesh( aGen.CreateMesh( false ));
+  smIdType nbImported = 0;
+  try
+  {
+    for ( int i = 0; i < nbImports; ++i )
+      SMESH_DriverMesh::importSolidBoundary( aFile, *aMesh );
+    nbImported = aMesh->GetMeshDS()->NbNodes() + aMesh->GetMeshDS()->NbFaces();
+  }
+  catch ( const std::exception& )
+  {
+    nbImported = -1;
+  }
+  std::remove( aFile.c_str() );
+  return nbImported;
+}
+
+/*!
+  * \brief Import corrupted boundary files
+  */
+bool testCorruptedBoundary()
+{
+  SMESH_Gen aGen;
+  const smIdType aHugeNb = std::numeric_limits< smIdType >::max() / 2;
+
+  const std::string aValidData = makeBoundaryData( 4, 2, 3 );
+  CPPUNIT_ASSERT_EQUAL( smIdType( 4 + 2 ), importBoundaryData( aGen, aValidData ));
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Truncated file accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, aValidData.substr( 0, aValidData.size() - 1 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Huge number of nodes accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, makeBoundaryData( aHugeNb, 2, 3 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Negative number of nodes accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, makeBoundaryData( -4, 2, 3 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Huge number of faces accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, makeBoundaryData( 4, aHugeNb, 3 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Face of a missing node accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, makeBoundaryData( 4, 2, 10 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Face node ID 0 accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, makeBoundaryData( 4, 2, 0 )));
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Existing node IDs accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, aValidData, /*nbImports=*/2 ));
+
+  std::string aBadHeader = aValidData;
+  aBadHeader[ 0 ] = 'X';
+  CPPUNIT_ASSERT_EQUAL_MESSAGE( "Wrong header accepted", smIdType( -1 ),
+                                importBoundaryData( aGen, aBadHeader ));
+
+  std::unique_ptr< SMESH_Mesh > aMesh( aGen.CreateMesh( false ));
+  bool isRead = true;
+  try
+  {
+    SMESH_DriverMesh::importSolidBoundary( "SMESH_DriverMeshTest_missing.bin", *aMesh );
+  }
+  catch ( const std::exception& )
+  {
+    isRead = false;
+  }
+  CPPUNIT_ASSERT_MESSAGE( "Missing file read", !isRead );
+
+  return true;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testBinShape();
+  isOK = testSolidBoundary() && isOK;
+  isOK = testCorruptedBoundary() && isOK;
+  return isOK ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : TiledVectorTest.cxx
+//  Module : SMESH
+//  Purpose: Check TiledVector storing data at nodes of the Cartesian grid: values must be
+//            the same as in a std::vector, and tiles allocated only where values are changed.
+
+#include "StdMeshers_Cartesian_3D_Grid.hxx"
+
+// CPP TEST
+#include <cppunit/TestAssert.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace StdMeshers::Cartesian3D;
+
+/*!
+  * \brief Check an empty vector and a vector of default values
+  */
+bool testDefault()
+{
+  TiledVector< int > tv;
+  CPPUNIT_ASSERT_MESSAGE( "New TiledVector is not empty", tv.empty() && tv.size() == 0 );
+
+  const size_t size = 3 * TiledVector< int >::TileSize() + 5;
+  tv.resize( size, -1 );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong size", !tv.empty() && tv.size() == size );
+  CPPUNIT_ASSERT_MESSAGE( "Tiles allocated by resize()", tv.NbAllocatedTiles() == 0 );
+  for ( size_t i = 0; i < size; ++i )
+    CPPUNIT_ASSERT_MESSAGE( "Wrong default value", tv[ i ] == -1 );
+
+  TiledVector< const SMDS_MeshNode* > nodes;
+  nodes.resize( size );
+  for ( size_t i = 0; i < size; i += 7 )
+    CPPUNIT_ASSERT_MESSAGE( "Default pointer is not null", nodes[ i ] == nullptr );
+
+  tv.clear();
+  CPPUNIT_ASSERT_MESSAGE( "Not empty after clear()", tv.empty() && tv.NbAllocatedTiles() == 0 );
+
+  return true;
+}
+
+/*!
+  * \brief Check that only tiles of changed values are allocated
+  */
+bool testTiles()
+{
+  const size_t tileSize = TiledVector< int >::TileSize();
+  const size_t size     = 4 * tileSize + 1;
+
+  TiledVector< int > tv;
+  tv.resize( size, -1 );
+
+  tv.Change( tileSize + 10 ) = 7;
+  CPPUNIT_ASSERT_MESSAGE( "Wrong number of tiles", tv.NbAllocatedTiles() == 1 );
+  CPPUNIT_ASSERT_MESSAGE( "Tile not allocated", tv.IsAllocated( tileSize ) &&
+                          tv.IsAllocated( 2 * tileSize - 1 ));
+  CPPUNIT_ASSERT_MESSAGE( "Other tile allocated", !tv.IsAllocated( tileSize - 1 ) &&
+                          !tv.IsAllocated( 2 * tileSize ));
+  CPPUNIT_ASSERT_MESSAGE( "Wrong changed value", tv[ tileSize + 10 ] == 7 );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong value in allocated tile", tv[ tileSize + 9 ] == -1 &&
+                          tv[ tileSize + 11 ] == -1 );
+
+  // the last tile holds one value
+  tv.Change( size - 1 ) = 8;
+  CPPUNIT_ASSERT_MESSAGE( "Wrong number of tiles", tv.NbAllocatedTiles() == 2 );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong last value", tv[ size - 1 ] == 8 );
+
+  // resize() resets all values
+  tv.resize( size, 0 );
+  CPPUNIT_ASSERT_MESSAGE( "Tiles kept by resize()", tv.NbAllocatedTiles() == 0 );
+  CPPUNIT_ASSERT_MESSAGE( "Value kept by resize()", tv[ tileSize + 10 ] == 0 );
+
+  return true;
+}
+
+/*!
+  * \brief Compare with std::vector after changing values at pseudo-random indices
+  */
+bool testValues()
+{
+  const size_t size = 10 * TiledVector< int >::TileSize() + 123;
+
+  TiledVector< int > tv;
+  tv.resize( size, -1 );
+  std::vector< int > v( size, -1 );
+
+  // change values in the first half only
+  size_t index = 1;
+  for ( int i = 0; i < 5000; ++i )
+  {
+    index = ( index * 1103515245 + 12345 ) % ( size / 2 );
+    tv.Change( index ) = i;
+    v[ index ]         = i;
+  }
+  tv.Change( size - 1 ) += 2;
+  v[ size - 1 ]         += 2;
+
+  for ( size_t i = 0; i < size; ++i )
+    CPPUNIT_ASSERT_MESSAGE( "Value differs from std::vector", tv[ i ] == v[ i ] );
+
+  CPPUNIT_ASSERT_MESSAGE( "Too many tiles allocated",
+                          tv.NbAllocatedTiles() <= 6 + 1 ); // first half + last tile
+  return true;
+}
+
+// Entry point for test
+int main()
+{
+  bool isOK = testDefault() && testTiles() && testValues();
+  return isOK ? 0 : 1;
+}
@@ -60,6 +60,7 @@
 #include <gp_Pnt.hxx>
 
 #include <limits>
+#include <memory>
 #include <vector>
 #include <set>
 
@@ -148,6 +149,7 @@ namespace // internal utils
     const BBox* GetBox() const { return (BBox*) getBox(); }
     double GetMinSize() { return getData()->myMinSize; }
   };
+  class ElementBndBoxTree;
   //================================================================================
   /*!
    * \brief Adaptive wire discertizator.
@@ -156,6 +158,7 @@ namespace // internal utils
   {
   public:
     AdaptiveAlgo(int hypId, SMESH_Gen* gen);
+    ~AdaptiveAlgo();
     virtual bool Compute(SMESH_Mesh & aMesh, const TopoDS_Shape & aShape );
     virtual bool Evaluate(SMESH_Mesh &         theMesh,
                           const TopoDS_Shape & theShape,
@@ -164,11 +167,24 @@ namespace // internal utils
   private:
 
     bool makeSegments();
+    bool updateCache( SMESH_Mesh& theMesh );
+    void releaseCache( SMESH_Mesh& theMesh );
 
     const StdMeshers_Adaptive1D* myHyp;
     SMESH_Mesh*                  myMesh;
     vector< EdgeData >           myEdges;
     SegSizeTree*                 mySizeTree;
+
+    // data depending on the shape and deflection only, reused by Compute()
+    // of EDGEs of one mesh and released when all of them are computed
+    struct Cache
+    {
+      TopoDS_Shape                                myShape;
+      double                                      myDeflection;
+      Bnd_B3d                                     myBox;
+      vector< std::unique_ptr< ElementBndBoxTree >> myFaceTrees; // trees of FACE triangulations
+    };
+    Cache                        myCache;
   };
 
   //================================================================================
@@ -242,6 +258,7 @@ namespace // internal utils
     BRepAdaptor_Surface          mySurface;
     ElementBndBoxTree*           myTree;
     TColgp_Array1OfPnt           myNodes;
+    Handle(Poly_Triangulation)   myTriangulation; // the FACE can be re-triangulated
 
     typedef vector<int> IntVec;
     IntVec                       myFoundTriaIDs;
@@ -314,6 +331,7 @@ namespace // internal utils
   {
     TopLoc_Location loc;
     Handle(Poly_Triangulation) tr = BRep_Tool::Triangulation( face, loc );
+    myTriangulation = tr;
     if ( !tr.IsNull() )
     {
       myFaceTol         = SMESH_MesherHelper::MaxTolerance( face );
@@ -344,7 +362,7 @@ namespace // internal utils
     if ( !myTrias.empty() ) return; // already done
 
     TopLoc_Location loc;
-    Handle(Poly_Triangulation) tr = BRep_Tool::Triangulation( mySurface.Face(), loc );
+    const Handle(Poly_Triangulation)& tr = myTriangulation;
 
     if ( tr.IsNull() || !tr->NbTriangles() ) return;
 
@@ -444,8 +462,7 @@ namespace // internal utils
     double size = -1., maxLinkLen;
     int    jLongest = 0;
 
-    TopLoc_Location loc;
-    Handle(Poly_Triangulation) tr = BRep_Tool::Triangulation( mySurface.Face(), loc );
+    const Handle(Poly_Triangulation)& tr = myTriangulation;
     for ( int i = 1; i <= tr->NbTriangles(); ++i )
     {
       // get corners of a triangle
@@ -520,8 +537,7 @@ namespace // internal utils
     if ( myFoundTriaIDs.empty() )
       return minDist2;
 
-    TopLoc_Location loc;
-    Handle(Poly_Triangulation) tr = BRep_Tool::Triangulation( mySurface.Face(), loc );
+    const Handle(Poly_Triangulation)& tr = myTriangulation;
 
     Standard_Integer n[ 3 ];
     for ( size_t i = 0; i < myFoundTriaIDs.size(); ++i )
@@ -1095,6 +1111,17 @@ AdaptiveAlgo::AdaptiveAlgo(int        hypId,
     myHyp(NULL)
 {
   _name = "AdaptiveAlgo_1D";
+  myCache.myDeflection = -1;
+}
+
+//================================================================================
+/*!
+ * \brief Destructor
+ */
+//================================================================================
+
+AdaptiveAlgo::~AdaptiveAlgo()
+{
 }
 
 //================================================================================
@@ -1126,28 +1153,16 @@ bool AdaptiveAlgo::Compute(SMESH_Mesh &         theMesh,
   SMESH_MesherHelper helper( theMesh );
   const double grading = 0.7;
 
-  TopTools_IndexedMapOfShape edgeMap, faceMap;
-  TopExp::MapShapes( theShape,                 TopAbs_EDGE, edgeMap );
-  TopExp::MapShapes( theMesh.GetShapeToMesh(), TopAbs_FACE, faceMap );
-
-  // Triangulate the shape with the given deflection ?????????
-  {
-    BRepMesh_IncrementalMesh im( theMesh.GetShapeToMesh(), myHyp->GetDeflection(), /*isRelatif=*/0);
-  }
+  TopTools_IndexedMapOfShape edgeMap;
+  TopExp::MapShapes( theShape, TopAbs_EDGE, edgeMap );
 
-  // get a bnd box
-  Bnd_B3d box;
-  {
-    Bnd_Box aBox;
-    BRepBndLib::Add( theMesh.GetShapeToMesh(), aBox);
-    Standard_Real TXmin, TYmin, TZmin, TXmax, TYmax, TZmax;
-    aBox.Get(TXmin, TYmin, TZmin, TXmax, TYmax, TZmax);
-    box.Add( gp_XYZ( TXmin, TYmin, TZmin ));
-    box.Add( gp_XYZ( TXmax, TYmax, TZmax ));
-  }
+  // triangulate the shape and build trees of triangles, unless done by previous Compute()
+  if ( !updateCache( theMesh ))
+    return false;
   // *theProgress = 0.3;
 
   // holder of segment size at each point
+  Bnd_B3d box = myCache.myBox;
   SegSizeTree sizeTree( box, grading, myHyp->GetMinSize(), myHyp->GetMaxSize() );
   mySizeTree = & sizeTree;
 
@@ -1229,16 +1244,12 @@ bool AdaptiveAlgo::Compute(SMESH_Mesh &         theMesh,
 
   // Limit size of segments according to distance to closest FACE
 
-  for ( int iF = 1; iF <= faceMap.Extent(); ++iF )
+  for ( size_t iF = 0; iF < myCache.myFaceTrees.size(); ++iF )
   {
     if ( _computeCanceled ) return false;
 
-    const TopoDS_Face & face = TopoDS::Face( faceMap( iF ));
-    // cout << "FACE " << iF << "/" << faceMap.Extent()
-    //      << " id-" << theMesh.GetMeshDS()->ShapeToIndex( face ) << endl;
-
-    ElementBndBoxTree triaTree( face ); // tree of FACE triangulation
-    TriaTreeData*     triaSearcher = triaTree.GetTriaData();
+    TriaTreeData*      triaSearcher = myCache.myFaceTrees[ iF ]->GetTriaData();
+    const TopoDS_Face& face         = triaSearcher->mySurface.Face();
 
     triaSearcher->SetSizeByTrias( sizeTree, myHyp->GetDeflection() );
 
@@ -1330,11 +1341,96 @@ bool AdaptiveAlgo::Compute(SMESH_Mesh &         theMesh,
       } // while ( sizeDecreased )
     } // loop on myEdges
 
-    // *theProgress = 0.3 + 0.3 * iF / double( faceMap.Extent() );
+    // *theProgress = 0.3 + 0.3 * iF / double( myCache.myFaceTrees.size() );
 
   } // loop on faceMap
 
-  return makeSegments();
+  bool ok = makeSegments();
+
+  releaseCache( theMesh );
+
+  return ok;
+}
+
+//================================================================================
+/*!
+ * \brief Triangulate the shape to mesh and build trees of FACE triangulations if the
+ *        shape or hypothesis parameters changed since the previous Compute()
+ *  \return bool - false if computation is canceled
+ */
+//================================================================================
+
+bool AdaptiveAlgo::updateCache( SMESH_Mesh& theMesh )
+{
+  const TopoDS_Shape& shape = theMesh.GetShapeToMesh();
+  if ( myCache.myShape.IsEqual( shape ) &&
+       myCache.myDeflection == myHyp->GetDeflection() )
+    return true;
+
+  myCache.myShape.Nullify();
+  myCache.myFaceTrees.clear();
+
+  // Triangulate the shape with the given deflection ?????????
+  {
+    BRepMesh_IncrementalMesh im( shape, myHyp->GetDeflection(), /*isRelatif=*/0);
+  }
+
+  // get a bnd box
+  myCache.myBox.Clear();
+  {
+    Bnd_Box aBox;
+    BRepBndLib::Add( shape, aBox);
+    Standard_Real TXmin, TYmin, TZmin, TXmax, TYmax, TZmax;
+    aBox.Get(TXmin, TYmin, TZmin, TXmax, TYmax, TZmax);
+    myCache.myBox.Add( gp_XYZ( TXmin, TYmin, TZmin ));
+    myCache.myBox.Add( gp_XYZ( TXmax, TYmax, TZmax ));
+  }
+
+  TopTools_IndexedMapOfShape faceMap;
+  TopExp::MapShapes( shape, TopAbs_FACE, faceMap );
+  myCache.myFaceTrees.reserve( faceMap.Extent() );
+  for ( int iF = 1; iF <= faceMap.Extent(); ++iF )
+  {
+    if ( _computeCanceled )
+    {
+      myCache.myFaceTrees.clear();
+      return false;
+    }
+    const TopoDS_Face & face = TopoDS::Face( faceMap( iF ));
+    myCache.myFaceTrees.emplace_back( new ElementBndBoxTree( face )); // tree of FACE triangulation
+  }
+
+  myCache.myShape      = shape;
+  myCache.myDeflection = myHyp->GetDeflection();
+
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief Free the trees of FACE triangulations if no more EDGEs of the mesh
+ *        wait for Compute() with the hypothesis
+ */
+//================================================================================
+
+void AdaptiveAlgo::releaseCache( SMESH_Mesh& theMesh )
+{
+  SMESH_HypoFilter hypFilter( SMESH_HypoFilter::Is( myHyp ));
+
+  TopTools_IndexedMapOfShape edgeMap;
+  TopExp::MapShapes( theMesh.GetShapeToMesh(), TopAbs_EDGE, edgeMap );
+  for ( int iE = 1; iE <= edgeMap.Extent(); ++iE )
+  {
+    SMESH_subMesh* sm = theMesh.GetSubMeshContaining( edgeMap( iE ));
+    if ( sm &&
+         sm->GetComputeState() == SMESH_subMesh::READY_TO_COMPUTE &&
+         sm->IsEmpty() &&
+         theMesh.GetHypothesis( sm, hypFilter, /*andAncestors=*/true ))
+      return;
+  }
+
+  myCache.myShape.Nullify();
+  myCache.myFaceTrees.clear();
 }
 
 //================================================================================
@@ -69,7 +69,8 @@ StdMeshers_CartesianParameters3D::StdMeshers_CartesianParameters3D(int         h
     _toUseThresholdForInternalFaces( false ),
     _toCreateFaces( false ),
     _toUseQuanta(false),
-    _quanta(0.01)
+    _quanta(0.01),
+    _octreeLevels(0)
 {
   _name = "CartesianParameters3D"; // used by "Cartesian_3D"
   _param_algo_dim = 3; // 3D
@@ -811,6 +812,23 @@ void StdMeshers_CartesianParameters3D::SetQuanta(const double quanta)
     NotifySubMeshesHypothesisModification();
 }
 
+//=======================================================================
+//function : SetOctreeLevels
+//purpose  : Set number of levels of cell coarsening
+//=======================================================================
+
+void StdMeshers_CartesianParameters3D::SetOctreeLevels(int nbLevels)
+{
+  if ( nbLevels < 0 || nbLevels > 10 )
+    throw SALOME_Exception(LOCALIZED("Number of octree levels must be in the range [0,10]"));
+
+  if ( _octreeLevels != nbLevels )
+  {
+    _octreeLevels = nbLevels;
+    NotifySubMeshesHypothesisModification();
+  }
+}
+
 //=======================================================================
 //function : IsDefined
 //purpose  : Return true if parameters are well defined
@@ -862,7 +880,8 @@ std::ostream & StdMeshers_CartesianParameters3D::SaveTo(std::ostream & save)
        << " " << _toUseThresholdForInternalFaces
        << " " << _toCreateFaces
        << " " << _toUseQuanta
-       << " " << _quanta;
+       << " " << _quanta
+       << " " << _octreeLevels;
 
   return save;
 }
@@ -931,6 +950,9 @@ std::istream & StdMeshers_CartesianParameters3D::LoadFrom(std::istream & load)
   if ( load >> _toUseQuanta )
     load >> _quanta;
 
+  if ( !( load >> _octreeLevels ))
+    _octreeLevels = 0;
+
   return load;
 }
 
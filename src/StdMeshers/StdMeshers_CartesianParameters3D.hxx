@@ -170,6 +170,15 @@ public:
   void SetQuanta(const double quanta );
   double GetQuanta() const { return _quanta; }
 
+  /*!
+   * \brief Number of octree levels: cells far from the geometry boundary are
+   *        merged into cells up to 2^nbLevels times larger than the grid cells.
+   * \remark value [0, 10], 0 means no coarsening. Cells are never refined below
+   *         the grid spacing, which still defines the cell size at the boundary.
+   */
+  void SetOctreeLevels(int nbLevels);
+  int GetOctreeLevels() const { return _octreeLevels; }
+
 
   /*!
    * \brief Return true if parameters are well defined
@@ -208,6 +217,7 @@ public:
   bool   _toCreateFaces;
   bool   _toUseQuanta;
   double _quanta;
+  int    _octreeLevels;
 };
 
 #endif
@@ -239,7 +239,7 @@ bool StdMeshers_Cartesian_3D::Compute(SMESH_Mesh &         theMesh,
         vector< GridLine >& lines = grid._lines[ iDir ];
         for ( size_t i = 0; i < lines.size(); ++i )
         {
-          multiset< F_IntersectPoint >::iterator ip = lines[i]._intPoints.begin();
+          GridLine::TIntPointVec::iterator ip = lines[i]._intPoints.begin();
           for ( ; ip != lines[i]._intPoints.end(); ++ip )
             if ( ip->_node &&
                  !ip->_node->IsNull() &&
@@ -22,6 +22,7 @@
 //
 
 #include "StdMeshers_Cartesian_3D_Grid.hxx"
+#include "StdMeshers_Cartesian_3D_Octree.hxx"
 
 #ifdef WITH_TBB
 
@@ -35,6 +36,8 @@
 #include <tbb/parallel_for.h>
 #endif
 
+#include <SMDS_ElementRange.hxx>
+
 using namespace std;
 using namespace SMESH;
 using namespace StdMeshers::Cartesian3D;
@@ -49,38 +52,43 @@ void GridLine::RemoveExcessIntPoints( const double tol )
 {
   if ( _intPoints.size() < 2 ) return;
 
+  // merge each group of coincident points into the last point of the group
+  // and move the kept points to the vector beginning
   set< Transition > tranSet;
-  multiset< F_IntersectPoint >::iterator ip1, ip2 = _intPoints.begin();
-  while ( ip2 != _intPoints.end() )
+  size_t nbKept = 0;
+  for ( size_t i1, i2 = 0; i2 < _intPoints.size(); ++nbKept )
   {
     tranSet.clear();
-    ip1 = ip2++;
-    while ( ip2 != _intPoints.end() && ip2->_paramOnLine - ip1->_paramOnLine <= tol )
+    i1 = i2++;
+    while ( i2 < _intPoints.size() &&
+            _intPoints[ i2 ]._paramOnLine - _intPoints[ i1 ]._paramOnLine <= tol )
     {
-      tranSet.insert( ip1->_transition );
-      tranSet.insert( ip2->_transition );
-      ip2->Add( ip1->_faceIDs );
-      _intPoints.erase( ip1 );
-      ip1 = ip2++;
+      tranSet.insert( _intPoints[ i1 ]._transition );
+      tranSet.insert( _intPoints[ i2 ]._transition );
+      _intPoints[ i2 ].Add( _intPoints[ i1 ]._faceIDs );
+      i1 = i2++;
     }
     if ( tranSet.size() > 1 ) // points with different transition coincide
     {
       bool isIN  = tranSet.count( Trans_IN );
       bool isOUT = tranSet.count( Trans_OUT );
       if ( isIN && isOUT )
-        (*ip1)._transition = Trans_TANGENT;
+        _intPoints[ i1 ]._transition = Trans_TANGENT;
       else
-        (*ip1)._transition = isIN ? Trans_IN : Trans_OUT;
+        _intPoints[ i1 ]._transition = isIN ? Trans_IN : Trans_OUT;
     }
+    if ( nbKept != i1 )
+      _intPoints[ nbKept ] = _intPoints[ i1 ];
   }
+  _intPoints.resize( nbKept );
 }
 //================================================================================
 /*
   * Return ID of SOLID for nodes before the given intersection point
   */
-TGeomID GridLine::GetSolidIDBefore( multiset< F_IntersectPoint >::iterator ip,
-                                    const TGeomID                          prevID,
-                                    const Geometry&                        geom )
+TGeomID GridLine::GetSolidIDBefore( TIntPointVec::iterator ip,
+                                    const TGeomID          prevID,
+                                    const Geometry&        geom )
 {
   if ( ip == _intPoints.begin() )
     return 0;
@@ -95,7 +103,7 @@ TGeomID GridLine::GetSolidIDBefore( multiset< F_IntersectPoint >::iterator ip,
     case Trans_APEX:
     {
       // singularity point (apex of a cone)
-      multiset< F_IntersectPoint >::iterator ipBef = ip, ipAft = ++ip;
+      TIntPointVec::iterator ipBef = ip, ipAft = ++ip;
       if ( ipAft == _intPoints.end() )
         isOut = false;
       else
@@ -757,14 +765,38 @@ void Grid::ComputeUVW(const gp_XYZ& P, double UVW[3])
   p.Coord( UVW[0], UVW[1], UVW[2] );
 }
 //================================================================================
+/*
+  * Sort intersection points stored on GridLine's by parameter on line.
+  * Points of different FACEs with equal parameters keep the order of storing.
+  */
+void Grid::SortIntersections()
+{
+  for ( int iDir = 0; iDir < 3; ++iDir )
+  {
+    vector< GridLine >& lines = _lines[ iDir ];
+    SMDS_ParallelFor( lines.size(), [&]( size_t iL )
+                      {
+                        GridLine::TIntPointVec& intPnts = lines[ iL ]._intPoints;
+                        if ( !std::is_sorted( intPnts.begin(), intPnts.end() ))
+                          std::stable_sort( intPnts.begin(), intPnts.end() );
+                        if ( intPnts.capacity() > intPnts.size() )
+                          intPnts.shrink_to_fit();
+                      });
+  }
+}
+//================================================================================
 /*
   * Creates all nodes
   */
 void Grid::ComputeNodes(SMESH_MesherHelper& helper)
 {
-  // state of each node of the grid relative to the geometry
+  // state of each node of the grid relative to the geometry: OUT nodes are
+  // flagged in a bit vector while SOLID IDs are stored in tiles allocated only
+  // near the geometry, so that a large empty bounding box costs 1 bit per node
   const size_t nbGridNodes = _coords[0].size() * _coords[1].size() * _coords[2].size();
-  vector< TGeomID > shapeIDVec( nbGridNodes, theUndefID );
+  vector< bool >         isOutVec( nbGridNodes, false );
+  TiledVector< TGeomID > shapeIDVec;
+  shapeIDVec.resize( nbGridNodes, theUndefID );
   _nodes.resize( nbGridNodes, 0 );
   _allBorderNodes.resize( nbGridNodes, 0 );
   _gridIntP.resize( nbGridNodes, NULL );
@@ -792,8 +824,8 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
       const gp_XYZ lineDir = line._line.Direction().XYZ();
 
       line.RemoveExcessIntPoints( _tol );
-      multiset< F_IntersectPoint >&     intPnts = line._intPoints;
-      multiset< F_IntersectPoint >::iterator ip = intPnts.begin();
+      GridLine::TIntPointVec&           intPnts = line._intPoints;
+      GridLine::TIntPointVec::iterator       ip = intPnts.begin();
 
       // Create mesh nodes at intersections with geometry
       // and set OUT state of nodes between intersections
@@ -812,8 +844,11 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
         {
           while ( nodeParam < ip->_paramOnLine - _tol )
           {
-            TGeomID & nodeShapeID = shapeIDVec[ nIndex0 + nShift * ( nodeCoord-coord0 ) ];
-            nodeShapeID = Min( solidID, nodeShapeID );
+            const size_t nodeIndex = nIndex0 + nShift * ( nodeCoord-coord0 );
+            if ( solidID == 0 )
+              isOutVec[ nodeIndex ] = true;
+            else if ( solidID < shapeIDVec[ nodeIndex ])
+              shapeIDVec.Change( nodeIndex ) = solidID;
             if ( ++nodeCoord <  coordEnd )
               nodeParam = *nodeCoord - *coord0;
             else
@@ -839,14 +874,14 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
           if ( !_nodes[ nodeIndex ] )
           {
             gp_XYZ xyz = lineLoc + nodeParam * lineDir;
-            _nodes   [ nodeIndex ] = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
+            _nodes.Change( nodeIndex ) = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
             //_gridIntP[ nodeIndex ] = & * ip;
             //SetOnShape( _nodes[ nodeIndex ], *ip );
           }
           if ( _gridIntP[ nodeIndex ] )
             _gridIntP[ nodeIndex ]->Add( ip->_faceIDs );
           else
-            _gridIntP[ nodeIndex ] = & (*ip);
+            _gridIntP.Change( nodeIndex ) = & (*ip);
           // ip->_node        = _nodes[ nodeIndex ]; -- to differ from ip on links
           ip->_indexOnLine = nodeCoord-coord0;
           if ( ++nodeCoord < coordEnd )
@@ -855,10 +890,18 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
       }
       // set OUT state to nodes after the last ip
       for ( ; nodeCoord < coordEnd; ++nodeCoord )
-        shapeIDVec[ nIndex0 + nShift * ( nodeCoord-coord0 ) ] = 0;
+        isOutVec[ nIndex0 + nShift * ( nodeCoord-coord0 ) ] = true;
     }
   }
 
+  // merge cells far from the geometry boundary into coarse ones
+  if ( _octree )
+    _octree->FindLeaves( [&]( size_t nodeIndex )
+                         {
+                           const TGeomID id = isOutVec[ nodeIndex ] ? 0 : shapeIDVec[ nodeIndex ];
+                           return 0 < id && id < theUndefID;
+                         });
+
   // Create mesh nodes at !OUT nodes of the grid
 
   for ( size_t z = 0; z < _coords[2].size(); ++z )
@@ -866,14 +909,30 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
       for ( size_t x = 0; x < _coords[0].size(); ++x )
       {
         size_t nodeIndex = NodeIndex( x, y, z );
+        const TGeomID nodeShapeID = isOutVec[ nodeIndex ] ? 0 : shapeIDVec[ nodeIndex ];
+        if ( _octree && !_nodes[ nodeIndex ] && !_octree->IsFineNode( nodeIndex ))
+        {
+          // a node inside or at a corner of a coarse cell, or far outside the geometry
+          if ( _octree->IsCoarseNode( nodeIndex ) &&
+               0 < nodeShapeID && nodeShapeID < theUndefID )
+          {
+            gp_XYZ xyz = ( _coords[0][x] * _axes[0] +
+                           _coords[1][y] * _axes[1] +
+                           _coords[2][z] * _axes[2] );
+            const SMDS_MeshNode* node = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
+            _octree->SetCoarseNode( nodeIndex, node );
+            mesh->SetNodeInVolume( node, nodeShapeID );
+          }
+          continue;
+        }
         if ( !_nodes[ nodeIndex ] &&
-              0 < shapeIDVec[ nodeIndex ] && shapeIDVec[ nodeIndex ] < theUndefID )
+              0 < nodeShapeID && nodeShapeID < theUndefID )
         {
           gp_XYZ xyz = ( _coords[0][x] * _axes[0] +
                           _coords[1][y] * _axes[1] +
                           _coords[2][z] * _axes[2] );
-          _nodes[ nodeIndex ] = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
-          mesh->SetNodeInVolume( _nodes[ nodeIndex ], shapeIDVec[ nodeIndex ]);
+          const SMDS_MeshNode* node = _nodes.Change( nodeIndex ) = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
+          mesh->SetNodeInVolume( node, nodeShapeID );
         }
         else if ( _nodes[ nodeIndex ] && _gridIntP[ nodeIndex ] /*&&
                   !_nodes[ nodeIndex]->GetShapeID()*/ )
@@ -887,8 +946,8 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
           gp_XYZ xyz = ( _coords[0][x] * _axes[0] +
                           _coords[1][y] * _axes[1] +
                           _coords[2][z] * _axes[2] );
-          _allBorderNodes[ nodeIndex ] = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
-          mesh->SetNodeInVolume( _allBorderNodes[ nodeIndex ], shapeIDVec[ nodeIndex ]);
+          const SMDS_MeshNode* node = _allBorderNodes.Change( nodeIndex ) = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
+          mesh->SetNodeInVolume( node, nodeShapeID );
         }
       }
 #ifdef _MY_DEBUG_
@@ -899,7 +958,7 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
     LineIndexer li = GetLineIndexer( iDir );
     for ( ; li.More(); ++li )
     {
-      multiset< F_IntersectPoint >& intPnts = _lines[ iDir ][ li.LineIndex() ]._intPoints;
+      GridLine::TIntPointVec& intPnts = _lines[ iDir ][ li.LineIndex() ]._intPoints;
       if ( intPnts.empty() ) continue;
       if ( intPnts.size() == 1 )
       {
@@ -982,9 +1041,20 @@ bool Grid::GridInitAndInterserctWithShape( const TopoDS_Shape& theShape,
       {
         copier.Perform( facesItersectors[i]._face );
         facesItersectors[i]._face = TopoDS::Face( copier );
+        // IntCurvesFace_Intersector must work on the copy
+        delete facesItersectors[i]._surfaceInt;
+        facesItersectors[i]._surfaceInt = 0;
       }
     }
   }
+  // split intersection with large faces into tasks for load balance
+  const size_t maxNbLinesPerTask = 1024;
+  vector< FaceGridIntersector > intersectionTasks;
+  intersectionTasks.reserve( facesItersectors.size() );
+  for ( size_t i = 0; i < facesItersectors.size(); ++i )
+    facesItersectors[i].Split( maxNbLinesPerTask, intersectionTasks );
+  facesItersectors.swap( intersectionTasks );
+
   // Intersection of grid lines with the geometry boundary.
   tbb::parallel_for ( tbb::blocked_range<size_t>( 0, facesItersectors.size() ),
                       ParallelIntersector( facesItersectors ),
@@ -1003,6 +1073,16 @@ bool Grid::GridInitAndInterserctWithShape( const TopoDS_Shape& theShape,
   // in case of parallel work of facesItersectors
   for ( size_t i = 0; i < facesItersectors.size(); ++i )
     facesItersectors[i].StoreIntersections();
+  SortIntersections();
+
+  // find cells that can be merged into coarse ones; not done with internal
+  // faces as they are meshed by fine cells only
+  _octree.reset();
+  if ( hyp->GetOctreeLevels() > 0 && !_toConsiderInternalFaces )
+  {
+    _octree = std::make_shared< CellOctree >( this, hyp->GetOctreeLevels() );
+    _octree->MarkCutCells( theShape );
+  }
 
   if ( computeCanceled ) return false;
 
@@ -1100,7 +1180,18 @@ void Tools::GetExactBndBox( const vector< TopoDS_Shape >& faceVec, const double*
 void FaceGridIntersector::Intersect()
 {
   FaceLineIntersector intersector;
-  intersector._surfaceInt = GetCurveFaceIntersector();
+  if ( IsAnalytic() )
+  {
+    // use IntCurvesFace_Intersector only to intersect with a general surface
+    if ( !_classifier )
+      _classifier = std::make_shared< BRepTopAdaptor_FClass2d >( _face, Precision::PConfusion() );
+    intersector._classifier = _classifier.get();
+  }
+  else
+  {
+    intersector._surfaceInt = GetCurveFaceIntersector();
+    _surfaceInt = 0; // to be deleted by intersector
+  }
   intersector._tol        = _grid->_tol;
   intersector._transOut   = _face.Orientation() == TopAbs_REVERSED ? Trans_IN : Trans_OUT;
   intersector._transIn    = _face.Orientation() == TopAbs_REVERSED ? Trans_OUT : Trans_IN;
@@ -1145,6 +1236,9 @@ void FaceGridIntersector::Intersect()
   _intersections.clear();
   for ( int iDir = 0; iDir < 3; ++iDir ) // loop on 3 line directions
   {
+    if ( _iDir >= 0 && _iDir != iDir )
+      continue;
+
     if ( surf.GetType() == GeomAbs_Plane )
     {
       // check if all lines in this direction are parallel to a plane
@@ -1165,17 +1259,32 @@ void FaceGridIntersector::Intersect()
         continue;
     }
 
-    // intersect the grid lines with the face
-    for ( size_t iL = 0; iL < _grid->_lines[iDir].size(); ++iL )
+    // find lines crossing the face bounding box
+    size_t range1[2], range2[2];
+    if ( _iDir >= 0 )
     {
-      GridLine& gridLine = _grid->_lines[iDir][iL];
-      if ( _bndBox.IsOut( gridLine._line )) continue;
-
-      intersector._intPoints.clear();
-      (intersector.*interFunction)( gridLine ); // <- intersection with gridLine
-      for ( size_t i = 0; i < intersector._intPoints.size(); ++i )
-        _intersections.push_back( std::make_pair( &gridLine, intersector._intPoints[i] ));
+      std::copy( _range1, _range1 + 2, range1 );
+      std::copy( _range2, _range2 + 2, range2 );
+    }
+    else if ( !GetLineRange( iDir, range1, range2 ))
+    {
+      continue;
     }
+    LineIndexer li = _grid->GetLineIndexer( iDir );
+    const size_t nbLines1 = li._size[ li._iVar1 ];
+
+    // intersect the grid lines with the face
+    for ( size_t i2 = range2[0]; i2 < range2[1]; ++i2 )
+      for ( size_t i1 = range1[0]; i1 < range1[1]; ++i1 )
+      {
+        GridLine& gridLine = _grid->_lines[iDir][ i1 + i2 * nbLines1 ];
+        if ( _bndBox.IsOut( gridLine._line )) continue;
+
+        intersector._intPoints.clear();
+        (intersector.*interFunction)( gridLine ); // <- intersection with gridLine
+        for ( size_t i = 0; i < intersector._intPoints.size(); ++i )
+          _intersections.push_back( std::make_pair( &gridLine, intersector._intPoints[i] ));
+      }
   }
 
   if ( _face.Orientation() == TopAbs_INTERNAL )
@@ -1190,6 +1299,102 @@ void FaceGridIntersector::Intersect()
   return;
 }
 
+//================================================================================
+/*
+ * Return true if the face lies on a plane, cylinder, cone, sphere or torus
+ */
+bool FaceGridIntersector::IsAnalytic() const
+{
+  switch ( BRepAdaptor_Surface( _face, /*restriction=*/false ).GetType() ) {
+  case GeomAbs_Plane:
+  case GeomAbs_Cylinder:
+  case GeomAbs_Cone:
+  case GeomAbs_Sphere:
+  case GeomAbs_Torus:
+    return true;
+  default:;
+  }
+  return false;
+}
+
+//================================================================================
+/*
+ * Find ranges of indices of lines of iDir direction crossing the face bounding box.
+ * range1 is along LineIndexer::_iVar1, range2 is along LineIndexer::_iVar2.
+ * Return false if no line crosses the box.
+ */
+bool FaceGridIntersector::GetLineRange( int iDir, size_t range1[2], size_t range2[2] ) const
+{
+  if ( _bndBox.IsVoid() )
+    return false;
+
+  // bounding box of the face box in the grid axes
+  double xyz[6], uvwMin[3], uvwMax[3], uvw[3];
+  _bndBox.Get( xyz[0], xyz[1], xyz[2], xyz[3], xyz[4], xyz[5] );
+  for ( int iC = 0; iC < 8; ++iC )
+  {
+    gp_XYZ corner( xyz[ iC & 1 ? 3 : 0 ], xyz[ iC & 2 ? 4 : 1 ], xyz[ iC & 4 ? 5 : 2 ]);
+    _grid->ComputeUVW( corner, uvw );
+    for ( int i = 0; i < 3; ++i )
+    {
+      uvwMin[i] = iC ? Min( uvwMin[i], uvw[i] ) : uvw[i];
+      uvwMax[i] = iC ? Max( uvwMax[i], uvw[i] ) : uvw[i];
+    }
+  }
+
+  LineIndexer   li = _grid->GetLineIndexer( iDir );
+  const size_t iVar[2] = { li._iVar1, li._iVar2 };
+  size_t*    range[2] = { range1, range2 };
+  for ( int i = 0; i < 2; ++i )
+  {
+    const vector< double >& coords = _grid->_coords[ iVar[i] ];
+    range[i][0] = std::lower_bound( coords.begin(), coords.end(),
+                                    uvwMin[ iVar[i] ] - _grid->_tol ) - coords.begin();
+    range[i][1] = std::upper_bound( coords.begin(), coords.end(),
+                                    uvwMax[ iVar[i] ] + _grid->_tol ) - coords.begin();
+    if ( range[i][0] >= range[i][1] )
+      return false;
+  }
+  return true;
+}
+
+//================================================================================
+/*
+ * Split intersection of an analytic face into tasks intersecting lines of one
+ * direction, at most maxNbLines lines per task, for better load balance of threads.
+ * A not analytic face makes one task as IntCurvesFace_Intersector is costly to create.
+ */
+void FaceGridIntersector::Split( size_t maxNbLines, std::vector< FaceGridIntersector >& tasks )
+{
+  if ( !IsAnalytic() )
+  {
+    tasks.push_back( *this );
+    _surfaceInt = 0; // passed to the task
+    return;
+  }
+  if ( !_classifier )
+    _classifier = std::make_shared< BRepTopAdaptor_FClass2d >( _face, Precision::PConfusion() );
+
+  for ( int iDir = 0; iDir < 3; ++iDir )
+  {
+    size_t range1[2], range2[2];
+    if ( !GetLineRange( iDir, range1, range2 ))
+      continue;
+    const size_t nbLines1 = range1[1] - range1[0];
+    const size_t nbLines2 = range2[1] - range2[0];
+    const size_t  nbTasks = std::min( nbLines2, 1 + nbLines1 * nbLines2 / std::max( maxNbLines, size_t( 1 )));
+    for ( size_t iT = 0; iT < nbTasks; ++iT )
+    {
+      tasks.push_back( *this );
+      FaceGridIntersector& task = tasks.back();
+      task._iDir = iDir;
+      std::copy( range1, range1 + 2, task._range1 );
+      task._range2[0] = range2[0] + nbLines2 *   iT       / nbTasks;
+      task._range2[1] = range2[0] + nbLines2 * ( iT + 1 ) / nbTasks;
+    }
+  }
+}
+
 #ifdef WITH_TBB
 //================================================================================
 /*
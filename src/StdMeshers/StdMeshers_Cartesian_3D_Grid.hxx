@@ -332,12 +332,13 @@ namespace Cartesian3D
   {
     gp_Lin _line;
     double _length; // line length
-    std::multiset< F_IntersectPoint > _intPoints;
+    typedef std::vector< F_IntersectPoint > TIntPointVec;
+    TIntPointVec _intPoints; // sorted by _paramOnLine after Grid::SortIntersections()
 
     void RemoveExcessIntPoints( const double tol );
-    TGeomID GetSolidIDBefore( std::multiset< F_IntersectPoint >::iterator ip,
-                              const TGeomID                          prevID,
-                              const Geometry&                        geom);
+    TGeomID GetSolidIDBefore( TIntPointVec::iterator ip,
+                              const TGeomID          prevID,
+                              const Geometry&        geom);
   };
   // --------------------------------------------------------------------------
   /*!
@@ -410,6 +411,73 @@ namespace Cartesian3D
       static void GetExactBndBox( const std::vector< TopoDS_Shape >& faceVec, const double* axesDirs, Bnd_Box& shapeBox );
   };
 
+  // --------------------------------------------------------------------------
+  /*!
+   * \brief Sparse array of values at grid nodes or cells.
+   *
+   * Values are stored by tiles of TileSize() consecutive indices. A tile is
+   * allocated at the first Change() of a value in it, not allocated tiles hold
+   * the default value. So memory is spent only on grid nodes close to the geometry,
+   * which matters when the bounding box of the geometry is much larger than its volume.
+   * Reading is thread safe, Change() is not.
+   */
+  template< typename T >
+  class TiledVector
+  {
+    static const size_t theTileBits = 12;
+    static const size_t theTileSize = size_t( 1 ) << theTileBits;
+
+    std::vector< std::unique_ptr< T[] > > _tiles;
+    size_t                                _size;
+    T                                     _default;
+
+  public:
+    TiledVector(): _size( 0 ), _default() {}
+
+    //! Set size and default value; all values are reset to the default one
+    void resize( size_t size, const T& defaultValue = T() )
+    {
+      _tiles.clear();
+      _tiles.resize(( size + theTileSize - 1 ) >> theTileBits );
+      _size    = size;
+      _default = defaultValue;
+    }
+    void clear() { _tiles.clear(); _size = 0; }
+
+    size_t size()  const { return _size; }
+    bool   empty() const { return _size == 0; }
+
+    T operator[]( size_t i ) const
+    {
+      const T* tile = _tiles[ i >> theTileBits ].get();
+      return tile ? tile[ i & ( theTileSize - 1 )] : _default;
+    }
+
+    //! Return a modifiable value; allocate a tile if necessary
+    T& Change( size_t i )
+    {
+      std::unique_ptr< T[] >& tile = _tiles[ i >> theTileBits ];
+      if ( !tile )
+      {
+        tile.reset( new T[ theTileSize ]);
+        std::fill( tile.get(), tile.get() + theTileSize, _default );
+      }
+      return tile[ i & ( theTileSize - 1 )];
+    }
+
+    //! Return true if a tile holding i-th value is allocated
+    bool IsAllocated( size_t i ) const { return bool( _tiles[ i >> theTileBits ]); }
+
+    size_t NbAllocatedTiles() const
+    {
+      return std::count_if( _tiles.begin(), _tiles.end(),
+                            []( const std::unique_ptr< T[] >& t ) { return bool( t ); });
+    }
+    static size_t TileSize() { return theTileSize; }
+  };
+
+  class CellOctree;
+
   class STDMESHERS_EXPORT Grid
   {
     public:
@@ -423,10 +491,10 @@ namespace Cartesian3D
     // index shift within _nodes of nodes of a cell from the 1st node
     int                    _nodeShift[8];
 
-    std::vector< const SMDS_MeshNode* >    _nodes;          // mesh nodes at grid nodes
-    std::vector< const SMDS_MeshNode* >    _allBorderNodes; // mesh nodes between the bounding box and the geometry boundary
+    TiledVector< const SMDS_MeshNode* >    _nodes;          // mesh nodes at grid nodes
+    TiledVector< const SMDS_MeshNode* >    _allBorderNodes; // mesh nodes between the bounding box and the geometry boundary
 
-    std::vector< const F_IntersectPoint* > _gridIntP; // grid node intersection with geometry
+    TiledVector< const F_IntersectPoint* > _gridIntP; // grid node intersection with geometry
     ObjectPool< E_IntersectPoint >        _edgeIntPool; // intersections with EDGEs
     ObjectPool< F_IntersectPoint >        _extIntPool; // intersections with extended INTERNAL FACEs
     //list< E_IntersectPoint >          _edgeIntP; // intersections with EDGEs
@@ -440,6 +508,8 @@ namespace Cartesian3D
     bool                              _toUseQuanta;
     double                            _quanta;
 
+    std::shared_ptr< CellOctree >     _octree; // merges cells far from the geometry, may be null
+
     SMESH_MesherHelper*               _helper;
 
     size_t CellIndex( size_t i, size_t j, size_t k ) const
@@ -507,6 +577,7 @@ namespace Cartesian3D
                         const double*         axesDirs,
                         const Bnd_Box&        bndBox );
     void ComputeUVW(const gp_XYZ& p, double uvw[3]);
+    void SortIntersections();
     void ComputeNodes(SMESH_MesherHelper& helper);
     bool GridInitAndInterserctWithShape( const TopoDS_Shape& theShape,
                                          std::map< TGeomID, std::vector< TGeomID > >& edge2faceIDsMap, 
@@ -592,25 +663,49 @@ namespace Cartesian3D
     TGeomID     _faceID;
     Grid*       _grid;
     Bnd_Box     _bndBox;
-    IntCurvesFace_Intersector* _surfaceInt;
+    IntCurvesFace_Intersector* _surfaceInt; // used for not analytic surfaces only
+    std::shared_ptr< BRepTopAdaptor_FClass2d > _classifier; // used for analytic surfaces
     std::vector< std::pair< GridLine*, F_IntersectPoint > > _intersections;
 
-    FaceGridIntersector(): _grid(0), _surfaceInt(0) {}
+    // lines to intersect: if _iDir < 0, all lines crossing _bndBox, else lines of _iDir
+    // direction with indices along LineIndexer::_iVar1 in [_range1[0],_range1[1]) and
+    // along LineIndexer::_iVar2 in [_range2[0],_range2[1])
+    int         _iDir;
+    size_t      _range1[2], _range2[2];
+
+    FaceGridIntersector(): _grid(0), _surfaceInt(0), _iDir(-1) {}
     void Intersect();
 
+    //! Return true if the face lies on a plane, cylinder, cone, sphere or torus
+    bool IsAnalytic() const;
+
+    //! Find ranges of indices of lines of a direction crossing the face bounding box
+    bool GetLineRange( int iDir, size_t range1[2], size_t range2[2] ) const;
+
+    //! Split intersection into tasks intersecting at most maxNbLines lines
+    void Split( size_t maxNbLines, std::vector< FaceGridIntersector >& tasks );
+
+    //! Append intersection points to GridLine's; Grid::SortIntersections() is to be called then
     void StoreIntersections()
     {
       for ( size_t i = 0; i < _intersections.size(); ++i )
       {
-        std::multiset< F_IntersectPoint >::iterator ip =
-          _intersections[i].first->_intPoints.insert( _intersections[i].second );
-        ip->_faceIDs.reserve( 1 );
-        ip->_faceIDs.push_back( _faceID );
+        GridLine::TIntPointVec& intPoints = _intersections[i].first->_intPoints;
+        intPoints.push_back( _intersections[i].second );
+        intPoints.back()._faceIDs.reserve( 1 );
+        intPoints.back()._faceIDs.push_back( _faceID );
       }
+      std::vector< std::pair< GridLine*, F_IntersectPoint > >().swap( _intersections );
     }
     const Bnd_Box& GetFaceBndBox()
     {
-      GetCurveFaceIntersector();
+      if ( _bndBox.IsVoid() )
+      {
+        if ( IsAnalytic() )
+          BRepBndLib::Add( _face, _bndBox, /*useTriangulation=*/false );
+        else
+          GetCurveFaceIntersector();
+      }
       return _bndBox;
     }
     IntCurvesFace_Intersector* GetCurveFaceIntersector()
@@ -618,7 +713,8 @@ namespace Cartesian3D
       if ( !_surfaceInt )
       {
         _surfaceInt = new IntCurvesFace_Intersector( _face, Precision::PConfusion() );
-        _bndBox     = _surfaceInt->Bounding();
+        if ( _bndBox.IsVoid() )
+          _bndBox   = _surfaceInt->Bounding();
         if ( _bndBox.IsVoid() )
           BRepBndLib::Add (_face, _bndBox);
       }
@@ -669,6 +765,7 @@ namespace Cartesian3D
     gp_Sphere   _sphere;
     gp_Torus    _torus;
     IntCurvesFace_Intersector* _surfaceInt;
+    const BRepTopAdaptor_FClass2d* _classifier; // classifier of analytic surfaces, not owned
 
     std::vector< F_IntersectPoint > _intPoints;
 
@@ -684,7 +781,9 @@ namespace Cartesian3D
      */
     bool UVIsOnFace() const
     {
-      TopAbs_State state = _surfaceInt->ClassifyUVPoint(gp_Pnt2d( _u,_v ));
+      TopAbs_State state = ( _classifier ?
+                             _classifier->Perform( gp_Pnt2d( _u,_v )) :
+                             _surfaceInt->ClassifyUVPoint( gp_Pnt2d( _u,_v )));
       return ( state == TopAbs_IN || state == TopAbs_ON );
     }
     void addIntPoint(const bool toClassify=true);
@@ -692,7 +791,7 @@ namespace Cartesian3D
     {
       return -_tol < _w && _w < linLength + _tol;
     }
-    FaceLineIntersector():_surfaceInt(0) {}
+    FaceLineIntersector():_surfaceInt(0), _classifier(0) {}
     ~FaceLineIntersector() { if (_surfaceInt ) delete _surfaceInt; _surfaceInt = 0; }
   };
 
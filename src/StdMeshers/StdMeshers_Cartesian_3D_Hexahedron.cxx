@@ -22,6 +22,7 @@
 //
 
 #include "StdMeshers_Cartesian_3D_Hexahedron.hxx"
+#include "StdMeshers_Cartesian_3D_Octree.hxx"
 
 #include <numeric>
 
@@ -1684,7 +1685,8 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
 
   CellsAroundLink c( _grid, 0 );
   const size_t nbGridCells = c._nbCells[0] * c._nbCells[1] * c._nbCells[2];
-  vector< Hexahedron* > allHexa( nbGridCells, 0 );
+  THexaVector allHexa; // hexahedra are created near the geometry only
+  allHexa.resize( nbGridCells, 0 );
   int nbIntHex = 0;
 
   // set intersection nodes from GridLine's to links of allHexa
@@ -1697,7 +1699,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
     for ( ; lineInd.More(); ++lineInd )
     {
       GridLine& line = _grid->_lines[ iDir ][ lineInd.LineIndex() ];
-      multiset< F_IntersectPoint >::const_iterator ip = line._intPoints.begin();
+      GridLine::TIntPointVec::const_iterator ip = line._intPoints.begin();
       for ( ; ip != line._intPoints.end(); ++ip )
       {
         // if ( !ip->_node ) continue; // intersection at a grid node
@@ -1707,7 +1709,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
         {
           if ( !fourCells.GetCell( iL, i,j,k, cellIndex, iLink ))
             continue;
-          Hexahedron *& hex = allHexa[ cellIndex ];
+          Hexahedron *& hex = allHexa.Change( cellIndex );
           if ( !hex)
           {
             hex = new Hexahedron( *this, i, j, k, cellIndex );
@@ -1732,7 +1734,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
   for ( size_t i = 0; i < allHexa.size(); ++i )
   {
     // initialize this by not cut allHexa[ i ]
-    Hexahedron * & hex = allHexa[ i ];
+    Hexahedron * hex = allHexa[ i ];
     if ( hex ) // split hexahedron
     {
       intHexa.push_back( hex );
@@ -1744,6 +1746,8 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
     }
     else
     {
+      if ( _grid->_octree && !_grid->_octree->IsFineCell( i ))
+        continue; // the cell is a part of a coarse cell or is outside
       this->init( i ); // == init(i,j,k)
     }
     if (( _nbCornerNodes == 8 ) &&
@@ -1780,7 +1784,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
     else if ( _nbCornerNodes > 3 && !hex )
     {
       // all intersections of hex with geometry are at grid nodes
-      hex = new Hexahedron( *this, _i, _j, _k, i );
+      hex = allHexa.Change( i ) = new Hexahedron( *this, _i, _j, _k, i );
       intHexa.push_back( hex );
     }
   }
@@ -1811,6 +1815,10 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
     if ( Hexahedron * hex = intHexa[ i ] )
       nbAdded += hex->addVolumes( helper );
 
+  // add coarse volumes
+  if ( _grid->_octree )
+    nbAdded += _grid->_octree->MakeElements( helper );
+
   // fill boundaryVolumes with volumes neighboring too small skipped volumes
   if ( _grid->_toCreateFaces )
   {
@@ -1853,7 +1861,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
   * \brief Implements geom edges into the mesh
   */
 void Hexahedron::addEdges(SMESH_MesherHelper&                      helper,
-                          vector< Hexahedron* >&                   hexes,
+                          THexaVector&                             hexes,
                           const map< TGeomID, vector< TGeomID > >& edge2faceIDsMap)
 {
   if ( edge2faceIDsMap.empty() ) return;
@@ -2034,7 +2042,7 @@ void Hexahedron::addEdges(SMESH_MesherHelper&                      helper,
   * \brief Fully cut hexes that are partially cut by INTERNAL FACE.
   *        Cut them by extended INTERNAL FACE.
   */
-void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
+void Hexahedron::cutByExtendedInternal( THexaVector&                hexes,
                                         const TColStd_MapOfInteger& intEdgeIDs )
 {
   IntAna_IntConicQuad intersection;
@@ -2124,8 +2132,8 @@ void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
         int  i = ! ( u < _grid->_tol ); // [0,1]
         int iN = link._nodes[ i ] - hex->_hexNodes; // [0-7]
 
-        const F_IntersectPoint * & ip = _grid->_gridIntP[ hex->_origNodeInd +
-                                                          _grid->_nodeShift[iN] ];
+        const F_IntersectPoint * & ip = _grid->_gridIntP.Change( hex->_origNodeInd +
+                                                                _grid->_nodeShift[iN] );
         if ( !ip )
         {
           ip = _grid->_extIntPool.getNew();
@@ -2157,7 +2165,7 @@ void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
             continue;
           Hexahedron * h = hexes[ cellIndex ];
           if ( !h )
-            h = hexes[ cellIndex ] = new Hexahedron( *this, i, j, k, cellIndex );
+            h = hexes.Change( cellIndex ) = new Hexahedron( *this, i, j, k, cellIndex );
           h->_hexLinks[iLink]._fIntPoints.push_back( ip );
           h->_nbFaceIntNodes++;
           //isCut = true;
@@ -2358,7 +2366,7 @@ int Hexahedron::getEntity( const E_IntersectPoint* ip, int* facets, int& sub )
   * \brief Adds intersection with an EDGE
   */
 bool Hexahedron::addIntersection( const E_IntersectPoint* ip,
-                                  vector< Hexahedron* >&  hexes,
+                                  THexaVector&            hexes,
                                   int ijk[], int dIJK[] )
 {
   bool added = false;
@@ -3082,8 +3090,8 @@ bool Hexahedron::isInHole() const
         const GridLine& line = _grid->_lines[ iDir ][ lineIndex[ iL ]];
         if ( !line._intPoints.empty() )
         {
-          multiset< F_IntersectPoint >::const_iterator ip =
-            line._intPoints.upper_bound( curIntPnt );
+          GridLine::TIntPointVec::const_iterator ip =
+            std::upper_bound( line._intPoints.begin(), line._intPoints.end(), curIntPnt );
           --ip;
           firstIntPnt = &(*ip);
         }
@@ -4419,7 +4427,7 @@ void Hexahedron::getBoundaryElems( vector< const SMDS_MeshElement* > & boundaryE
   */
 //================================================================================
 
-void Hexahedron::removeExcessSideDivision(const vector< Hexahedron* >& allHexa)
+void Hexahedron::removeExcessSideDivision(const THexaVector& allHexa)
 {
   if ( ! _volumeDefs.IsPolyhedron() )
     return; // not a polyhedron
@@ -4572,7 +4580,7 @@ void Hexahedron::removeExcessSideDivision(const vector< Hexahedron* >& allHexa)
   */
 //================================================================================
 
-void Hexahedron::removeExcessNodes(vector< Hexahedron* >& allHexa)
+void Hexahedron::removeExcessNodes(THexaVector& allHexa)
 {
   if ( ! _volumeDefs.IsPolyhedron() )
     return; // not a polyhedron
@@ -96,6 +96,7 @@ namespace Cartesian3D
     // --------------------------------------------------------------------------------
     struct _Face;
     struct _Link;
+    typedef StdMeshers::Cartesian3D::TiledVector< Hexahedron* > THexaVector; // hexahedra at grid cells
     enum IsInternalFlag { IS_NOT_INTERNAL, IS_INTERNAL, IS_CUT_BY_INTERNAL_FACE };
     // --------------------------------------------------------------------------------
     struct _Node //!< node either at a hexahedron corner or at intersection
@@ -560,14 +561,14 @@ namespace Cartesian3D
     size_t getSolids( StdMeshers::Cartesian3D::TGeomID ids[] );
     bool isCutByInternalFace( IsInternalFlag & maxFlag );
     void addEdges(SMESH_MesherHelper&         helper,
-                  std::vector< Hexahedron* >& intersectedHex,
+                  THexaVector&                intersectedHex,
                   const TEdge2faceIDsMap&     edge2faceIDsMap);
     gp_Pnt findIntPoint( double u1, double proj1, double u2, double proj2,
                          double proj, BRepAdaptor_Curve& curve,
                          const gp_XYZ& axis, const gp_XYZ& origin );
     int  getEntity( const StdMeshers::Cartesian3D::E_IntersectPoint* ip, int* facets, int& sub );
     bool addIntersection( const StdMeshers::Cartesian3D::E_IntersectPoint* ip,
-                          std::vector< Hexahedron* >&  hexes,
+                          THexaVector&                 hexes,
                           int ijk[], int dIJK[] );
     bool isQuadOnFace( const size_t iQuad );
     bool findChain( _Node* n1, _Node* n2, _Face& quad, std::vector<_Node*>& chainNodes );
@@ -598,11 +599,11 @@ namespace Cartesian3D
                       const TEdge2faceIDsMap& edge2faceIDsMap );
     void getVolumes( std::vector< const SMDS_MeshElement* > & volumes );
     void getBoundaryElems( std::vector< const SMDS_MeshElement* > & boundaryVolumes );
-    void removeExcessSideDivision(const std::vector< Hexahedron* >& allHexa);
-    void removeExcessNodes(std::vector< Hexahedron* >& allHexa);
+    void removeExcessSideDivision(const THexaVector& allHexa);
+    void removeExcessNodes(THexaVector& allHexa);
     void preventVolumesOverlapping();
     StdMeshers::Cartesian3D::TGeomID getAnyFace() const;
-    void cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
+    void cutByExtendedInternal( THexaVector&                hexes,
                                 const TColStd_MapOfInteger& intEdgeIDs );
     gp_Pnt mostDistantInternalPnt( int hexIndex, const gp_Pnt& p1, const gp_Pnt& p2 );
     bool isOutPoint( _Link& link, int iP, SMESH_MesherHelper& helper, const Solid* solid ) const;
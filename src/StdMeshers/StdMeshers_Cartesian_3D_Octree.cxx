@@ -0,0 +1,541 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : StdMeshers_Cartesian_3D_Octree.cxx
+//  Module : SMESH
+//  Purpose: Merge cells of the BodyFitting grid lying far from the geometry boundary
+//
+
+#include "StdMeshers_Cartesian_3D_Octree.hxx"
+
+#include <GCPnts_AbscissaPoint.hxx>
+#include <GCPnts_UniformAbscissa.hxx>
+
+using namespace std;
+using namespace StdMeshers::Cartesian3D;
+
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Return index of a grid cell along an axis containing a coordinate;
+   *        -1 if the coordinate is out of the grid
+   */
+  //================================================================================
+
+  int locateCell( const vector< double >& coords, double u, double tol )
+  {
+    if ( u < coords.front() - tol || u > coords.back() + tol )
+      return -1;
+    int i = int( std::upper_bound( coords.begin(), coords.end(), u ) - coords.begin() ) - 1;
+    return std::max( 0, std::min( i, int( coords.size() ) - 2 ));
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Constructor
+ */
+//================================================================================
+
+CellOctree::CellOctree( Grid* grid, int nbLevels )
+  : _grid( grid ), _nbLevels( nbLevels )
+{
+  for ( int iDir = 0; iDir < 3; ++iDir )
+    _nbCells[ iDir ] = int( _grid->_coords[ iDir ].size() ) - 1;
+
+  _cutBlocks.resize( _nbLevels + 1 );
+  _leafCodes.resize( _nbLevels + 1 );
+}
+
+//================================================================================
+/*!
+ * \brief Find grid cells cut by the geometry boundary: cells around links of
+ *        grid lines intersected by FACEs and cells containing points of EDGEs
+ */
+//================================================================================
+
+void CellOctree::MarkCutCells( const TopoDS_Shape& shape )
+{
+  _cutBlocks[0].clear();
+
+  for ( int iDir = 0; iDir < 3; ++iDir )
+  {
+    const vector< double >& coords = _grid->_coords[ iDir ];
+    const int iDir1 = ( iDir + 1 ) % 3, iDir2 = ( iDir + 2 ) % 3;
+
+    LineIndexer li = _grid->GetLineIndexer( iDir );
+    for ( ; li.More(); ++li )
+    {
+      const GridLine& line = _grid->_lines[ iDir ][ li.LineIndex() ];
+      GridLine::TIntPointVec::const_iterator ip = line._intPoints.begin();
+      for ( ; ip != line._intPoints.end(); ++ip )
+      {
+        const double u = coords[0] + ip->_paramOnLine;
+        const int  iLink = locateCell( coords, u, _grid->_tol );
+        if ( iLink < 0 )
+          continue;
+        // an intersection at a grid node cuts links on both sides of the node
+        const int iLink0 = iLink - ( u - coords[ iLink ]     < 2 * _grid->_tol );
+        const int iLink1 = iLink + ( coords[ iLink + 1 ] - u < 2 * _grid->_tol );
+        for ( int iL = iLink0; iL <= iLink1; ++iL )
+        {
+          li.SetIndexOnLine( std::max( 0, iL ));
+          TIJK cell = {{ int( li.I() ), int( li.J() ), int( li.K() ) }};
+          cell[ iDir ] = iL;
+          // 4 cells sharing the link
+          for ( int d1 = 0; d1 < 2; ++d1 )
+            for ( int d2 = 0; d2 < 2; ++d2 )
+            {
+              TIJK c = cell;
+              c[ iDir1 ] -= d1;
+              c[ iDir2 ] -= d2;
+              markCutCell( c );
+            }
+        }
+      }
+    }
+  }
+
+  // small features can be missed by grid lines, mark cells at VERTEXes and EDGEs
+
+  TopTools_IndexedMapOfShape vertices, edges;
+  TopExp::MapShapes( shape, TopAbs_VERTEX, vertices );
+  TopExp::MapShapes( shape, TopAbs_EDGE,   edges );
+
+  for ( int i = 1; i <= vertices.Extent(); ++i )
+    markCutPoint( BRep_Tool::Pnt( TopoDS::Vertex( vertices( i ))).XYZ() );
+
+  for ( int i = 1; i <= edges.Extent(); ++i )
+  {
+    const TopoDS_Edge& edge = TopoDS::Edge( edges( i ));
+    if ( BRep_Tool::Degenerated( edge ))
+      continue;
+    BRepAdaptor_Curve curve( edge );
+    const double  length = GCPnts_AbscissaPoint::Length( curve );
+    const int   nbPoints = 2 + int( length / _grid->_minCellSize );
+    GCPnts_UniformAbscissa discret( curve, nbPoints );
+    if ( discret.IsDone() )
+      for ( int iP = 1; iP <= discret.NbPoints(); ++iP )
+        markCutPoint( curve.Value( discret.Parameter( iP )).XYZ() );
+    else
+      for ( int iP = 0; iP < nbPoints; ++iP )
+      {
+        double u = curve.FirstParameter() + ( curve.LastParameter() - curve.FirstParameter() ) * iP / ( nbPoints - 1 );
+        markCutPoint( curve.Value( u ).XYZ() );
+      }
+  }
+
+  // make sets of cut blocks of all levels
+
+  vector< size_t >& cutCells = _cutBlocks[0];
+  std::sort( cutCells.begin(), cutCells.end() );
+  cutCells.erase( std::unique( cutCells.begin(), cutCells.end() ), cutCells.end() );
+
+  for ( int level = 1; level <= _nbLevels; ++level )
+  {
+    const vector< size_t >& children = _cutBlocks[ level - 1 ];
+    vector< size_t >&        parents = _cutBlocks[ level ];
+    parents.reserve( children.size() / 4 );
+    const size_t nbX = nbBlocks( level - 1, 0 ), nbY = nbBlocks( level - 1, 1 );
+    for ( size_t code : children )
+    {
+      TIJK parent = {{ int( code % nbX ) / 2, int( code / nbX % nbY ) / 2, int( code / nbX / nbY ) / 2 }};
+      parents.push_back( blockCode( level, parent ));
+    }
+    std::sort( parents.begin(), parents.end() );
+    parents.erase( std::unique( parents.begin(), parents.end() ), parents.end() );
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Find coarse cells inside the geometry and fine cells.
+ *  \param [in] isInsideNode - tells whether a grid node is inside the geometry
+ */
+//================================================================================
+
+void CellOctree::FindLeaves( const std::function< bool( size_t nodeIndex ) >& isInsideNode )
+{
+  const size_t nbGridCells = size_t( _nbCells[0] ) * _nbCells[1] * _nbCells[2];
+  const size_t nbGridNodes = ( _grid->_coords[0].size() *
+                               _grid->_coords[1].size() *
+                               _grid->_coords[2].size() );
+  _isFineCell.resize( nbGridCells, false );
+  _isFineNode.resize( nbGridNodes, false );
+  _leaves.clear();
+  _coarseNodes.clear();
+  for ( size_t i = 0; i < _leafCodes.size(); ++i )
+    _leafCodes[i].clear();
+
+  TIJK block;
+  for ( block[2] = 0; block[2] < nbBlocks( _nbLevels, 2 ); ++block[2] )
+    for ( block[1] = 0; block[1] < nbBlocks( _nbLevels, 1 ); ++block[1] )
+      for ( block[0] = 0; block[0] < nbBlocks( _nbLevels, 0 ); ++block[0] )
+        addBlock( _nbLevels, block, isInsideNode );
+}
+
+//================================================================================
+/*!
+ * \brief Make a block either a fine cell, or a coarse cell, or split it
+ */
+//================================================================================
+
+void CellOctree::addBlock( int level, const TIJK& block,
+                           const std::function< bool( size_t ) >& isInsideNode )
+{
+  if ( isOutOfGrid( level, block ))
+    return;
+
+  const int size = 1 << level;
+  const TIJK cell0 = {{ block[0] * size, block[1] * size, block[2] * size }};
+
+  if ( level == 0 )
+  {
+    _isFineCell.Change( _grid->CellIndex( cell0[0], cell0[1], cell0[2] )) = true;
+    for ( int iN = 0; iN < 8; ++iN )
+      _isFineNode.Change( _grid->NodeIndex( cell0[0] + bool( iN & 1 ),
+                                            cell0[1] + bool( iN & 2 ),
+                                            cell0[2] + bool( iN & 4 ))) = true;
+    return;
+  }
+
+  if ( isInGrid( level, block ) && !hasCutAround( level, block ))
+  {
+    // the block is either fully inside or fully outside the geometry
+    if ( isInsideNode( _grid->NodeIndex( cell0 )))
+    {
+      _leaves.push_back( Leaf{ cell0, level });
+      _leafCodes[ level ].insert( blockCode( level, block ));
+      for ( int iN = 0; iN < 8; ++iN )
+        _coarseNodes.insert( make_pair( _grid->NodeIndex( cell0[0] + size * bool( iN & 1 ),
+                                                          cell0[1] + size * bool( iN & 2 ),
+                                                          cell0[2] + size * bool( iN & 4 )),
+                                        (const SMDS_MeshNode*) 0 ));
+    }
+    return;
+  }
+
+  for ( int iC = 0; iC < 8; ++iC )
+  {
+    TIJK child = {{ 2 * block[0] + bool( iC & 1 ),
+                    2 * block[1] + bool( iC & 2 ),
+                    2 * block[2] + bool( iC & 4 ) }};
+    addBlock( level - 1, child, isInsideNode );
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Return a mesh node at a grid node, either a fine or a coarse one
+ */
+//================================================================================
+
+const SMDS_MeshNode* CellOctree::GetNode( size_t nodeIndex ) const
+{
+  if ( const SMDS_MeshNode* node = _grid->_nodes[ nodeIndex ])
+    return node;
+  std::unordered_map< size_t, const SMDS_MeshNode* >::const_iterator i2n =
+    _coarseNodes.find( nodeIndex );
+  return i2n == _coarseNodes.end() ? 0 : i2n->second;
+}
+
+//================================================================================
+/*!
+ * \brief Create volumes in coarse cells
+ *  \return int - number of created volumes
+ */
+//================================================================================
+
+int CellOctree::MakeElements( SMESH_MesherHelper& helper )
+{
+  SMESHDS_Mesh* mesh = helper.GetMeshDS();
+
+  int nbAdded = 0;
+  vector< pair< TIJK, int > > quads;
+  vector< const SMDS_MeshNode* > nodes, quadNodes;
+  vector< int > quantities;
+
+  for ( const Leaf& leaf : _leaves )
+  {
+    const int size = 1 << leaf._level;
+    const TIJK block = {{ leaf._ijk[0] / size, leaf._ijk[1] / size, leaf._ijk[2] / size }};
+
+    nodes.clear();
+    quantities.clear();
+    bool isHexa = true, isOK = true;
+
+    for ( int iDir = 0; iDir < 3 && isOK; ++iDir )
+      for ( int isMax = 0; isMax < 2 && isOK; ++isMax )
+      {
+        TIJK neighbor = block;
+        neighbor[ iDir ] += isMax ? 1 : -1;
+        const int plane = leaf._ijk[ iDir ] + isMax * size;
+
+        quads.clear();
+        getFaceQuads( leaf._level, neighbor, iDir, isMax, plane, /*isTop=*/true, quads );
+
+        for ( size_t iQ = 0; iQ < quads.size() && isOK; ++iQ )
+        {
+          getQuadNodes( quads[ iQ ].first, quads[ iQ ].second, iDir, isMax, quadNodes );
+          isOK = ( quadNodes.size() >= 4 );
+          nodes.insert( nodes.end(), quadNodes.begin(), quadNodes.end() );
+          quantities.push_back( (int) quadNodes.size() );
+        }
+        isHexa = isHexa && ( quads.size() == 1 && quadNodes.size() == 4 );
+      }
+    if ( !isOK )
+      continue;
+
+    const SMDS_MeshElement* volume;
+    if ( isHexa )
+    {
+      const SMDS_MeshNode* n[8];
+      for ( int iN = 0; iN < 8; ++iN )
+        n[ iN ] = GetNode( _grid->NodeIndex( leaf._ijk[0] + size * bool( iN & 1 ),
+                                             leaf._ijk[1] + size * bool( iN & 2 ),
+                                             leaf._ijk[2] + size * bool( iN & 4 )));
+      // order of n[] is defined by enum SMESH_Block::TShapeID
+      volume = mesh->AddVolume( n[0], n[2], n[3], n[1],
+                                n[4], n[6], n[7], n[5] );
+    }
+    else
+    {
+      volume = mesh->AddPolyhedralVolume( nodes, quantities );
+    }
+    if ( !volume )
+      continue;
+
+    mesh->SetMeshElementOnShape( volume, nodes[0]->GetShapeID() );
+    ++nbAdded;
+  }
+
+  return nbAdded;
+}
+
+//================================================================================
+/*!
+ * \brief Find quadrangles a face of a coarse cell is split into by neighbor cells
+ *  \param [in] level - level of the neighbor block
+ *  \param [in] block - the neighbor block
+ *  \param [in] iDir - axis normal to the face
+ *  \param [in] isMax - true if the face is at the max side of the coarse cell
+ *  \param [in] plane - grid index of the face along \a iDir
+ *  \param [in] isTop - true if the block is of the same size as the coarse cell
+ *  \param [out] quads - origin and size of quadrangles
+ */
+//================================================================================
+
+void CellOctree::getFaceQuads( int level, const TIJK& block, int iDir, bool isMax, int plane,
+                               bool isTop, vector< pair< TIJK, int > >& quads ) const
+{
+  const int size = 1 << level;
+  if ( level == 0 ||
+       isOutOfGrid( level, block ) ||
+       isLeaf( level, block ) ||
+       ( isTop && hasLeafParent( level, block )))
+  {
+    TIJK origin = {{ block[0] * size, block[1] * size, block[2] * size }};
+    origin[ iDir ] = plane;
+    quads.push_back( make_pair( origin, size ));
+    return;
+  }
+
+  // the neighbor block is split; take its children adjacent to the face
+  const int iDir1 = ( iDir + 1 ) % 3, iDir2 = ( iDir + 2 ) % 3;
+  for ( int i2 = 0; i2 < 2; ++i2 )
+    for ( int i1 = 0; i1 < 2; ++i1 )
+    {
+      TIJK child = {{ 2 * block[0], 2 * block[1], 2 * block[2] }};
+      child[ iDir  ] += !isMax;
+      child[ iDir1 ] += i1;
+      child[ iDir2 ] += i2;
+      getFaceQuads( level - 1, child, iDir, isMax, plane, /*isTop=*/false, quads );
+    }
+}
+
+//================================================================================
+/*!
+ * \brief Return mesh nodes along boundary of a quadrangle of a coarse cell face
+ *        so that the face normal is external
+ */
+//================================================================================
+
+void CellOctree::getQuadNodes( const TIJK& origin, int size, int iDir, bool isMax,
+                               vector< const SMDS_MeshNode* >& nodes ) const
+{
+  nodes.clear();
+
+  const int iDir1 = ( iDir + 1 ) % 3, iDir2 = ( iDir + 2 ) % 3;
+
+  // corners in the order giving a normal along iDir
+  int corners[4][2] = { { 0, 0 }, { size, 0 }, { size, size }, { 0, size } };
+  if ( !isMax )
+    std::swap( corners[1], corners[3] );
+
+  for ( int iC = 0; iC < 4; ++iC )
+  {
+    const int* c1 = corners[ iC ];
+    const int* c2 = corners[( iC + 1 ) % 4 ];
+    const int  d1 = ( c2[0] > c1[0] ) - ( c2[0] < c1[0] );
+    const int  d2 = ( c2[1] > c1[1] ) - ( c2[1] < c1[1] );
+    TIJK ijk = origin;
+    ijk[ iDir1 ] += c1[0];
+    ijk[ iDir2 ] += c1[1];
+    for ( int i = 0; i < size; ++i, ijk[ iDir1 ] += d1, ijk[ iDir2 ] += d2 )
+    {
+      if ( const SMDS_MeshNode* node = GetNode( _grid->NodeIndex( ijk )))
+        nodes.push_back( node );
+      else if ( i == 0 )
+      {
+        nodes.clear(); // no corner node
+        return;
+      }
+    }
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Return number of blocks of a level along an axis
+ */
+//================================================================================
+
+int CellOctree::nbBlocks( int level, int iDir ) const
+{
+  return ( _nbCells[ iDir ] + ( 1 << level ) - 1 ) >> level;
+}
+
+//================================================================================
+/*!
+ * \brief Return a unique index of a block of a level
+ */
+//================================================================================
+
+size_t CellOctree::blockCode( int level, const TIJK& block ) const
+{
+  return ( block[0] + size_t( nbBlocks( level, 0 )) *
+           ( block[1] + size_t( nbBlocks( level, 1 )) * block[2] ));
+}
+
+//================================================================================
+/*!
+ * \brief Check if a block does not include any grid cell
+ */
+//================================================================================
+
+bool CellOctree::isOutOfGrid( int level, const TIJK& block ) const
+{
+  for ( int iDir = 0; iDir < 3; ++iDir )
+    if ( block[ iDir ] < 0 || ( block[ iDir ] << level ) >= _nbCells[ iDir ])
+      return true;
+  return false;
+}
+
+//================================================================================
+/*!
+ * \brief Check if all cells of a block are within the grid
+ */
+//================================================================================
+
+bool CellOctree::isInGrid( int level, const TIJK& block ) const
+{
+  for ( int iDir = 0; iDir < 3; ++iDir )
+    if ( block[ iDir ] < 0 || (( block[ iDir ] + 1 ) << level ) > _nbCells[ iDir ])
+      return false;
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief Check if a block or any of 26 neighbor blocks is cut by the geometry
+ */
+//================================================================================
+
+bool CellOctree::hasCutAround( int level, const TIJK& block ) const
+{
+  const vector< size_t >& cutBlocks = _cutBlocks[ level ];
+  TIJK b;
+  for ( b[2] = block[2] - 1; b[2] <= block[2] + 1; ++b[2] )
+    for ( b[1] = block[1] - 1; b[1] <= block[1] + 1; ++b[1] )
+      for ( b[0] = block[0] - 1; b[0] <= block[0] + 1; ++b[0] )
+        if ( !isOutOfGrid( level, b ) &&
+             std::binary_search( cutBlocks.begin(), cutBlocks.end(), blockCode( level, b )))
+          return true;
+  return false;
+}
+
+//================================================================================
+/*!
+ * \brief Check if a block is a coarse cell
+ */
+//================================================================================
+
+bool CellOctree::isLeaf( int level, const TIJK& block ) const
+{
+  return level > 0 && _leafCodes[ level ].count( blockCode( level, block ));
+}
+
+//================================================================================
+/*!
+ * \brief Check if a block is inside a larger coarse cell
+ */
+//================================================================================
+
+bool CellOctree::hasLeafParent( int level, const TIJK& block ) const
+{
+  TIJK parent = block;
+  for ( int l = level + 1; l <= _nbLevels; ++l )
+  {
+    parent[0] /= 2; parent[1] /= 2; parent[2] /= 2;
+    if ( isLeaf( l, parent ))
+      return true;
+  }
+  return false;
+}
+
+//================================================================================
+/*!
+ * \brief Store a cut cell
+ */
+//================================================================================
+
+void CellOctree::markCutCell( const TIJK& cell )
+{
+  if ( !isOutOfGrid( 0, cell ))
+    _cutBlocks[0].push_back( blockCode( 0, cell ));
+}
+
+//================================================================================
+/*!
+ * \brief Store a cell containing a point of the geometry boundary
+ */
+//================================================================================
+
+void CellOctree::markCutPoint( const gp_XYZ& point )
+{
+  double uvw[3];
+  _grid->ComputeUVW( point, uvw );
+
+  TIJK cell;
+  for ( int iDir = 0; iDir < 3; ++iDir )
+    if (( cell[ iDir ] = locateCell( _grid->_coords[ iDir ], uvw[ iDir ], _grid->_tol )) < 0 )
+      return;
+
+  markCutCell( cell );
+}
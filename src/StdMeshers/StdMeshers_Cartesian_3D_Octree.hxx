@@ -0,0 +1,130 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+//  File   : StdMeshers_Cartesian_3D_Octree.hxx
+//  Module : SMESH
+//  Purpose: Merge cells of the BodyFitting grid lying far from the geometry boundary
+//
+
+#ifndef _SMESH_Cartesian_3D_OCTREE_HXX_
+#define _SMESH_Cartesian_3D_OCTREE_HXX_
+
+// STD
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// SMESH
+#include "SMESH_StdMeshers.hxx"
+#include "StdMeshers_Cartesian_3D_Grid.hxx"
+
+namespace StdMeshers
+{
+namespace Cartesian3D
+{
+  // --------------------------------------------------------------------------
+  /*!
+   * \brief Octree of grid cells.
+   *
+   * An aligned block of 2^L x 2^L x 2^L grid cells becomes one coarse cell (a leaf)
+   * if no cell in the block and in its 26 neighbor blocks of the same size is cut
+   * by the geometry boundary. Other cells remain "fine" ones and are meshed by
+   * Hexahedron as usual. Faces of a coarse cell are split according to the sizes
+   * of neighbor cells; the coarse cell is meshed by a hexahedron if no face is split
+   * else by a polyhedron, so the mesh stays conformal.
+   *
+   * The octree only coarsens: no cell is smaller than a grid cell, and a cell is
+   * kept fine only because it is cut by the boundary or neighbors a cut one. So
+   * local refinement by a size field, by proximity or by curvature of FACEs is not
+   * done here; it is defined by spacing functions of the grid as before.
+   *
+   * Usage: MarkCutCells() after intersection of grid lines with the geometry,
+   * FindLeaves() when the state of grid nodes is known, MakeElements() after
+   * creation of mesh nodes.
+   */
+  class STDMESHERS_EXPORT CellOctree
+  {
+  public:
+    struct Leaf
+    {
+      TIJK _ijk;   // index of the first grid cell of the leaf
+      int  _level; // the leaf includes 2^_level grid cells along each axis
+    };
+
+    CellOctree( Grid* grid, int nbLevels );
+
+    //! Find grid cells cut by the geometry boundary
+    void MarkCutCells( const TopoDS_Shape& shape );
+
+    //! Find coarse cells inside the geometry and fine cells
+    void FindLeaves( const std::function< bool( size_t nodeIndex ) >& isInsideNode );
+
+    //! Return true if a grid cell is not merged into a coarse cell
+    bool IsFineCell( size_t cellIndex ) const { return _isFineCell[ cellIndex ]; }
+
+    //! Return true if a grid node is a corner of a fine cell
+    bool IsFineNode( size_t nodeIndex ) const { return _isFineNode[ nodeIndex ]; }
+
+    //! Return true if a grid node is a corner of a coarse cell
+    bool IsCoarseNode( size_t nodeIndex ) const { return _coarseNodes.count( nodeIndex ); }
+
+    //! Store a mesh node created at a corner of a coarse cell
+    void SetCoarseNode( size_t nodeIndex, const SMDS_MeshNode* node ) { _coarseNodes[ nodeIndex ] = node; }
+
+    //! Return a mesh node at a grid node, either a fine or a coarse one
+    const SMDS_MeshNode* GetNode( size_t nodeIndex ) const;
+
+    const std::vector< Leaf >& GetLeaves() const { return _leaves; }
+
+    //! Create volumes in coarse cells; return their number
+    int MakeElements( SMESH_MesherHelper& helper );
+
+  private:
+
+    int    nbBlocks ( int level, int iDir ) const;
+    size_t blockCode( int level, const TIJK& block ) const;
+    bool   isOutOfGrid  ( int level, const TIJK& block ) const;
+    bool   isInGrid     ( int level, const TIJK& block ) const;
+    bool   hasCutAround ( int level, const TIJK& block ) const;
+    bool   isLeaf       ( int level, const TIJK& block ) const;
+    bool   hasLeafParent( int level, const TIJK& block ) const;
+    void   markCutCell  ( const TIJK& cell );
+    void   markCutPoint ( const gp_XYZ& point );
+    void   addBlock     ( int level, const TIJK& block,
+                          const std::function< bool( size_t ) >& isInsideNode );
+    void   getFaceQuads ( int level, const TIJK& block, int iDir, bool isMax, int plane,
+                          bool isTop, std::vector< std::pair< TIJK, int > >& quads ) const;
+    void   getQuadNodes ( const TIJK& origin, int size, int iDir, bool isMax,
+                          std::vector< const SMDS_MeshNode* >& nodes ) const;
+
+    Grid*                                  _grid;
+    int                                    _nbLevels;
+    int                                    _nbCells[3];
+    std::vector< std::vector< size_t > >   _cutBlocks; // sorted codes of cut blocks per level
+    std::vector< std::unordered_set< size_t > > _leafCodes; // codes of leaves per level
+    std::vector< Leaf >                    _leaves;    // coarse cells inside the geometry
+    TiledVector< bool >                    _isFineCell;
+    TiledVector< bool >                    _isFineNode;
+    std::unordered_map< size_t, const SMDS_MeshNode* > _coarseNodes;
+  };
+
+} // end namespace Cartesian3D
+} // end namespace StdMeshers
+
+#endif
@@ -63,6 +63,7 @@
 #include <gp_Ax2.hxx>
 #include <gp_Ax3.hxx>
 
+#include <cstdlib>
 #include <limits>
 #include <numeric>
 
@@ -5608,8 +5609,8 @@ bool StdMeshers_Sweeper::ComputeNodesOnStraight()
 {
   prepareTopBotDelaunay();
 
-  const SMDS_MeshNode     *botNode, *topNode;
-  const BRepMesh_Triangle *topTria;
+  const SMDS_MeshNode *botNode, *topNode;
+  int    topTria;
   double botBC[3], topBC[3]; // barycentric coordinates
   int    botTriaNodes[3], topTriaNodes[3];
   bool   checkUV = true;
@@ -5627,7 +5628,7 @@ bool StdMeshers_Sweeper::ComputeNodesOnStraight()
     // get a starting triangle basing on that top and bot boundary nodes have same index
     topTria = myTopDelaunay->GetTriangleNear( botTriaNodes[0] );
     topTria = myTopDelaunay->FindTriangle( topUV, topTria, topBC, topTriaNodes );
-    if ( !topTria )
+    if ( topTria < 0 )
       return false;
 
     // create nodes along a line
@@ -5718,10 +5719,12 @@ void StdMeshers_Sweeper::prepareTopBotDelaunay()
   TSideVector botWires( 1, StdMeshers_FaceSide::New( botUV, myBotFace, dummyE, mesh ));
   TSideVector topWires( 1, StdMeshers_FaceSide::New( topUV, myTopFace, dummyE, mesh ));
 
-  // Delaunay mesh on the FACEs.
-  bool checkUV = false;
-  myBotDelaunay.reset( new NSProjUtils::Delaunay( botWires, checkUV ));
-  myTopDelaunay.reset( new NSProjUtils::Delaunay( topWires, checkUV ));
+  // Delaunay mesh on the FACEs. Flat arrays of SMESH_Delaunay2D are used instead
+  // of BRepMesh if SMESH_FLAT_DELAUNAY environment variable is set
+  bool checkUV     = false;
+  bool useBRepMesh = !getenv("SMESH_FLAT_DELAUNAY");
+  myBotDelaunay.reset( new NSProjUtils::Delaunay( botWires, checkUV, useBRepMesh ));
+  myTopDelaunay.reset( new NSProjUtils::Delaunay( topWires, checkUV, useBRepMesh ));
 
   if ( myHelper->GetIsQuadratic() )
   {
@@ -5758,14 +5761,18 @@ void StdMeshers_Sweeper::prepareTopBotDelaunay()
 
 bool StdMeshers_Sweeper::findDelaunayTriangles()
 {
-  const SMDS_MeshNode     *botNode, *topNode;
-  const BRepMesh_Triangle *topTria;
-  TopBotTriangles          tbTrias;
+  const SMDS_MeshNode *botNode, *topNode;
+  TopBotTriangles      tbTrias;
   bool  checkUV = true;
 
   size_t nbInternalNodes = myIntColumns.size();
   myTopBotTriangles.resize( nbInternalNodes );
 
+  std::vector< gp_XY > topUVs;
+  std::vector< int >   colIDs;
+  topUVs.reserve( nbInternalNodes );
+  colIDs.reserve( nbInternalNodes );
+
   myBotDelaunay->InitTraversal( nbInternalNodes );
 
   while (( botNode = myBotDelaunay->NextNode( tbTrias.myBotBC, tbTrias.myBotTriaNodes )))
@@ -5773,15 +5780,9 @@ bool StdMeshers_Sweeper::findDelaunayTriangles()
     int colID = myNodeID2ColID( botNode->GetID() );
     TNodeColumn* column = myIntColumns[ colID ];
 
-    // find a Delaunay triangle containing the topNode
     topNode = column->back();
-    gp_XY topUV = myHelper->GetNodeUV( myTopFace, topNode, NULL, &checkUV );
-    // get a starting triangle basing on that top and bot boundary nodes have same index
-    topTria = myTopDelaunay->GetTriangleNear( tbTrias.myBotTriaNodes[0] );
-    topTria = myTopDelaunay->FindTriangle( topUV, topTria,
-                                           tbTrias.myTopBC, tbTrias.myTopTriaNodes );
-    if ( !topTria )
-      tbTrias.SetTopByBottom();
+    topUVs.push_back( myHelper->GetNodeUV( myTopFace, topNode, NULL, &checkUV ));
+    colIDs.push_back( colID );
 
     myTopBotTriangles[ colID ] = tbTrias;
   }
@@ -5792,6 +5793,26 @@ bool StdMeshers_Sweeper::findDelaunayTriangles()
     return false;
   }
 
+  // find Delaunay triangles containing the top nodes, all at once
+  std::vector< int >    topTrias, topTriaNodes;
+  std::vector< double > topBC;
+  myTopDelaunay->FindTriangles( topUVs, topTrias, topBC, topTriaNodes );
+
+  for ( size_t i = 0; i < colIDs.size(); ++i )
+  {
+    TopBotTriangles& tb = myTopBotTriangles[ colIDs[i] ];
+    if ( topTrias[i] < 0 )
+    {
+      tb.SetTopByBottom();
+      continue;
+    }
+    for ( int j = 0; j < 3; ++j )
+    {
+      tb.myTopBC       [j] = topBC       [ 3 * i + j ];
+      tb.myTopTriaNodes[j] = topTriaNodes[ 3 * i + j ];
+    }
+  }
+
   myBotDelaunay.reset();
   myTopDelaunay.reset();
   myNodeID2ColID.Clear();
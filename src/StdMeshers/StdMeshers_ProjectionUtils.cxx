@@ -2925,15 +2925,82 @@ namespace StdMeshers_ProjectionUtils
 
   } // Morph::Perform
 
+  //================================================================================
+  /*!
+   * \brief Store mesh faces of a source FACE in arrays
+   *  \param [in] srcHelper - helper of the source mesh to get node UV
+   *  \param [in] srcFace - the source FACE
+   *  \return bool - false if there is no mesh on \a srcFace
+   */
+  //================================================================================
+
+  bool SourceFaceMesh::Load( SMESH_MesherHelper& srcHelper, const TopoDS_Face& srcFace )
+  {
+    _nodes.clear();
+    _xyz.clear();
+    _uv.clear();
+    _faceNodes.clear();
+    _faceOffsets.clear();
+    _nbSubMeshNodes = _nbSubMeshElems = -1;
+
+    SMESHDS_SubMesh* srcSubDS = srcHelper.GetMeshDS()->MeshElements( srcFace );
+    if ( !srcSubDS || srcSubDS->NbElements() == 0 )
+      return false;
+
+    _nbSubMeshNodes = srcSubDS->NbNodes();
+    _nbSubMeshElems = srcSubDS->NbElements();
+    _faceOffsets.reserve( _nbSubMeshElems + 1 );
+    _faceOffsets.push_back( 0 );
+
+    std::map< const SMDS_MeshNode*, int > nodeIndex;
+    bool uvOK;
+    SMDS_ElemIteratorPtr elemIt = srcSubDS->GetElements();
+    while ( elemIt->more() )
+    {
+      const SMDS_MeshElement* elem = elemIt->next();
+      const int nbN = elem->NbCornerNodes();
+      for ( int i = 0; i < nbN; ++i )
+      {
+        const SMDS_MeshNode* node = elem->GetNode( i );
+        std::pair< std::map< const SMDS_MeshNode*, int >::iterator, bool > n2i =
+          nodeIndex.insert( std::make_pair( node, (int) _nodes.size() ));
+        if ( n2i.second )
+        {
+          _nodes.push_back( node );
+          _xyz.push_back( SMESH_NodeXYZ( node ));
+          _uv.push_back( srcHelper.GetNodeUV( srcFace, node,
+                                              elem->GetNode( srcHelper.WrapIndex( i+1, nbN )), &uvOK ));
+        }
+        _faceNodes.push_back( n2i.first->second );
+      }
+      _faceOffsets.push_back( _faceNodes.size() );
+    }
+    return true;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Return true if the loaded data correspond to the source sub-mesh
+   */
+  //================================================================================
+
+  bool SourceFaceMesh::IsLoaded( const SMESHDS_SubMesh* srcSubMesh ) const
+  {
+    return ( srcSubMesh &&
+             srcSubMesh->NbNodes()    == _nbSubMeshNodes &&
+             srcSubMesh->NbElements() == _nbSubMeshElems );
+  }
+
   //=======================================================================
   //function : Delaunay
   //purpose  : construct from face sides
   //=======================================================================
 
-  Delaunay::Delaunay( const TSideVector& wires, bool checkUV ):
+  Delaunay::Delaunay( const TSideVector& wires, bool checkUV, bool useBRepMesh ):
     SMESH_Delaunay( SideVector2UVPtStructVec( wires ),
                     TopoDS::Face( wires[0]->FaceHelper()->GetSubShape() ),
-                    wires[0]->FaceHelper()->GetSubShapeID() )
+                    wires[0]->FaceHelper()->GetSubShapeID(),
+                    useBRepMesh )
   {
     _wire = wires[0]; // keep a wire to assure _helper to keep alive
     _helper = _wire->FaceHelper();
@@ -2947,10 +3014,12 @@ namespace StdMeshers_ProjectionUtils
 
   Delaunay::Delaunay( const std::vector< const UVPtStructVec* > & boundaryNodes,
                       SMESH_MesherHelper&                         faceHelper,
-                      bool                                        checkUV):
+                      bool                                        checkUV,
+                      bool                                        useBRepMesh):
     SMESH_Delaunay( boundaryNodes,
                     TopoDS::Face( faceHelper.GetSubShape() ),
-                    faceHelper.GetSubShapeID() )
+                    faceHelper.GetSubShapeID(),
+                    useBRepMesh )
   {
     _helper = & faceHelper;
     _checkUVPtr = checkUV ? & _checkUV : 0;
@@ -51,6 +51,7 @@ class SMDS_MeshNode;
 class SMESH_Algo;
 class SMESH_Hypothesis;
 class SMESH_Mesh;
+class SMESHDS_SubMesh;
 class SMESH_subMesh;
 class TopoDS_Shape;
 
@@ -156,11 +157,12 @@ namespace StdMeshers_ProjectionUtils
   {
   public:
 
-    Delaunay( const TSideVector& wires, bool checkUV = false );
+    Delaunay( const TSideVector& wires, bool checkUV = false, bool useBRepMesh = true );
 
     Delaunay( const std::vector< const UVPtStructVec* > & boundaryNodes,
               SMESH_MesherHelper&                         faceHelper,
-              bool                                        checkUV = false);
+              bool                                        checkUV = false,
+              bool                                        useBRepMesh = true);
 
   protected:
     virtual gp_XY getNodeUV( const TopoDS_Face& face, const SMDS_MeshNode* node ) const;
@@ -191,6 +193,40 @@ namespace StdMeshers_ProjectionUtils
                  const bool                    moveAll);
   };
 
+  //-----------------------------------------------------------------------------------------
+  /*!
+   * \brief Mesh faces on a source FACE stored in arrays. It is loaded once and
+   *        shared by projections of the source FACE to several target FACEs.
+   */
+  struct SourceFaceMesh
+  {
+    std::vector< const SMDS_MeshNode* > _nodes;       // nodes in the order of first use by faces
+    std::vector< gp_XYZ >               _xyz;         // coordinates of _nodes
+    std::vector< gp_XY >                _uv;          // UV of _nodes on the source FACE
+    std::vector< int >                  _faceNodes;   // indices in _nodes of corner nodes of faces
+    std::vector< size_t >               _faceOffsets; // start of face nodes in _faceNodes
+    smIdType                            _nbSubMeshNodes, _nbSubMeshElems;
+
+    SourceFaceMesh(): _nbSubMeshNodes( -1 ), _nbSubMeshElems( -1 ) {}
+
+    bool Load( SMESH_MesherHelper& srcHelper, const TopoDS_Face& srcFace );
+
+    //! Return true if the loaded data correspond to the source sub-mesh.
+    //  The source mesh can change as target FACEs of the same mesh are computed,
+    //  so the data are valid within one compute session only.
+    bool IsLoaded( const SMESHDS_SubMesh* srcSubMesh ) const;
+
+    size_t NbFaces() const { return _faceOffsets.empty() ? 0 : _faceOffsets.size() - 1; }
+  };
+  typedef boost::shared_ptr< SourceFaceMesh > SourceFaceMeshPtr;
+
+  // SourceFaceMesh's by IDs of a source mesh and a source FACE sub-mesh
+  typedef std::map< std::pair< int, int >, SourceFaceMeshPtr > TSourceFaceMeshCache;
+
+  // auxiliary meshes built on source FACEs by IDs of a source mesh, a source FACE,
+  // its EDGEs and parameters of the auxiliary mesh
+  typedef std::map< std::vector< int >, boost::shared_ptr< SMESH_Mesh > > TSourceAuxMeshCache;
+
   //-----------------------------------------------------------------------------------------
   /*!
    * \brief Looks for association of all sub-shapes of two shapes
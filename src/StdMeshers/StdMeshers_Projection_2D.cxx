@@ -37,6 +37,7 @@
 
 #include <ObjectPool.hxx>
 #include <SMDS_EdgePosition.hxx>
+#include <SMDS_ElementRange.hxx>
 #include <SMDS_FacePosition.hxx>
 #include <SMESHDS_Hypothesis.hxx>
 #include <SMESHDS_Mesh.hxx>
@@ -116,6 +117,7 @@ StdMeshers_Projection_2D::StdMeshers_Projection_2D(int hypId, SMESH_Gen* gen)
   _name = "Projection_2D";
   _compatibleHypothesis.push_back("ProjectionSource2D");
   _sourceHypo = 0;
+  _toKeepSrcFaceMeshes = false;
 }
 
 //================================================================================
@@ -224,8 +226,66 @@ bool StdMeshers_Projection_2D::CheckHypothesis(SMESH_Mesh&
   return ( theStatus == HYP_OK );
 }
 
+//================================================================================
+/*!
+ * \brief Keep source FACE meshes to share them by projections to several target
+ *        FACEs, or release them if \a subMeshes is empty
+ */
+//================================================================================
+
+void StdMeshers_Projection_2D::PrepareCompute(SMESH_Mesh&                          /*theMesh*/,
+                                              const std::vector< SMESH_subMesh* >& theSubMeshes)
+{
+  _srcFaceMeshes.clear();
+  _srcQuadMeshes.clear();
+  _toKeepSrcFaceMeshes = ( theSubMeshes.size() > 1 );
+}
+
 namespace {
 
+  //================================================================================
+  /*!
+   * \brief Provider of mesh of a source FACE loading it on the first demand only.
+   *        The loaded mesh is stored in a cache if it is given.
+   */
+  //================================================================================
+
+  struct SourceFaceMeshLoader
+  {
+    SMESH_subMesh*                    _srcSubMesh;
+    TopoDS_Face                       _srcFace;
+    SMESH_MesherHelper*               _srcHelper;
+    TAssocTool::TSourceFaceMeshCache* _cache;
+    TAssocTool::SourceFaceMeshPtr     _srcFaceMesh;
+
+    SourceFaceMeshLoader( SMESH_subMesh*                    srcSubMesh,
+                          const TopoDS_Face&                srcFace,
+                          SMESH_MesherHelper*               srcHelper,
+                          TAssocTool::TSourceFaceMeshCache* cache )
+      : _srcSubMesh( srcSubMesh ), _srcFace( srcFace ), _srcHelper( srcHelper ), _cache( cache ) {}
+
+    const TAssocTool::SourceFaceMesh& Get()
+    {
+      if ( _srcFaceMesh )
+        return *_srcFaceMesh;
+
+      SMESH_Mesh*           srcMesh = _srcSubMesh->GetFather();
+      std::pair< int, int > key( srcMesh->GetId(), _srcSubMesh->GetId() );
+      if ( _cache )
+      {
+        auto key2mesh = _cache->find( key );
+        if ( key2mesh != _cache->end() &&
+             key2mesh->second->IsLoaded( _srcSubMesh->GetSubMeshDS() ))
+          return *( _srcFaceMesh = key2mesh->second );
+      }
+      _srcFaceMesh.reset( new TAssocTool::SourceFaceMesh );
+      _srcFaceMesh->Load( *_srcHelper, _srcFace );
+      if ( _cache )
+        (*_cache)[ key ] = _srcFaceMesh;
+      return *_srcFaceMesh;
+    }
+  };
+
   //================================================================================
   /*!
    * \brief define if a node is new or old
@@ -588,6 +648,7 @@ namespace {
                       const TopoDS_Face&                 srcFace,
                       const TSideVector&                 tgtWires,
                       const TSideVector&                 srcWires,
+                      SourceFaceMeshLoader&              srcFaceMeshLoader,
                       const TAssocTool::TShapeShapeMap&  shape2ShapeMap,
                       TAssocTool::TNodeNodeMap&          src2tgtNodes,
                       const bool                         is1DComputed)
@@ -698,7 +759,6 @@ namespace {
     SMESH_MesherHelper  edgeHelper( *tgtMesh );
     edgeHelper.ToFixNodeParameters( true );
 
-    const SMDS_MeshNode* nullNode = 0;
     TAssocTool::TNodeNodeMap::iterator srcN_tgtN;
 
     // indices of nodes to create properly oriented faces
@@ -707,29 +767,44 @@ namespace {
     if ( isReverse )
       std::swap( tri1, tri2 ), std::swap( quad1, quad3 );
 
-    SMDS_ElemIteratorPtr elemIt = srcSubDS->GetElements();
+    // get existing target nodes and location of new ones
+    const TAssocTool::SourceFaceMesh& srcFaceMesh = srcFaceMeshLoader.Get();
+    const size_t nbSrcNodes = srcFaceMesh._nodes.size();
+    vector< const SMDS_MeshNode* > tgtNodeOfSrc( nbSrcNodes );
+    for ( size_t iN = 0; iN < nbSrcNodes && !src2tgtNodes.empty(); ++iN )
+      if (( srcN_tgtN = src2tgtNodes.find( srcFaceMesh._nodes[ iN ])) != src2tgtNodes.end() )
+        tgtNodeOfSrc[ iN ] = srcN_tgtN->second;
+
+    vector< gp_XYZ > tgtXYZ( nbSrcNodes );
+    SMDS_ParallelFor( nbSrcNodes, [&]( size_t iN )
+                      {
+                        if ( !tgtNodeOfSrc[ iN ])
+                          tgtXYZ[ iN ] = trsf.Transform( srcFaceMesh._xyz[ iN ]);
+                      });
+
     vector< const SMDS_MeshNode* > tgtNodes;
-    while ( elemIt->more() ) // loop on all mesh faces on srcFace
+    for ( size_t iF = 0; iF < srcFaceMesh.NbFaces(); ++iF ) // loop on all mesh faces on srcFace
     {
-      const SMDS_MeshElement* elem = elemIt->next();
-      const int nbN = elem->NbCornerNodes();
+      const int* srcNodeInd = & srcFaceMesh._faceNodes[ srcFaceMesh._faceOffsets[ iF ]];
+      const int nbN = int( srcFaceMesh._faceOffsets[ iF + 1 ] - srcFaceMesh._faceOffsets[ iF ]);
       tgtNodes.resize( nbN );
       helper->SetElementsOnShape( false );
       for ( int i = 0; i < nbN; ++i ) // loop on nodes of the source element
       {
-        const SMDS_MeshNode* srcNode = elem->GetNode(i);
-        srcN_tgtN = src2tgtNodes.insert( make_pair( srcNode, nullNode )).first;
-        if ( srcN_tgtN->second == nullNode )
+        const int iN = srcNodeInd[ i ];
+        if ( !tgtNodeOfSrc[ iN ])
         {
           // create a new node
-          gp_Pnt tgtP = trsf.Transform( SMESH_TNodeXYZ( srcNode ));
+          const SMDS_MeshNode* srcNode = srcFaceMesh._nodes[ iN ];
+          const gp_Pnt           tgtP = tgtXYZ[ iN ];
           SMDS_MeshNode* n = helper->AddNode( tgtP.X(), tgtP.Y(), tgtP.Z() );
-          srcN_tgtN->second = n;
+          tgtNodeOfSrc[ iN ] = n;
+          src2tgtNodes.insert( make_pair( srcNode, n ));
           switch ( srcNode->GetPosition()->GetTypeOfPosition() )
           {
           case SMDS_TOP_FACE:
           {
-            gp_Pnt2d srcUV = srcHelper->GetNodeUV( srcFace, srcNode );
+            const gp_XY& srcUV = srcFaceMesh._uv[ iN ];
             tgtMeshDS->SetNodeOnFace( n, helper->GetSubShapeID(), srcUV.X(), srcUV.Y() );
             break;
           }
@@ -770,7 +845,7 @@ namespace {
           default:;
           }
         }
-        tgtNodes[i] = srcN_tgtN->second;
+        tgtNodes[i] = tgtNodeOfSrc[ iN ];
       }
       // create a new face
       helper->SetElementsOnShape( true );
@@ -835,6 +910,7 @@ namespace {
                              const TopoDS_Face&                 srcFace,
                              const TSideVector&                 tgtWires,
                              const TSideVector&                 srcWires,
+                             SourceFaceMeshLoader&              srcFaceMeshLoader,
                              const TAssocTool::TShapeShapeMap&  shape2ShapeMap,
                              TAssocTool::TNodeNodeMap&          src2tgtNodes,
                              const bool                         is1DComputed)
@@ -933,28 +1009,40 @@ namespace {
 
     SMESH_MesherHelper* srcHelper = srcWires[0]->FaceHelper();
 
-    const SMDS_MeshNode* nullNode = 0;
     TAssocTool::TNodeNodeMap::iterator srcN_tgtN;
 
-    SMDS_ElemIteratorPtr elemIt = srcSubDS->GetElements();
+    // get existing target nodes and UV and location of new ones
+    const TAssocTool::SourceFaceMesh& srcFaceMesh = srcFaceMeshLoader.Get();
+    const size_t nbSrcNodes = srcFaceMesh._nodes.size();
+    vector< const SMDS_MeshNode* > tgtNodeOfSrc( nbSrcNodes );
+    for ( size_t iN = 0; iN < nbSrcNodes && !src2tgtNodes.empty(); ++iN )
+      if (( srcN_tgtN = src2tgtNodes.find( srcFaceMesh._nodes[ iN ])) != src2tgtNodes.end() )
+        tgtNodeOfSrc[ iN ] = srcN_tgtN->second;
+
+    // the surface is evaluated when a node is created, as Geom_Surface is not
+    // guaranteed to be safe to evaluate from several threads
+    vector< gp_XY > tgtUVs( nbSrcNodes );
+    SMDS_ParallelFor( nbSrcNodes, [&]( size_t iN )
+                      {
+                        if ( !tgtNodeOfSrc[ iN ])
+                          tgtUVs[ iN ] = trsf.Transform( srcFaceMesh._uv[ iN ]);
+                      });
+
     vector< const SMDS_MeshNode* > tgtNodes;
-    bool uvOK;
-    while ( elemIt->more() ) // loop on all mesh faces on srcFace
+    for ( size_t iF = 0; iF < srcFaceMesh.NbFaces(); ++iF ) // loop on all mesh faces on srcFace
     {
-      const SMDS_MeshElement* elem = elemIt->next();
-      const int nbN = elem->NbCornerNodes();
+      const int* srcNodeInd = & srcFaceMesh._faceNodes[ srcFaceMesh._faceOffsets[ iF ]];
+      const int nbN = int( srcFaceMesh._faceOffsets[ iF + 1 ] - srcFaceMesh._faceOffsets[ iF ]);
       tgtNodes.resize( nbN );
       for ( int i = 0; i < nbN; ++i ) // loop on nodes of the source element
       {
-        const SMDS_MeshNode* srcNode = elem->GetNode(i);
-        srcN_tgtN = src2tgtNodes.insert( make_pair( srcNode, nullNode )).first;
-        if ( srcN_tgtN->second == nullNode )
+        const int iN = srcNodeInd[ i ];
+        if ( !tgtNodeOfSrc[ iN ])
         {
           // create a new node
-          gp_Pnt2d srcUV = srcHelper->GetNodeUV( srcFace, srcNode,
-                                                 elem->GetNode( helper->WrapIndex(i+1,nbN)), &uvOK);
-          gp_Pnt2d   tgtUV = trsf.Transform( srcUV );
-          gp_Pnt      tgtP = tgtSurface->Value( tgtUV.X(), tgtUV.Y() );
+          const SMDS_MeshNode* srcNode = srcFaceMesh._nodes[ iN ];
+          const gp_XY&           tgtUV = tgtUVs[ iN ];
+          const gp_Pnt            tgtP = tgtSurface->Value( tgtUV.X(), tgtUV.Y() );
           SMDS_MeshNode* n = tgtMeshDS->AddNode( tgtP.X(), tgtP.Y(), tgtP.Z() );
           switch ( srcNode->GetPosition()->GetTypeOfPosition() )
           {
@@ -978,9 +1066,10 @@ namespace {
           }
           default:;
           }
-          srcN_tgtN->second = n;
+          tgtNodeOfSrc[ iN ] = n;
+          src2tgtNodes.insert( make_pair( srcNode, n ));
         }
-        tgtNodes[i] = srcN_tgtN->second;
+        tgtNodes[i] = tgtNodeOfSrc[ iN ];
       }
       // create a new face (with reversed orientation)
       switch ( nbN )
@@ -1255,7 +1344,8 @@ namespace {
                     const TSideVector&                 srcWires,
                     const TAssocTool::TShapeShapeMap&  shape2ShapeMap,
                     TAssocTool::TNodeNodeMap&          src2tgtNodes,
-                    const bool                         is1DComputed)
+                    const bool                         is1DComputed,
+                    TAssocTool::TSourceAuxMeshCache*   srcQuadMeshes)
   {
     SMESH_Mesh * tgtMesh = tgtWires[0]->GetMesh();
     SMESH_Mesh * srcMesh = srcWires[0]->GetMesh();
@@ -1269,14 +1359,39 @@ namespace {
 
     // make auxiliary structured meshes that will be used to get corresponding
     // points on the target FACE
-    QuadMesh srcQuadMesh( srcFace ), tgtQuadMesh( tgtFace );
     double avgSize = calcAverageFaceSize( srcMeshDS->MeshElements( srcFace ));
     int nbSeg1 = (int) Max( 2., Max( srcWires[0]->EdgeLength(0),
                                      srcWires[0]->EdgeLength(2)) / avgSize );
     int nbSeg2 = (int) Max( 2., Max( srcWires[0]->EdgeLength(1),
                                      srcWires[0]->EdgeLength(3)) / avgSize );
-    if ( !srcQuadMesh.Compute( srcWires, nbSeg1, nbSeg2, /*isSrc=*/true ) ||
-         !tgtQuadMesh.Compute( tgtWires, nbSeg1, nbSeg2, /*isSrc=*/false ))
+
+    // the source mesh and its element searcher are shared by projections of srcFace
+    // starting from the same EDGE
+    std::vector< int > srcKey = { srcMesh->GetId(), srcMeshDS->ShapeToIndex( srcFace ),
+                                  nbSeg1, nbSeg2 };
+    for ( int iE = 0; iE < srcWires[0]->NbEdges(); ++iE )
+      srcKey.push_back( srcMeshDS->ShapeToIndex( srcWires[0]->Edge( iE )));
+
+    boost::shared_ptr< SMESH_Mesh > srcQuadMeshPtr;
+    if ( srcQuadMeshes )
+    {
+      auto key2mesh = srcQuadMeshes->find( srcKey );
+      if ( key2mesh != srcQuadMeshes->end() )
+        srcQuadMeshPtr = key2mesh->second;
+    }
+    if ( !srcQuadMeshPtr )
+    {
+      QuadMesh* quadMesh = new QuadMesh( srcFace );
+      srcQuadMeshPtr.reset( quadMesh );
+      if ( !quadMesh->Compute( srcWires, nbSeg1, nbSeg2, /*isSrc=*/true ))
+        return false;
+      if ( srcQuadMeshes )
+        (*srcQuadMeshes)[ srcKey ] = srcQuadMeshPtr;
+    }
+    QuadMesh& srcQuadMesh = *static_cast< QuadMesh* >( srcQuadMeshPtr.get() );
+
+    QuadMesh tgtQuadMesh( tgtFace );
+    if ( !tgtQuadMesh.Compute( tgtWires, nbSeg1, nbSeg2, /*isSrc=*/false ))
       return false;
 
     // Make new faces
@@ -2118,6 +2233,11 @@ bool StdMeshers_Projection_2D::Compute(SMESH_Mesh& theMesh, const TopoDS_Shape&
   if ( err && !err->IsOK() )
     return error( err );
 
+  // mesh of the source FACE is loaded by a projection needing it, if not yet loaded
+  // by a previous projection
+  SourceFaceMeshLoader srcFaceMesh( srcSubMesh, srcFace, srcWires[0]->FaceHelper(),
+                                    _toKeepSrcFaceMeshes ? &_srcFaceMeshes : nullptr );
+
   bool projDone = false;
 
   if ( !projDone && !piercingLine.IsNull() )
@@ -2130,20 +2250,21 @@ bool StdMeshers_Projection_2D::Compute(SMESH_Mesh& theMesh, const TopoDS_Shape&
   if ( !projDone )
   {
     // try to project from the same face with different location
-    projDone = projectPartner( tgtFace, srcFace, tgtWires, srcWires,
+    projDone = projectPartner( tgtFace, srcFace, tgtWires, srcWires, srcFaceMesh,
                                shape2ShapeMap, _src2tgtNodes, is1DComputed );
   }
   if ( !projDone )
   {
     // projection in case if the faces are similar in 2D space
-    projDone = projectBy2DSimilarity( tgtFace, srcFace, tgtWires, srcWires,
+    projDone = projectBy2DSimilarity( tgtFace, srcFace, tgtWires, srcWires, srcFaceMesh,
                                       shape2ShapeMap, _src2tgtNodes, is1DComputed );
   }
   if ( !projDone )
   {
     // projection in case of quadrilateral faces
     projDone = projectQuads( tgtFace, srcFace, tgtWires, srcWires,
-                             shape2ShapeMap, _src2tgtNodes, is1DComputed);
+                             shape2ShapeMap, _src2tgtNodes, is1DComputed,
+                             _toKeepSrcFaceMeshes ? &_srcQuadMeshes : nullptr );
   }
   if ( !projDone && !piercingTried )
   {
@@ -46,6 +46,9 @@ public:
 
   virtual bool Compute(SMESH_Mesh& aMesh, const TopoDS_Shape& aShape);
 
+  virtual void PrepareCompute(SMESH_Mesh&                          aMesh,
+                              const std::vector< SMESH_subMesh* >& subMeshes);
+
   virtual bool Evaluate(SMESH_Mesh & aMesh, const TopoDS_Shape & aShape,
                         MapShapeNbElems& aResMap);
 
@@ -67,6 +70,12 @@ public:
 
   StdMeshers_ProjectionUtils::TNodeNodeMap _src2tgtNodes;
 
+  // mesh of source FACEs and auxiliary quadrangle meshes of source FACEs
+  // kept between PrepareCompute() calls
+  StdMeshers_ProjectionUtils::TSourceFaceMeshCache _srcFaceMeshes;
+  StdMeshers_ProjectionUtils::TSourceAuxMeshCache  _srcQuadMeshes;
+  bool                                     _toKeepSrcFaceMeshes;
+
 };
 
 #endif
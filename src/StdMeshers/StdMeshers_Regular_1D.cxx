@@ -27,6 +27,7 @@
 //
 #include "StdMeshers_Regular_1D.hxx"
 
+#include "SMDS_ElementRange.hxx"
 #include "SMDS_MeshElement.hxx"
 #include "SMDS_MeshNode.hxx"
 #include "SMESHDS_Mesh.hxx"
@@ -704,7 +705,7 @@ bool StdMeshers_Regular_1D::divideIntoEqualSegments( SMESH_Mesh &        theMesh
   else // huge nb segments
   {
     // use FIXED_POINTS_1D method
-    StdMeshers_FixedPoints1D fixedPointsHyp( GetGen()->GetANewId(), GetGen() );
+    StdMeshers_FixedPoints1D fixedPointsHyp( GetGen() ? GetGen()->GetANewId() : -1, GetGen() );
     _fpHyp = &fixedPointsHyp;
     std::vector<double>   params = { 0., 1. };
     std::vector<smIdType> nbSegs = { theNbPoints - 1 };
@@ -1342,6 +1343,173 @@ bool StdMeshers_Regular_1D::computeInternalParameters(SMESH_Mesh &     theMesh,
   return false;
 }
 
+//================================================================================
+/*!
+ * \brief Return true if nodes on an EDGE are to be distributed in reversed order
+ *  \param [in] theMesh - the mesh
+ *  \param [in] theEdge - the EDGE, not FORWARD oriented
+ *  \param [in] theEdgeID - ID of \a theEdge
+ */
+//================================================================================
+
+bool StdMeshers_Regular_1D::isReversed( SMESH_Mesh&        theMesh,
+                                        const TopoDS_Edge& theEdge,
+                                        int                theEdgeID ) const
+{
+  bool reversed = false;
+  if ( theMesh.GetShapeToMesh().ShapeType() >= TopAbs_WIRE && _revEdgesIDs.empty() ) {
+    // if the shape to mesh is WIRE or EDGE
+    reversed = ( theEdge.Orientation() == TopAbs_REVERSED );
+  }
+  if ( !_mainEdge.IsNull() ) {
+    // take into account reversing the edge the hypothesis is propagated from
+    // (_mainEdge.Orientation() marks mutual orientation of EDGEs in propagation chain)
+    reversed = ( _mainEdge.Orientation() == TopAbs_REVERSED );
+    if ( _hypType != DISTRIB_PROPAGATION ) {
+      int mainID = theMesh.GetMeshDS()->ShapeToIndex(_mainEdge);
+      if ( std::find( _revEdgesIDs.begin(), _revEdgesIDs.end(), mainID) != _revEdgesIDs.end())
+        reversed = !reversed;
+    }
+  }
+  // take into account this edge reversing
+  if ( std::find( _revEdgesIDs.begin(), _revEdgesIDs.end(), theEdgeID) != _revEdgesIDs.end())
+    reversed = !reversed;
+
+  return reversed;
+}
+
+//================================================================================
+/*!
+ * \brief Return true if computeInternalParameters() with the hypothesis set by
+ *        CheckHypothesis() neither reads the mesh nor uses non thread-safe tools
+ */
+//================================================================================
+
+bool StdMeshers_Regular_1D::isParallelizable() const
+{
+  switch ( _hypType ) {
+  case NONE:
+  case ADAPTIVE:            // meshed by another algo
+  case DISTRIB_PROPAGATION: // uses nodes of the main edge
+    return false;
+  case LOCAL_LENGTH:        // may compute the main edge
+    return _mainEdge.IsNull();
+  case NB_SEGMENTS:         // expression evaluation is not thread-safe
+    return _ivalue[ DISTR_TYPE_IND ] != StdMeshers_NumberOfSegments::DT_ExprFunc;
+  default:;
+  }
+  return true;
+}
+
+//================================================================================
+/*!
+ * \brief State of the algo set by CheckHypothesis() for an EDGE and
+ *        node parameters computed on the EDGE
+ */
+//================================================================================
+
+struct StdMeshers_Regular_1D::TEdgeTask
+{
+  TopoDS_Edge                     _edge;
+  int                             _edgeID;
+  bool                            _reversed;
+  bool                            _isOK;
+  std::list< double >             _params;
+
+  HypothesisType                  _hypType;
+  const StdMeshers_FixedPoints1D* _fpHyp;
+  double                          _value [2];
+  smIdType                        _ivalue[3];
+  std::vector<double>             _vvalue[1];
+  std::string                     _svalue[1];
+
+  void Save( const StdMeshers_Regular_1D& algo )
+  {
+    _hypType = algo._hypType;
+    _fpHyp   = algo._fpHyp;
+    std::copy( algo._value,  algo._value  + 2, _value );
+    std::copy( algo._ivalue, algo._ivalue + 3, _ivalue );
+    _vvalue[0] = algo._vvalue[0];
+    _svalue[0] = algo._svalue[0];
+  }
+  void Load( StdMeshers_Regular_1D& algo ) const
+  {
+    algo._hypType = _hypType;
+    algo._fpHyp   = _fpHyp;
+    std::copy( _value,  _value  + 2, algo._value );
+    std::copy( _ivalue, _ivalue + 3, algo._ivalue );
+    algo._vvalue[0] = _vvalue[0];
+    algo._svalue[0] = _svalue[0];
+    algo._mainEdge.Nullify();
+  }
+};
+
+//================================================================================
+/*!
+ * \brief Compute in parallel node parameters on EDGEs to be computed
+ *
+ * Hypotheses are checked sequentially as it requires access to the mesh. Then
+ * each thread computes parameters by its own algo using own curve adaptors. Mesh
+ * elements are created by Compute() as usual.
+ */
+//================================================================================
+
+void StdMeshers_Regular_1D::PrepareCompute(SMESH_Mesh&                          theMesh,
+                                           const std::vector< SMESH_subMesh* >& theSubMeshes)
+{
+  _edgeParams.clear();
+  if ( theSubMeshes.size() < 2 )
+    return;
+
+  std::vector< TEdgeTask > tasks;
+  tasks.reserve( theSubMeshes.size() );
+
+  SMESH_Hypothesis::Hypothesis_Status aStatus;
+  for ( SMESH_subMesh* sm : theSubMeshes )
+  {
+    const TopoDS_Shape& edge = sm->GetSubShape();
+    if ( edge.ShapeType() != TopAbs_EDGE ||
+         !CheckHypothesis( theMesh, edge, aStatus ) ||
+         !isParallelizable() )
+      continue;
+
+    tasks.emplace_back();
+    TEdgeTask& task = tasks.back();
+    task._edge     = TopoDS::Edge( edge );
+    task._edgeID   = sm->GetId();
+    task._reversed = isReversed( theMesh, task._edge, task._edgeID );
+    task._isOK     = false;
+    task.Save( *this );
+  }
+  if ( tasks.size() < 2 )
+    return;
+
+  SMDS_ParallelForBlocks( tasks.size(), [&]( size_t iBeg, size_t iEnd )
+  {
+    StdMeshers_Regular_1D algo( -1, /*gen=*/nullptr ); // not to modify this algo
+    for ( size_t i = iBeg; i < iEnd; ++i )
+    {
+      TEdgeTask& task = tasks[ i ];
+      TopoDS_Edge E = TopoDS::Edge( task._edge.Oriented( TopAbs_FORWARD ));
+      double f, l;
+      Handle(Geom_Curve) curve = BRep_Tool::Curve( E, f, l );
+      double length = EdgeLength( E );
+      if ( curve.IsNull() || length <= 0 )
+        continue;
+
+      task.Load( algo );
+      BRepAdaptor_Curve C3d( E );
+      task._isOK = algo.computeInternalParameters( theMesh, C3d, length, f, l,
+                                                   task._params, task._reversed );
+    }
+  });
+
+  // Compute() will re-compute parameters on failed EDGEs to report an error
+  for ( TEdgeTask& task : tasks )
+    if ( task._isOK )
+      _edgeParams[ task._edgeID ].swap( task._params );
+}
+
 //=============================================================================
 /*!
  *
@@ -1401,27 +1569,16 @@ bool StdMeshers_Regular_1D::Compute(SMESH_Mesh & theMesh, const TopoDS_Shape & t
   if ( !Curve.IsNull() && length > 0 )
   {
     list< double > params;
-    bool reversed = false;
-    if ( theMesh.GetShapeToMesh().ShapeType() >= TopAbs_WIRE && _revEdgesIDs.empty() ) {
-      // if the shape to mesh is WIRE or EDGE
-      reversed = ( EE.Orientation() == TopAbs_REVERSED );
-    }
-    if ( !_mainEdge.IsNull() ) {
-      // take into account reversing the edge the hypothesis is propagated from
-      // (_mainEdge.Orientation() marks mutual orientation of EDGEs in propagation chain)
-      reversed = ( _mainEdge.Orientation() == TopAbs_REVERSED );
-      if ( _hypType != DISTRIB_PROPAGATION ) {
-        int mainID = meshDS->ShapeToIndex(_mainEdge);
-        if ( std::find( _revEdgesIDs.begin(), _revEdgesIDs.end(), mainID) != _revEdgesIDs.end())
-          reversed = !reversed;
-      }
-    }
-    // take into account this edge reversing
-    if ( std::find( _revEdgesIDs.begin(), _revEdgesIDs.end(), shapeID) != _revEdgesIDs.end())
-      reversed = !reversed;
+    bool reversed = isReversed( theMesh, EE, shapeID );
 
     BRepAdaptor_Curve C3d( E );
-    if ( ! computeInternalParameters( theMesh, C3d, length, f, l, params, reversed, true )) {
+    std::map< int, std::list< double > >::iterator id2params = _edgeParams.find( shapeID );
+    if ( id2params != _edgeParams.end() ) // computed by PrepareCompute()
+    {
+      params.swap( id2params->second );
+      _edgeParams.erase( id2params );
+    }
+    else if ( ! computeInternalParameters( theMesh, C3d, length, f, l, params, reversed, true )) {
       return false;
     }
     redistributeNearVertices( theMesh, C3d, length, params, VFirst, VLast );
@@ -39,6 +39,7 @@ class Adaptor3d_Curve;
 class StdMeshers_Adaptive1D;
 class StdMeshers_FixedPoints1D;
 class StdMeshers_SegmentLengthAroundVertex;
+class TopoDS_Edge;
 class TopoDS_Vertex;
 
 class STDMESHERS_EXPORT StdMeshers_Regular_1D: public SMESH_1D_Algo
@@ -57,6 +58,9 @@ public:
   virtual bool Evaluate(SMESH_Mesh & aMesh, const TopoDS_Shape & aShape,
                         MapShapeNbElems& aResMap);
 
+  virtual void PrepareCompute(SMESH_Mesh&                          aMesh,
+                              const std::vector< SMESH_subMesh* >& subMeshes);
+
   virtual void CancelCompute();
 
   virtual const std::list <const SMESHDS_Hypothesis *> &
@@ -114,6 +118,10 @@ protected:
                       int nbSegments,
                       bool theReverse);
 
+  bool isReversed( SMESH_Mesh& theMesh, const TopoDS_Edge& theEdge, int theEdgeID ) const;
+
+  bool isParallelizable() const;
+
   /*!
    * \brief Return StdMeshers_SegmentLengthAroundVertex assigned to vertex
    */
@@ -160,6 +168,11 @@ protected:
   // a source of propagated hypothesis, is set by CheckHypothesis()
   // always called before Compute()
   TopoDS_Shape _mainEdge;
+
+  // node parameters on EDGEs computed by PrepareCompute(), by EDGE ID
+  std::map< int, std::list< double > > _edgeParams;
+
+  struct TEdgeTask;
 };
 
 #endif
@@ -839,6 +839,13 @@ QFrame* StdMeshersGUI_CartesianParamCreator::buildFrame()
   myQuanta->RangeStepAndValidator( 1e-6, 1, 0.05, "length_precision" );
   myQuanta->setEnabled(false);
   argGroupLayout->addWidget( myQuanta, row, 1 );  
+  row++;
+
+  argGroupLayout->addWidget( new QLabel( tr("OCTREE_LEVELS"), GroupC1 ), row, 0 );
+  myOctreeLevels = new SalomeApp_IntSpinBox( GroupC1 );
+  myOctreeLevels->setMinimum( 0 );
+  myOctreeLevels->setMaximum( 10 );
+  argGroupLayout->addWidget( myOctreeLevels, row, 1 );
   fr->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
   fr->setLayout(argGroupLayout);
   row++;
@@ -1031,6 +1038,7 @@ void StdMeshersGUI_CartesianParamCreator::retrieveParams() const
   myQuanta->setValue( h->GetQuanta() );
   if (h->GetToUseQuanta())
     myQuanta->setEnabled(true);
+  myOctreeLevels->setValue( h->GetOctreeLevels() );
 
   // grid definition
   for ( int ax = 0; ax < 3; ++ax )
@@ -1123,6 +1131,7 @@ QString StdMeshersGUI_CartesianParamCreator::storeParams() const
     h->SetToUseThresholdForInternalFaces( myUseThresholdForInternalFaces->isChecked() );
     h->SetToUseQuanta( mySetQuanta->isChecked() );
     h->SetQuanta( myQuanta->text().toDouble() );
+    h->SetOctreeLevels( myOctreeLevels->value() );
 
     // grid
     for ( int ax = 0; ax < 3; ++ax )
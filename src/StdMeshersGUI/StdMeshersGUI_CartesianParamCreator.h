@@ -54,6 +54,7 @@ class QTreeWidgetItem;
 class QWidget;
 class SMESHGUI_MeshEditPreview;
 class SMESHGUI_SpinBox;
+class SalomeApp_IntSpinBox;
 
 namespace StdMeshersGUI
 {
@@ -158,6 +159,7 @@ private:
   QCheckBox*                  myUseThresholdForInternalFaces;
   QCheckBox*                  mySetQuanta;
   SMESHGUI_SpinBox*           myQuanta;
+  SalomeApp_IntSpinBox*       myOctreeLevels;
 
   StdMeshersGUI::GridAxisTab* myAxisTabs[3];
   QGroupBox*                  myFixedPointGrp;
@@ -602,6 +602,10 @@ Consider creating another hypothesis instead of using this one for this mesh/sub
         <source>QUANTA_VALUE</source>
         <translation>Quanta Value</translation>
     </message>
+    <message>
+        <source>OCTREE_LEVELS</source>
+        <translation>Octree Levels</translation>
+    </message>
     <message>
         <source>AXIS_X</source>
         <translation>Axis X</translation>
@@ -578,6 +578,10 @@ Veuillez plutôt créer une autre hypothèse à la place de celle-ci pour ce mai
         <source>QUANTA_VALUE</source>
         <translation>Valeur Quanta</translation>
     </message>
+    <message>
+        <source>OCTREE_LEVELS</source>
+        <translation>Niveaux d&apos;octree</translation>
+    </message>
     <message>
         <source>AXIS_X</source>
         <translation>Axe X</translation>
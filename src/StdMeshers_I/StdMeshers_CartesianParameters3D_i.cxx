@@ -475,6 +475,38 @@ CORBA::Double StdMeshers_CartesianParameters3D_i::GetQuanta()
   return this->GetImpl()->GetQuanta();
 }
 
+//=============================================================================
+/*!
+ *  SetOctreeLevels
+ */
+//=============================================================================
+
+void StdMeshers_CartesianParameters3D_i::SetOctreeLevels(CORBA::Short nbLevels)
+{
+  ASSERT( myBaseImpl );
+  if ( GetOctreeLevels() == nbLevels )
+    return;
+  try {
+    this->GetImpl()->SetOctreeLevels( nbLevels );
+  }
+  catch ( SALOME_Exception& S_ex ) {
+    THROW_SALOME_CORBA_EXCEPTION( S_ex.what(), SALOME::BAD_PARAM );
+  }
+  // Update Python script
+  SMESH::TPythonDump() << _this() << ".SetOctreeLevels( " << nbLevels << " )";
+}
+
+//=============================================================================
+/*!
+ *  GetOctreeLevels
+ */
+//=============================================================================
+
+CORBA::Short StdMeshers_CartesianParameters3D_i::GetOctreeLevels()
+{
+  return this->GetImpl()->GetOctreeLevels();
+}
+
 //=======================================================================
 //function : IsGridBySpacing
 //purpose  : Return true if the grid is defined by spacing functions and
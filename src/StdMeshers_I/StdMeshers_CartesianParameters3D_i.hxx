@@ -137,6 +137,12 @@ class STDMESHERS_I_EXPORT StdMeshers_CartesianParameters3D_i:
   void SetQuanta(CORBA::Double quanta);
   CORBA::Double GetQuanta();
 
+  /*!
+   * Set number of levels of cell coarsening away from the geometry boundary
+   */
+  void SetOctreeLevels(CORBA::Short nbLevels);
+  CORBA::Short GetOctreeLevels();
+
   /*!
    * \brief Return true if the grid is defined by spacing functions and
    *        not by node coordinates
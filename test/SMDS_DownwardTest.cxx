@@ -0,0 +1,426 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_DownwardTest.cxx (unit test)
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// smesh
+#include "SMDS_Downward.hxx"
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+#include "SMDS_UnstructuredGrid.hxx"
+#include "SMDS_VolumeTool.hxx"
+
+namespace
+{
+  typedef std::vector< const SMDS_MeshNode* > TNodes;
+  typedef std::vector< int >                  TKey; // sorted vtk IDs of corner nodes
+
+  //! Build a mesh of n*n*n cubes split into volumes of different types
+  class TMixedMeshBuilder
+  {
+  public:
+    TMixedMeshBuilder( SMDS_Mesh& mesh, int n, bool quadratic )
+      : myMesh( mesh ), myN( n ), myQuadratic( quadratic )
+    {
+      for ( int k = 0; k <= n; ++k )
+        for ( int j = 0; j <= n; ++j )
+          for ( int i = 0; i <= n; ++i )
+            myGrid.push_back( mesh.AddNode( i, j, k ));
+
+      for ( int k = 0; k < n; ++k )
+        for ( int j = 0; j < n; ++j )
+          for ( int i = 0; i < n; ++i )
+          {
+            const SMDS_MeshNode* c[8] = { node( i, j,   k   ), node( i, j+1, k   ),
+                                          node( i+1, j+1, k ), node( i+1, j, k   ),
+                                          node( i, j,   k+1 ), node( i, j+1, k+1 ),
+                                          node( i+1, j+1, k+1 ), node( i+1, j, k+1 ) };
+            switch ( k % 4 ) {
+            case 0: // hexahedron, its bottom is a mesh face in the first layer
+            {
+              addVolume({ c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7] });
+              if ( k == 0 )
+                addFace({ c[0], c[1], c[2], c[3] });
+              break;
+            }
+            case 1: // 6 pyramids with the apex at the cube center
+            {
+              const SMDS_MeshNode* apex = mesh.AddNode( i + 0.5, j + 0.5, k + 0.5 );
+              const int quads[6][4] = {{ 0,1,2,3 }, { 4,7,6,5 }, { 0,4,5,1 },
+                                       { 1,5,6,2 }, { 2,6,7,3 }, { 3,7,4,0 }};
+              for ( int f = 0; f < 6; ++f )
+                addVolume({ c[ quads[f][0]], c[ quads[f][1]], c[ quads[f][2]], c[ quads[f][3]], apex });
+              break;
+            }
+            case 2: // 2 prisms
+            {
+              addVolume({ c[0], c[1], c[2], c[4], c[5], c[6] });
+              addVolume({ c[0], c[2], c[3], c[4], c[6], c[7] });
+              break;
+            }
+            case 3: // 2 prisms split into 3 tetrahedra each
+            {
+              const int prisms[2][6] = {{ 0,1,2,4,5,6 }, { 0,2,3,4,6,7 }};
+              for ( int p = 0; p < 2; ++p )
+              {
+                const SMDS_MeshNode* a = c[ prisms[p][0]], *b = c[ prisms[p][1]], *d = c[ prisms[p][2]];
+                const SMDS_MeshNode* e = c[ prisms[p][3]], *f = c[ prisms[p][4]], *g = c[ prisms[p][5]];
+                addVolume({ a, b, d, e });
+                addVolume({ b, d, e, f });
+                addVolume({ d, e, f, g });
+              }
+              break;
+            }
+            }
+          }
+    }
+
+  private:
+
+    const SMDS_MeshNode* node( int i, int j, int k ) const
+    {
+      return myGrid[ i + ( myN + 1 ) * ( j + ( myN + 1 ) * k )];
+    }
+
+    //! Return a medium node of a link
+    const SMDS_MeshNode* middle( const SMDS_MeshNode* n1, const SMDS_MeshNode* n2 )
+    {
+      std::pair< smIdType, smIdType > link( std::min( n1->GetID(), n2->GetID() ),
+                                            std::max( n1->GetID(), n2->GetID() ));
+      const SMDS_MeshNode* & n12 = myMiddles[ link ];
+      if ( !n12 )
+        n12 = myMesh.AddNode( 0.5 * ( n1->X() + n2->X() ),
+                              0.5 * ( n1->Y() + n2->Y() ),
+                              0.5 * ( n1->Z() + n2->Z() ));
+      return n12;
+    }
+
+    //! Add medium nodes of given links to corner nodes
+    void addMiddles( TNodes& nodes, const int links[][2], int nbLinks )
+    {
+      if ( !myQuadratic )
+        return;
+      const TNodes corners = nodes;
+      for ( int i = 0; i < nbLinks; ++i )
+        nodes.push_back( middle( corners[ links[i][0]], corners[ links[i][1]] ));
+    }
+
+    void addFace( TNodes n )
+    {
+      const int links[4][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 }};
+      addMiddles( n, links, 4 );
+      if ( myQuadratic )
+        myMesh.AddFace( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7] );
+      else
+        myMesh.AddFace( n[0], n[1], n[2], n[3] );
+    }
+
+    void addVolume( TNodes n )
+    {
+      switch ( n.size() ) {
+      case 4:
+      {
+        const int links[6][2] = {{ 0,1 }, { 1,2 }, { 2,0 }, { 0,3 }, { 1,3 }, { 2,3 }};
+        addMiddles( n, links, 6 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3] );
+        break;
+      }
+      case 5:
+      {
+        const int links[8][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 },
+                                 { 0,4 }, { 1,4 }, { 2,4 }, { 3,4 }};
+        addMiddles( n, links, 8 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4] );
+        break;
+      }
+      case 6:
+      {
+        const int links[9][2] = {{ 0,1 }, { 1,2 }, { 2,0 }, { 3,4 }, { 4,5 }, { 5,3 },
+                                 { 0,3 }, { 1,4 }, { 2,5 }};
+        addMiddles( n, links, 9 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12], n[13], n[14] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5] );
+        break;
+      }
+      case 8:
+      {
+        const int links[12][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 }, { 4,5 }, { 5,6 },
+                                  { 6,7 }, { 7,4 }, { 0,4 }, { 1,5 }, { 2,6 }, { 3,7 }};
+        addMiddles( n, links, 12 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12], n[13], n[14], n[15], n[16], n[17], n[18], n[19] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7] );
+        break;
+      }
+      }
+    }
+
+    SMDS_Mesh&                                               myMesh;
+    int                                                      myN;
+    bool                                                     myQuadratic;
+    TNodes                                                   myGrid;
+    std::map< std::pair< smIdType, smIdType >, const SMDS_MeshNode* > myMiddles;
+  };
+
+  //! Facet of volumes found by comparing nodes of all facets of all volumes
+  struct TRefFacet
+  {
+    std::set< int > myNodes;   // vtk IDs of all nodes
+    std::set< int > myVolumes; // vtk IDs of volumes
+  };
+
+  //! Connectivity computed without downward connectivity, as a reference
+  struct TReference
+  {
+    std::map< TKey, TRefFacet >         myFacets;
+    std::map< int, std::set< TKey > >   myFacetsOfVolume;  // by volume vtk ID
+    std::map< TKey, std::set< TKey > >  myFacetsOfEdge;    // facets sharing an edge
+    std::map< TKey, std::set< int > >   myEdgeNodes;
+
+    TReference( const SMDS_Mesh& mesh )
+    {
+      SMDS_VolumeTool vTool;
+      for ( SMDS_VolumeIteratorPtr vIt = mesh.volumesIterator(); vIt->more(); )
+      {
+        const SMDS_MeshVolume* vol = vIt->next();
+        vTool.Set( vol );
+        const int step = vol->IsQuadratic() ? 2 : 1;
+        for ( int iF = 0; iF < vTool.NbFaces(); ++iF )
+        {
+          const SMDS_MeshNode** fNodes = vTool.GetFaceNodes( iF );
+          const int            nbNodes = vTool.NbFaceNodes( iF );
+          TKey key;
+          std::set< int > allNodes;
+          for ( int i = 0; i < nbNodes; ++i )
+          {
+            allNodes.insert( (int) fNodes[i]->GetVtkID() );
+            if ( i % step == 0 )
+              key.push_back( (int) fNodes[i]->GetVtkID() );
+          }
+          std::sort( key.begin(), key.end() );
+
+          TRefFacet& facet = myFacets[ key ];
+          facet.myNodes = allNodes;
+          facet.myVolumes.insert( (int) vol->GetVtkID() );
+          myFacetsOfVolume[ (int) vol->GetVtkID() ].insert( key );
+
+          for ( int i = 0; i < nbNodes; i += step )
+          {
+            const SMDS_MeshNode* n1 = fNodes[ i ];
+            const SMDS_MeshNode* n2 = fNodes[( i + step ) % nbNodes ];
+            TKey edgeKey = { (int) std::min( n1->GetVtkID(), n2->GetVtkID() ),
+                             (int) std::max( n1->GetVtkID(), n2->GetVtkID() ) };
+            myFacetsOfEdge[ edgeKey ].insert( key );
+            std::set< int >& edgeNodes = myEdgeNodes[ edgeKey ];
+            edgeNodes.insert( (int) n1->GetVtkID() );
+            edgeNodes.insert( (int) n2->GetVtkID() );
+            if ( step == 2 )
+              edgeNodes.insert( (int) fNodes[ i + 1 ]->GetVtkID() );
+          }
+        }
+      }
+    }
+  };
+
+  //! Return corner nodes of a face or an edge of downward connectivity
+  TKey cornerKey( const std::set< int >& nodes, const std::set< int >& allCorners )
+  {
+    TKey key;
+    for ( int n : nodes )
+      if ( allCorners.count( n ))
+        key.push_back( n );
+    return key; // sorted as taken from a set
+  }
+
+  //! Compare downward connectivity of a mesh with the reference
+  void checkConnectivity( SMDS_Mesh& mesh, const std::string& test )
+  {
+    TReference ref( mesh );
+
+    std::set< int > corners; // vtk IDs of corner nodes
+    for ( const auto& key2facet : ref.myFacets )
+      corners.insert( key2facet.first.begin(), key2facet.first.end() );
+
+    SMDS_UnstructuredGrid* grid = mesh.GetGrid();
+    grid->BuildDownwardConnectivity( false );
+
+    int neighbors[ NBMAXNEIGHBORS ], downIds[ NBMAXNEIGHBORS ];
+    unsigned char downTypes[ NBMAXNEIGHBORS ];
+    std::set< std::pair< int, unsigned char > > checkedFaces, checkedEdges;
+
+    for ( SMDS_VolumeIteratorPtr vIt = mesh.volumesIterator(); vIt->more(); )
+    {
+      const SMDS_MeshVolume* vol = vIt->next();
+      const int            vtkId = (int) vol->GetVtkID();
+      const std::set< TKey >& refFacets = ref.myFacetsOfVolume[ vtkId ];
+
+      // neighbor volumes
+      std::set< int > refNeighbors;
+      for ( const TKey& key : refFacets )
+        for ( int v : ref.myFacets[ key ].myVolumes )
+          if ( v != vtkId )
+            refNeighbors.insert( v );
+
+      const int nbNeighbors = grid->GetNeighbors( neighbors, downIds, downTypes, vtkId );
+      std::set< int > foundNeighbors( neighbors, neighbors + nbNeighbors );
+      if ( foundNeighbors != refNeighbors )
+        throw std::runtime_error( "wrong neighbors of a volume in " + test );
+
+      // faces of the volume
+      const unsigned char vType = (unsigned char) grid->GetCellType( vtkId );
+      SMDS_Downward*    volDown = grid->getDownArray( vType );
+      const int       volDownId = grid->CellIdToDownId( vtkId );
+      const int           nbDown = volDown->getNumberOfDownCells( volDownId );
+      const int*          fIds   = volDown->getDownCells( volDownId );
+      const unsigned char* fTypes = volDown->getDownTypes( volDownId );
+      if ( nbDown != (int) refFacets.size() )
+        throw std::runtime_error( "wrong nb of faces of a volume in " + test );
+
+      for ( int iF = 0; iF < nbDown; ++iF )
+      {
+        std::set< int > fNodes;
+        SMDS_Downward* faceDown = grid->getDownArray( fTypes[ iF ]);
+        faceDown->getNodeIds( fIds[ iF ], fNodes );
+        const TKey key = cornerKey( fNodes, corners );
+        if ( !refFacets.count( key ))
+          throw std::runtime_error( "wrong face of a volume in " + test );
+        const TRefFacet& refFacet = ref.myFacets[ key ];
+        if ( fNodes != refFacet.myNodes )
+          throw std::runtime_error( "wrong nodes of a face in " + test );
+
+        if ( !checkedFaces.insert( std::make_pair( fIds[ iF ], fTypes[ iF ])).second )
+          continue;
+
+        // volumes sharing the face
+        const int nbUp = faceDown->getNumberOfUpCells( fIds[ iF ]);
+        const int* upIds = faceDown->getUpCells( fIds[ iF ]);
+        const unsigned char* upTypes = faceDown->getUpTypes( fIds[ iF ]);
+        std::set< int > upVolumes;
+        for ( int i = 0; i < nbUp; ++i )
+          upVolumes.insert( grid->getDownArray( upTypes[i] )->getVtkCellId( upIds[i] ));
+        if ( upVolumes != refFacet.myVolumes )
+          throw std::runtime_error( "wrong volumes of a face in " + test );
+
+        // edges of the face
+        const int nbEdges = faceDown->getNumberOfDownCells( fIds[ iF ]);
+        const int* eIds = faceDown->getDownCells( fIds[ iF ]);
+        const unsigned char* eTypes = faceDown->getDownTypes( fIds[ iF ]);
+        if ( nbEdges != (int) key.size() )
+          throw std::runtime_error( "wrong nb of edges of a face in " + test );
+        for ( int iE = 0; iE < nbEdges; ++iE )
+        {
+          std::set< int > eNodes;
+          SMDS_Downward* edgeDown = grid->getDownArray( eTypes[ iE ]);
+          edgeDown->getNodeIds( eIds[ iE ], eNodes );
+          const TKey edgeKey = cornerKey( eNodes, corners );
+          if ( !ref.myFacetsOfEdge.count( edgeKey ) || eNodes != ref.myEdgeNodes[ edgeKey ])
+            throw std::runtime_error( "wrong nodes of an edge in " + test );
+
+          if ( !checkedEdges.insert( std::make_pair( eIds[ iE ], eTypes[ iE ])).second )
+            continue;
+          if ( edgeDown->getNumberOfUpCells( eIds[ iE ]) != (int) ref.myFacetsOfEdge[ edgeKey ].size() )
+            throw std::runtime_error( "wrong nb of faces sharing an edge in " + test );
+        }
+      }
+    }
+    if ( checkedFaces.size() != ref.myFacets.size() )
+      throw std::runtime_error( "wrong nb of faces in " + test );
+    if ( checkedEdges.size() != ref.myFacetsOfEdge.size() )
+      throw std::runtime_error( "wrong nb of edges in " + test );
+
+    // mesh faces are found among faces of volumes
+    int volumes[ NBMAXNEIGHBORS ];
+    for ( SMDS_FaceIteratorPtr fIt = mesh.facesIterator(); fIt->more(); )
+    {
+      const SMDS_MeshFace* face = fIt->next();
+      const int           vtkId = (int) face->GetVtkID();
+      if ( grid->CellIdToDownId( vtkId ) < 0 )
+        throw std::runtime_error( "no downward face of a mesh face in " + test );
+
+      TKey key;
+      for ( int i = 0; i < face->NbCornerNodes(); ++i )
+        key.push_back( (int) face->GetNode( i )->GetVtkID() );
+      std::sort( key.begin(), key.end() );
+
+      const int nbVolumes = grid->GetParentVolumes( volumes, vtkId );
+      if ( std::set< int >( volumes, volumes + nbVolumes ) != ref.myFacets[ key ].myVolumes )
+        throw std::runtime_error( "wrong parent volumes of a mesh face in " + test );
+    }
+  }
+}
+
+bool testLinearMesh()
+{
+  SMDS_Mesh mesh;
+  TMixedMeshBuilder( mesh, 4, /*quadratic=*/false );
+  checkConnectivity( mesh, "testLinearMesh()\n" );
+  return true;
+}
+
+bool testQuadraticMesh()
+{
+  SMDS_Mesh mesh;
+  TMixedMeshBuilder( mesh, 4, /*quadratic=*/true );
+  checkConnectivity( mesh, "testQuadraticMesh()\n" );
+  return true;
+}
+
+bool testTiming()
+{
+  SMDS_Mesh mesh;
+  TMixedMeshBuilder( mesh, 40, /*quadratic=*/false );
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  mesh.GetGrid()->BuildDownwardConnectivity( false );
+  std::chrono::duration< double > time = std::chrono::steady_clock::now() - start;
+
+  std::cout << "BuildDownwardConnectivity() of " << mesh.NbVolumes() << " volumes: "
+            << time.count() << " s" << std::endl;
+  return true;
+}
+
+int main()
+{
+  if ( !testLinearMesh() || !testQuadraticMesh() || !testTiming() )
+    return 1;
+
+  return 0;
+}
@@ -0,0 +1,233 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_ElementRangeTest.cxx (unit test)
+
+// std
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// smesh
+#include "SMDS_ElementRange.hxx"
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+
+namespace
+{
+  //! Return elements in the order of an iterator
+  template< class ITERATOR_PTR >
+  std::vector< const SMDS_MeshElement* > iterated( ITERATOR_PTR it )
+  {
+    std::vector< const SMDS_MeshElement* > elems;
+    while ( it->more() )
+      elems.push_back( it->next() );
+    return elems;
+  }
+
+  //! Return elements in the order of a range
+  template< class RANGE >
+  std::vector< const SMDS_MeshElement* > ranged( const RANGE& range )
+  {
+    std::vector< const SMDS_MeshElement* > elems;
+    for ( auto e : range )
+      elems.push_back( e );
+    return elems;
+  }
+
+  //! Return elements of a range visited by SMDS_ParallelForEach(), in the order of IDs
+  template< class RANGE >
+  std::vector< const SMDS_MeshElement* > parallelRanged( const RANGE& range, smIdType maxID )
+  {
+    std::vector< const SMDS_MeshElement* > byID( maxID + 1, nullptr );
+    std::vector< int >                     nbVisits( maxID + 1, 0 );
+    SMDS_ParallelForEach( range, [&]( const SMDS_MeshElement* e )
+                          {
+                            byID    [ e->GetID() ] = e; // each element writes its own item
+                            nbVisits[ e->GetID() ]++;
+                          });
+    std::vector< const SMDS_MeshElement* > elems;
+    for ( size_t id = 0; id < byID.size(); ++id )
+    {
+      if ( nbVisits[ id ] > 1 )
+        throw std::runtime_error( "an element visited twice by SMDS_ParallelForEach()\n" );
+      if ( byID[ id ])
+        elems.push_back( byID[ id ]);
+    }
+    return elems;
+  }
+
+  //! Create nodes and triangles and quadrangles on them, each element type
+  //  occupying several chunks, then remove some of them to make holes
+  void makeMesh( SMDS_Mesh& mesh )
+  {
+    const int nbX = 100, nbY = 50; // 5000 nodes, 4900 faces, more than 1024 per chunk
+    std::vector< const SMDS_MeshNode* > nodes;
+    for ( int j = 0; j < nbY; ++j )
+      for ( int i = 0; i < nbX; ++i )
+        nodes.push_back( mesh.AddNode( i, j, 0 ));
+
+    for ( int j = 0; j < nbY - 1; ++j )
+      for ( int i = 0; i < nbX - 1; ++i )
+      {
+        const SMDS_MeshNode* n1 = nodes[ i + nbX * j ],      *n2 = nodes[ i + 1 + nbX * j ];
+        const SMDS_MeshNode* n3 = nodes[ i + 1 + nbX * (j+1) ], *n4 = nodes[ i + nbX * (j+1) ];
+        if (( i + j ) % 3 )
+          mesh.AddFace( n1, n2, n3, n4 );
+        else
+          mesh.AddFace( n1, n2, n3 );
+        if ( i == 0 )
+          mesh.AddEdge( n1, n4 );
+      }
+
+    // remove every 7th face and a block of faces filling a chunk
+    std::vector< const SMDS_MeshElement* > toRemove;
+    for ( SMDS_ElemIteratorPtr fIt = mesh.elementsIterator( SMDSAbs_Face ); fIt->more(); )
+    {
+      const SMDS_MeshElement* f = fIt->next();
+      if ( f->GetID() % 7 == 0 || ( f->GetID() > 1500 && f->GetID() < 3000 ))
+        toRemove.push_back( f );
+    }
+    for ( const SMDS_MeshElement* f : toRemove )
+      mesh.RemoveFreeElement( f );
+
+    // remove free nodes
+    std::vector< const SMDS_MeshNode* > freeNodes;
+    for ( SMDS_NodeIteratorPtr nIt = mesh.nodesIterator(); nIt->more(); )
+    {
+      const SMDS_MeshNode* n = nIt->next();
+      if ( n->NbInverseElements() == 0 )
+        freeNodes.push_back( n );
+    }
+    if ( freeNodes.empty() )
+      throw std::runtime_error( "no free nodes in makeMesh()\n" );
+    for ( const SMDS_MeshNode* n : freeNodes )
+      mesh.RemoveNode( n );
+  }
+}
+
+bool testEmptyMesh()
+{
+  SMDS_Mesh mesh;
+  if ( mesh.nodesRange().begin() != mesh.nodesRange().end() ||
+       mesh.elementsRange().begin() != mesh.elementsRange().end() )
+    throw std::runtime_error( "range of an empty mesh is not empty in testEmptyMesh()\n" );
+
+  int nbVisited = 0;
+  SMDS_ParallelForEach( mesh.nodesRange(), [&]( const SMDS_MeshNode* ) { ++nbVisited; });
+  if ( nbVisited != 0 )
+    throw std::runtime_error( "node of an empty mesh visited in testEmptyMesh()\n" );
+  return true;
+}
+
+bool testRanges()
+{
+  SMDS_Mesh mesh;
+  makeMesh( mesh );
+
+  if ( ranged( mesh.nodesRange() ) != iterated( mesh.nodesIterator() ))
+    throw std::runtime_error( "nodesRange() differs from nodesIterator() in testRanges()\n" );
+
+  const SMDSAbs_ElementType types[] = { SMDSAbs_All, SMDSAbs_Edge, SMDSAbs_Face, SMDSAbs_Volume };
+  for ( SMDSAbs_ElementType type : types )
+    if ( ranged( mesh.elementsRange( type )) != iterated( mesh.elementsIterator( type )))
+      throw std::runtime_error( "elementsRange() differs from elementsIterator() in testRanges()\n" );
+
+  const SMDSAbs_EntityType entities[] = { SMDSEntity_Edge, SMDSEntity_Triangle,
+                                          SMDSEntity_Quadrangle, SMDSEntity_Tetra };
+  for ( SMDSAbs_EntityType entity : entities )
+    if ( ranged( mesh.elementEntityRange( entity )) != iterated( mesh.elementEntityIterator( entity )))
+      throw std::runtime_error( "elementEntityRange() differs from elementEntityIterator() in testRanges()\n" );
+
+  // sub-ranges by chunks cover the whole range
+  SMDS_ElemRange faces = mesh.elementsRange( SMDSAbs_Face );
+  if ( faces.ChunkEnd() - faces.ChunkBegin() < 3 )
+    throw std::runtime_error( "too few chunks in testRanges()\n" );
+  std::vector< const SMDS_MeshElement* > bySubRanges;
+  for ( int iChunk = faces.ChunkBegin(); iChunk < faces.ChunkEnd(); ++iChunk )
+  {
+    std::vector< const SMDS_MeshElement* > sub = ranged( faces.SubRange( iChunk, iChunk + 1 ));
+    bySubRanges.insert( bySubRanges.end(), sub.begin(), sub.end() );
+  }
+  if ( bySubRanges != ranged( faces ))
+    throw std::runtime_error( "sub-ranges differ from the range in testRanges()\n" );
+
+  // post-increment
+  SMDS_NodeRange nodes = mesh.nodesRange();
+  SMDS_NodeRange::iterator nIt = nodes.begin();
+  const SMDS_MeshNode* first = *nIt++;
+  if ( first != mesh.nodesIterator()->next() || *nIt == first )
+    throw std::runtime_error( "wrong post-increment in testRanges()\n" );
+
+  return true;
+}
+
+bool testParallelForEach()
+{
+  SMDS_Mesh mesh;
+  makeMesh( mesh );
+
+  if ( parallelRanged( mesh.nodesRange(), mesh.MaxNodeID() ) != iterated( mesh.nodesIterator() ))
+    throw std::runtime_error( "wrong nodes visited by SMDS_ParallelForEach()\n" );
+
+  if ( parallelRanged( mesh.elementsRange( SMDSAbs_Face ), mesh.MaxElementID() ) !=
+       iterated( mesh.elementsIterator( SMDSAbs_Face )))
+    throw std::runtime_error( "wrong faces visited by SMDS_ParallelForEach()\n" );
+
+  SMDS_EntityRange quads = mesh.elementEntityRange( SMDSEntity_Quadrangle );
+  if ( parallelRanged( quads.SubRange( quads.ChunkBegin() + 1, quads.ChunkEnd() ), mesh.MaxElementID() ) !=
+       ranged( quads.SubRange( quads.ChunkBegin() + 1, quads.ChunkEnd() )))
+    throw std::runtime_error( "wrong quadrangles visited by SMDS_ParallelForEach()\n" );
+
+  return true;
+}
+
+bool testParallelFor()
+{
+  for ( size_t nbItems : { 0, 1, 7, 100000 })
+  {
+    std::vector< size_t > squares( nbItems, 0 );
+    SMDS_ParallelFor( nbItems, [&]( size_t i ) { squares[ i ] = i * i; });
+    for ( size_t i = 0; i < nbItems; ++i )
+      if ( squares[ i ] != i * i )
+        throw std::runtime_error( "item not processed by SMDS_ParallelFor()\n" );
+
+    // blocks do not overlap and cover all items
+    std::vector< int > nbVisits( nbItems, 0 );
+    SMDS_ParallelForBlocks( nbItems, [&]( size_t begin, size_t end )
+                            {
+                              if ( begin >= end || end > nbItems )
+                                throw std::runtime_error( "wrong block of SMDS_ParallelForBlocks()\n" );
+                              for ( size_t i = begin; i < end; ++i )
+                                nbVisits[ i ]++;
+                            });
+    for ( size_t i = 0; i < nbItems; ++i )
+      if ( nbVisits[ i ] != 1 )
+        throw std::runtime_error( "item processed not once by SMDS_ParallelForBlocks()\n" );
+  }
+  return true;
+}
+
+int main()
+{
+  if ( !testEmptyMesh() || !testRanges() || !testParallelForEach() || !testParallelFor() )
+    return 1;
+
+  return 0;
+}
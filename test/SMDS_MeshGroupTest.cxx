@@ -0,0 +1,366 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_MeshGroupTest.cxx (unit test)
+
+// std
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// smesh
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshGroup.hxx"
+#include "SMDS_MeshNode.hxx"
+
+namespace
+{
+  //! Create nodes with IDs 1..nbNodes; X of a node is equal to its ID
+  void makeNodes( SMDS_Mesh& mesh, int nbNodes )
+  {
+    for ( int i = 1; i <= nbNodes; ++i )
+      mesh.AddNodeWithID( i, 0, 0, i );
+  }
+
+  //! Check that a group contains exactly given nodes and iterates them in ID order
+  void checkContents( const SMDS_MeshGroup&  group,
+                      const std::set< int >& ids,
+                      const std::string&     test )
+  {
+    if ( group.Extent() != (smIdType) ids.size() )
+      throw std::runtime_error( "wrong Extent() in " + test );
+    if ( group.IsEmpty() != ids.empty() )
+      throw std::runtime_error( "wrong IsEmpty() in " + test );
+
+    std::set< int >::const_iterator id = ids.begin();
+    for ( SMDS_ElemIteratorPtr eIt = group.GetElements(); eIt->more(); ++id )
+    {
+      const SMDS_MeshElement* e = eIt->next();
+      if ( id == ids.end() || e->GetID() != *id )
+        throw std::runtime_error( "wrong iteration in " + test );
+    }
+    if ( id != ids.end() )
+      throw std::runtime_error( "missing elements in iteration in " + test );
+
+    const SMDS_Mesh* mesh = group.GetMesh();
+    for ( SMDS_NodeIteratorPtr nIt = mesh->nodesIterator(); nIt->more(); )
+    {
+      const SMDS_MeshNode* n = nIt->next();
+      if ( group.Contains( n ) != (bool) ids.count( (int) n->GetID() ))
+        throw std::runtime_error( "wrong Contains() in " + test );
+    }
+  }
+
+  //! Return memory of a group allocated for storing IDs
+  size_t storageSize( const SMDS_MeshGroup& group )
+  {
+    return group.GetMemorySize() - sizeof( SMDS_MeshGroup );
+  }
+}
+
+bool testOutOfOrder()
+{
+  const std::string test = "testOutOfOrder()\n";
+  SMDS_Mesh mesh;
+  const int nbNodes = 300;
+  makeNodes( mesh, nbNodes );
+
+  SMDS_MeshGroup group( &mesh );
+  std::set< int > ids;
+
+  // add in the reversed order, so that all IDs except the first one are pending
+  for ( int i = nbNodes; i > 0; i -= 2 )
+  {
+    if ( !group.Add( mesh.FindNode( i )))
+      throw std::runtime_error( "Add() failed in " + test );
+    ids.insert( i );
+  }
+  if ( group.GetType() != SMDSAbs_Node )
+    throw std::runtime_error( "wrong type in " + test );
+  checkContents( group, ids, test );
+
+  // interleave IDs
+  for ( int i = 1; i <= nbNodes; i += 2 )
+  {
+    group.Add( mesh.FindNode( i ));
+    ids.insert( i );
+  }
+  checkContents( group, ids, test );
+  if ( group.Add( mesh.FindNode( 7 )))
+    throw std::runtime_error( "duplicate added in " + test );
+
+  // remove each third and re-add them
+  for ( int i = 3; i <= nbNodes; i += 3 )
+  {
+    if ( !group.Remove( mesh.FindNode( i )))
+      throw std::runtime_error( "Remove() failed in " + test );
+    ids.erase( i );
+  }
+  if ( group.Remove( mesh.FindNode( 3 )))
+    throw std::runtime_error( "removed twice in " + test );
+  checkContents( group, ids, test );
+
+  for ( int i = nbNodes - nbNodes % 3; i > 0; i -= 3 )
+  {
+    if ( !group.Add( mesh.FindNode( i )))
+      throw std::runtime_error( "Add() of a removed element failed in " + test );
+    ids.insert( i );
+  }
+  checkContents( group, ids, test );
+
+  // remove all; the group gets no type
+  for ( int i = 1; i <= nbNodes; ++i )
+    group.Remove( mesh.FindNode( i ));
+  ids.clear();
+  checkContents( group, ids, test );
+  if ( group.GetType() != SMDSAbs_All )
+    throw std::runtime_error( "type of an empty group in " + test );
+
+  return true;
+}
+
+bool testStorage()
+{
+  const std::string test = "testStorage()\n";
+  SMDS_Mesh mesh;
+  const int nbNodes = 10000;
+  makeNodes( mesh, nbNodes );
+
+  SMDS_MeshGroup group( &mesh );
+  std::set< int > ids;
+
+  // dense IDs are stored in a bit set
+  for ( int i = 1; i <= nbNodes; ++i )
+  {
+    group.Add( mesh.FindNode( i ));
+    ids.insert( i );
+  }
+  checkContents( group, ids, test );
+  const size_t bitSetSize = storageSize( group );
+  if ( bitSetSize > nbNodes / 8 * 2 )
+    throw std::runtime_error( "dense IDs are not stored in a bit set in " + test );
+
+  // each 50-th remain: a vector would take less memory, but not twice less,
+  // so the bit set is kept not to switch storage back and forth
+  for ( int i = 1; i <= nbNodes; ++i )
+    if ( i % 50 )
+    {
+      group.Remove( mesh.FindNode( i ));
+      ids.erase( i );
+    }
+  checkContents( group, ids, test );
+  if ( storageSize( group ) != bitSetSize )
+    throw std::runtime_error( "storage changed within hysteresis in " + test );
+
+  // each 1000-th remain: IDs are stored in a vector
+  for ( int i = 50; i <= nbNodes; i += 50 )
+    if ( i % 1000 )
+    {
+      group.Remove( mesh.FindNode( i ));
+      ids.erase( i );
+    }
+  checkContents( group, ids, test );
+  if ( storageSize( group ) >= bitSetSize / 2 )
+    throw std::runtime_error( "sparse IDs are not stored in a vector in " + test );
+
+  // each 50-th again; added out of order, so they are stored in the vector
+  for ( int i = nbNodes - 50; i > 0; i -= 50 )
+  {
+    group.Add( mesh.FindNode( i ));
+    ids.insert( i );
+  }
+  checkContents( group, ids, test );
+  if ( storageSize( group ) < ids.size() * sizeof( smIdType ))
+    throw std::runtime_error( "IDs are not stored in a vector in " + test );
+
+  // all again: a bit set is chosen when IDs are appended
+  for ( int i = 1; i <= nbNodes; ++i )
+  {
+    group.Add( mesh.FindNode( i ));
+    ids.insert( i );
+  }
+  checkContents( group, ids, test );
+  if ( storageSize( group ) > nbNodes / 8 * 2 )
+    throw std::runtime_error( "IDs are not stored in a bit set again in " + test );
+
+  // type mismatch
+  const SMDS_MeshNode* n = mesh.FindNode( 1 );
+  const SMDS_MeshElement* edge = mesh.AddEdge( n, mesh.FindNode( 2 ));
+  if ( group.Add( edge ) || group.Contains( edge ))
+    throw std::runtime_error( "element of other type added in " + test );
+
+  return true;
+}
+
+bool testCompact()
+{
+  const std::string test = "testCompact()\n";
+  SMDS_Mesh mesh;
+  const int nbNodes = 1000;
+  makeNodes( mesh, nbNodes );
+
+  // two groups to compact: of sparse IDs in a vector and of dense IDs in a bit set
+  SMDS_MeshGroup sparseGroup( &mesh ), denseGroup( &mesh );
+  for ( int i = 1; i <= nbNodes; ++i )
+  {
+    if ( i % 100 == 0 )
+      sparseGroup.Add( mesh.FindNode( i ));
+    if ( i % 2 == 0 )
+      denseGroup.Add( mesh.FindNode( i ));
+  }
+  // add out of order to have pending IDs at compacting
+  sparseGroup.Add( mesh.FindNode( 555 ));
+
+  // remove the first nodes, then compacting renumbers nodes
+  const int nbRemoved = 100;
+  for ( int i = 1; i <= nbRemoved; ++i )
+  {
+    const SMDS_MeshNode* n = mesh.FindNode( i );
+    sparseGroup.Remove( n );
+    denseGroup.Remove( n );
+    mesh.RemoveNode( n );
+  }
+  mesh.CompactMesh();
+
+  std::set< int > sparseIDs, denseIDs;
+  for ( int i = nbRemoved + 1; i <= nbNodes; ++i )
+  {
+    if ( i % 100 == 0 || i == 555 )
+      sparseIDs.insert( i - nbRemoved );
+    if ( i % 2 == 0 )
+      denseIDs.insert( i - nbRemoved );
+  }
+  checkContents( sparseGroup, sparseIDs, test );
+  checkContents( denseGroup, denseIDs, test );
+
+  // the groups refer to the same nodes as before
+  for ( SMDS_ElemIteratorPtr eIt = denseGroup.GetElements(); eIt->more(); )
+  {
+    const SMDS_MeshNode* n = static_cast< const SMDS_MeshNode* >( eIt->next() );
+    if ( n->X() != n->GetID() + nbRemoved )
+      throw std::runtime_error( "wrong node after compacting in " + test );
+  }
+  if ( storageSize( denseGroup ) > nbNodes / 8 * 2 )
+    throw std::runtime_error( "dense IDs are not stored in a bit set in " + test );
+
+  return true;
+}
+
+bool testMove()
+{
+  const std::string test = "testMove()\n";
+  SMDS_Mesh mesh;
+  const int nbNodes = 200;
+  makeNodes( mesh, nbNodes );
+
+  SMDS_MeshGroup group1( &mesh ), group2( &mesh );
+  std::set< int > ids;
+  for ( int i = nbNodes; i > 0; i -= 3 )
+  {
+    group1.Add( mesh.FindNode( i ));
+    ids.insert( i );
+  }
+  group2.Add( mesh.FindNode( 2 ));
+
+  const int tic = group2.Tic();
+  group2 = std::move( group1 );
+  checkContents( group2, ids, test );
+  checkContents( group1, std::set< int >(), test );
+  if ( group2.Tic() == tic )
+    throw std::runtime_error( "Tic() not changed in " + test );
+
+  // the emptied group can be filled again
+  group1.Add( mesh.FindNode( 2 ));
+  checkContents( group1, std::set< int >{ 2 }, test );
+  checkContents( group2, ids, test );
+
+  return true;
+}
+
+bool testFreedElements()
+{
+  const std::string test = "testFreedElements()\n";
+  SMDS_Mesh mesh;
+  const int nbNodes = 200;
+  makeNodes( mesh, nbNodes );
+
+  // nodes stored in a vector and in a bit set
+  SMDS_MeshGroup sparseGroup( &mesh ), denseGroup( &mesh );
+  std::set< int > sparseIDs, denseIDs;
+  for ( int i = 1; i <= nbNodes; ++i )
+  {
+    if ( i % 10 == 1 )
+    {
+      sparseGroup.Add( mesh.FindNode( i ));
+      sparseIDs.insert( i );
+    }
+    denseGroup.Add( mesh.FindNode( i ));
+    denseIDs.insert( i );
+  }
+
+  // faces on nodes 1-2-3 and 2-3-4
+  mesh.AddFaceWithID( 1, 2, 3, nbNodes + 1 );
+  mesh.AddFaceWithID( 2, 3, 4, nbNodes + 2 );
+  SMDS_MeshGroup faceGroup( &mesh );
+  faceGroup.Add( mesh.FindElement( nbNodes + 1 ));
+  faceGroup.Add( mesh.FindElement( nbNodes + 2 ));
+
+  // free nodes not via SMDS_MeshGroup::Remove(); node 1 is freed with its face
+  for ( int i = 1; i <= nbNodes; i += 5 )
+  {
+    if ( i == 1 )
+      mesh.RemoveNode( mesh.FindNode( i ));
+    else
+      mesh.RemoveFreeElement( mesh.FindNode( i ));
+    sparseIDs.erase( i );
+    denseIDs.erase( i );
+  }
+  checkContents( sparseGroup, sparseIDs, test );
+  checkContents( denseGroup,  denseIDs,  test );
+  if ( faceGroup.Extent() != 1 || faceGroup.GetElements()->next()->GetID() != nbNodes + 2 )
+    throw std::runtime_error( "face of a freed node is kept in " + test );
+
+  // new elements re-using IDs of freed ones are not in groups
+  for ( int i = 1; i <= nbNodes; i += 5 )
+    mesh.AddNodeWithID( i, 0, 0, i );
+  mesh.AddFaceWithID( 1, 2, 3, nbNodes + 1 );
+  checkContents( sparseGroup, sparseIDs, test );
+  checkContents( denseGroup,  denseIDs,  test );
+  if ( faceGroup.Extent() != 1 || faceGroup.Contains( mesh.FindElement( nbNodes + 1 )))
+    throw std::runtime_error( "new face with ID of a freed one is in " + test );
+
+  // clearing the mesh empties groups
+  mesh.Clear();
+  checkContents( sparseGroup, std::set< int >(), test );
+  if ( !faceGroup.IsEmpty() )
+    throw std::runtime_error( "group is not empty after clearing the mesh in " + test );
+
+  return true;
+}
+
+int main()
+{
+  if ( !testOutOfOrder() || !testStorage() || !testCompact() || !testMove() ||
+       !testFreedElements() )
+    return 1;
+
+  return 0;
+}
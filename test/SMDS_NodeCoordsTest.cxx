@@ -0,0 +1,194 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_NodeCoordsTest.cxx (unit test)
+
+// std
+#include <iostream>
+#include <stdexcept>
+#include <set>
+#include <vector>
+
+// smesh
+#include "SMDS_ElementHolder.hxx"
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+#include "SMDS_NodeCoords.hxx"
+
+#include <Utils_SALOME_Exception.hxx>
+
+namespace
+{
+  //! Element holder counting notifications of modified nodes
+  struct TModifTracker : public SMDS_ElementHolder
+  {
+    std::set< const SMDS_MeshElement* > _modified;
+
+    TModifTracker( const SMDS_Mesh* mesh ): SMDS_ElementHolder( mesh ) { trackChanges( true ); }
+
+  protected:
+    virtual SMDS_ElemIteratorPtr getElements() { return SMDS_ElemIteratorPtr(); }
+    virtual void tmpClear() {}
+    virtual void add( const SMDS_MeshElement* ) {}
+    virtual void compact() {}
+    virtual void elementChanged( const SMDS_MeshElement* elem, TChange change )
+    {
+      if ( change == ELEM_MODIFIED )
+        _modified.insert( elem );
+    }
+  };
+
+  //! Create nodes and remove some of them to have vtk IDs with no nodes
+  std::vector< const SMDS_MeshNode* > makeNodes( SMDS_Mesh& mesh, int nbNodes )
+  {
+    std::vector< const SMDS_MeshNode* > nodes;
+    for ( int i = 0; i < nbNodes; ++i )
+      nodes.push_back( mesh.AddNode( i, 2 * i, 3 * i ));
+
+    std::vector< const SMDS_MeshNode* > kept;
+    for ( int i = 0; i < nbNodes; ++i )
+      if ( i % 5 == 1 )
+        mesh.RemoveNode( nodes[i] );
+      else
+        kept.push_back( nodes[i] );
+    return kept;
+  }
+
+  bool sameCoords( const SMDS_NodeCoords& coords, const SMDS_MeshNode* n )
+  {
+    return ( coords.X( n ) == n->X() && coords.Y( n ) == n->Y() && coords.Z( n ) == n->Z() );
+  }
+}
+
+bool testLoad()
+{
+  SMDS_NodeCoords empty;
+  if ( empty.Size() != 0 || empty.IsUpToDate() || empty.GetMesh() )
+    throw std::runtime_error( "wrong empty view in testLoad()\n" );
+
+  SMDS_Mesh mesh;
+  std::vector< const SMDS_MeshNode* > nodes = makeNodes( mesh, 3000 );
+
+  SMDS_NodeCoords coords( &mesh );
+  if ( !coords.IsUpToDate() || coords.GetMesh() != &mesh )
+    throw std::runtime_error( "new view is not up to date in testLoad()\n" );
+
+  for ( const SMDS_MeshNode* n : nodes )
+  {
+    if ( !sameCoords( coords, n ))
+      throw std::runtime_error( "wrong coordinates in testLoad()\n" );
+    if ( coords.Node( SMDS_NodeCoords::Index( n )) != n )
+      throw std::runtime_error( "wrong node by index in testLoad()\n" );
+    double xyz[3];
+    coords.GetXYZ( SMDS_NodeCoords::Index( n ), xyz );
+    const double* x = coords.XArray(), *y = coords.YArray(), *z = coords.ZArray();
+    const vtkIdType i = SMDS_NodeCoords::Index( n );
+    if ( xyz[0] != n->X() || xyz[1] != n->Y() || xyz[2] != n->Z() ||
+         x[i]   != n->X() || y[i]   != n->Y() || z[i]   != n->Z() )
+      throw std::runtime_error( "wrong coordinate arrays in testLoad()\n" );
+  }
+
+  // the view is out of date after any change of nodes
+  mesh.MoveNode( nodes[0], -1, -1, -1 );
+  if ( coords.IsUpToDate() )
+    throw std::runtime_error( "view is up to date after MoveNode() in testLoad()\n" );
+  coords.Load( &mesh );
+  if ( !coords.IsUpToDate() || coords.X( nodes[0] ) != -1 )
+    throw std::runtime_error( "view is not reloaded in testLoad()\n" );
+
+  mesh.AddNode( 0, 0, 0 );
+  if ( coords.IsUpToDate() )
+    throw std::runtime_error( "view is up to date after AddNode() in testLoad()\n" );
+
+  return true;
+}
+
+bool testMoveNodes()
+{
+  SMDS_Mesh mesh;
+  std::vector< const SMDS_MeshNode* > nodes = makeNodes( mesh, 3000 );
+  TModifTracker tracker( &mesh );
+
+  // change the view only
+  SMDS_NodeCoords coords( &mesh );
+  std::set< const SMDS_MeshElement* > moved;
+  for ( size_t i = 0; i < nodes.size(); i += 3 )
+  {
+    const vtkIdType index = SMDS_NodeCoords::Index( nodes[i] );
+    coords.SetXYZ( index, coords.X( index ) + 1, coords.Y( index ), -coords.Z( index ));
+    moved.insert( nodes[i] );
+  }
+  for ( size_t i = 0; i < nodes.size(); i += 3 )
+    if ( sameCoords( coords, nodes[i] ))
+      throw std::runtime_error( "SetXYZ() moved a node in testMoveNodes()\n" );
+  if ( !coords.IsUpToDate() || !tracker._modified.empty() )
+    throw std::runtime_error( "SetXYZ() changed the mesh in testMoveNodes()\n" );
+
+  // write the view to the mesh
+  const SMDS_NodeCoords changed = coords;
+  if ( mesh.MoveNodes( coords ) != (smIdType) moved.size() )
+    throw std::runtime_error( "wrong number of nodes moved in testMoveNodes()\n" );
+  for ( const SMDS_MeshNode* n : nodes )
+    if ( !sameCoords( changed, n ))
+      throw std::runtime_error( "node not moved by MoveNodes() in testMoveNodes()\n" );
+  if ( coords.IsUpToDate() )
+    throw std::runtime_error( "view is up to date after MoveNodes() in testMoveNodes()\n" );
+  if ( tracker._modified != moved )
+    throw std::runtime_error( "wrong nodes notified of by MoveNodes() in testMoveNodes()\n" );
+
+  // nothing to move
+  coords.Load( &mesh );
+  tracker._modified.clear();
+  if ( mesh.MoveNodes( coords ) != 0 || !tracker._modified.empty() )
+    throw std::runtime_error( "unchanged nodes moved in testMoveNodes()\n" );
+
+  // move given nodes
+  std::vector< const SMDS_MeshNode* > toMove = { nodes[1], nodes[2] };
+  std::vector< double > xyz = { 1, 2, 3, 4, 5, 6 };
+  mesh.MoveNodes( toMove, xyz );
+  if ( nodes[1]->X() != 1 || nodes[1]->Y() != 2 || nodes[1]->Z() != 3 ||
+       nodes[2]->X() != 4 || nodes[2]->Y() != 5 || nodes[2]->Z() != 6 )
+    throw std::runtime_error( "nodes not moved by MoveNodes( nodes, xyz ) in testMoveNodes()\n" );
+  if ( tracker._modified.size() != 2 )
+    throw std::runtime_error( "wrong notification by MoveNodes( nodes, xyz ) in testMoveNodes()\n" );
+
+  // errors
+  bool thrown = false;
+  try { xyz.pop_back(); mesh.MoveNodes( toMove, xyz ); }
+  catch ( const SALOME_Exception& ) { thrown = true; }
+  if ( !thrown )
+    throw std::runtime_error( "too few coordinates accepted in testMoveNodes()\n" );
+
+  SMDS_Mesh otherMesh;
+  makeNodes( otherMesh, 10 );
+  thrown = false;
+  try { mesh.MoveNodes( SMDS_NodeCoords( &otherMesh )); }
+  catch ( const SALOME_Exception& ) { thrown = true; }
+  if ( !thrown )
+    throw std::runtime_error( "view of other mesh accepted in testMoveNodes()\n" );
+
+  return true;
+}
+
+int main()
+{
+  if ( !testLoad() || !testMoveNodes() )
+    return 1;
+
+  return 0;
+}
@@ -0,0 +1,338 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_VolumeFacetIteratorTest.cxx (unit test)
+
+// std
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// smesh
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+#include "SMDS_VolumeTool.hxx"
+
+namespace
+{
+  typedef std::vector< const SMDS_MeshNode* > TNodes;
+
+  //! Build a mesh of n*n*n cubes split into volumes of different types;
+  //! every other cube has volumes of reversed orientation
+  class TMixedMeshBuilder
+  {
+  public:
+    TMixedMeshBuilder( SMDS_Mesh& mesh, int n, bool quadratic )
+      : myMesh( mesh ), myN( n ), myQuadratic( quadratic )
+    {
+      for ( int k = 0; k <= n; ++k )
+        for ( int j = 0; j <= n; ++j )
+          for ( int i = 0; i <= n; ++i )
+            myGrid.push_back( mesh.AddNode( i, j, k ));
+
+      for ( int k = 0; k < n; ++k )
+        for ( int j = 0; j < n; ++j )
+          for ( int i = 0; i < n; ++i )
+          {
+            const SMDS_MeshNode* c[8] = { node( i, j,   k   ), node( i, j+1, k   ),
+                                          node( i+1, j+1, k ), node( i+1, j, k   ),
+                                          node( i, j,   k+1 ), node( i, j+1, k+1 ),
+                                          node( i+1, j+1, k+1 ), node( i+1, j, k+1 ) };
+            myReversed = ( i + j + k ) % 2;
+            switch ( k % 4 ) {
+            case 0: // hexahedron
+            {
+              addVolume({ c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7] });
+              break;
+            }
+            case 1: // 6 pyramids with the apex at the cube center
+            {
+              const SMDS_MeshNode* apex = mesh.AddNode( i + 0.5, j + 0.5, k + 0.5 );
+              const int quads[6][4] = {{ 0,1,2,3 }, { 4,7,6,5 }, { 0,4,5,1 },
+                                       { 1,5,6,2 }, { 2,6,7,3 }, { 3,7,4,0 }};
+              for ( int f = 0; f < 6; ++f )
+                addVolume({ c[ quads[f][0]], c[ quads[f][1]], c[ quads[f][2]], c[ quads[f][3]], apex });
+              break;
+            }
+            case 2: // 2 prisms
+            {
+              addVolume({ c[0], c[1], c[2], c[4], c[5], c[6] });
+              addVolume({ c[0], c[2], c[3], c[4], c[6], c[7] });
+              break;
+            }
+            case 3: // 2 prisms split into 3 tetrahedra each
+            {
+              const int prisms[2][6] = {{ 0,1,2,4,5,6 }, { 0,2,3,4,6,7 }};
+              for ( int p = 0; p < 2; ++p )
+              {
+                const SMDS_MeshNode* a = c[ prisms[p][0]], *b = c[ prisms[p][1]], *d = c[ prisms[p][2]];
+                const SMDS_MeshNode* e = c[ prisms[p][3]], *f = c[ prisms[p][4]], *g = c[ prisms[p][5]];
+                addVolume({ a, b, d, e });
+                addVolume({ b, d, e, f });
+                addVolume({ d, e, f, g });
+              }
+              break;
+            }
+            }
+          }
+    }
+
+    //! Add a tri-quadratic hexahedron and a polyhedron apart from the cubes
+    void addSpecialVolumes()
+    {
+      const double x0 = myN + 2;
+      TNodes n;
+      // corners, medium nodes of edges, centers of faces and the volume center
+      const double corners[8][3] = {{ 0,0,0 }, { 0,1,0 }, { 1,1,0 }, { 1,0,0 },
+                                    { 0,0,1 }, { 0,1,1 }, { 1,1,1 }, { 1,0,1 }};
+      const int links[12][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 }, { 4,5 }, { 5,6 },
+                                { 6,7 }, { 7,4 }, { 0,4 }, { 1,5 }, { 2,6 }, { 3,7 }};
+      const int faces[6][4] = {{ 0,1,2,3 }, { 0,1,5,4 }, { 1,2,6,5 },
+                               { 2,3,7,6 }, { 3,0,4,7 }, { 4,5,6,7 }};
+      for ( int i = 0; i < 8; ++i )
+        n.push_back( myMesh.AddNode( x0 + corners[i][0], corners[i][1], corners[i][2] ));
+      for ( int i = 0; i < 12; ++i )
+        n.push_back( center({ n[ links[i][0]], n[ links[i][1]] }));
+      for ( int i = 0; i < 6; ++i )
+        n.push_back( center({ n[ faces[i][0]], n[ faces[i][1]], n[ faces[i][2]], n[ faces[i][3]] }));
+      n.push_back( center({ n[0], n[6] }));
+      myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                        n[10], n[11], n[12], n[13], n[14], n[15], n[16], n[17], n[18], n[19],
+                        n[20], n[21], n[22], n[23], n[24], n[25], n[26] );
+
+      // a tetrahedron defined as a polyhedron
+      TNodes t = { myMesh.AddNode( x0 + 2, 0, 0 ), myMesh.AddNode( x0 + 3, 0, 0 ),
+                   myMesh.AddNode( x0 + 2, 1, 0 ), myMesh.AddNode( x0 + 2, 0, 1 )};
+      TNodes polyNodes = { t[0], t[2], t[1],  t[0], t[1], t[3],  t[1], t[2], t[3],  t[2], t[0], t[3] };
+      myMesh.AddPolyhedralVolume( polyNodes, std::vector< int >( 4, 3 ));
+    }
+
+  private:
+
+    const SMDS_MeshNode* node( int i, int j, int k ) const
+    {
+      return myGrid[ i + ( myN + 1 ) * ( j + ( myN + 1 ) * k )];
+    }
+
+    //! Return a new node at the center of given ones
+    const SMDS_MeshNode* center( const TNodes& nodes )
+    {
+      double xyz[3] = { 0, 0, 0 };
+      for ( const SMDS_MeshNode* n : nodes )
+      {
+        xyz[0] += n->X() / nodes.size();
+        xyz[1] += n->Y() / nodes.size();
+        xyz[2] += n->Z() / nodes.size();
+      }
+      return myMesh.AddNode( xyz[0], xyz[1], xyz[2] );
+    }
+
+    //! Return a medium node of a link
+    const SMDS_MeshNode* middle( const SMDS_MeshNode* n1, const SMDS_MeshNode* n2 )
+    {
+      std::pair< smIdType, smIdType > link( std::min( n1->GetID(), n2->GetID() ),
+                                            std::max( n1->GetID(), n2->GetID() ));
+      const SMDS_MeshNode* & n12 = myMiddles[ link ];
+      if ( !n12 )
+        n12 = center({ n1, n2 });
+      return n12;
+    }
+
+    //! Add medium nodes of given links to corner nodes
+    void addMiddles( TNodes& nodes, const int links[][2], int nbLinks )
+    {
+      if ( !myQuadratic )
+        return;
+      const TNodes corners = nodes;
+      for ( int i = 0; i < nbLinks; ++i )
+        nodes.push_back( middle( corners[ links[i][0]], corners[ links[i][1]] ));
+    }
+
+    void addVolume( TNodes n )
+    {
+      switch ( n.size() ) {
+      case 4:
+      {
+        if ( myReversed )
+          std::swap( n[1], n[2] );
+        const int links[6][2] = {{ 0,1 }, { 1,2 }, { 2,0 }, { 0,3 }, { 1,3 }, { 2,3 }};
+        addMiddles( n, links, 6 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3] );
+        break;
+      }
+      case 5:
+      {
+        if ( myReversed )
+          std::swap( n[1], n[3] );
+        const int links[8][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 },
+                                 { 0,4 }, { 1,4 }, { 2,4 }, { 3,4 }};
+        addMiddles( n, links, 8 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4] );
+        break;
+      }
+      case 6:
+      {
+        if ( myReversed )
+          std::rotate( n.begin(), n.begin() + 3, n.end() ); // swap bottom and top
+        const int links[9][2] = {{ 0,1 }, { 1,2 }, { 2,0 }, { 3,4 }, { 4,5 }, { 5,3 },
+                                 { 0,3 }, { 1,4 }, { 2,5 }};
+        addMiddles( n, links, 9 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12], n[13], n[14] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5] );
+        break;
+      }
+      case 8:
+      {
+        if ( myReversed )
+          std::rotate( n.begin(), n.begin() + 4, n.end() ); // swap bottom and top
+        const int links[12][2] = {{ 0,1 }, { 1,2 }, { 2,3 }, { 3,0 }, { 4,5 }, { 5,6 },
+                                  { 6,7 }, { 7,4 }, { 0,4 }, { 1,5 }, { 2,6 }, { 3,7 }};
+        addMiddles( n, links, 12 );
+        if ( myQuadratic )
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], n[8], n[9],
+                            n[10], n[11], n[12], n[13], n[14], n[15], n[16], n[17], n[18], n[19] );
+        else
+          myMesh.AddVolume( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7] );
+        break;
+      }
+      }
+    }
+
+    SMDS_Mesh&                                               myMesh;
+    int                                                      myN;
+    bool                                                     myQuadratic;
+    bool                                                     myReversed;
+    TNodes                                                   myGrid;
+    std::map< std::pair< smIdType, smIdType >, const SMDS_MeshNode* > myMiddles;
+  };
+
+  //! Compare facets given by SMDS_VolumeFacetIterator with those of SMDS_VolumeTool
+  void compareFacets( const SMDS_Mesh& mesh, bool ignoreCentralNodes, const std::string& where )
+  {
+    // volumes to find facets of, polyhedra excluded
+    std::vector< const SMDS_MeshElement* > volumes;
+    int nbReversed = 0;
+    SMDS_VolumeTool vTool;
+    for ( SMDS_ElemIteratorPtr vIt = mesh.elementsIterator( SMDSAbs_Volume ); vIt->more(); )
+    {
+      const SMDS_MeshElement* vol = vIt->next();
+      if ( vol->IsPoly() )
+        continue;
+      volumes.push_back( vol );
+      vTool.Set( vol );
+      nbReversed += !vTool.IsForward();
+    }
+    if ( nbReversed == 0 || nbReversed == (int) volumes.size() )
+      throw std::runtime_error( "volumes of one orientation only in " + where );
+
+    size_t iVol = 0;
+    int  iFacet = 0, nbFree = 0, nbShared = 0;
+    for ( SMDS_VolumeFacetIterator fIt( mesh.elementsIterator( SMDSAbs_Volume ), ignoreCentralNodes );
+          fIt.more(); fIt.next() )
+    {
+      if ( iVol < volumes.size() && fIt.Volume() != volumes[ iVol ] )
+      {
+        ++iVol; // next volume
+        iFacet = 0;
+      }
+      if ( iVol >= volumes.size() || fIt.Volume() != volumes[ iVol ] || fIt.FacetIndex() != iFacet )
+        throw std::runtime_error( "wrong volume or facet order in " + where );
+
+      if ( iFacet == 0 && !vTool.Set( volumes[ iVol ], ignoreCentralNodes ))
+        throw std::runtime_error( "SMDS_VolumeTool not set in " + where );
+      if ( fIt.NbFacetNodes() != vTool.NbFaceNodes( iFacet ))
+        throw std::runtime_error( "wrong number of facet nodes in " + where );
+
+      // same nodes in same order, the last one being the first one
+      const SMDS_MeshNode** nn = fIt.FacetNodes(), **vnn = vTool.GetFaceNodes( iFacet );
+      if ( !std::equal( nn, nn + fIt.NbFacetNodes() + 1, vnn ))
+        throw std::runtime_error( "wrong facet nodes in " + where );
+
+      // external normal
+      if ( !vTool.IsFaceExternal( iFacet ))
+        throw std::runtime_error( "facet not external in " + where );
+
+      // free facets
+      const SMDS_MeshElement* otherVol = 0, *vToolOtherVol = 0;
+      const bool isFree = fIt.IsFree( &otherVol );
+      if ( isFree != vTool.IsFreeFace( iFacet, &vToolOtherVol ) || otherVol != vToolOtherVol )
+        throw std::runtime_error( "wrong IsFree() in " + where );
+      nbFree   += isFree;
+      nbShared += !isFree;
+
+      ++iFacet;
+    }
+    if ( iVol + 1 != volumes.size() || iFacet != vTool.NbFaces() )
+      throw std::runtime_error( "not all volumes iterated in " + where );
+    if ( nbFree == 0 || nbShared == 0 )
+      throw std::runtime_error( "no free or no shared facets in " + where );
+  }
+}
+
+bool testLinear()
+{
+  SMDS_Mesh mesh;
+  TMixedMeshBuilder( mesh, 4, /*quadratic=*/false );
+  compareFacets( mesh, /*ignoreCentralNodes=*/true, "testLinear()\n" );
+  return true;
+}
+
+bool testQuadratic()
+{
+  SMDS_Mesh mesh;
+  TMixedMeshBuilder builder( mesh, 4, /*quadratic=*/true );
+  builder.addSpecialVolumes();
+  compareFacets( mesh, /*ignoreCentralNodes=*/true,  "testQuadratic()\n" );
+  compareFacets( mesh, /*ignoreCentralNodes=*/false, "testQuadratic() with central nodes\n" );
+  return true;
+}
+
+bool testEmpty()
+{
+  SMDS_Mesh mesh;
+  SMDS_VolumeFacetIterator fIt( mesh.elementsIterator( SMDSAbs_Volume ));
+  if ( fIt.more() || fIt.Volume() || fIt.IsFree() )
+    throw std::runtime_error( "facets of an empty mesh in testEmpty()\n" );
+
+  SMDS_VolumeFacetIterator nullIt(( SMDS_ElemIteratorPtr() ));
+  if ( nullIt.more() )
+    throw std::runtime_error( "facets of a null iterator in testEmpty()\n" );
+  return true;
+}
+
+int main()
+{
+  if ( !testEmpty() || !testLinear() || !testQuadratic() )
+    return 1;
+
+  return 0;
+}
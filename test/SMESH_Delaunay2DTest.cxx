@@ -0,0 +1,263 @@
+// Copyright (C) 2016-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_Delaunay2DTest.cxx (unit test)
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// smesh
+#include "SMESH_Delaunay2D.hxx"
+
+namespace
+{
+  double area( const SMESH_Delaunay2D& delaunay, int iTria )
+  {
+    const int* n = delaunay.GetTriaNodes( iTria );
+    const gp_XY& a = delaunay.GetNode( n[0] );
+    return 0.5 * (( delaunay.GetNode( n[1] ) - a ) ^ ( delaunay.GetNode( n[2] ) - a ));
+  }
+
+  // area of a convex polygon given by counterclockwise points
+  double polygonArea( const std::vector< gp_XY >& polygon )
+  {
+    double a = 0;
+    for ( size_t i = 0; i < polygon.size(); ++i )
+      a += polygon[ i ] ^ polygon[( i + 1 ) % polygon.size() ];
+    return 0.5 * a;
+  }
+
+  //! Check that triangles are not inverted, cover the convex hull, are Delaunay
+  //  and adjacency is consistent
+  void checkTriangulation( const SMESH_Delaunay2D&     delaunay,
+                           const std::vector< gp_XY >& points,
+                           double                      hullArea,
+                           const std::string&          test )
+  {
+    const double size = std::sqrt( hullArea );
+    double totalArea = 0;
+    for ( int iT = 0; iT < delaunay.NbTriangles(); ++iT )
+    {
+      const double a = area( delaunay, iT );
+      if ( a <= 1e-12 * hullArea )
+        throw std::runtime_error( "degenerated triangle in " + test );
+      totalArea += a;
+
+      const int* n = delaunay.GetTriaNodes( iT );
+      for ( int i = 0; i < 3; ++i )
+      {
+        int adj = delaunay.GetNeighbor( iT, i );
+        if ( adj < 0 )
+          continue;
+        int nbBack = 0;
+        for ( int j = 0; j < 3; ++j )
+          nbBack += ( delaunay.GetNeighbor( adj, j ) == iT );
+        if ( nbBack != 1 )
+          throw std::runtime_error( "wrong adjacency in " + test );
+      }
+
+      // no point is strictly inside the circumcircle
+      const gp_XY& p0 = delaunay.GetNode( n[0] );
+      const gp_XY& p1 = delaunay.GetNode( n[1] );
+      const gp_XY& p2 = delaunay.GetNode( n[2] );
+      for ( const gp_XY& p : points )
+      {
+        const gp_XY a = p0 - p, b = p1 - p, c = p2 - p;
+        double det = ( a.SquareModulus() * ( b ^ c ) +
+                       b.SquareModulus() * ( c ^ a ) +
+                       c.SquareModulus() * ( a ^ b ));
+        if ( det > 1e-9 * size * size * size * size )
+          throw std::runtime_error( "not Delaunay triangle in " + test );
+      }
+    }
+    if ( std::abs( totalArea - hullArea ) > 1e-9 * hullArea )
+      throw std::runtime_error( "triangles do not cover the convex hull in " + test );
+  }
+}
+
+bool testCollinearPoints()
+{
+  // all points on a line
+  {
+    std::vector< gp_XY > points;
+    for ( int i = 0; i < 10; ++i )
+      points.push_back( gp_XY( i, 2 * i ));
+    SMESH_Delaunay2D delaunay( points );
+    if ( delaunay.NbTriangles() != 0 )
+      throw std::runtime_error( "triangles on collinear points in testCollinearPoints()\n" );
+    double bc[3];
+    if ( delaunay.FindTriangle( gp_XY( 1, 2 ), -1, bc ) >= 0 )
+      throw std::runtime_error( "found triangle on collinear points in testCollinearPoints()\n" );
+  }
+  // nodes on boundary of a rectangle, many of them collinear on the sides
+  {
+    std::vector< gp_XY > points;
+    const int nbX = 40, nbY = 3;
+    for ( int i = 0; i < nbX; ++i ) points.push_back( gp_XY( i, 0 ));
+    for ( int i = 0; i < nbY; ++i ) points.push_back( gp_XY( nbX, i ));
+    for ( int i = 0; i < nbX; ++i ) points.push_back( gp_XY( nbX - i, nbY ));
+    for ( int i = 0; i < nbY; ++i ) points.push_back( gp_XY( 0, nbY - i ));
+    SMESH_Delaunay2D delaunay( points );
+    checkTriangulation( delaunay, points, nbX * nbY, "rectangle of testCollinearPoints()\n" );
+    if ( delaunay.NbTriangles() != (int) points.size() - 2 )
+      throw std::runtime_error( "wrong nb triangles in rectangle of testCollinearPoints()\n" );
+  }
+  // nodes on an arc of a large radius, almost collinear, closed by a chord
+  {
+    std::vector< gp_XY > points, hull;
+    const double R = 1e4, angle = 1e-3;
+    const int nbArc = 30;
+    for ( int i = 0; i <= nbArc; ++i )
+    {
+      double a = -angle / 2 + angle * i / nbArc;
+      points.push_back( gp_XY( R * std::sin( a ), R * std::cos( a ) - R ));
+    }
+    hull = points;
+    std::reverse( hull.begin(), hull.end() );
+    points.push_back( gp_XY( 1, -6e-4 )); // an inner point
+    SMESH_Delaunay2D delaunay( points );
+    checkTriangulation( delaunay, points, polygonArea( hull ), "arc of testCollinearPoints()\n" );
+  }
+  return true;
+}
+
+bool testDuplicatePoints()
+{
+  std::vector< gp_XY > points;
+  for ( int i = 0; i < 5; ++i )
+    for ( int j = 0; j < 5; ++j )
+      points.push_back( gp_XY( i + 0.1 * ( j % 2 ), j ));
+  const int nbUnique = (int) points.size();
+  SMESH_Delaunay2D delaunay1( points );
+
+  // duplicate each third point
+  for ( int i = 0; i < nbUnique; i += 3 )
+    points.push_back( points[ i ]);
+  SMESH_Delaunay2D delaunay2( points );
+
+  if ( delaunay1.NbTriangles() != delaunay2.NbTriangles() )
+    throw std::runtime_error( "duplicates change nb triangles in testDuplicatePoints()\n" );
+  if ( delaunay2.NbNodes() != (int) points.size() )
+    throw std::runtime_error( "wrong nb nodes in testDuplicatePoints()\n" );
+
+  const double hullArea = polygonArea({ gp_XY( 0, 0 ),   gp_XY( 4, 0 ), gp_XY( 4.1, 1 ),
+                                        gp_XY( 4.1, 3 ), gp_XY( 4, 4 ), gp_XY( 0, 4 ) });
+  checkTriangulation( delaunay2, points, hullArea, "testDuplicatePoints()\n" );
+
+  // a duplicate node shares a triangle with its original
+  for ( int i = nbUnique; i < (int) points.size(); ++i )
+  {
+    int iT = delaunay2.GetTriangleNear( i );
+    if ( iT < 0 )
+      throw std::runtime_error( "no triangle near a duplicate in testDuplicatePoints()\n" );
+    const int* n = delaunay2.GetTriaNodes( iT );
+    bool found = false;
+    for ( int j = 0; j < 3; ++j )
+      found |= (( delaunay2.GetNode( n[j] ) - points[ i ]).SquareModulus() == 0 );
+    if ( !found )
+      throw std::runtime_error( "wrong triangle near a duplicate in testDuplicatePoints()\n" );
+  }
+  return true;
+}
+
+bool testFindTriangle()
+{
+  // boundary of a unit disk and some inner points
+  std::vector< gp_XY > points, hull;
+  const int nbBnd = 64;
+  for ( int i = 0; i < nbBnd; ++i )
+  {
+    double a = 2 * M_PI * i / nbBnd;
+    points.push_back( gp_XY( std::cos( a ), std::sin( a )));
+  }
+  hull = points;
+  for ( int i = 1; i < 8; ++i )
+    points.push_back( gp_XY( 0.1 * i * std::cos( i ), 0.1 * i * std::sin( i )));
+  SMESH_Delaunay2D delaunay( points );
+  checkTriangulation( delaunay, points, polygonArea( hull ), "testFindTriangle()\n" );
+
+  // points to locate: a regular grid covering the disk, nodes and middles of hull edges
+  std::vector< gp_XY > uvs;
+  for ( int i = 0; i <= 50; ++i )
+    for ( int j = 0; j <= 50; ++j )
+      uvs.push_back( gp_XY( -1.2 + 2.4 * i / 50, -1.2 + 2.4 * j / 50 ));
+  for ( int i = 0; i < nbBnd; ++i )
+  {
+    uvs.push_back( hull[ i ]);
+    uvs.push_back( 0.5 * ( hull[ i ] + hull[( i + 1 ) % nbBnd ]));
+  }
+
+  std::vector< int >    trias;
+  std::vector< double > bcs;
+  delaunay.FindTriangles( uvs, trias, bcs );
+
+  for ( size_t i = 0; i < uvs.size(); ++i )
+  {
+    // is inside the convex hull?
+    bool isIn = true;
+    double minDist = 1.;
+    for ( int j = 0; j < nbBnd; ++j )
+    {
+      const gp_XY& p1 = hull[ j ];
+      const gp_XY& p2 = hull[( j + 1 ) % nbBnd ];
+      double dist = (( p2 - p1 ) ^ ( uvs[i] - p1 )) / ( p2 - p1 ).Modulus();
+      isIn    = isIn && dist >= 0;
+      minDist = std::min( minDist, std::abs( dist ));
+    }
+    if ( minDist > 1e-12 && isIn != ( trias[i] >= 0 ))
+      throw std::runtime_error( "wrong location of a point in testFindTriangle()\n" );
+    if ( trias[i] < 0 )
+      continue;
+
+    double bc[3];
+    int iT = delaunay.FindTriangle( uvs[i], -1, bc );
+    if ( iT != trias[i] )
+      throw std::runtime_error( "FindTriangle() != FindTriangles() in testFindTriangle()\n" );
+
+    const double* bc1 = & bcs[ 3 * i ];
+    if ( bc1[0] < 0 || bc1[1] < 0 || bc1[2] < 0 ||
+         std::abs( bc1[0] + bc1[1] + bc1[2] - 1. ) > 1e-12 )
+      throw std::runtime_error( "wrong barycentric coordinates in testFindTriangle()\n" );
+
+    const int* n = delaunay.GetTriaNodes( iT );
+    gp_XY p = ( bc1[0] * delaunay.GetNode( n[0] ) +
+                bc1[1] * delaunay.GetNode( n[1] ) +
+                bc1[2] * delaunay.GetNode( n[2] ));
+    if (( p - uvs[i] ).Modulus() > 1e-9 )
+      throw std::runtime_error( "point not restored by barycentric coordinates in testFindTriangle()\n" );
+
+    // start from any triangle
+    iT = delaunay.FindTriangle( uvs[i], int( i ) % delaunay.NbTriangles(), bc );
+    if ( iT < 0 || bc[0] < 0 || bc[1] < 0 || bc[2] < 0 )
+      throw std::runtime_error( "point not found from a given triangle in testFindTriangle()\n" );
+  }
+  return true;
+}
+
+int main()
+{
+  if ( !testCollinearPoints() || !testDuplicatePoints() || !testFindTriangle() )
+    return 1;
+
+  return 0;
+}
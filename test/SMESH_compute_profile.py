@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+
+# Check timing of computation stages recorded by the profiler of SMESH_Gen
+
+import salome
+salome.salome_init()
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+
+mesh = smesh.Mesh( Box_1, "profiled" )
+mesh.Segment().NumberOfSegments( 4 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+
+smesh.SetComputeProfiling( True )
+assert smesh.IsComputeProfiling()
+smesh.GetComputeProfile( True ) # clear records of other meshes
+
+assert mesh.Compute()
+
+profile = smesh.GetComputeProfile()
+records = profile["records"]
+totals  = { ( t["stage"], t["name"] ): t for t in profile["totals"] }
+assert profile["nb_removed_records"] == 0
+
+# number of computed sub-meshes and of produced nodes and elements
+expected = { "Regular_1D":    ( 12, 12 * 3, 12 * 4 ),
+             "Quadrangle_2D": (  6,  6 * 9,  6 * 16 ),
+             "Hexa_3D":       (  1,      27,     64 )}
+for name, ( nbComputed, nbNodes, nbElems ) in expected.items():
+  t = totals[( "Compute", name )]
+  assert t["count"] == nbComputed, t
+  assert t["nb_nodes"] == nbNodes, t
+  assert t["nb_elements"] == nbElems, t
+  assert ( "CheckHypothesis", name ) in totals
+
+for r in records:
+  assert r["mesh"] == mesh.GetId()
+  assert r["wall_time"] >= 0 and r["cpu_time"] >= 0
+  assert r["self_time"] <= r["wall_time"] + 1e-9, r
+  if r["stage"] == "Compute":
+    assert r["ok"], r
+
+nbRecords = sum( t["count"] for t in profile["totals"] )
+assert len( records ) == nbRecords
+
+# records are removed on demand
+assert smesh.GetComputeProfile( True )["records"] == records
+assert smesh.GetComputeProfile()["records"] == []
+
+# nothing is recorded when profiling is off
+smesh.SetComputeProfiling( False )
+assert not smesh.IsComputeProfiling()
+mesh.Clear()
+assert mesh.Compute()
+assert smesh.GetComputeProfile()["records"] == []
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+
+# Check distances between sets of elements: minimal distance, Hausdorff
+# distance and histogram of distances between two parallel squares;
+# minimal distance between crossing and skew elements
+
+import math
+import salome
+salome.salome_init()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+# a square [0,100]x[0,100] at z=0 split into 2x2 quadrangles
+mesh1 = smesh.Mesh( "square 1" )
+for j in range( 3 ):
+  for i in range( 3 ):
+    mesh1.AddNode( 50 * i, 50 * j, 0 )
+for j in range( 2 ):
+  for i in range( 2 ):
+    n = 1 + i + 3 * j
+    mesh1.AddFace([ n, n + 1, n + 4, n + 3 ])
+
+# a square [0,50]x[0,50] at z=10
+mesh2 = smesh.Mesh( "square 2" )
+for x, y in [ (0,0), (50,0), (50,50), (0,50) ]:
+  mesh2.AddNode( x, y, 10 )
+mesh2.AddFace([ 1, 2, 3, 4 ])
+
+tol = 1e-9
+
+minDist = smesh.GetMinDistance( mesh1, mesh2 )
+assert abs( minDist.value - 10 ) < tol, minDist.value
+assert abs( smesh.MinDistance( mesh2, mesh1 ) - 10 ) < tol
+
+# the farthest node is the corner (100,100,0) of square 1, closest to (50,50,10)
+hausdorff = math.sqrt( 50**2 + 50**2 + 10**2 )
+measure = smesh.GetHausdorffDistance( mesh1, mesh2 )
+assert abs( measure.value - hausdorff ) < tol, measure.value
+assert measure.node1 == 9, measure.node1
+assert abs( measure.maxX - 50 ) < tol and abs( measure.maxY - 50 ) < tol and abs( measure.maxZ - 10 ) < tol
+assert abs( smesh.HausdorffDistance( mesh2, mesh1 ) - hausdorff ) < tol
+
+# distances from nodes of square 1: 4 nodes at 10, 4 nodes at sqrt(50**2+10**2), one at hausdorff
+histogram = smesh.GetDistanceHistogram( mesh1, mesh2, 2 )
+assert len( histogram ) == 2
+assert abs( histogram[0].min - 10 ) < tol
+assert abs( histogram[1].max - hausdorff ) < tol
+assert [ r.nbEvents for r in histogram ] == [ 4, 5 ], [ r.nbEvents for r in histogram ]
+
+# all nodes of square 2 are at the same distance from square 1
+histogram = smesh.GetDistanceHistogram( mesh2, mesh1, 3 )
+assert sum( r.nbEvents for r in histogram ) == mesh2.NbNodes()
+assert histogram[0].nbEvents == mesh2.NbNodes()
+
+# closest points of crossing edges lie inside the edges, not at nodes
+edges1 = smesh.Mesh( "edge 1" )
+edge1 = edges1.AddEdge([ edges1.AddNode( 0, 0, 0 ), edges1.AddNode( 10, 0, 0 )])
+edges2 = smesh.Mesh( "edge 2" )
+edge2 = edges2.AddEdge([ edges2.AddNode( 5, -5, 1 ), edges2.AddNode( 5, 5, 1 )])
+measure = smesh.GetMinDistance( edges1, edges2 )
+assert abs( measure.value - 1 ) < tol, measure.value
+assert measure.elem1 == edge1 and measure.elem2 == edge2, ( measure.elem1, measure.elem2 )
+assert abs( measure.minZ - 1 ) < tol and abs( measure.minX ) < tol and abs( measure.minY ) < tol
+assert abs( measure.maxX - 5 ) < tol and abs( measure.maxY ) < tol and abs( measure.maxZ - 1 ) < tol
+assert abs( smesh.MinDistance( edges2, edges1 ) - 1 ) < tol
+
+# a triangle piercing square 1 far from nodes of both
+tria = smesh.Mesh( "piercing triangle" )
+tria.AddFace([ tria.AddNode( 20, 20, -5 ), tria.AddNode( 30, 20, 5 ), tria.AddNode( 20, 30, 5 )])
+assert smesh.MinDistance( mesh1, tria ) < tol
+assert smesh.MinDistance( tria, mesh1 ) < tol
+
+# an edge crossing a hexahedron through its faces
+hexa = smesh.Mesh( "hexahedron" )
+hexaNodes = [ hexa.AddNode( x, y, z ) for z in ( 0, 100 ) for x, y in [( 0,0 ), ( 0,100 ), ( 100,100 ), ( 100,0 )]]
+hexa.AddVolume( hexaNodes )
+edge = smesh.Mesh( "crossing edge" )
+edgeNodes = [ edge.AddNode( -10, 50, 50 ), edge.AddNode( 110, 50, 50 )]
+edge.AddEdge( edgeNodes )
+assert smesh.MinDistance( hexa, edge ) < tol
+assert smesh.MinDistance( edge, hexa ) < tol
+
+# moved aside, the edge is closest to a vertical edge of the hexahedron at mid-height
+edge.MoveNode( edgeNodes[0], -20, 10, 50 )
+edge.MoveNode( edgeNodes[1], 10, -20, 50 )
+measure = smesh.GetMinDistance( hexa, edge )
+assert abs( measure.value - 10 / math.sqrt( 2 )) < tol, measure.value
+assert abs( measure.maxX + 5 ) < tol and abs( measure.maxY + 5 ) < tol and abs( measure.maxZ - 50 ) < tol
+assert abs( smesh.MinDistance( edge, hexa ) - measure.value ) < tol
@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+
+# Check that groups on filter updated incrementally after each modification of
+# a mesh contain the same elements as the filter evaluated over the whole mesh
+
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+import SMeshHelper
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+geompy.addToStudy( Box_1, 'Box_1' )
+faces = geompy.SubShapeAllSortedCentres( Box_1, geompy.ShapeType["FACE"] )
+for i, f in enumerate( faces ):
+  geompy.addToStudyInFather( Box_1, f, 'Face_%s' % ( i + 1 ))
+
+mesh = smesh.Mesh( Box_1, "group on filter update" )
+mesh.Segment().NumberOfSegments( 4 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+
+# criteria of all kinds of locality: depending on an element only, on its neighbors
+# and on the whole mesh (shape IDs)
+criteria = [( SMESH.FACE,   SMESH.FT_Area,              SMESH.FT_MoreThan, 625.1    ),
+            ( SMESH.VOLUME, SMESH.FT_Volume3D,          SMESH.FT_LessThan, 15624.9  ),
+            ( SMESH.VOLUME, SMESH.FT_BadOrientedVolume, SMESH.FT_EqualTo,  ""       ),
+            ( SMESH.FACE,   SMESH.FT_FreeEdges,         SMESH.FT_EqualTo,  ""       ),
+            ( SMESH.NODE,   SMESH.FT_FreeNodes,         SMESH.FT_EqualTo,  ""       ),
+            ( SMESH.VOLUME, SMESH.FT_BareBorderVolume,  SMESH.FT_EqualTo,  ""       ),
+            ( SMESH.NODE,   SMESH.FT_BelongToGeom,      SMESH.FT_EqualTo,  faces[0] ),
+            ( SMESH.FACE,   SMESH.FT_BelongToGeom,      SMESH.FT_EqualTo,  faces[0] )]
+
+groups = []
+for i, ( elemType, critType, compare, threshold ) in enumerate( criteria ):
+  filter = smesh.GetFilter( elemType, critType, compare, threshold )
+  groups.append( mesh.GroupOnFilter( elemType, "group %s" % i, filter ))
+
+def check( step ):
+  for ( elemType, critType, compare, threshold ), group in zip( criteria, groups ):
+    filter = smesh.GetFilter( elemType, critType, compare, threshold )
+    ids = mesh.GetIdsFromFilter( filter )
+    assert sorted( group.GetIDs() ) == sorted( ids ), ( step, group.GetName() )
+
+check( "initial" )
+
+# add elements
+n1 = mesh.AddNode( 200, 0,  0 )
+n2 = mesh.AddNode( 250, 0,  0 )
+n3 = mesh.AddNode( 250, 50, 0 )
+n4 = mesh.AddNode( 200, 50, 0 )
+newFace = mesh.AddFace([ n1, n2, n3, n4 ])
+freeNode = mesh.AddNode( 300, 0, 0 )
+check( "add" )
+assert newFace in groups[0].GetIDs() and newFace in groups[3].GetIDs()
+assert freeNode in groups[4].GetIDs()
+
+# move a node
+corner = mesh.FindNodeClosestTo( 0, 0, 0 )
+mesh.MoveNode( corner, -10, -10, -10 )
+check( "move a node" )
+assert groups[0].Size() == 3 + 1
+
+# move all nodes at once
+meshData = SMeshHelper.GetMeshData( mesh )
+coords, nodeIDs = SMeshHelper.GetNodeCoordinates( meshData )
+coords = coords.copy()
+coords[ list( nodeIDs ).index( corner )] = [ 0, 0, 0 ]
+assert SMeshHelper.SetNodeCoordinates( meshData, coords )
+check( "move all nodes" )
+assert groups[0].Size() == 1
+
+# change nodes of a cell
+hexa = mesh.FindElementsByPoint( 12.5, 12.5, 12.5, SMESH.VOLUME )[0]
+n = mesh.GetElemNodes( hexa )
+assert mesh.ChangeElemNodes( hexa, [ n[0], n[3], n[2], n[1], n[4], n[7], n[6], n[5] ])
+check( "change nodes" )
+assert groups[2].GetIDs() == [ hexa ]
+assert mesh.ChangeElemNodes( hexa, n )
+check( "restore nodes" )
+assert groups[2].IsEmpty()
+
+# change shapes of a node and of a face
+inNode = mesh.FindNodeClosestTo( 25, 25, 25 )
+mesh.SetNodeOnFace( inNode, faces[0], 0, 0 )
+face = mesh.FindElementsByPoint( 100, 12.5, 12.5, SMESH.FACE )[0]
+mesh.SetMeshElementOnShape( face, faces[0] )
+check( "change shapes" )
+assert inNode in groups[6].GetIDs() and face in groups[7].GetIDs()
+
+# change nodes of cells of one domain at the domain boundary
+hexas = mesh.GetElementsByType( SMESH.VOLUME )
+left  = [ h for h in hexas if mesh.BaryCenter( h )[0] < 50 ]
+right = [ h for h in hexas if mesh.BaryCenter( h )[0] > 50 ]
+domains = [ mesh.MakeGroupByIds( "left",  SMESH.VOLUME, left  ),
+            mesh.MakeGroupByIds( "right", SMESH.VOLUME, right )]
+nbNodes = mesh.NbNodes()
+assert mesh.DoubleNodesOnGroupBoundaries( domains, False )
+assert mesh.NbNodes() > nbNodes
+check( "double nodes" )
+assert groups[5].Size() >= 2 * 4 * 4 # at least hexas sharing the domain boundary
+
+# remove elements and nodes
+mesh.RemoveElements([ newFace ])
+check( "remove elements" )
+assert n1 in groups[4].GetIDs()
+
+mesh.RemoveNodes([ freeNode, mesh.FindNodeClosestTo( 100, 50, 50 )])
+check( "remove nodes" )
@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+
+# Check that at replacement of the shape to mesh, the mesh of sub-shapes not
+# changed by the replacement is kept: one of two boxes of a partition changes
+
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+Box_2 = geompy.MakeBoxTwoPnt( geompy.MakeVertex( 100, 0, 0 ), geompy.MakeVertex( 200, 100, 100 ))
+Box_3 = geompy.MakeBoxTwoPnt( geompy.MakeVertex( 100, 0, 0 ), geompy.MakeVertex( 250, 100, 100 ))
+oldShape = geompy.MakePartition([ Box_1, Box_2 ], [], [], [], geompy.ShapeType["SOLID"])
+newShape = geompy.MakePartition([ Box_1, Box_3 ], [], [], [], geompy.ShapeType["SOLID"])
+geompy.addToStudy( oldShape, 'oldShape' )
+geompy.addToStudy( newShape, 'newShape' )
+# make the new shape look modified
+geompy.TranslateDXDYDZ( newShape, 0, 0, 0 )
+assert newShape.GetTick() != oldShape.GetTick()
+
+mesh = smesh.Mesh( oldShape, "kept sub-meshes" )
+mesh.Segment().NumberOfSegments( 4 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+assert mesh.NbHexas() == 2 * 4**3
+
+def getNodes( shape ):
+  "Return coordinates of nodes of the box at origin by node ID"
+  solid = geompy.SubShapeAllSortedCentres( shape, geompy.ShapeType["SOLID"] )[0]
+  nodes = mesh.GetMesh().GetSubMeshNodesId( geompy.GetSubShapeID( shape, solid ), True )
+  return { n: mesh.GetNodeXYZ( n ) for n in nodes }
+
+oldNodes = getNodes( oldShape )
+assert len( oldNodes ) == 5**3
+
+mesh.GetMesh().ReplaceShape( newShape )
+nbKept = mesh.GetMesh().GetNbKeptSubMeshes()
+print( "nb kept sub-meshes:", nbKept )
+# the SOLID, 6 FACEs, 12 EDGEs and 8 VERTEXes of the box at origin
+assert nbKept == 1 + 6 + 12 + 8, nbKept
+
+assert mesh.Compute()
+assert mesh.NbHexas() == 2 * 4**3, mesh.NbHexas()
+assert abs( smesh.GetVolume( mesh ) - 100**3 - 150*100*100 ) < 1e-6
+
+# mesh of the unchanged box is the same
+newNodes = getNodes( newShape )
+assert newNodes == oldNodes
+
+# a reversed FACE is not considered unchanged
+Face_1 = geompy.SubShapeAllSortedCentres( Box_1, geompy.ShapeType["FACE"] )[0]
+faceMesh = smesh.Mesh( Face_1, "face" )
+faceMesh.Segment().NumberOfSegments( 3 )
+faceMesh.Quadrangle()
+assert faceMesh.Compute()
+Face_2 = geompy.ChangeOrientationShellCopy( Face_1 )
+geompy.addToStudy( Face_2, 'Face_2' )
+geompy.TranslateDXDYDZ( Face_2, 0, 0, 0 )
+assert Face_2.GetTick() != Face_1.GetTick()
+faceMesh.GetMesh().ReplaceShape( Face_2 )
+assert faceMesh.GetMesh().GetNbKeptSubMeshes() == 4 + 4 # EDGEs and VERTEXes
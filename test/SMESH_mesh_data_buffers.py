@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+
+# Check bulk accessors of mesh data of SMeshHelper: node coordinates,
+# connectivity and groups read by numpy without copying, and moving of all nodes
+
+import gc
+import numpy
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+import SMeshHelper
+
+Box_1 = geompy.MakeBoxDXDYDZ( 10, 20, 30 )
+geompy.addToStudy( Box_1, 'Box_1' )
+
+mesh = smesh.Mesh( Box_1, "bulk data" )
+mesh.Segment().NumberOfSegments( 3 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+# two groups of the same name
+faces = geompy.SubShapeAllSortedCentres( Box_1, geompy.ShapeType["FACE"] )
+mesh.GroupOnGeom( faces[0], "side", SMESH.FACE )
+mesh.GroupOnGeom( faces[1], "side", SMESH.FACE )
+mesh.MakeGroupByIds( "first hexa", SMESH.VOLUME, [ mesh.GetElementsByType( SMESH.VOLUME )[0] ])
+
+meshData = SMeshHelper.GetMeshData( mesh )
+coords, nodeIDs = SMeshHelper.GetNodeCoordinates( meshData )
+hexaIDs, offsets, conn = SMeshHelper.GetConnectivity( meshData, SMESH.Entity_Hexa )
+groups = SMeshHelper.GetGroups( meshData )
+
+# arrays stay valid after the last reference to meshData is removed
+del meshData
+gc.collect()
+
+assert coords.shape == ( mesh.NbNodes(), 3 )
+assert sorted( nodeIDs.tolist() ) == sorted( mesh.GetNodesId() )
+for i, n in enumerate( nodeIDs ):
+  assert coords[ i ].tolist() == mesh.GetNodeXYZ( int( n ))
+
+assert len( hexaIDs ) == mesh.NbHexas() == 27
+assert len( offsets ) == len( hexaIDs ) + 1 and offsets[-1] == len( conn )
+for i, e in enumerate( hexaIDs ):
+  nodes = nodeIDs[ conn[ offsets[i] : offsets[i+1] ]].tolist()
+  assert nodes == mesh.GetElemNodes( int( e )), ( e, nodes )
+
+assert len( groups ) == 3
+for ( name, gType, ids ), group in zip( groups, mesh.GetGroups() ):
+  assert name == group.GetName()
+  assert gType == group.GetType()
+  assert sorted( ids.tolist() ) == sorted( group.GetIDs() )
+assert [ g[0] for g in groups ].count( "side" ) == 2
+
+# move all nodes
+meshData = SMeshHelper.GetMeshData( mesh )
+coords, nodeIDs = SMeshHelper.GetNodeCoordinates( meshData )
+newCoords = 2 * coords + [ 1, 2, 3 ]
+assert SMeshHelper.SetNodeCoordinates( meshData, newCoords )
+for i, n in enumerate( nodeIDs ):
+  assert mesh.GetNodeXYZ( int( n )) == newCoords[ i ].tolist()
+assert abs( smesh.GetVolume( mesh ) - 8 * 10 * 20 * 30 ) < 1e-6
+# wrong number of coordinates
+assert not SMeshHelper.SetNodeCoordinates( meshData, newCoords[1:] )
+
+# data read before the mesh is modified stays as it was
+newNode = mesh.AddNode( 100, 100, 100 )
+hexaNodes = [ mesh.AddNode( x, y, z ) for z in ( 50, 60 ) for x, y in [( 50,50 ), ( 50,60 ), ( 60,60 ), ( 60,50 )]]
+mesh.AddVolume( hexaNodes )
+hexaIDs, offsets, conn = SMeshHelper.GetConnectivity( meshData, SMESH.Entity_Hexa )
+assert len( hexaIDs ) == 27 and len( conn ) == 27 * 8
+assert conn.max() < len( nodeIDs )
+# nodes added after reading the data are not moved
+assert not SMeshHelper.SetNodeCoordinates( meshData, newCoords )
+# new data includes the new nodes and element
+meshData = SMeshHelper.GetMeshData( mesh )
+coords, nodeIDs = SMeshHelper.GetNodeCoordinates( meshData )
+hexaIDs, offsets, conn = SMeshHelper.GetConnectivity( meshData, SMESH.Entity_Hexa )
+assert len( nodeIDs ) == mesh.NbNodes() and len( hexaIDs ) == 28
+# an absent entity gives empty arrays
+ids, offsets, conn = SMeshHelper.GetConnectivity( meshData, SMESH.Entity_Polyhedra )
+assert len( ids ) == 0 and offsets.tolist() == [ 0 ] and len( conn ) == 0
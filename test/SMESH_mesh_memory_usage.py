@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+
+# Check the report of memory used by mesh data structures
+
+import salome
+salome.salome_init()
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+
+def makeHexaMesh( nbSegments ):
+  mesh = smesh.Mesh( Box_1, "hexa %s" % nbSegments )
+  mesh.Segment().NumberOfSegments( nbSegments )
+  mesh.Quadrangle()
+  mesh.Hexahedron()
+  assert mesh.Compute()
+  return mesh
+
+entityNames = [ str( SMESH.EntityType._item( i )) for i in range( SMESH.Entity_Last._v ) ]
+
+def checkUsage( mesh, sampling=False ):
+  usage = mesh.GetMemoryUsage( sampling )
+  assert usage["total"] > 0
+  assert usage["total"] == sum( usage["components"].values() ), usage
+  # entities are named as SMESH.EntityType and only used ones are reported
+  usedEntities = set( str( t ) for t, nb in mesh.GetMeshInfo().items() if nb > 0 )
+  assert set( usage["entities"] ) == usedEntities, ( usage["entities"], usedEntities )
+  assert set( usage["entities"] ) <= set( entityNames )
+  return usage
+
+# memory of elements grows with their number, bytes per hexahedron are same
+
+mesh2 = makeHexaMesh( 2 )
+mesh4 = makeHexaMesh( 4 )
+usage2 = checkUsage( mesh2 )
+usage4 = checkUsage( mesh4 )
+assert not usage2["sampled"] and not usage4["sampled"]
+assert usage4["total"] > usage2["total"]
+for name in "Entity_Node", "Entity_Edge", "Entity_Quadrangle", "Entity_Hexa":
+  assert usage4["entities"][ name ] > usage2["entities"][ name ], name
+assert usage2["entities"]["Entity_Hexa"] / 8 == usage4["entities"]["Entity_Hexa"] / 64
+
+# a group adds memory
+
+groupsSize = usage4["components"]["groups"]
+mesh4.MakeGroupByIds( "all volumes", SMESH.VOLUME, mesh4.GetElementsByType( SMESH.VOLUME ))
+usage4 = checkUsage( mesh4 )
+assert usage4["components"]["groups"] > groupsSize
+
+# sizes of many polygons are extrapolated from a sample
+
+mesh = smesh.Mesh()
+nodes = [ mesh.AddNode( x, y, 0 ) for x, y in (( 0, 0 ), ( 1, 0 ), ( 2, 1 ), ( 1, 2 ), ( 0, 1 )) ]
+nbPolygons = 3000
+for i in range( nbPolygons ):
+  mesh.AddPolygonalFace( nodes )
+usage  = checkUsage( mesh )
+sample = checkUsage( mesh, sampling=True )
+assert not usage["sampled"]
+assert sample["sampled"]
+assert usage["entities"]["Entity_Polygon"] == sample["entities"]["Entity_Polygon"]
@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+
+# Check the worker method of mesher_launcher.py: jobs read from stdin run a
+# stand-in runner with arguments passed as is, and wrong jobs are rejected
+
+import json
+import os
+import shutil
+import stat
+import subprocess
+import sys
+import tempfile
+
+import mesher_launcher
+
+work_dir = tempfile.mkdtemp( prefix="SMESH_worker_" )
+
+# stand-in runner writes its arguments to the output mesh file; it fails for NETGEN2D
+runner = os.path.join( work_dir, "runner.py" )
+with open( runner, "w" ) as f:
+  f.write( "#!{}\n".format( sys.executable ))
+  f.write( "import json, sys\n"
+           "print( 'stand-in runner', sys.argv[1:] )\n"
+           "if sys.argv[1] == 'NETGEN2D': sys.exit( 1 )\n"
+           "with open( sys.argv[7], 'w' ) as f: json.dump( sys.argv[1:], f )\n" )
+os.chmod( runner, os.stat( runner ).st_mode | stat.S_IXUSR )
+
+hacked = os.path.join( work_dir, "hacked" )
+def inWorkDir( name ):
+  return os.path.join( work_dir, name )
+
+# file names a shell would interpret
+shape_file  = inWorkDir( "shape $(touch hacked).brep" )
+output_file = inWorkDir( "out put;touch hacked.med" )
+good_job = { "id": "good",
+             "mesher": "NETGEN3D",
+             "input_mesh_file": inWorkDir( "mesh.med" ),
+             "shape_file": shape_file,
+             "hypo_file": inWorkDir( "hypo.dat" ),
+             "elem_orient_file": inWorkDir( "orient.dat" ),
+             "new-element-file": inWorkDir( "new_elements.dat" ),
+             "output_mesh_file": output_file }
+jobs = [ good_job,
+         dict( good_job, id="bad mesher", mesher="NETGEN3D; touch {}".format( hacked )),
+         dict( good_job, id="bad key", runner="/bin/sh" ),
+         dict( good_job, id="bad value", hypo_file=[ "hypo.dat" ]),
+         dict( good_job, id="runner failure", mesher="NETGEN2D" ) ]
+stdin = "\n".join( json.dumps( job ) for job in jobs ) + "\nquit\n"
+
+cmd = [ sys.executable, mesher_launcher.__file__, "--method", "worker", "--runner", runner ]
+output = subprocess.run( cmd, input=stdin, capture_output=True, text=True, check=True ).stdout
+print( output )
+answers = output.splitlines()
+
+assert len( answers ) == len( jobs ), answers
+assert answers[0] == "OK good", answers[0]
+for answer, job in zip( answers[1:], jobs[1:] ):
+  assert answer.startswith( "FAILED {} ".format( job["id"] )), answer
+
+# the runner got the arguments unchanged
+with open( output_file ) as f:
+  runner_args = json.load( f )
+assert runner_args == [ "NETGEN3D", good_job["input_mesh_file"], shape_file, good_job["hypo_file"],
+                        good_job["elem_orient_file"], good_job["new-element-file"], output_file ], runner_args
+with open( inWorkDir( "run.log" )) as f:
+  assert "stand-in runner" in f.read()
+
+assert not os.path.exists( hacked )
+
+shutil.rmtree( work_dir )
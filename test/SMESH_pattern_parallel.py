@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+
+# Check that a pattern mapped onto many hexahedra at once, which is done in parallel,
+# gives same points as the pattern mapped onto each hexahedron alone
+
+import salome
+salome.salome_init()
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+
+mesh = smesh.Mesh( Box_1, "hexahedra" )
+mesh.Segment().NumberOfSegments( 6 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+
+# distort hexahedra by moving internal nodes
+for i, id in enumerate( mesh.GetNodesId() ):
+  x, y, z = mesh.GetNodeXYZ( id )
+  if 0 < min( x, y, z ) and max( x, y, z ) < 100:
+    mesh.MoveNode( id, x + ( i % 3 - 1 ), y + ( i % 5 - 2 ), z + ( i % 7 - 3 ))
+
+pattern = smesh.GetPattern()
+assert pattern.LoadFromFile("""!!! Nb of points:
+15
+      0        0        0   !- 0
+      1        0        0   !- 1
+      0        1        0   !- 2
+      1        1        0   !- 3
+      0        0        1   !- 4
+      1        0        1   !- 5
+      0        1        1   !- 6
+      1        1        1   !- 7
+    0.5        0      0.5   !- 8
+    0.5        0        1   !- 9
+    0.5      0.5      0.5   !- 10
+    0.5      0.5        1   !- 11
+      1        0      0.5   !- 12
+      1      0.5      0.5   !- 13
+      1      0.5        1   !- 14
+  !!! Indices of points of 4 elements:
+  8 12 5 9 10 13 14 11
+  0 8 9 4 2 10 11 6
+  2 10 11 6 3 13 14 7
+  0 1 12 8 2 3 13 10""")
+
+def pointSet( points ):
+  return sorted( ( round( p.x, 6 ), round( p.y, 6 ), round( p.z, 6 )) for p in points )
+
+volumes = mesh.GetElementsByType( SMESH.VOLUME )
+assert len( volumes ) == 6 * 6 * 6
+
+allPoints = pattern.ApplyToHexahedrons( mesh.GetMesh(), volumes, 0, 3 )
+assert pattern.GetErrorCode() == SMESH.SMESH_Pattern.ERR_OK, pattern.GetErrorCode()
+assert len( allPoints ) == 15 * len( volumes )
+
+onePoints = []
+for id in volumes:
+  points = pattern.ApplyToHexahedrons( mesh.GetMesh(), [ id ], 0, 3 )
+  assert len( points ) == 15, id
+  onePoints.extend( points )
+
+assert pointSet( allPoints ) == pointSet( onePoints )
+
+# each hexahedron is split into 4 ones
+assert pattern.ApplyToHexahedrons( mesh.GetMesh(), volumes, 0, 3 )
+assert pattern.MakeMesh( mesh.GetMesh(), True, True )
+assert mesh.NbVolumes() == 4 * len( volumes )
@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+
+# Check that Prism_3D sweeping between non-straight vertical EDGEs gives same nodes
+# whether BRepMesh or flat arrays (SMESH_FLAT_DELAUNAY environment variable) are
+# used for Delaunay triangulation of the bottom and top FACEs
+
+import os, math
+
+import salome
+salome.salome_init()
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+# a square swept along a quarter of a circle, so that vertical EDGEs are arcs
+size   = 10.
+radius = 20.
+Face_1 = geompy.MakeFaceHW( size, size, 1 )
+Arc_1  = geompy.MakeArc( geompy.MakeVertex( 0, 0, 0 ),
+                         geompy.MakeVertex( radius * ( 1 - math.cos( math.pi/4 )), 0,
+                                            radius * math.sin( math.pi/4 )),
+                         geompy.MakeVertex( radius, 0, radius ))
+Pipe_1 = geompy.MakePipe( Face_1, Arc_1 )
+
+def computePrism( name ):
+  mesh = smesh.Mesh( Pipe_1, name )
+  mesh.Segment().NumberOfSegments( 8 )
+  mesh.Quadrangle()
+  mesh.Prism()
+  assert mesh.Compute(), name
+  return mesh
+
+os.environ.pop( "SMESH_FLAT_DELAUNAY", None )
+meshBRep = computePrism( "BRepMesh Delaunay" )
+
+os.environ[ "SMESH_FLAT_DELAUNAY" ] = "1"
+try:
+  meshFlat = computePrism( "flat Delaunay" )
+finally:
+  del os.environ[ "SMESH_FLAT_DELAUNAY" ]
+
+assert meshBRep.NbVolumes() == 8 * 8 * 8
+assert meshFlat.NbVolumes() == meshBRep.NbVolumes()
+assert meshFlat.NbNodes()   == meshBRep.NbNodes()
+
+tol = 1e-6 * size
+for id in meshBRep.GetNodesId():
+  xyz1 = meshBRep.GetNodeXYZ( id )
+  xyz2 = meshFlat.GetNodeXYZ( id )
+  assert max( abs( c1 - c2 ) for c1, c2 in zip( xyz1, xyz2 )) < tol, ( id, xyz1, xyz2 )
+
+volume = geompy.BasicProperties( Pipe_1 )[2]
+assert abs( meshFlat.GetVolume() - volume ) < 1e-2 * volume
@@ -0,0 +1,43 @@
+#!/usr/bin/env python
+
+# Check that conversion to quadratic is reproducible: conversion of two
+# equal meshes gives medium nodes with equal IDs and coordinates
+
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+geompy.addToStudy( Box_1, 'Box_1' )
+
+def makeQuadraticMesh( name ):
+  mesh = smesh.Mesh( Box_1, name )
+  mesh.Segment().NumberOfSegments( 6 )
+  mesh.Quadrangle()
+  mesh.Hexahedron()
+  assert mesh.Compute()
+  nbLinearNodes = mesh.NbNodes()
+  mesh.ConvertToQuadratic( theForce3d=False )
+  assert mesh.NbHexasOfOrder( SMESH.ORDER_QUADRATIC ) == 6**3
+  assert mesh.NbNodes() > nbLinearNodes
+  return mesh
+
+mesh1 = makeQuadraticMesh( "quadratic 1" )
+mesh2 = makeQuadraticMesh( "quadratic 2" )
+
+assert mesh1.NbNodes() == mesh2.NbNodes()
+assert mesh1.GetNodesId() == mesh2.GetNodesId()
+for n in mesh1.GetNodesId():
+  xyz1 = mesh1.GetNodeXYZ( n )
+  xyz2 = mesh2.GetNodeXYZ( n )
+  assert max( abs( xyz1[i] - xyz2[i] ) for i in range( 3 )) < 1e-12, ( n, xyz1, xyz2 )
+
+assert mesh1.GetElementsId() == mesh2.GetElementsId()
+for e in mesh1.GetElementsId():
+  assert mesh1.GetElemNodes( e ) == mesh2.GetElemNodes( e ), e
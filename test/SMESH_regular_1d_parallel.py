@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+
+# Check that Regular_1D gives the same segments when node parameters of all edges
+# are computed in parallel at once (Compute() of the whole mesh) and when they are
+# computed edge by edge (Compute() of each edge)
+
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+Box_1      = geompy.MakeBoxDXDYDZ( 200, 200, 200 )
+Cylinder_1 = geompy.MakeCylinderRH( 70, 300 )
+Partition_1 = geompy.MakePartition([ Box_1, Cylinder_1 ], [], [], [], geompy.ShapeType["SOLID"], 0, [], 0)
+geompy.addToStudy( Partition_1, 'Partition_1' )
+
+edges = geompy.SubShapeAllSortedCentres( Partition_1, geompy.ShapeType["EDGE"] )
+assert len( edges ) > 10
+
+def makeMesh( name ):
+  mesh = smesh.Mesh( Partition_1, name )
+  mesh.Segment().NumberOfSegments( 7, 3 ) # scale distribution
+  mesh.Segment( edges[0] ).Arithmetic1D( 5, 20 )
+  mesh.Segment( edges[1] ).GeometricProgression( 3, 1.2 )
+  mesh.Segment( edges[2] ).LocalLength( 11 )
+  mesh.Segment( edges[3] ).Deflection1D( 0.5 )
+  mesh.Segment( edges[4] ).NumberOfSegments( 9, [ 0, 1, 0.5, 3, 1, 1 ]) # table distribution
+  return mesh
+
+# all edges at once; parameters of edges are prepared in parallel
+mesh1 = makeMesh( "at once" )
+assert mesh1.Compute( Partition_1 )
+
+# edge by edge; parameters of each edge are computed sequentially
+mesh2 = makeMesh( "edge by edge" )
+for edge in edges:
+  assert mesh2.Compute( edge )
+
+assert mesh1.NbNodes() == mesh2.NbNodes(), ( mesh1.NbNodes(), mesh2.NbNodes() )
+assert mesh1.NbEdges() == mesh2.NbEdges(), ( mesh1.NbEdges(), mesh2.NbEdges() )
+
+for i, edge in enumerate( edges ):
+  nodes1 = mesh1.GetSubMeshNodesId( edge, False )
+  nodes2 = mesh2.GetSubMeshNodesId( edge, False )
+  assert len( nodes1 ) == len( nodes2 ), ( i, len( nodes1 ), len( nodes2 ))
+  # nodes on an edge are created in the order of parameters by both ways
+  for n1, n2 in zip( sorted( nodes1 ), sorted( nodes2 )):
+    xyz1 = mesh1.GetNodeXYZ( n1 )
+    xyz2 = mesh2.GetNodeXYZ( n2 )
+    for j in range( 3 ):
+      assert abs( xyz1[j] - xyz2[j] ) < 1e-9, ( i, n1, n2, xyz1, xyz2 )
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+
+# Check that the skin of a whole 3D mesh, where facets shared by volumes are
+# found in bulk, is same as the skin of all volumes given one by one
+
+import salome
+salome.salome_init()
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+Box_1 = geompy.MakeBoxDXDYDZ( 100, 100, 100 )
+
+def makeMesh( name ):
+  mesh = smesh.Mesh( Box_1, name )
+  mesh.Segment().NumberOfSegments( 4 )
+  mesh.Quadrangle()
+  mesh.Hexahedron()
+  assert mesh.Compute()
+  return mesh
+
+def elemKeys( mesh, elemType ):
+  """ Return sorted list of sets of rounded coordinates of element nodes """
+  keys = []
+  for e in mesh.GetElementsByType( elemType ):
+    key = [ tuple( round( c, 6 ) for c in mesh.GetNodeXYZ( n )) for n in mesh.GetElemNodes( e )]
+    keys.append( tuple( sorted( key )))
+  keys.sort()
+  return keys
+
+def checkSkin( mesh, nbFaces ):
+  volumes = mesh.GetElementsByType( SMESH.VOLUME )
+  for dim, elemType in [( SMESH.BND_2DFROM3D, SMESH.FACE ),
+                        ( SMESH.BND_1DFROM3D, SMESH.EDGE )]:
+    # whole mesh
+    bulk,_ = mesh.MakeBoundaryMesh( mesh, dim, "", mesh.GetName() + "_bulk", False, True )
+    # each volume
+    byVol,_ = mesh.MakeBoundaryMesh( volumes, dim, "", mesh.GetName() + "_byVol", False, True )
+    bulkKeys, byVolKeys = elemKeys( bulk, elemType ), elemKeys( byVol, elemType )
+    assert bulkKeys == byVolKeys, ( mesh.GetName(), dim, len( bulkKeys ), len( byVolKeys ))
+    if elemType == SMESH.FACE:
+      assert len( bulkKeys ) == nbFaces, ( mesh.GetName(), len( bulkKeys ), nbFaces )
+      skinKeys = bulkKeys
+
+  # Make2DMeshFrom3D() on a mesh without faces
+  skin = smesh.CopyMesh( mesh, mesh.GetName() + "_skin" )
+  skin.RemoveElements( skin.GetElementsByType( SMESH.FACE ))
+  skin.RemoveElements( skin.GetElementsByType( SMESH.EDGE ))
+  assert skin.Make2DMeshFrom3D()
+  assert elemKeys( skin, SMESH.FACE ) == skinKeys, mesh.GetName()
+
+  # faces must not be re-created
+  assert skin.Make2DMeshFrom3D()
+  assert skin.NbFaces() == nbFaces, ( mesh.GetName(), skin.NbFaces() )
+
+def makeMixed( mesh ):
+  """ Split some hexahedra into prisms and some into tetrahedra """
+  volumes = mesh.GetElementsByType( SMESH.VOLUME )
+  mesh.SplitHexahedraIntoPrisms( volumes[ 32: ], ( 0, 0, 100 ), ( 0, 0, 1 ),
+                                 smesh.Hex_2Prisms, allDomains=True )
+  mesh.SplitVolumesIntoTetra( volumes[ :16 ], smesh.Hex_5Tet )
+  assert mesh.NbHexas() > 0 and mesh.NbPrisms() > 0 and mesh.NbTetras() > 0
+  return mesh
+
+# linear mixed mesh; faces of hexahedra are split by neighbor tetrahedra,
+# hence some internal facets are free
+mixed = makeMixed( makeMesh( "mixed" ))
+byVol,_ = mixed.MakeBoundaryMesh( mixed.GetElementsByType( SMESH.VOLUME ), SMESH.BND_2DFROM3D,
+                                  "", "mixed_nbFaces", False, True )
+nbMixedFaces = byVol.NbFaces()
+assert nbMixedFaces > 6 * 16
+checkSkin( mixed, nbMixedFaces )
+
+# quadratic mixed mesh
+quadratic = makeMixed( makeMesh( "quadratic" ))
+quadratic.ConvertToQuadratic( theForce3d=True )
+assert quadratic.NbVolumesOfOrder( SMESH.ORDER_QUADRATIC ) == quadratic.NbVolumes()
+checkSkin( quadratic, nbMixedFaces )
+
+# bi-quadratic hexahedra
+biquad = makeMesh( "biquadratic" )
+biquad.ConvertToQuadratic( theForce3d=True, theToBiQuad=True )
+assert biquad.NbTriQuadraticHexas() == 64
+checkSkin( biquad, 6 * 16 )
@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+
+# Check order of nodes created by translation of a whole mesh:
+# copies of nodes follow IDs of source nodes, free nodes included,
+# copies of elements follow IDs of source elements
+
+import salome
+salome.salome_init()
+
+import SMESH
+from salome.smesh import smeshBuilder
+smesh = smeshBuilder.New()
+
+mesh = smesh.Mesh()
+for x, y in [ (0,0), (1,0), (0,1), (1,1), (5,5), (2,1) ]:
+  mesh.AddNode( x, y, 0 )
+# element nodes are not in the order of IDs; node 5 is free
+mesh.AddFace([ 6, 4, 2 ])
+mesh.AddFace([ 1, 2, 3 ])
+mesh.AddFace([ 3, 2, 4 ])
+
+nbNodes = mesh.NbNodes()
+nbFaces = mesh.NbFaces()
+vector  = [ 10, 20, 30 ]
+
+def checkCopy( tgtMesh, nodeShift, elemShift ):
+  for nID in range( 1, nbNodes + 1 ):
+    srcXYZ = mesh.GetNodeXYZ( nID )
+    tgtXYZ = tgtMesh.GetNodeXYZ( nID + nodeShift )
+    for i in range( 3 ):
+      assert abs( tgtXYZ[i] - srcXYZ[i] - vector[i] ) < 1e-12, ( nID, srcXYZ, tgtXYZ )
+  for eID in range( 1, nbFaces + 1 ):
+    srcNodes = mesh.GetElemNodes( eID )
+    tgtNodes = tgtMesh.GetElemNodes( eID + elemShift )
+    assert tgtNodes == [ n + nodeShift for n in srcNodes ], ( eID, srcNodes, tgtNodes )
+
+# copy to a new mesh
+newMesh = mesh.TranslateObjectMakeMesh( mesh, vector, False, "translated" )
+assert newMesh.NbNodes() == nbNodes
+assert newMesh.NbFaces() == nbFaces
+checkCopy( newMesh, 0, 0 )
+
+# copy within the mesh
+mesh.TranslateObject( mesh, vector, Copy=True )
+assert mesh.NbNodes() == 2 * nbNodes
+assert mesh.NbFaces() == 2 * nbFaces
+checkCopy( mesh, nbNodes, nbFaces )
+
+# copy a small and a large part of a bigger mesh; nodes of a small part are
+# mapped via a hash table, those of a large part, via a vector indexed by ID
+grid = smesh.Mesh()
+n = 20
+for j in range( n + 1 ):
+  for i in range( n + 1 ):
+    grid.AddNode( i, j, 0 )
+for j in range( n ):
+  for i in range( n ):
+    n1 = 1 + i + ( n + 1 ) * j
+    grid.AddFace([ n1, n1 + 1, n1 + n + 2, n1 + n + 1 ])
+
+for faces in [ [ 3, 4, 2 * n + 7 ], list( range( 1, n * n // 2 )) ]:
+  nbNodes0 = grid.NbNodes()
+  nbFaces0 = grid.NbFaces()
+  srcNodes = sorted( set( sum([ grid.GetElemNodes( f ) for f in faces ], [] )))
+  grid.Translate( faces, vector, Copy=True )
+  assert grid.NbNodes() == nbNodes0 + len( srcNodes )
+  assert grid.NbFaces() == nbFaces0 + len( faces )
+  for i, f in enumerate( faces ):
+    tgtNodes = grid.GetElemNodes( nbFaces0 + 1 + i )
+    for srcNode, tgtNode in zip( grid.GetElemNodes( f ), tgtNodes ):
+      srcXYZ = grid.GetNodeXYZ( srcNode )
+      tgtXYZ = grid.GetNodeXYZ( tgtNode )
+      for k in range( 3 ):
+        assert abs( tgtXYZ[k] - srcXYZ[k] - vector[k] ) < 1e-12, ( f, srcXYZ, tgtXYZ )
@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+
+# Check octree coarsening of Body Fitting: merged cells reduce the number of volumes,
+# the mesh volume is kept, and the mesh stays conformal (the skin is the same)
+
+import salome
+salome.salome_init()
+import GEOM
+from salome.geom import geomBuilder
+geompy = geomBuilder.New()
+
+import SMESH, SALOMEDS
+from salome.smesh import smeshBuilder
+smesh =  smeshBuilder.New()
+
+Sphere_1 = geompy.MakeSphereR(100)
+geompy.addToStudy( Sphere_1, 'Sphere_1' )
+
+def computeMesh( nbLevels ):
+  mesh = smesh.Mesh( Sphere_1, 'Octree_%s' % nbLevels )
+  Cartesian_3D = mesh.BodyFitted()
+  params = Cartesian_3D.SetGrid([ '5' ],[ '5' ],[ '5' ], 4, 0 )
+  params.SetOctreeLevels( nbLevels )
+  assert params.GetOctreeLevels() == nbLevels
+  isDone = mesh.Compute()
+  assert isDone, "Compute failed with %s octree levels" % nbLevels
+  nbVolumes = mesh.NbVolumes()
+  volume    = smesh.GetVolume( mesh )
+  # faces between cells of different size would be free, i.e. add to the skin
+  mesh.Make2DMeshFrom3D()
+  area      = smesh.GetArea( mesh )
+  return mesh, nbVolumes, volume, area
+
+mesh0, nbVolumes0, volume0, area0 = computeMesh( 0 )
+mesh2, nbVolumes2, volume2, area2 = computeMesh( 3 )
+
+print("nb volumes:", nbVolumes0, nbVolumes2)
+print("volume:", volume0, volume2)
+print("skin area:", area0, area2)
+
+assert nbVolumes2 < 0.8 * nbVolumes0
+assert mesh2.NbPolyhedrons() > mesh0.NbPolyhedrons() # transition cells
+assert abs( volume2 - volume0 ) < 1e-6 * volume0
+assert abs( area2   - area0   ) < 1e-6 * area0
+
+if salome.sg.hasDesktop():
+  salome.sg.updateObjBrowser()